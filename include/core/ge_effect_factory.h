@@ -34,12 +34,25 @@ class GEShaderFilter;
 
 namespace GraphicsEffectEngine {
 
+// Base class of the objects a creator returns, UNKNOWN for effects implemented by external libraries
+enum class GEEffectCategory : uint8_t {
+    UNKNOWN,
+    FILTER, // Rosen::GEShaderFilter
+    SHADER, // Rosen::GEShader
+    MASK,   // Rosen::Drawing::GEShaderMask
+    SHAPE,  // Rosen::Drawing::GEShaderShape
+};
+
 class GEEffectFactory {
 public:
     using VisualEffectImplPtr = std::shared_ptr<Rosen::Drawing::GEVisualEffectImpl>;
     using EffectCreator = std::function<std::shared_ptr<Rosen::Drawing::IGEFilterType>(VisualEffectImplPtr)>;
 
-    static void Register(Rosen::Drawing::GEFilterType type, EffectCreator&& creator);
+    static void Register(Rosen::Drawing::GEFilterType type, EffectCreator&& creator,
+        GEEffectCategory category = GEEffectCategory::UNKNOWN);
+
+    static bool IsRegistered(Rosen::Drawing::GEFilterType type);
+    static GEEffectCategory GetCategory(Rosen::Drawing::GEFilterType type);
 
     static std::shared_ptr<Rosen::Drawing::IGEFilterType> Create(VisualEffectImplPtr impl);
     static std::shared_ptr<Rosen::GEShader> CreateShader(VisualEffectImplPtr impl);
@@ -50,6 +63,7 @@ public:
 private:
     static constexpr size_t MAX_EFFECTS = static_cast<size_t>(Rosen::Drawing::GEFilterType::MAX);
     static std::array<std::optional<EffectCreator>, MAX_EFFECTS> creators_;
+    static std::array<GEEffectCategory, MAX_EFFECTS> categories_;
 
     GEEffectFactory() = delete;
     ~GEEffectFactory() = delete;
@@ -77,6 +91,22 @@ namespace OHOS {
 namespace GraphicsEffectEngine {
 namespace Internal {  // Internal implementation namespace, not exposed externally
 
+template<typename EffectClass>
+constexpr GEEffectCategory GetEffectCategory()
+{
+    if constexpr (std::is_base_of_v<::OHOS::Rosen::GEShaderFilter, EffectClass>) {
+        return GEEffectCategory::FILTER;
+    } else if constexpr (std::is_base_of_v<::OHOS::Rosen::GEShader, EffectClass>) {
+        return GEEffectCategory::SHADER;
+    } else if constexpr (std::is_base_of_v<::OHOS::Rosen::Drawing::GEShaderMask, EffectClass>) {
+        return GEEffectCategory::MASK;
+    } else if constexpr (std::is_base_of_v<::OHOS::Rosen::Drawing::GEShaderShape, EffectClass>) {
+        return GEEffectCategory::SHAPE;
+    } else {
+        return GEEffectCategory::UNKNOWN;
+    }
+}
+
 template<typename FullClassName>
 void RegisterEffect(const char* logTag)
 {
@@ -92,7 +122,7 @@ void RegisterEffect(const char* logTag)
             if (FactoryCheckNullptr(params.get(), tagGetParams.c_str(),
                 static_cast<int32_t>(ve->GetFilterType()))) return nullptr;
             return std::make_shared<FullClassName>(*params);
-        });
+        }, GetEffectCategory<FullClassName>());
 }
 
 template<typename ParamType, ::OHOS::Rosen::Drawing::GEFilterType EffectType>
@@ -140,7 +170,7 @@ void RegisterExternalFallbackEffect(const char* logTag)
             }
             GE_LOGW("[GEEffectFactory] %{public}s: External failed, using fallback", logTag);
             return std::make_shared<FallbackClass>(*params);
-        });
+        }, GetEffectCategory<FallbackClass>());
 }
 
 } // namespace Internal
@@ -178,12 +208,14 @@ void RegisterExternalFallbackEffect(const char* logTag)
         static GEEffectRegistrar_##EffectType g_effectRegistrar_##EffectType; \
     }
 
-#define GE_FACTORY_REGISTER_CUSTOM(EffectType, Lambda) \
+// Category is one of FILTER, SHADER, MASK or SHAPE, the base class of the objects Lambda returns
+#define GE_FACTORY_REGISTER_CUSTOM(EffectType, Category, Lambda) \
     namespace { \
         struct GEEffectRegistrar_##EffectType { \
             GEEffectRegistrar_##EffectType() \
             { ::OHOS::GraphicsEffectEngine::GEEffectFactory::Register( \
-                ::OHOS::Rosen::Drawing::GEFilterType::EffectType, (Lambda)); } \
+                ::OHOS::Rosen::Drawing::GEFilterType::EffectType, (Lambda), \
+                ::OHOS::GraphicsEffectEngine::GEEffectCategory::Category); } \
         }; \
         static GEEffectRegistrar_##EffectType g_effectRegistrar_##EffectType; \
     }
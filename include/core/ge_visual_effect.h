@@ -16,6 +16,7 @@
 #define GRAPHICS_EFFECT_GE_VISUAL_EFFECT_H
 
 #include <memory>
+#include <string_view>
 #include <vector>
 
 #include "common/rs_vector2.h"
@@ -41,6 +42,28 @@ enum class DrawingPaintType { NONE, BRUSH, PEN, PAINT, BRUSH_PEN };
 
 class GEVisualEffectImpl;
 
+// Params tag resolved by GEVisualEffect::ResolveParamTag, wraps a GEParamsMemberTag value
+class GEParamTagHandle {
+public:
+    GEParamTagHandle() = default;
+
+    bool IsValid() const
+    {
+        return value_ != 0;
+    }
+
+    uint32_t GetValue() const
+    {
+        return value_;
+    }
+
+private:
+    friend class GEVisualEffect;
+    explicit GEParamTagHandle(uint32_t value) : value_(value) {}
+
+    uint32_t value_ = 0; // 0: GEParamsMemberTag::INVALID
+};
+
 class GE_EXPORT GEVisualEffect {
 public:
     GEVisualEffect(const std::string& name, DrawingPaintType type = DrawingPaintType::BRUSH,
@@ -77,6 +100,38 @@ public:
     void SetParam(const std::string& tag, const GESDFBorderParams& param);
     void SetParam(const std::string& tag, const GESDFShadowParams& param);
 
+    /**
+     * @brief Resolve a params tag name once, e.g. when an animation is set up.
+     * The handle does not depend on the effect, it can be reused with SetParam on any GEVisualEffect to skip the
+     * name lookup of the string overloads. Unknown names give an invalid handle, which SetParam ignores.
+     */
+    static GEParamTagHandle ResolveParamTag(std::string_view tag);
+
+    void SetParam(GEParamTagHandle tag, int32_t param);
+    void SetParam(GEParamTagHandle tag, int64_t param);
+    void SetParam(GEParamTagHandle tag, float param);
+    void SetParam(GEParamTagHandle tag, double param);
+    void SetParam(GEParamTagHandle tag, const std::shared_ptr<Drawing::Image> param);
+    void SetParam(GEParamTagHandle tag, const Drawing::Matrix param);
+    void SetParam(GEParamTagHandle tag, const std::pair<float, float>& param);
+    void SetParam(GEParamTagHandle tag, const std::vector<std::pair<float, float>>& param);
+    void SetParam(GEParamTagHandle tag, const std::vector<Vector2f>& param);
+    void SetParam(GEParamTagHandle tag, const std::vector<Vector4f>& param);
+    void SetParam(GEParamTagHandle tag, const Drawing::Path& param);
+    void SetParam(GEParamTagHandle tag, const std::array<Drawing::Point, POINT_NUM>& param);
+    void SetParam(GEParamTagHandle tag, bool param);
+    void SetParam(GEParamTagHandle tag, uint32_t param);
+    void SetParam(GEParamTagHandle tag, const std::vector<float>& param);
+    void SetParam(GEParamTagHandle tag, const std::shared_ptr<Drawing::GEShaderMask> param);
+    void SetParam(GEParamTagHandle tag, const std::shared_ptr<Drawing::GEShaderShape> param);
+    void SetParam(GEParamTagHandle tag, const Drawing::Color4f& param);
+    void SetParam(GEParamTagHandle tag, const Vector3f& param);
+    void SetParam(GEParamTagHandle tag, const Vector4f& param);
+    void SetParam(GEParamTagHandle tag, const GERRect& param);
+    void SetParam(GEParamTagHandle tag, const RectF& param);
+    void SetParam(GEParamTagHandle tag, const GESDFBorderParams& param);
+    void SetParam(GEParamTagHandle tag, const GESDFShadowParams& param);
+
     const std::shared_ptr<Drawing::GEShaderShape> GetGEShaderShape(const std::string& tag) const;
 
     const std::string& GetName() const
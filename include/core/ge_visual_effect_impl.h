@@ -32,6 +32,8 @@
 #include "ge_filter_params.h"
 #include "ge_filter_type.h"
 #include "ge_log.h"
+#include "ge_params_dirty_bits.h"
+#include "ge_params_hasher.h"
 #include "ge_params_reflection.h"
 #include "ge_shader.h"
 #include "ge_shader_filter.h"
@@ -58,6 +60,9 @@ public:
     using FilterType = GEFilterType;
 
     GEVisualEffectImpl(const std::string& name, const std::optional<Drawing::CanvasInfo>& canvasInfo = std::nullopt);
+    // Default params of filterType, for callers walking effect types rather than names (e.g. GEShaderPrewarm)
+    explicit GEVisualEffectImpl(
+        FilterType filterType, const std::optional<Drawing::CanvasInfo>& canvasInfo = std::nullopt);
     ~GEVisualEffectImpl();
 
     // ========================================================================
@@ -80,8 +85,10 @@ public:
             return;
         }
 
-        // Use generated helper to set parameter by tag
-        SetParamInternal(*params_, tag, value);
+        // Use generated helper to set parameter by tag, writes of the current value are not recorded
+        if (SetParamInternal(*params_, tag, value)) {
+            MarkParamChanged(tag);
+        }
     }
 
     /// Set parameter by string tag (runtime lookup to enum, then dispatch)
@@ -98,6 +105,55 @@ public:
         }
     }
 
+    // ========================================================================
+    // Batched updates
+    // ========================================================================
+
+    /**
+     * @brief Start a batch of SetParam calls. Until the matching Commit(), changes are only recorded in the pending
+     * dirty bits: the params generation, the params hash and GetDirtyBitsSince() are not updated.
+     * Batches may nest, only the outermost Commit() publishes the changes.
+     */
+    void BeginUpdate()
+    {
+        if (updateDepth_++ == 0) {
+            pendingDirtyBits_.Reset();
+        }
+    }
+
+    /**
+     * @brief End a batch started by BeginUpdate(). The changes of the whole batch bump the params generation once.
+     * @return True when the outermost batch changed any param.
+     */
+    bool Commit();
+
+    /**
+     * @brief Apply several tag/value pairs as one batch.
+     * e.g. SetParams(std::pair { tagA, 1.0f }, std::pair { tagB, 2 })
+     * @return True when any param changed.
+     */
+    template<typename... Values>
+    bool SetParams(const std::pair<GEParamsMemberTag, Values>&... tagValues)
+    {
+        BeginUpdate();
+        (SetParam(tagValues.first, tagValues.second), ...);
+        return Commit();
+    }
+
+    /**
+     * @brief Params members changed after generation was observed through GetParamsGeneration().
+     * Only the last change (a single SetParam or a committed batch) is recorded: when generation is older than that,
+     * every member is reported dirty. Consumers can skip re-uploading uniforms or rebuilding images derived from
+     * members that are not dirty.
+     */
+    GEParamsDirtyBits GetDirtyBitsSince(uint64_t generation) const
+    {
+        if (generation == paramsGeneration_) {
+            return {};
+        }
+        return generation + 1 == paramsGeneration_ ? lastDirtyBits_ : GEParamsDirtyBits::All();
+    }
+
     // ========================================================================
     // Filter type management
     // ========================================================================
@@ -121,6 +177,7 @@ public:
     void MakeParams()
     {
         params_ = GEFilterParams::Box(std::make_shared<ParamsType>());
+        MarkParamsChanged();
     }
 
     template<typename ParamsType>
@@ -132,6 +189,28 @@ public:
         return GEFilterParams::Unbox<ParamsType>(*params_);
     }
 
+    /**
+     * @brief Monotonic counter bumped whenever params_ is replaced or SetParam writes a new value, once per batch.
+     * Consumers holding objects built from the params (e.g. GECompiledEffectChain) compare it to detect changes.
+     * @note Writes through the pointer returned by GetParams() are not tracked, call MarkParamsChanged() after them.
+     */
+    uint64_t GetParamsGeneration() const
+    {
+        return paramsGeneration_;
+    }
+
+    // Every member is reported dirty, deferred to Commit() inside a batch
+    void MarkParamsChanged()
+    {
+        MarkDirty(GEParamsDirtyBits::All());
+    }
+
+    /**
+     * @brief Content hash of the params, recomputed only when the params generation changes.
+     * @return nullptr when there are no params or they hold a member without a stable hash (e.g. Drawing::Path).
+     */
+    const GEParamsHash* GetParamsHash() const;
+
     // ========================================================================
     // CanvasInfo management - Screen canvas geometry info
     // ========================================================================
@@ -282,26 +361,44 @@ private:
         return tagType == params.GetType();
     }
 
+    void MarkParamChanged(GEParamsMemberTag tag)
+    {
+        GEParamsDirtyBits dirty;
+        dirty.Set(tag);
+        MarkDirty(dirty);
+    }
+
+    void MarkDirty(const GEParamsDirtyBits& dirty);
+
     /// Internal set param implementation - uses reflection metadata to set field value
     /// Non-template overloads for each type, generated from FOR_EACH_PARAM_TYPE
     /// Implementations in ge_visual_effect_impl.cpp
 #define DECLARE_SET_PARAM_INTERNAL(Type) \
-    void SetParamInternal(GEFilterParams& params, GEParamsMemberTag tag, const Type& value);
+    bool SetParamInternal(GEFilterParams& params, GEParamsMemberTag tag, const Type& value);
 
     FOR_EACH_PARAM_TYPE(DECLARE_SET_PARAM_INTERNAL)
 #undef DECLARE_SET_PARAM_INTERNAL
 
     // Compatibility placeholders, remove these placeholders if future effects use them
-    void SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long&);
-    void SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long long&);
-    void SetParamInternal(GEFilterParams&, GEParamsMemberTag, const double&);
-    void SetParamInternal(GEFilterParams&, GEParamsMemberTag, const std::shared_ptr<Drawing::ColorFilter>);
+    bool SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long&);
+    bool SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long long&);
+    bool SetParamInternal(GEFilterParams&, GEParamsMemberTag, const double&);
+    bool SetParamInternal(GEFilterParams&, GEParamsMemberTag, const std::shared_ptr<Drawing::ColorFilter>);
 
 private:
     FilterType filterType_ = FilterType::NONE;
     Drawing::CanvasInfo canvasInfo_;
     std::shared_ptr<std::any> cacheAnyPtr_ = nullptr;
     std::unique_ptr<GEFilterParams> params_ = nullptr;
+    uint64_t paramsGeneration_ = 0;
+    // Members changed by the change that produced paramsGeneration_
+    GEParamsDirtyBits lastDirtyBits_;
+    // Members changed by the open batch, published by the outermost Commit()
+    GEParamsDirtyBits pendingDirtyBits_;
+    uint32_t updateDepth_ = 0;
+    // Lazily computed by GetParamsHash, valid while paramsHashGeneration_ matches paramsGeneration_
+    mutable std::optional<uint64_t> paramsHashGeneration_;
+    mutable std::optional<GEParamsHash> paramsHash_;
 };
 
 } // namespace Drawing
@@ -36,6 +36,14 @@ public:
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
 
+    bool SupportsShaderChaining() const override
+    {
+        return true;
+    }
+
+    std::shared_ptr<Drawing::ShaderEffect> OnMakeChainedShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
     const GE_EXPORT std::string GetDescription() const;
 
 private:
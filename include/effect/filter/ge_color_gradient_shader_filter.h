@@ -38,6 +38,14 @@ public:
     std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst) override;
 
+    bool SupportsShaderChaining() const override
+    {
+        return true;
+    }
+
+    std::shared_ptr<Drawing::ShaderEffect> OnMakeChainedShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
     void Preprocess(Drawing::Canvas& canvas, const Drawing::Rect& src, const Drawing::Rect& dst) override;
 
     bool CheckInParams(float* color, float* position, float* strength, int tupleSize);
@@ -47,6 +55,11 @@ public:
 
 private:
     std::shared_ptr<Drawing::RuntimeShaderBuilder> PreProcessColorGradientBuilder(float geoWidth, float geoHeight);
+    // Matrix mapping geometry space to image pixels, false when it cannot be inverted
+    bool GetGeometryMatrix(Drawing::Matrix& matrix, Drawing::Matrix& invertMatrix) const;
+    // Builder blending the gradient over srcImageShader, both evaluated in geometry space
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeBlendBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& srcImageShader);
 
     std::vector<float> colors_;
     std::vector<float> positions_;
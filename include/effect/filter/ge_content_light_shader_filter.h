@@ -41,7 +41,6 @@ public:
 
 private:
     void GenerateContentLightEffect();
-    static std::shared_ptr<Drawing::RuntimeEffect> contentLightShaderEffect_;
     float ClampValue(float x, float minValue, float maxValue);
     void ClampLightValue();
 
@@ -49,6 +48,9 @@ private:
     Vector4f lightColor_;
     float lightIntensity_ = 0.0f;
     Vector3f rotationAngle_;
+
+    // Looked up in GERuntimeEffectRegistry on first use, which compiles it once for all instances
+    std::shared_ptr<Drawing::RuntimeEffect> contentLightShaderEffect_;
 };
 
 } // namespace Rosen
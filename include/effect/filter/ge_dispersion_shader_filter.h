@@ -35,8 +35,19 @@ public:
     std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
 
+    bool SupportsShaderChaining() const override
+    {
+        return true;
+    }
+
+    std::shared_ptr<Drawing::ShaderEffect> OnMakeChainedShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
 protected:
     virtual std::shared_ptr<Drawing::RuntimeEffect> GetDispersionEffect();
+    // Null when the effect or the mask shader cannot be made
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeDispersionBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& imageShader);
     Drawing::GEDispersionShaderFilterParams params_;
 
 private:
@@ -33,6 +33,17 @@ public:
 
     void SetCacheProvider(IGECacheProvider* cacheProvider) override;
 
+    /**
+     * @brief Key of the downsampled edge image stored in the cache provider.
+     * Depends on the panel only, not on the background it blurs, so each frame a panel overwrites its own entry
+     * while panels at other places or of other styles keep theirs.
+     */
+    static uint64_t GetEdgeCacheKey(float radius, float radiusScale, const Drawing::Rect& src,
+        const Drawing::Rect& dst);
+
+    // Edge image stored under key, nullptr when provider holds none
+    static std::shared_ptr<Drawing::Image> GetEdgeImage(const IGECacheProvider& provider, uint64_t key);
+
 private:
     Drawing::GEFrostedGlassBlurShaderFilterParams blurParams_;
     IGECacheProvider* cacheProvider_ = nullptr;
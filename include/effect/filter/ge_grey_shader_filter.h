@@ -19,6 +19,8 @@
 #include "ge_shader_filter.h"
 #include "ge_visual_effect.h"
 
+#include "effect/runtime_shader_builder.h"
+
 namespace OHOS {
 namespace Rosen {
 
@@ -31,11 +33,27 @@ public:
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
 
+    bool IsReusableAcrossFrames() const override
+    {
+        return true;
+    }
+
+    bool SupportsShaderChaining() const override
+    {
+        return true;
+    }
+
+    std::shared_ptr<Drawing::ShaderEffect> OnMakeChainedShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info) override;
+
 private:
     bool InitGreyAdjustmentEffect();
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> MakeGreyBuilder(
+        const std::shared_ptr<Drawing::ShaderEffect>& imageShader) const;
 
     float greyCoef1_;
     float greyCoef2_;
+    std::shared_ptr<Drawing::RuntimeEffect> greyAdjustEffect_;
 };
 
 } // namespace Rosen
@@ -48,6 +48,11 @@ public:
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
 
+    bool IsReusableAcrossFrames() const override
+    {
+        return true;
+    }
+
     // noise factor
     void SetFactor(float factor);
 
@@ -77,6 +82,9 @@ private:
         const Drawing::ImageInfo& scaledInfo, const int width, const int height);
     bool IsInputValid(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src,
         const Drawing::Rect& dst);
+    // Native backend of OnProcessImage for canvases without a GPU context, nullptr when it can not run
+    std::shared_ptr<Drawing::Image> ProcessImageOnCpu(const std::shared_ptr<Drawing::Image>& input,
+        const Drawing::Rect& src, const Drawing::Rect& dst, int numberOfPasses, float radiusByPasses);
     const OHOS::Rosen::Drawing::Matrix BuildMatrix(
         const Drawing::Rect &src, const Drawing::ImageInfo &scaledInfo, const std::shared_ptr<Drawing::Image> &input);
 
@@ -86,6 +94,11 @@ private:
     float blurRadius_ = 0.0f;
     float blurScale_ = 0.25f;
     float factor_ = 1.75f; // 1.75 from experience
+    // Shared through GERuntimeEffectRegistry, compiled once per process
+    std::shared_ptr<Drawing::RuntimeEffect> blurEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> mixEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> blurEffectAf_;
+    std::shared_ptr<Drawing::RuntimeEffect> simpleFilter_;
 };
 
 } // namespace Rosen
@@ -15,13 +15,17 @@
 #ifndef GRAPHICS_EFFECT_GE_MESA_BLUR_SHADER_FILTER_H
 #define GRAPHICS_EFFECT_GE_MESA_BLUR_SHADER_FILTER_H
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 
+#include "ge_cache_provider.h"
 #include "ge_filter_type_info.h"
 #include "ge_shader_filter.h"
 #include "ge_visual_effect.h"
 
 #include "draw/canvas.h"
+#include "draw/surface.h"
 #include "effect/color_filter.h"
 #include "effect/runtime_effect.h"
 #include "effect/runtime_shader_builder.h"
@@ -31,6 +35,28 @@
 
 namespace OHOS {
 namespace Rosen {
+// Last outputs of a MESA blur in temporal mode. The next frame draws into backSurface while the caller may still
+// read the snapshot of surface, then the two swap
+struct GEMESABlurTemporalCache : GECache<GEMESABlurTemporalCache> {
+    std::shared_ptr<Drawing::Surface> surface;
+    // Output of the frame before, nullptr until a frame patches surface
+    std::shared_ptr<Drawing::Surface> backSurface;
+    // Where backSurface is older than surface
+    Drawing::RectI stalePatch;
+    const void* context = nullptr;
+    int width = 0;
+    int height = 0;
+    int bytesPerPixel = 0;
+
+    // Both surfaces, also counted before they are made, so a provider over its budget rejects the entry first
+    size_t GetByteSize() const override
+    {
+        constexpr size_t surfaceCount = 2;
+        return surfaceCount * static_cast<size_t>(std::max(width, 0)) * static_cast<size_t>(std::max(height, 0)) *
+            static_cast<size_t>(std::max(bytesPerPixel, 0));
+    }
+};
+
 class GEMESABlurShaderFilter : public GEShaderFilter {
 public:
     GE_EXPORT GEMESABlurShaderFilter(const Drawing::GEMESABlurShaderFilterParams& params);
@@ -41,8 +67,33 @@ public:
 
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst) override;
+
+    bool IsReusableAcrossFrames() const override
+    {
+        return true;
+    }
     static GE_EXPORT void SetMesaModeByCCM(int mode);
 
+    void SetCacheProvider(IGECacheProvider* cacheProvider) override
+    {
+        // Set again by GERender on every run, only another provider may accept what this one rejected
+        if (cacheProvider != cacheProvider_) {
+            isTemporalStoreRejected_ = false;
+        }
+        cacheProvider_ = cacheProvider;
+    }
+
+    void SetDirtyRect(const std::optional<Drawing::Rect>& dirtyRect) override
+    {
+        dirtyRect_ = dirtyRect;
+    }
+
+    // Whether blurs of a whole image given a dirty rect keep their output in the cache provider and re-blur only the
+    // area the next dirty rects reach; set by persist.sys.graphic.effect.mesatemporal, on unless it is 0
+    static GE_EXPORT bool IsTemporalEnabled();
+    // Patches covering more of the image re-blur the whole image
+    static constexpr float TEMPORAL_MAX_AREA_RATIO = 0.25f;
+
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImageWithoutUpSampling(Drawing::Canvas &canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect &src, const Drawing::Rect &dst);
 
@@ -100,9 +151,8 @@ protected:
         const Drawing::SamplingOptions& linear, bool isEasySampling = false) const;
 
     virtual bool SetBlurParams(NewBlurParams& bParam);
+    // Radii below 100 copy a plan generated at build time, larger ones scale one row of offsets
     GE_EXPORT bool SetGeneralBlurParams(NewBlurParams& bParam);
-    GE_EXPORT bool SetBlurParamsHelper(NewBlurParams& bParam,
-        const std::vector<std::vector<float>>& offsetTable, float st, float ed);
 
     virtual Drawing::ImageInfo ComputeImageInfo(const Drawing::ImageInfo& originalInfo, int& width, int& height) const;
     GE_EXPORT Drawing::Matrix BuildStretchMatrix(const Drawing::ImageInfo& scaledInfo,
@@ -143,6 +193,10 @@ private:
     std::shared_ptr<Drawing::Image> OutputImageWithoutBlur(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image>& image,
         const Drawing::Rect& src, const Drawing::Rect& dst) const;
+    // Native backend of OnProcessImage for canvases without a GPU context, nullptr when it can not run. Grey
+    // adjustment, direction blur and pixel stretch before the blur are left to the shaders.
+    std::shared_ptr<Drawing::Image> ProcessImageOnCpu(const std::shared_ptr<Drawing::Image>& image,
+        const Drawing::Rect& src, const Drawing::Rect& dst);
 
     std::shared_ptr<Drawing::ShaderEffect> ApplyFuzedFilter(Drawing::Canvas& canvas,
         Drawing::RuntimeShaderBuilder& blurBuilder, const std::shared_ptr<Drawing::Image>& input,
@@ -153,6 +207,31 @@ private:
     GE_EXPORT std::shared_ptr<Drawing::Image> ScaleAndAddRandomColor(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image>& image, const std::shared_ptr<Drawing::Image>& blurImage,
         const Drawing::Rect& src, const Drawing::Rect& dst, int& width, int& height) const;
+    void SetMixInput(Drawing::RuntimeShaderBuilder& mixBuilder, const std::shared_ptr<Drawing::Image>& blurImage,
+        const Drawing::Rect& dst) const;
+
+    /**
+     * @brief Temporal mode of OnProcessImage, nullptr when it does not apply.
+     * Only used with a dirty rect and a cache provider which accepts the entry, otherwise the pooled passes of
+     * OnProcessImage are cheaper. The output is drawn into a surface of GETransientSurfacePool kept in the cache
+     * provider. The next frame blurs only the area the dirty rect reaches, aligned to the downsampling so it samples
+     * the same texels as a blur of the whole image. It draws it into a second kept surface, brought up to date from
+     * the first, so the previous output the caller still holds is never copied on write. Whole images are blurred
+     * at the aligned size too.
+     */
+    std::shared_ptr<Drawing::Image> ProcessImageTemporally(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src, const Drawing::Rect& dst);
+    bool CanProcessTemporally(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
+        const Drawing::Rect& src, const Drawing::Rect& dst) const;
+    // Reach of an input pixel in the output, in input pixels
+    int GetTemporalSupport(const NewBlurParams& blur) const;
+    static Drawing::RectI OutsetToGrid(const Drawing::RectI& rect, int outset, int grid, int width, int height);
+    uint64_t GetTemporalCacheKey(const Drawing::ImageInfo& info) const;
+    // Blur area of image and draw its part patch into surface
+    bool BlurTemporalArea(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
+        const Drawing::RectI& area, const Drawing::RectI& patch, Drawing::Surface& surface);
+    // Copy the pixels of from inside patch into to
+    static bool CopyTemporalPatch(Drawing::Surface& from, Drawing::Surface& to, const Drawing::RectI& patch);
 
     std::string GetDescription() const;
     bool IsInputValid(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src,
@@ -167,6 +246,18 @@ private:
     Drawing::Matrix BuildStretchMatrixFull(const Drawing::Rect& src,
         const Drawing::Rect& dst, int inputWidth, int inputHeight) const;
     void CalculatePixelStretch(int width, int height);
+
+    IGECacheProvider* cacheProvider_ = nullptr;
+    // The provider refused an entry of the output size, so the temporal mode is off until the provider changes
+    bool isTemporalStoreRejected_ = false;
+    std::optional<Drawing::Rect> dirtyRect_;
+
+    // Shared through GERuntimeEffectRegistry, compiled once per process
+    std::shared_ptr<Drawing::RuntimeEffect> blurEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> directionBlurEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> mixEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> simpleFilter_;
+    std::shared_ptr<Drawing::RuntimeEffect> greyAdjustEffect_;
 };
 
 } // namespace Rosen
@@ -17,6 +17,7 @@
 #define GRAPHICS_EFFECT_GE_SDF_FROM_IMAGE_FILTER_H
 
 #include <memory>
+#include <vector>
 
 #include "draw/canvas.h"
 #include "effect/runtime_effect.h"
@@ -43,18 +44,39 @@ public:
     GE_EXPORT std::shared_ptr<Drawing::Image> OnProcessImage(Drawing::Canvas& canvas,
         std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst) override;
 
+    // Set by persist.sys.graphic.effect.sdftile, on unless it is 0
+    GE_EXPORT static bool IsTilingEnabled();
+
+    // Outputs with a side over MAX_UNTILED_SIZE are generated in tiles of about TILE_SIZE
+    static constexpr int MAX_UNTILED_SIZE = 2048;
+    static constexpr int TILE_SIZE = 1024;
+
 private:
+    struct Tile {
+        // Pixels of the output this tile writes
+        Drawing::RectI core;
+        // Pixels this tile computes, the core grown by the tile margin within the output
+        Drawing::RectI area;
+    };
+
     int spreadFactor_ = 64;
     bool generateDerivs_ = true;
 
+    // Shared through GERuntimeEffectRegistry, compiled once per process
+    std::shared_ptr<Drawing::RuntimeEffect> jfaPrepareEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> jfaIterationEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> jfaProcessResultEffect_;
+    std::shared_ptr<Drawing::RuntimeEffect> sdfFillDerivEffect_;
+
     bool InitJFAPrepareEffect();
     bool InitJfaIterationEffect();
     bool InitJfaProcessResultEffect();
     bool InitFillDerivEffect();
 
+    // Prepare pass over area of the output grid, the image is stretched from src to dst as for the full grid
     std::shared_ptr<Drawing::Image> RunJFAPrepareEffect(Drawing::Canvas& canvas, std::shared_ptr<Drawing::Image> image,
         const Drawing::SamplingOptions& samplingOptions, const Drawing::Rect& src, const Drawing::Rect& dst,
-        const Drawing::ColorType& outputColorType);
+        const Drawing::RectI& area, const Drawing::ColorType& outputColorType);
 
     std::shared_ptr<Drawing::Image> RunJfaIterationsEffect(Drawing::Canvas& canvas,
         std::shared_ptr<Drawing::Image> image, const Drawing::SamplingOptions& samplingOptions,
@@ -71,6 +93,24 @@ private:
         const std::shared_ptr<Drawing::Image> blurredSDFImage, const Drawing::SamplingOptions& samplingOptions,
         const Drawing::ColorType& outputColorType);
 
+    // All passes over area of the output grid, nullptr when the field can not be made
+    std::shared_ptr<Drawing::Image> ProcessArea(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
+        const Drawing::Rect& src, const Drawing::Rect& dst, const Drawing::RectI& area);
+
+    // Distance a tile reads beyond its core: the spread of the field plus the reach of the derivative passes
+    int GetTileMargin() const;
+    bool UseTiles(int outputWidth, int outputHeight) const;
+    std::vector<Tile> MakeTiles(int outputWidth, int outputHeight) const;
+
+    // Runs the passes tile by tile and copies each core into the output, so the transient F16 images are bounded by
+    // the tile size instead of the output size
+    std::shared_ptr<Drawing::Image> ProcessImageTiled(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src, const Drawing::Rect& dst);
+
+    // CPU backend of OnProcessImage, reads the image back and encodes the field like the JFA passes do
+    std::shared_ptr<Drawing::Image> ProcessImageOnCpu(const std::shared_ptr<Drawing::Image>& image,
+        const Drawing::Rect& src, const Drawing::Rect& dst) const;
+
     bool IsInputValid(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src,
         const Drawing::Rect& dst);
 
@@ -22,6 +22,7 @@
 
 #include "ge_cache_provider.h"
 #include "draw/canvas.h"
+#include "effect/shader_effect.h"
 #include "ge_filter_type.h"
 #include "ge_shader_filter_params.h"
 #include "image/image.h"
@@ -53,12 +54,46 @@ public:
         return false; // Placeholder default implementation (Does not support directly draw on canvas)
     }
 
+    /**
+     * @brief Whether the filter may be applied as a shader nested in the ones of its neighbours.
+     * @note Only per-pixel or local-sampling filters can override this to return true, together with
+     *       OnMakeChainedShader. GERender then nests consecutive such filters and rasterizes their run once, saving
+     *       one intermediate image per filter.
+     */
+    virtual bool SupportsShaderChaining() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Output of the filter as a shader reading input instead of an image.
+     * @param input Shader of the input image, sampled in the pixel space of info.
+     * @param info Image info of the input image, the returned shader is sampled in the same pixel space.
+     * @return The shader producing the same pixels as OnProcessImage would, or nullptr when the filter cannot be
+     *         chained with its current params. GERender then rasterizes input and falls back to OnProcessImage.
+     */
+    virtual std::shared_ptr<Drawing::ShaderEffect> OnMakeChainedShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+    {
+        return nullptr;
+    }
+
     GE_EXPORT std::shared_ptr<Drawing::Image> ProcessImage(Drawing::Canvas& canvas,
         const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst);
 
     GE_EXPORT bool DrawImage(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image> image,
         const Drawing::Rect& src, const Drawing::Rect& dst, Drawing::Brush& brush);
 
+    GE_EXPORT std::shared_ptr<Drawing::ShaderEffect> MakeChainedShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info);
+
+    // Sampling of the input image of chained shaders, the one OnProcessImage of chainable filters uses
+    GE_EXPORT static std::shared_ptr<Drawing::ShaderEffect> MakeChainInputShader(const Drawing::Image& image);
+
+    // Rasterize a chain built with MakeChainedShader into an image of the given info, nullptr on failure
+    GE_EXPORT static std::shared_ptr<Drawing::Image> MakeChainedImage(Drawing::Canvas& canvas,
+        const std::shared_ptr<Drawing::ShaderEffect>& shader, const Drawing::ImageInfo& info);
+
     uint32_t Hash() const
     {
         return hash_;
@@ -88,6 +123,25 @@ public:
 
     virtual void SetCacheProvider(IGECacheProvider* cacheProvider) {}
 
+    /**
+     * @brief Area of the input changed since the last input the filter processed with the same cache provider,
+     *        in input pixels. std::nullopt when unknown, an empty rect when nothing changed.
+     * @note Set before every run. Filters keeping their last output in the cache provider may redo only the
+     *       outputs this area reaches, the others ignore it.
+     */
+    virtual void SetDirtyRect(const std::optional<Drawing::Rect>& dirtyRect) {}
+
+    /**
+     * @brief Whether one instance may be kept alive and run again on later frames while its params are unchanged.
+     * @note Filters whose Preprocess or OnProcessImage mutate members derived from params (e.g. in-place tone
+     *       mapping, lazily built images sized to the first input) must keep the default. Only filters returning
+     *       true are kept by GECompiledEffectChain.
+     */
+    virtual bool IsReusableAcrossFrames() const
+    {
+        return false;
+    }
+
 protected:
     /**
      * @brief Create a matrix that translates to the top-left corner of destination area.
@@ -102,6 +156,13 @@ protected:
         return translateMatrix;
     }
 
+    /**
+     * @brief Make input sampled through localMatrix, i.e. evaluating the result at p evaluates input at
+     *        localMatrix^-1 * p. Used in OnMakeChainedShader by filters working in geometry space.
+     */
+    static std::shared_ptr<Drawing::ShaderEffect> MakeLocalMatrixShader(
+        const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::Matrix& localMatrix);
+
 protected:
     Drawing::CanvasInfo canvasInfo_;
     float supportHeadroom_ = 0.0f;
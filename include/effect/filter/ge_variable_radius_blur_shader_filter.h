@@ -40,6 +40,15 @@ public:
     std::string GetDescription();
     std::string GetDetailedDescription();
 
+    // Whether large radii blend levels of a downsampled pyramid instead of running the box passes, set by
+    // persist.sys.graphic.effect.vrbpyramid, on unless it is 0
+    static bool IsPyramidEnabled();
+
+    // Half radii below this keep the box passes, which are cheap there and exact
+    static constexpr float PYRAMID_MIN_RADIUS = 4.0f;
+    // Enough for the largest half radius of 30, whose level is log2(30)
+    static constexpr int MAX_PYRAMID_LEVELS = 5;
+
 protected:
     Drawing::GEVariableRadiusBlurShaderFilterParams params_;
 
@@ -47,12 +56,18 @@ private:
     static void MakeHorizontalBoxBlurEffect(bool applyInsideMask = false);
     static void MakeVerticalBoxBlurEffect(bool applyInsideMask = false);
     static void MakeTextureShaderEffect();
+    static void MakePyramidEffects();
+    bool UsePyramid(float radius) const;
+    static int GetPyramidLevelCount(float radius, int width, int height);
     static std::shared_ptr<Drawing::Image> DrawBoxLinearGradientBlur(const std::shared_ptr<Drawing::Image>& image,
         Drawing::Canvas& canvas, float radius, std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader,
-        const Drawing::Rect& dst);
+        const Drawing::Rect& dst, bool usePyramid = false);
     static std::shared_ptr<Drawing::Image> BuildBoxLinearGradientBlur(const std::shared_ptr<Drawing::Image>& image,
         Drawing::Canvas& canvas, float radius, std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader,
         Drawing::Matrix blurMatrix);
+    static std::shared_ptr<Drawing::Image> BuildPyramidLinearGradientBlur(
+        const std::shared_ptr<Drawing::Image>& image, Drawing::Canvas& canvas, float radius,
+        std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader, const Drawing::Matrix& blurMatrix);
 };
 
 } // namespace Rosen
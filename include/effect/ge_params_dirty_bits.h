@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_PARAMS_DIRTY_BITS_H
+#define GRAPHICS_EFFECT_GE_PARAMS_DIRTY_BITS_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ge_params_reflection.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+
+/**
+ * @brief Set of params members written with a new value, one bit per GEParamsMemberTag of a params type.
+ *
+ * The bit of a tag is GEParamsMemberHelper::GetTagIndexInParams(tag), so bits of different params types overlap and a
+ * set is only meaningful for the params type it was recorded on. All() stands for "every member", used when the whole
+ * params object is replaced or changed outside of SetParam.
+ */
+class GEParamsDirtyBits {
+public:
+    // gen_metadata.py fails when a params type declares more tags than this
+    static constexpr uint32_t CAPACITY = 64;
+
+    static GEParamsDirtyBits All()
+    {
+        GEParamsDirtyBits dirty;
+        dirty.bits_ = ~uint64_t(0);
+        return dirty;
+    }
+
+    void Set(GEParamsMemberTag tag)
+    {
+        uint32_t index = GEParamsMemberHelper::GetTagIndexInParams(tag);
+        if (index < CAPACITY) {
+            bits_ |= uint64_t(1) << index;
+        }
+    }
+
+    bool Test(GEParamsMemberTag tag) const
+    {
+        uint32_t index = GEParamsMemberHelper::GetTagIndexInParams(tag);
+        return index < CAPACITY && (bits_ & (uint64_t(1) << index)) != 0;
+    }
+
+    // True when any of tags is dirty, e.g. TestAny(GEParamsMemberTag::A, GEParamsMemberTag::B)
+    template<typename... Tags>
+    bool TestAny(Tags... tags) const
+    {
+        return (Test(tags) || ...);
+    }
+
+    bool Any() const
+    {
+        return bits_ != 0;
+    }
+
+    void Merge(const GEParamsDirtyBits& other)
+    {
+        bits_ |= other.bits_;
+    }
+
+    void Reset()
+    {
+        bits_ = 0;
+    }
+
+    uint64_t GetValue() const
+    {
+        return bits_;
+    }
+
+private:
+    uint64_t bits_ = 0;
+};
+
+template<typename T, typename = void>
+struct GEParamsHasEqualOperator : std::false_type {};
+
+template<typename T>
+struct GEParamsHasEqualOperator<T, std::void_t<decltype(std::declval<const T&>() == std::declval<const T&>())>>
+    : std::true_type {};
+
+/**
+ * @brief Whether writing rhs over a member holding lhs leaves it unchanged.
+ *
+ * Used by the generated SetParamsMemberByTag to only report real changes. Types without operator== (e.g. plain
+ * aggregates of the SDF params) always compare different, so writing them is always reported. Pointers compare by
+ * identity, matching GEParamsHasher.
+ */
+template<typename T>
+bool GEParamsFieldEqual(const T& lhs, const T& rhs)
+{
+    if constexpr (GEParamsHasEqualOperator<T>::value) {
+        return lhs == rhs;
+    } else {
+        return false;
+    }
+}
+
+template<typename First, typename Second>
+bool GEParamsFieldEqual(const std::pair<First, Second>& lhs, const std::pair<First, Second>& rhs)
+{
+    return GEParamsFieldEqual(lhs.first, rhs.first) && GEParamsFieldEqual(lhs.second, rhs.second);
+}
+
+template<typename T>
+bool GEParamsFieldEqual(const std::weak_ptr<T>& lhs, const std::weak_ptr<T>& rhs)
+{
+    // An expired pointer may be replaced by a new object, treat it as changed
+    return !lhs.expired() && !lhs.owner_before(rhs) && !rhs.owner_before(lhs);
+}
+
+// Containers compare element-wise, their own operator== would not compile for elements without one
+template<typename T, size_t N>
+bool GEParamsFieldEqual(const std::array<T, N>& lhs, const std::array<T, N>& rhs)
+{
+    for (size_t i = 0; i < N; ++i) {
+        if (!GEParamsFieldEqual(lhs[i], rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+bool GEParamsFieldEqual(const std::vector<T>& lhs, const std::vector<T>& rhs)
+{
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (!GEParamsFieldEqual(lhs[i], rhs[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_PARAMS_DIRTY_BITS_H
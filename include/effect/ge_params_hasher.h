@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_PARAMS_HASHER_H
+#define GRAPHICS_EFFECT_GE_PARAMS_HASHER_H
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "draw/path.h"
+#include "ge_effects_params.h"
+#include "image/image.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+
+/**
+ * @brief Hash of a params struct with the objects it was computed from by identity.
+ */
+struct GEParamsHash {
+    uint64_t value = 0;
+    std::vector<std::shared_ptr<const void>> retained;
+};
+
+/**
+ * @brief Accumulates a 64-bit content hash over params members.
+ *
+ * Plain values are hashed by content. Images are hashed by unique ID. Shapes and masks are hashed by identity, so the
+ * hasher retains them: a consumer keeping the hash beyond the lifetime of the params must keep GetRetained() too,
+ * otherwise a new object allocated at the same address would produce the same hash.
+ * Members without a stable content representation (e.g. Drawing::Path) mark the hash as not hashable.
+ *
+ * Overloads are picked by the generated GEParamsMemberHelper::HashParams, a new params member type needs one here.
+ */
+class GEParamsHasher {
+public:
+    explicit GEParamsHasher(uint64_t seed = 0) : hash_(Mix(seed ^ SEED_SALT)) {}
+
+    void Combine(uint64_t value)
+    {
+        hash_ = Mix(hash_ ^ value);
+    }
+
+    void Combine(bool value)
+    {
+        Combine(static_cast<uint64_t>(value));
+    }
+
+    void Combine(int32_t value)
+    {
+        Combine(static_cast<uint64_t>(static_cast<uint32_t>(value)));
+    }
+
+    void Combine(uint32_t value)
+    {
+        Combine(static_cast<uint64_t>(value));
+    }
+
+    void Combine(float value)
+    {
+        uint32_t bits = 0;
+        static_assert(sizeof(bits) == sizeof(value));
+        std::memcpy(&bits, &value, sizeof(bits));
+        Combine(bits);
+    }
+
+    template<typename T, std::enable_if_t<std::is_enum_v<T>, int> = 0>
+    void Combine(T value)
+    {
+        Combine(static_cast<uint64_t>(value));
+    }
+
+    template<typename T>
+    void Combine(const Vector2<T>& value)
+    {
+        Combine(value[0]);
+        Combine(value[1]);
+    }
+
+    template<typename T>
+    void Combine(const Vector3<T>& value)
+    {
+        Combine(value[0]);
+        Combine(value[1]);
+        Combine(value[2]); // 2: z component
+    }
+
+    template<typename T>
+    void Combine(const Vector4<T>& value)
+    {
+        Combine(value[0]);
+        Combine(value[1]);
+        Combine(value[2]); // 2: z component
+        Combine(value[3]); // 3: w component
+    }
+
+    void Combine(const Color& value)
+    {
+        Combine(static_cast<uint32_t>(value.CastToColorQuad()));
+    }
+
+    void Combine(const Color4f& value)
+    {
+        Combine(value.redF_);
+        Combine(value.greenF_);
+        Combine(value.blueF_);
+        Combine(value.alphaF_);
+    }
+
+    void Combine(const Point& value)
+    {
+        Combine(value.GetX());
+        Combine(value.GetY());
+    }
+
+    void Combine(const Matrix& value)
+    {
+        Matrix::Buffer buffer;
+        value.GetAll(buffer);
+        Combine(buffer);
+    }
+
+    void Combine(const RectF& value)
+    {
+        Combine(value.GetLeft());
+        Combine(value.GetTop());
+        Combine(value.GetWidth());
+        Combine(value.GetHeight());
+    }
+
+    void Combine(const GERRect& value)
+    {
+        Combine(value.left_);
+        Combine(value.top_);
+        Combine(value.width_);
+        Combine(value.height_);
+        for (const auto& radius : value.radius_) {
+            Combine(radius);
+        }
+    }
+
+    void Combine(const GESDFBorderParams& value)
+    {
+        Combine(value.color);
+        Combine(value.width);
+        Combine(value.isOutline);
+    }
+
+    void Combine(const GESDFShadowParams& value)
+    {
+        Combine(value.color);
+        Combine(value.offsetX);
+        Combine(value.offsetY);
+        Combine(value.radius);
+        Combine(value.path);
+        Combine(value.isFilled);
+        Combine(value.elevation);
+    }
+
+    void Combine(const Path&)
+    {
+        hashable_ = false;
+    }
+
+    template<typename First, typename Second>
+    void Combine(const std::pair<First, Second>& value)
+    {
+        Combine(value.first);
+        Combine(value.second);
+    }
+
+    template<typename T, size_t N>
+    void Combine(const std::array<T, N>& value)
+    {
+        for (const auto& element : value) {
+            Combine(element);
+        }
+    }
+
+    template<typename T>
+    void Combine(const std::vector<T>& value)
+    {
+        Combine(static_cast<uint64_t>(value.size()));
+        for (const auto& element : value) {
+            Combine(element);
+        }
+    }
+
+    void Combine(const std::shared_ptr<Image>& value)
+    {
+        Combine(value ? value->GetUniqueID() : 0u);
+    }
+
+    void Combine(const std::weak_ptr<Image>& value)
+    {
+        Combine(value.lock());
+    }
+
+    template<typename T>
+    void Combine(const std::shared_ptr<T>& value)
+    {
+        Combine(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value.get())));
+        if (value != nullptr) {
+            retained_.push_back(value);
+        }
+    }
+
+    uint64_t GetResult() const
+    {
+        return hash_;
+    }
+
+    bool IsHashable() const
+    {
+        return hashable_;
+    }
+
+    const std::vector<std::shared_ptr<const void>>& GetRetained() const
+    {
+        return retained_;
+    }
+
+    std::vector<std::shared_ptr<const void>> TakeRetained()
+    {
+        return std::move(retained_);
+    }
+
+private:
+    static constexpr uint64_t SEED_SALT = 0x9e3779b97f4a7c15ULL;
+
+    // splitmix64 finalizer, every input bit affects every output bit
+    static constexpr uint64_t Mix(uint64_t value)
+    {
+        value ^= value >> 30; // 30: splitmix64 shift
+        value *= 0xbf58476d1ce4e5b9ULL;
+        value ^= value >> 27; // 27: splitmix64 shift
+        value *= 0x94d049bb133111ebULL;
+        value ^= value >> 31; // 31: splitmix64 shift
+        return value;
+    }
+
+    uint64_t hash_ = 0;
+    bool hashable_ = true;
+    std::vector<std::shared_ptr<const void>> retained_;
+};
+
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_PARAMS_HASHER_H
@@ -37,6 +37,7 @@ namespace Rosen {
 namespace Drawing {
 
 class GEFilterParams;
+class GEParamsHasher;
 
 // Helper macro to escape commas in macro arguments
 // e.g. CALL(std::pair<int, int>), the comma would separate into two macro arguments
@@ -1587,7 +1588,7 @@ public:
 
     // Convert filter name string to GEFilterType
     // Note: Strings are sourced from GEFilterParamsTypeInfo<Struct>::FilterName
-    static GEFilterType GetFilterTypeFromString(const std::string& str);
+    static GEFilterType GetFilterTypeFromString(std::string_view str);
 };
 
 // Type traits for accessing struct fields
@@ -2701,49 +2702,58 @@ public:
     // Convert GEParamsMemberTag to corresponding GEFilterType
     static GEFilterType GetFilterTypeFromTag(GEParamsMemberTag tag);
 
+    // Position of tag among the tags of its params type, the bit of tag in GEParamsDirtyBits
+    // Returns GEParamsDirtyBits::CAPACITY for INVALID and out of range tags
+    static uint32_t GetTagIndexInParams(GEParamsMemberTag tag);
+
     // Convert string to GEParamsMemberTag
     // Note: Strings are sourced from GEParamsFieldAccessor<Tag>::name for single source of truth
     //       Aliases from [[ge::prop(alias=...)]] are also included
-    static GEParamsMemberTag GEParamsMemberTagFromString(const std::string& str);
+    static GEParamsMemberTag GEParamsMemberTagFromString(std::string_view str);
+
+    // Hash every member of params into hasher, see GEParamsHasher for how each member type is hashed
+    // Returns false when params holds a member without a stable content hash
+    static bool HashParams(const GEFilterParams& params, GEParamsHasher& hasher);
 
     // Set params member by tag using overloaded functions (reduces binary bloat)
     // All implementations are in the .cpp file
+    // Returns true when the member now holds a different value, see GEParamsFieldEqual
     // Overloaded SetParamsMemberByTag for each unique parameter type
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixDirection& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixEffectType& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Color4f& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Matrix& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Path& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Point& value);
-    static void SetParamsMemberByTag(
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixDirection& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixEffectType& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Color4f& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Matrix& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Path& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Point& value);
+    static bool SetParamsMemberByTag(
         GEFilterParams& params, GEParamsMemberTag tag, const GEBezierWarpShaderFilterControlPointArray& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GERRect& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GESDFBorderParams& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GESDFShadowParams& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GESDFUnionOp& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const RectF& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector2f& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector3f& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector4f& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const bool& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const float& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const int32_t& value);
-    static void SetParamsMemberByTag(
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GERRect& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GESDFBorderParams& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GESDFShadowParams& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GESDFUnionOp& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const RectF& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector2f& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector3f& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector4f& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const bool& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const float& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const int32_t& value);
+    static bool SetParamsMemberByTag(
         GEFilterParams& params, GEParamsMemberTag tag, const std::pair<float, float>& value);
-    static void SetParamsMemberByTag(
+    static bool SetParamsMemberByTag(
         GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<Drawing::GEShaderShape>& value);
-    static void SetParamsMemberByTag(
+    static bool SetParamsMemberByTag(
         GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<Drawing::Image>& value);
-    static void SetParamsMemberByTag(
+    static bool SetParamsMemberByTag(
         GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<GEShaderMask>& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector2f>& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector4f>& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const std::vector<float>& value);
-    static void SetParamsMemberByTag(
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector2f>& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector4f>& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const std::vector<float>& value);
+    static bool SetParamsMemberByTag(
         GEFilterParams& params, GEParamsMemberTag tag, const std::vector<std::pair<float, float>>& value);
-    static void SetParamsMemberByTag(
+    static bool SetParamsMemberByTag(
         GEFilterParams& params, GEParamsMemberTag tag, const std::weak_ptr<Drawing::Image>& value);
-    static void SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const uint32_t& value);
+    static bool SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const uint32_t& value);
 };
 
 } // namespace Drawing
@@ -15,9 +15,9 @@
 #ifndef GRAPHICS_EFFECT_CONTOUR_DIAGONAL_FLOW_LIGHT_SHADER_H
 #define GRAPHICS_EFFECT_CONTOUR_DIAGONAL_FLOW_LIGHT_SHADER_H
 
-#include <queue>
 #include "common/rs_vector4.h"
 #include "effect/runtime_shader_builder.h"
+#include "ge_curve_spatial_index.h"
 #include "ge_filter_type_info.h"
 #include "ge_shader.h"
 #include "ge_shader_filter_params.h"
@@ -27,13 +27,7 @@
 namespace OHOS {
 namespace Rosen {
 
-const int box4fSize = 4;
-using Box4f = std::array<float, box4fSize>;
-
-struct Grid {
-    Box4f bbox;
-    std::vector<int> curveIndices;
-};
+using Box4f = GECurveSpatialIndex::Box;
 
 class GEKawaseBlurShaderFilter;
 class GE_EXPORT GEContourDiagonalFlowLightShader : public GEShader {
@@ -77,11 +71,8 @@ private:
     void AutoGridPartition(int width, int height, float maxThickness);
     void ComputeAllCurveBoundingBoxes(int width, int height, float maxThickness,
         Box4f& canvasBBox, std::vector<Box4f>& curveBBoxes);
-    void InitializeWorkQueue(const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes,
-        std::queue<Grid>& workQueue);
-    void SplitGrid(const Grid& current, const std::vector<Box4f>& curveBBoxes,
-        std::queue<Grid>& workQueue, float minGridSize);
-    void ProcessFinalGrid(Grid& current, const std::vector<Box4f>& curveBBoxes, int height);
+    void ProcessFinalGrid(const GECurveSpatialIndex::Node& leaf, int height);
+    static GECurveSpatialIndex::Config MakeSpatialIndexConfig();
     std::shared_ptr<Drawing::Image> CreateImg(Drawing::Canvas& canvas, const Drawing::Rect& rect);
     std::shared_ptr<Drawing::Image> CreateDrawImg(Drawing::Canvas& canvas, const Drawing::Rect& rect,
         const Drawing::Brush& brush);
@@ -102,7 +93,9 @@ private:
     size_t pointCnt_ = 0; // real input Point Cnt
 
     // grid : curves, boundingbox(xmin, xmax, ymin, ymax)
-    std::vector<std::pair<std::vector<float>, Grid>> curvesInGrid_{};
+    GECurveSpatialIndex spatialIndex_{MakeSpatialIndexConfig()};
+    std::vector<Box4f> curveBBoxes_{};
+    std::vector<std::pair<std::vector<float>, Box4f>> curvesInGrid_{};
     std::vector<std::vector<float>> segmentIndex_{};
     std::vector<float> curveWeightPrefix_{};
     std::vector<float> curveWeightCurrent_{};
@@ -81,6 +81,14 @@ protected:
      */
     virtual Drawing::Rect GetSubtractedRect(float width, float height) const { return Drawing::Rect(); }
 
+    /**
+     * @brief Draw the pixels touching outerRect but not lying fully inside innerRect with the attached brush.
+     * @details Lets SDF shaders shade only the band around a shape boundary, skipping an interior they leave
+     *          unchanged as a nine-patch. An empty or invalid innerRect draws all of outerRect.
+     */
+    static void DrawRectWithoutInner(Drawing::Canvas& canvas, const Drawing::Rect& outerRect,
+        const Drawing::Rect& innerRect);
+
     virtual std::shared_ptr<Drawing::ShaderEffect> MakeSDFShaderWithCache(
         std::shared_ptr<Drawing::GESDFShaderShape> sdfShape, Drawing::Canvas& canvas, const Drawing::Rect& rect,
         bool hasNormal = true) const;
@@ -46,6 +46,8 @@ public:
 
 private:
     std::shared_ptr<Drawing::RuntimeEffect> GetSDFBorderEffect();
+    // Shrinks rect to the border band and sets the interior it leaves untouched, false when the band is empty
+    bool GetBorderBand(Drawing::Rect& rect, Drawing::Rect& innerRect) const;
     Drawing::GESDFBorderShaderParams params_;
 
     inline static const std::string shaderCode_ = R"(
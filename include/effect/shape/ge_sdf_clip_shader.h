@@ -51,6 +51,8 @@ public:
 
 private:
     std::shared_ptr<Drawing::RuntimeEffect> GetSDFClipEffect();
+    // Clears rect outside the shape bounds with brush and shrinks rect to them, false when nothing is left
+    bool ClearOutsideBounds(Drawing::Canvas& canvas, const Drawing::Brush& brush, Drawing::Rect& rect);
     Drawing::GESDFClipShaderParams params_;
 
     inline static const std::string shaderCode_ = R"(
@@ -25,6 +25,20 @@ namespace Drawing {
 
 class GE_EXPORT GESDFDistortOpShaderShape : public GESDFShaderShape {
 public:
+    // Inverse bilinear mapping and barrel distortion terms of the corners
+    struct DistortUniforms {
+        float lu[2] = { 0.0f, 0.0f };
+        float e[2] = { 0.0f, 0.0f };
+        float f[2] = { 0.0f, 0.0f };
+        float g[2] = { 0.0f, 0.0f };
+        float k2 = 0.0f;
+        float ik2 = 0.0f;
+        float k1Base = 0.0f;
+        float k0Base = 0.0f;
+        float barrelDistortion[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float distortionEnable = 0.0f;
+    };
+
     using GESDFShaderShape::GenerateDrawingShader;
     using GESDFShaderShape::GenerateDrawingShaderHasNormal;
     DECLARE_GEFILTER_TYPEFUNC(GESDFDistortOpShaderShape, Drawing::GESDFDistortOpShapeParams);
@@ -36,6 +50,7 @@ public:
     std::shared_ptr<ShaderEffect> GenerateDrawingShader(float width, float height) const override;
     std::shared_ptr<ShaderEffect> GenerateDrawingShaderHasNormal(float width, float height) const override;
     void Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal) override;
+    void SetPrecisionHint(const GESDFPrecisionHint& hint) override;
 
     GESDFShapeType GetSDFShapeType() const override
     {
@@ -54,6 +69,7 @@ public:
 
     bool HasType(const GESDFShapeType type) const override;
     virtual bool GetInscribedRect(Rect& rect) override;
+    DistortUniforms ComputeUniforms() const;
 
 private:
     std::shared_ptr<ShaderEffect> GenerateDistortOpDrawingShader(std::shared_ptr<ShaderEffect> shapeShader,
@@ -39,6 +39,7 @@ public:
     }
 
     bool TryGetCenterAndHalfSize(float& outX, float& outY, Vector2f& shapeHalfSize) const override;
+    bool GetBoundingRect(Rect& rect) override;
 
     const Vector2f& GetCenter() const
     {
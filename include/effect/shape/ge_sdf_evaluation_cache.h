@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_SDF_EVALUATION_CACHE_H
+#define GRAPHICS_EFFECT_GE_SDF_EVALUATION_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ge_sdf_shader_shape.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+
+/**
+ * @class GESDFEvaluationCache
+ * @brief Evaluates a shape once per frame when several SDF consumers (border, shadow, clip, edge light, glass) use it.
+ *
+ * Frames are per thread and nest, GERender opens one around DrawShaderEffect and callers may open a wider one with
+ * BeginFrame and EndFrame. The first request of a shape in a frame gets the shape shader, as a single consumer gains
+ * nothing from a texture. The second request rasterizes distance and normal over the areas both consumers sample
+ * into one texture, which that and every later consumer sample instead of evaluating the tree again. The outermost
+ * EndFrame releases the textures.
+ */
+class GE_EXPORT GESDFEvaluationCache {
+public:
+    class GE_EXPORT FrameScope {
+    public:
+        FrameScope() { BeginFrame(); }
+        ~FrameScope() { EndFrame(); }
+        FrameScope(const FrameScope&) = delete;
+        FrameScope& operator=(const FrameScope&) = delete;
+    };
+
+    static void BeginFrame();
+    static void EndFrame();
+    static bool IsInFrame();
+
+    /**
+     * @brief Shader of shape for a width x height canvas, sampled by the caller over sampleRect.
+     * @param hint Precision the caller needs, shape shaders are generated with it and the shared texture at full
+     * precision.
+     * @return The shape shader outside frames, on the first request or when the texture can not be made, otherwise
+     * a sampler of the frame texture. Both carry the normal in rgb when it is part of the texture.
+     */
+    static std::shared_ptr<ShaderEffect> GetShader(const std::shared_ptr<GESDFShaderShape>& shape, Canvas& canvas,
+        float width, float height, const Rect& sampleRect, bool hasNormal = false,
+        const GESDFPrecisionHint& hint = {});
+
+    // Shapes requested in the current frame of the calling thread
+    static size_t GetEntryCount();
+
+    // Set by persist.sys.graphic.effect.sdfevalcache, on unless it is 0
+    static bool IsEnabled();
+
+    // Larger areas and more shapes per frame are evaluated directly
+    static constexpr int32_t MAX_TEXTURE_SIZE = 4096;
+    static constexpr size_t MAX_ENTRIES = 32;
+
+private:
+    struct Entry {
+        // Held so the address can not be reused by another shape within the frame
+        std::shared_ptr<GESDFShaderShape> shape;
+        // Shapes updated in place within the frame change their hash
+        uint32_t hash = 0;
+        float width = 0.0f;
+        float height = 0.0f;
+        const void* context = nullptr;
+        // Union of every rect sampled so far
+        Rect sampleRect;
+        std::shared_ptr<Image> image;
+        RectI imageArea;
+    };
+
+    struct FrameState {
+        uint32_t depth = 0;
+        std::vector<Entry> entries;
+    };
+
+    static FrameState& GetFrameState();
+    static bool RasterizeEntry(Entry& entry, Canvas& canvas);
+    static std::shared_ptr<ShaderEffect> MakeSampler(const Entry& entry);
+};
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_SDF_EVALUATION_CACHE_H
@@ -15,8 +15,9 @@
 #ifndef GRAPHICS_EFFECT_GE_SDF_PATH_SHADER_SHAPE_H
 #define GRAPHICS_EFFECT_GE_SDF_PATH_SHADER_SHAPE_H
 
-#include <queue>
+#include <vector>
 
+#include "ge_curve_spatial_index.h"
 #include "ge_filter_type_info.h"
 #include "ge_sdf_shader_shape.h"
 #include "ge_shader_filter_params.h"
@@ -26,15 +27,51 @@ namespace Rosen {
 namespace Drawing {
 
 namespace {
+using Box4f = GECurveSpatialIndex::Box;
+} // namespace
+
+/**
+ * @brief Quadratic segments of a path in structure-of-arrays layout, in path order.
+ * Segment i goes from start[i] through control[i] to end[i]. Lines have their control point on their start point.
+ * Clear keeps the capacity, so a buffer reused across frames stops allocating once it fits the path.
+ */
+struct GESDFPathCurves {
+    std::vector<float> startX;
+    std::vector<float> startY;
+    std::vector<float> controlX;
+    std::vector<float> controlY;
+    std::vector<float> endX;
+    std::vector<float> endY;
+
+    size_t Size() const
+    {
+        return startX.size();
+    }
 
-static constexpr uint32_t BOX_4F_SIZE = 4;
-using Box4f = std::array<float, BOX_4F_SIZE>;
+    void Clear()
+    {
+        for (auto* array : { &startX, &startY, &controlX, &controlY, &endX, &endY }) {
+            array->clear();
+        }
+    }
+
+    void Reserve(size_t count)
+    {
+        for (auto* array : { &startX, &startY, &controlX, &controlY, &endX, &endY }) {
+            array->reserve(count);
+        }
+    }
 
-struct Grid {
-    Box4f bbox;
-    std::vector<uint32_t> curveIndices;
+    void Add(const Vector2f& start, const Vector2f& control, const Vector2f& end)
+    {
+        startX.push_back(start.x_);
+        startY.push_back(start.y_);
+        controlX.push_back(control.x_);
+        controlY.push_back(control.y_);
+        endX.push_back(end.x_);
+        endY.push_back(end.y_);
+    }
 };
-} // namespace
 
 class GE_EXPORT GESDFPathShaderShape : public GESDFShaderShape {
 public:
@@ -51,7 +88,20 @@ public:
     std::shared_ptr<ShaderEffect> GenerateDrawingShaderHasNormal(Canvas& canvas,
         float width, float height) override;
     void Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal) override;
+    // maxError above a pixel lowers the field resolution to 1 / maxError, maxDistance bounds the propagation passes
+    void SetPrecisionHint(const GESDFPrecisionHint& hint) override
+    {
+        precisionHint_ = hint;
+    }
+    // Segments of path as their end points and control points: 2 for lines, 3 for quadratics and 4 for cubics
     static std::vector<std::vector<Vector2f>> GetCurveByPath(const Drawing::Path& path);
+    // Segments of path as quadratics appended to curves, cubics and conics approximated. Returns the segment count
+    static size_t GetQuadCurvesByPath(const Drawing::Path& path, GESDFPathCurves& curves);
+
+    // Distance fields are kept across frames in a process-wide LRU cache, keyed by path geometry and target size.
+    // A budget of 0 disables the cache, it can also be switched off with persist.sys.graphic.effect.enablesdfcache.
+    static void SetDistanceFieldCacheBudget(size_t byteBudget);
+    static void ClearDistanceFieldCache();
 
     GESDFShapeType GetSDFShapeType() const override
     {
@@ -78,6 +128,8 @@ public:
         return type == GESDFShapeType::PATH;
     }
 
+    bool GetBoundingRect(Rect& rect) override;
+
     static void cubicToQuadraticSingle(const Vector2f& p0, Vector2f& p1, const Vector2f& p2, const Vector2f& p3);
 
     static float calculateTimeStep(const Vector2f& p0, const Vector2f& p1, const Vector2f& p2, bool isLine);
@@ -90,31 +142,37 @@ private:
     std::shared_ptr<Image> RunSDFPropagation(
         Canvas& canvas, std::shared_ptr<Image> sdfTex, std::shared_ptr<Image> maskTex, int width, int height);
     std::shared_ptr<Image> ComputeDistanceField(Canvas& canvas, std::shared_ptr<Image> jfaTex, int width, int height);
+    // CPU backend of Preprocess, exact distances to curves_ in the layout ComputeDistanceField outputs
+    std::shared_ptr<Image> ComputeDistanceFieldOnCpu(const Drawing::Path& path, int width, int height) const;
 
     std::shared_ptr<Image> GenerateSeedTexture(Canvas& canvas, int width, int height,
         const std::vector<std::vector<Vector2f>>& paramsCoef, std::shared_ptr<Image>& pathImage);
     void UpdateScale(Vector2f& scale, const Drawing::Rect& rect);
 
     // Helper functions for Preprocess
+    // Lowers scale to the resolution the precision hint allows, false when it stays
+    bool ApplyPrecisionHint(Vector2f& scale) const;
+    void PreprocessDistanceField(Canvas& canvas, const Rect& rect);
     Drawing::Path PreparePathForRendering(const Drawing::Rect& rect, float& width, float& height);
-    std::vector<Vector2f> ProcessCurveSegments(const std::vector<std::vector<Vector2f>>& paramsCoef);
+    void ConvertCurvesToNDC(float width, float height);
     void RenderGridsToSurface(const Drawing::Rect& targetRect);
     void ProcessSingleBatch(Drawing::RuntimeShaderBuilder& builder, size_t gridIndex, size_t batch,
     size_t start, size_t end, float vStart, float vEnd, std::shared_ptr<Drawing::Image>& prevSdf,
     std::shared_ptr<Drawing::ShaderEffect>& prevShader);
 
     // ========== Quadtree grid partition ==========
-    void AutoGridPartition(float width, float height, const std::vector<Vector2f>& pixelControlPoints);
-    void SplitGrid(
-        const Grid& current, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue, float minGridSize);
-    void ComputeAllCurveBoundingBoxes(float width, float height, const std::vector<Vector2f>& pixelControlPoints,
-        Box4f& canvasBBox, std::vector<Box4f>& curveBBoxes);
-    std::array<float, 4> ComputeCurveBoundingBox(size_t curveIndex, float maxThickness,
-        const std::vector<Vector2f>& pixelControlPoints, float width, float height);
-    void InitializeWorkQueue(
-        const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue);
-    void ProcessFinalGrid(Grid& current, const std::vector<Box4f>& curveBBoxes);
+    void AutoGridPartition(float width, float height);
+    void ComputeAllCurveBoundingBoxes(float width, float height, Box4f& canvasBBox, std::vector<Box4f>& curveBBoxes);
+    std::array<float, 4> ComputeCurveBoundingBox(size_t curveIndex, float maxThickness, float width, float height);
+    void UpdateEmptyGridStats();
+    void ProcessFinalGrid(const GECurveSpatialIndex::Node& leaf);
     void UpdateNumPasses(float height);
+    static GECurveSpatialIndex::Config MakeSpatialIndexConfig();
+
+    // Hash of the curves of the prepared path with everything else the distance field depends on
+    uint64_t MakeDistanceFieldCacheKey(Canvas& canvas, const Drawing::Path& path, float width, float height) const;
+    static std::shared_ptr<Image> LoadCachedDistanceField(uint64_t key);
+    static void StoreCachedDistanceField(uint64_t key, const std::shared_ptr<Image>& distanceField);
 
     // ========== Quadtree grid partition ==========
     void CreateSurfaceAndCanvas(Drawing::Canvas& canvas, const Drawing::Rect& rect);
@@ -130,11 +188,17 @@ private:
     std::shared_ptr<Image> disResult_ = nullptr;
 
     GESDFPathShapeParams params_ {};
+    GESDFPrecisionHint precisionHint_;
     uint32_t numPasses_ = 6;
     bool distanceCalc_ = true;
 
-    // Grid partition data storage
-    std::vector<std::pair<std::vector<float>, Grid>> curvesInGrid_;
+    // Pixel space quadratics of the path, kept across Preprocess calls to reuse their storage
+    GESDFPathCurves curves_;
+
+    // Grid partition data storage, the index and boxes are kept to reuse the partition of the previous frame
+    GECurveSpatialIndex spatialIndex_ { MakeSpatialIndexConfig() };
+    std::vector<Box4f> curveBBoxes_;
+    std::vector<std::pair<std::vector<float>, Box4f>> curvesInGrid_;
     std::vector<std::vector<float>> segmentIndex_;
     std::vector<float> controlPoints_;
     std::shared_ptr<Drawing::Surface> offscreenSurface_ = nullptr;
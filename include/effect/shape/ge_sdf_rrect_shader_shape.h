@@ -61,8 +61,11 @@ public:
     }
 
     bool GetInscribedRect(Rect& rect) override;
+    bool GetBoundingRect(Rect& rect) override;
 
 private:
+    // Inlines the resolved radii into flattened shape trees
+    friend class GESDFShapeCompiler;
     using CornerRadii = std::array<Vector2f, GERRect::CORNER_COUNT>;
 
     bool UseUniformRadiusFastPath() const;
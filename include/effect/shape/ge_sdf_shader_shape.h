@@ -16,6 +16,8 @@
 #ifndef GRAPHICS_EFFECT_GE_SDF_SHAPE_H
 #define GRAPHICS_EFFECT_GE_SDF_SHAPE_H
 
+#include <algorithm>
+
 #include "ge_shader_shape.h"
 #include "common/rs_vector2.h"
 
@@ -38,6 +40,30 @@ enum class GESDFShapeType : uint8_t {
     MAX = SMOOTH_SUB_OP,
 };
 
+// What a consumer needs from the distance field, generated fields may be coarser within these bounds
+struct GESDFPrecisionHint {
+    // Distances beyond it only need to stay beyond it, 0 for the whole range
+    float maxDistance = 0.0f;
+    // Tolerated absolute error in pixels, 0 for full resolution
+    float maxError = 0.0f;
+
+    bool operator==(const GESDFPrecisionHint& other) const
+    {
+        return maxDistance == other.maxDistance && maxError == other.maxError;
+    }
+
+    bool operator!=(const GESDFPrecisionHint& other) const
+    {
+        return !(*this == other);
+    }
+
+    // Same hint for an operand that is blended with another one up to spacing away
+    GESDFPrecisionHint Widen(float spacing) const
+    {
+        return { maxDistance > 0.0f ? maxDistance + std::max(spacing, 0.0f) : 0.0f, maxError };
+    }
+};
+
 class GE_EXPORT GESDFShaderShape : public GEShaderShape {
 public:
     GESDFShaderShape() = default;
@@ -55,8 +81,13 @@ public:
     virtual bool HasType(const GESDFShapeType type) const = 0;
     void CopyState(const GESDFShaderShape& shape);
     virtual bool GetInscribedRect(Rect& rect) override {return false;}
+    // Applies to the following Preprocess calls, composite shapes pass it to their children
+    virtual void SetPrecisionHint(const GESDFPrecisionHint& hint) {}
     virtual std::shared_ptr<Drawing::Image> MakeSDFImage(Canvas& canvas, float width, float height,
         bool hasNormal = true);
+    // Same as MakeSDFImage, but the image holds area of the shape, pixel (0, 0) at its top left corner
+    std::shared_ptr<Drawing::Image> MakeSDFImage(Canvas& canvas, float width, float height, const RectI& area,
+        bool hasNormal);
 };
 } // Drawing
 } // namespace Rosen
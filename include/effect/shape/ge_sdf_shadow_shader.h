@@ -53,6 +53,14 @@ private:
     // Original SDF shadow methods
     std::shared_ptr<Drawing::RuntimeEffect> GetSDFShadowEffect();
     void UpdateRectForShadow(Drawing::Rect& rect);
+    // Intersects rect with the shape bounds grown by the shadow, false when no shadow pixel is left
+    bool ClipRectToShadowBounds(Drawing::Rect& rect) const;
+    // Points of the shape sampled when shading rect, at the pixels and behind the shadow offset
+    Drawing::Rect GetShapeSampleRect(const Drawing::Rect& rect) const;
+    // Distance from the shape at which the shadow has faded out
+    float GetShadowExtent() const;
+    // Filled shadows only read the soft falloff and tolerate a coarser distance field
+    Drawing::GESDFPrecisionHint GetShapePrecisionHint() const;
 
     // Elevation shadow methods
     void ComputeElevationParams();
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_SDF_SHAPE_COMPILER_H
+#define GRAPHICS_EFFECT_GE_SDF_SHAPE_COMPILER_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ge_sdf_shader_shape.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+
+/**
+ * @class GESDFShapeCompiler
+ * @brief Flattens a tree of SDF shapes into one generated shader with an inline distance function per node.
+ *
+ * Rounded rects, union, sub, smooth sub, transform and distort nodes are inlined. Any other subtree is generated by
+ * its own shape and evaluated as a child shader, so every tree compiles. The program only depends on the tree
+ * topology, per node parameters go in one flat vec4 uniform array, so trees differing only in parameters share one
+ * builder and one compiled effect.
+ */
+class GE_EXPORT GESDFShapeCompiler {
+public:
+    enum class NodeKind : uint8_t {
+        CHILD_SHADER = 0,
+        RRECT,          // Uniform circular corner radius
+        RRECT_CORNERS,  // Elliptic radius per corner
+        UNION,
+        SMOOTH_UNION,
+        SUB,
+        SMOOTH_SUB,
+        TRANSFORM,
+        DISTORT,
+    };
+
+    struct Node {
+        NodeKind kind = NodeKind::CHILD_SHADER;
+        int32_t left = -1;        // Only child of transform and distort nodes
+        int32_t right = -1;
+        uint32_t paramOffset = 0; // First vec4 of the node in Program::params
+        uint32_t childSlot = 0;   // Child shader of CHILD_SHADER nodes
+    };
+
+    struct Program {
+        bool hasNormal = false;
+        // Post order, the root last
+        std::vector<Node> nodes;
+        // vec4 slots, 4 floats each
+        std::vector<float> params;
+        std::vector<std::shared_ptr<ShaderEffect>> children;
+        // Topology of nodes, equal keys generate equal sources
+        std::string key;
+    };
+
+    // Deeper or larger trees are left to the nested shaders
+    static constexpr size_t MAX_NODES = 64;
+    static constexpr size_t MAX_PARAM_SLOTS = 128;
+
+    /**
+     * @brief Flatten the tree under root for a width x height target.
+     * @return false when the tree has no node to inline or is too large, program is then unspecified.
+     */
+    static bool Flatten(const GESDFShaderShape& root, float width, float height, bool hasNormal, Program& program);
+
+    // SkSL of a flattened program, shaders with the same key get the same source
+    static std::string GenerateSource(const Program& program);
+
+    /**
+     * @brief One shader evaluating the whole tree under root, its builder cached per thread by topology.
+     * @return nullptr when disabled, when the tree does not flatten or when the program fails, callers then nest
+     * their children.
+     */
+    static std::shared_ptr<ShaderEffect> GenerateDrawingShader(const GESDFShaderShape& root,
+        float width, float height, bool hasNormal);
+
+    // Set by persist.sys.graphic.effect.sdfcompile, on unless it is 0
+    static bool IsEnabled();
+
+private:
+    // Node index of shape, or -1 when it generates no shader
+    static int32_t AddShape(const std::shared_ptr<GESDFShaderShape>& shape, float width, float height,
+        Program& program);
+    // Same as AddShape, but returns -2 for a shape that can only be a child shader
+    static int32_t AddInlineShape(const GESDFShaderShape& shape, float width, float height, Program& program);
+    static int32_t AddChildShader(const GESDFShaderShape& shape, float width, float height, Program& program);
+    static int32_t AddSubOp(NodeKind kind, const std::shared_ptr<GESDFShaderShape>& leftShape,
+        const std::shared_ptr<GESDFShaderShape>& rightShape, float spacing, float width, float height,
+        Program& program);
+    static int32_t AddNode(NodeKind kind, int32_t left, int32_t right, std::initializer_list<float> params,
+        Program& program);
+};
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_SDF_SHAPE_COMPILER_H
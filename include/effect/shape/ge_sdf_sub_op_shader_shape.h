@@ -36,18 +36,30 @@ public:
     std::shared_ptr<ShaderEffect> GenerateDrawingShader(float width, float height) const override;
     std::shared_ptr<ShaderEffect> GenerateDrawingShaderHasNormal(float width, float height) const override;
     void Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal) override;
+    void SetPrecisionHint(const GESDFPrecisionHint& hint) override;
 
     GESDFShapeType GetSDFShapeType() const override
     {
         return GESDFShapeType::SUB_OP;
     }
 
+    inline const std::shared_ptr<GESDFShaderShape>& GetLeftSDFShape() const
+    {
+        return params_.left;
+    }
+
+    inline const std::shared_ptr<GESDFShaderShape>& GetRightSDFShape() const
+    {
+        return params_.right;
+    }
+
     void CopyState(const GESDFSubOpShaderShape& shape)
     {
         params_ = shape.params_;
     }
 
     bool HasType(const GESDFShapeType type) const override;
+    bool GetBoundingRect(Rect& rect) override;
 
 protected:
     GESDFSubOpShapeParams params_ {};
@@ -69,18 +81,35 @@ public:
     std::shared_ptr<ShaderEffect> GenerateDrawingShader(float width, float height) const override;
     std::shared_ptr<ShaderEffect> GenerateDrawingShaderHasNormal(float width, float height) const override;
     void Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal) override;
+    void SetPrecisionHint(const GESDFPrecisionHint& hint) override;
 
     GESDFShapeType GetSDFShapeType() const override
     {
         return GESDFShapeType::SMOOTH_SUB_OP;
     }
 
+    inline float GetSpacing() const
+    {
+        return params_.spacing;
+    }
+
+    inline const std::shared_ptr<GESDFShaderShape>& GetLeftSDFShape() const
+    {
+        return params_.left;
+    }
+
+    inline const std::shared_ptr<GESDFShaderShape>& GetRightSDFShape() const
+    {
+        return params_.right;
+    }
+
     void CopyState(const GESDFSmoothSubOpShaderShape& shape)
     {
         params_ = shape.params_;
     }
 
     bool HasType(const GESDFShapeType type) const override;
+    bool GetBoundingRect(Rect& rect) override;
 
 private:
     GESDFSmoothSubOpShapeParams params_ {};
@@ -37,6 +37,7 @@ public:
     std::shared_ptr<ShaderEffect> GenerateDrawingShader(float width, float height) const override;
     std::shared_ptr<ShaderEffect> GenerateDrawingShaderHasNormal(float width, float height) const override;
     void Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal) override;
+    void SetPrecisionHint(const GESDFPrecisionHint& hint) override;
     GESDFShapeType GetSDFShapeType() const override
     {
         return GESDFShapeType::TRANSFORM;
@@ -49,13 +50,36 @@ public:
         return params_.matrix;
     }
 
-    void CopyState(const GESDFTransformShaderShape& shape)
+    inline const std::shared_ptr<GESDFShaderShape>& GetSDFShape() const
     {
-        params_ = shape.params_;
+        return params_.shape;
     }
 
+    inline int GetUnionMode() const
+    {
+        return params_.unionMode;
+    }
+
+    // Keeps the current child when the new one is the same shape, so animating the matrix reuses its state
+    void CopyState(const GESDFTransformShaderShape& shape);
+
     bool HasType(const GESDFShapeType type) const override;
+    bool GetBoundingRect(Rect& rect) override;
 private:
+    struct ChildShaderCache {
+        std::shared_ptr<GESDFShaderShape> shape = nullptr;
+        uint32_t hash = 0;
+        float width = 0.0f;
+        float height = 0.0f;
+        GESDFPrecisionHint hint;
+        std::shared_ptr<ShaderEffect> shader = nullptr;
+    };
+
+    // Equal non zero hashes mark the same shape, shapes without a hash are never taken as unchanged
+    static bool IsSameShape(const std::shared_ptr<GESDFShaderShape>& shape, uint32_t hash,
+        const std::shared_ptr<GESDFShaderShape>& other);
+    // Child shader at width x height, reused while only the matrix changes
+    std::shared_ptr<ShaderEffect> GetChildShader(float width, float height, bool hasNormal) const;
     std::shared_ptr<ShaderEffect> GenerateGravityPullDrawingShader(float width, float height) const;
     std::shared_ptr<Drawing::RuntimeShaderBuilder> GetGravityPullDrawingShaderBuilder() const;
     std::shared_ptr<ShaderEffect> GenerateGravityPullDrawingShaderHasNormal(float width, float height) const;
@@ -65,6 +89,16 @@ private:
     std::shared_ptr<ShaderEffect> GenerateShaderEffect(float width, float height,
         std::shared_ptr<ShaderEffect> shapeShader, std::shared_ptr<Drawing::RuntimeShaderBuilder> builder) const;
     GESDFTransformShapeParams params_ {};
+    mutable ChildShaderCache childShaderCache_;
+    mutable ChildShaderCache childNormalShaderCache_;
+    // Last preprocess of the child, the normal variant also serves plain requests
+    std::shared_ptr<GESDFShaderShape> preprocessedShape_ = nullptr;
+    uint32_t preprocessedHash_ = 0;
+    Rect preprocessedRect_;
+    bool preprocessedNormal_ = false;
+    GESDFPrecisionHint preprocessedHint_;
+    // The child state is only reused under the hint it was made with
+    GESDFPrecisionHint precisionHint_;
 };
 } // Drawing
 } // namespace Rosen
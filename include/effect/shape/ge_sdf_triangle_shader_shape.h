@@ -70,6 +70,8 @@ public:
         return type == GESDFShapeType::TRIANGLE;
     }
 
+    bool GetBoundingRect(Rect& rect) override;
+
 private:
     std::shared_ptr<Drawing::RuntimeShaderBuilder> GetSDFTriangleShaderShapeBuilder() const;
     std::shared_ptr<Drawing::RuntimeShaderBuilder> GetSDFTriangleNormalShapeBuilder() const;
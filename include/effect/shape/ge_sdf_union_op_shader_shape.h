@@ -37,6 +37,7 @@ public:
     std::shared_ptr<ShaderEffect> GenerateDrawingShader(float width, float height) const override;
     std::shared_ptr<ShaderEffect> GenerateDrawingShaderHasNormal(float width, float height) const override;
     void Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal) override;
+    void SetPrecisionHint(const GESDFPrecisionHint& hint) override;
 
     GESDFShapeType GetSDFShapeType() const override
     {
@@ -70,6 +71,7 @@ public:
 
     bool HasType(const GESDFShapeType type) const override;
     bool GetInscribedRect(Rect& rect) override;
+    bool GetBoundingRect(Rect& rect) override;
 private:
     GESDFUnionOpShapeParams params_ {};
     std::shared_ptr<ShaderEffect> GenerateUnionOpDrawingShader(std::shared_ptr<ShaderEffect> leftShader,
@@ -36,6 +36,8 @@ public:
     virtual std::shared_ptr<ShaderEffect> GenerateDrawingShaderHasNormal(Canvas& canvas, float width, float height);
     virtual void Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal = false);
     virtual bool GetInscribedRect(Rect& rect) {return false;}
+    // Conservative box holding every point with a negative distance, false when the shape can not tell
+    virtual bool GetBoundingRect(Rect& rect) {return false;}
 
     void SetHash(uint32_t hash)
     {
@@ -14,6 +14,10 @@
  */
 #ifndef GRAPHICS_EFFECT_GE_CACHE_PROVIDER_H
 #define GRAPHICS_EFFECT_GE_CACHE_PROVIDER_H
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
 #include "ge_downcast.h"
 
 namespace OHOS {
@@ -21,12 +25,55 @@ namespace Rosen {
 
 struct IGECache : ExactDowncastUtils::ExactDowncastable {
     virtual ~IGECache() = default;
+
+    // Approximate memory held by the cache, used by providers with a byte budget
+    virtual size_t GetByteSize() const
+    {
+        return 0;
+    }
+
+    // Copy of the cache with its exact type, so providers holding several entries can keep what is stored.
+    // Caches not derived from GECache return nullptr and are rejected by such providers.
+    virtual std::shared_ptr<IGECache> Clone() const
+    {
+        return nullptr;
+    }
 };
 
 struct IGECacheProvider : ExactDowncastUtils::ExactDowncastable {
+    // Key used by Store(cache), keyed providers keep it apart from the keys chosen by effects
+    static constexpr uint64_t DEFAULT_KEY = 0;
+
     virtual ~IGECacheProvider() = default;
     virtual const IGECache* GetFirst() const = 0;
     virtual bool Store(const IGECache& cache) = 0;
+
+    /**
+     * @brief Look up the cache of exact type typeId stored under key.
+     * The default implementation is for single-slot providers: the key is ignored and the only slot is returned
+     * when its type matches.
+     */
+    virtual const IGECache* GetByKey(ExactDowncastUtils::TypeID typeId, uint64_t key) const
+    {
+        auto cache = GetFirst();
+        return (cache != nullptr && cache->GetExactTypeID() == typeId) ? cache : nullptr;
+    }
+
+    /**
+     * @brief Store cache under key, next to the caches stored under other keys.
+     * The default implementation is for single-slot providers: the key is ignored and the only slot is overwritten.
+     */
+    virtual bool StoreByKey(const IGECache& cache, uint64_t key)
+    {
+        return Store(cache);
+    }
+
+    template<typename T>
+    const T* GetByKeyAs(uint64_t key) const
+    {
+        auto cache = GetByKey(ExactDowncastUtils::TypeID::Get<T>(), key);
+        return cache != nullptr ? cache->template As<T>() : nullptr;
+    }
 };
 
 template<typename Derived>
@@ -35,6 +82,11 @@ struct GECache : IGECache {
     {
         return ExactDowncastUtils::TypeID::Get<Derived>();
     }
+
+    std::shared_ptr<IGECache> Clone() const override
+    {
+        return std::make_shared<Derived>(static_cast<const Derived&>(*this));
+    }
 };
 
 template<typename Derived>
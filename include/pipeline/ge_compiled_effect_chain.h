@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_COMPILED_EFFECT_CHAIN_H
+#define GRAPHICS_EFFECT_GE_COMPILED_EFFECT_CHAIN_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ge_filter_type.h"
+#include "ge_shader_filter.h"
+#include "ge_visual_effect_container.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+class GEVisualEffectImpl;
+} // namespace Drawing
+
+/**
+ * @brief Filter instances compiled from a GEVisualEffectContainer and kept alive across frames.
+ *
+ * Each node remembers the GEVisualEffectImpl it was built from together with the filter type and params generation
+ * seen at build time. Update() keeps nodes whose effect is unchanged and only calls GEEffectFactory::CreateFilter for
+ * new or modified effects, so a chain re-applied every frame with identical params costs no allocation.
+ *
+ * Only filters reporting GEShaderFilter::IsReusableAcrossFrames() are kept. Other filters are created once to learn
+ * that, handed out by the next AcquireFilter() call and never compiled again, leaving their per-frame creation to the
+ * caller. Per-frame state (canvas info, headroom, cache, cache provider) is not part of a node and must be re-applied
+ * by the caller before each use.
+ */
+class GECompiledEffectChain {
+public:
+    GECompiledEffectChain() = default;
+    ~GECompiledEffectChain() = default;
+
+    /**
+     * @brief Synchronize the nodes with the effects currently in veContainer.
+     * Nodes of effects no longer present in veContainer are released.
+     * @return Number of filters created by this update, 0 when every node was up to date.
+     */
+    size_t Update(const Drawing::GEVisualEffectContainer& veContainer);
+
+    /**
+     * @brief Get the compiled filter of an effect.
+     * @return The filter built for impl, or nullptr when impl has no up to date node. A filter that is not reusable
+     *         is only returned once, later calls return nullptr.
+     */
+    std::shared_ptr<GEShaderFilter> AcquireFilter(const std::shared_ptr<Drawing::GEVisualEffectImpl>& impl);
+
+    size_t GetNodeCount() const
+    {
+        return nodes_.size();
+    }
+
+    void Clear();
+
+private:
+    struct Node {
+        std::weak_ptr<Drawing::GEVisualEffectImpl> impl;
+        Drawing::GEFilterType type = Drawing::GEFilterType::NONE;
+        uint64_t generation = 0;
+        bool reusable = false;
+        std::shared_ptr<GEShaderFilter> filter;
+    };
+
+    static bool IsNodeUpToDate(const Node& node, const std::shared_ptr<Drawing::GEVisualEffectImpl>& impl);
+    std::vector<Node>::iterator FindNode(const std::shared_ptr<Drawing::GEVisualEffectImpl>& impl);
+
+    std::vector<Node> nodes_;
+    // Kawase blur is created as MESA blur once this switch is on, so nodes built before the switch are stale.
+    bool mesaBlurAllEnabled_ = false;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_COMPILED_EFFECT_CHAIN_H
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_FILTER_FUSION_PASS_H
+#define GRAPHICS_EFFECT_GE_FILTER_FUSION_PASS_H
+
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "ge_common.h"
+#include "ge_filter_composer_pass.h"
+#include "ge_filter_type.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @brief Rewrites two adjacent effects of the given types into a single effect.
+ *
+ * rewrite returns nullptr when the params of the pair do not allow the fusion (e.g. missing params, or a stretch
+ * that would not commute with the effect before it), the pair is then left untouched.
+ */
+struct GEFilterFusionRule {
+    using Rewrite = std::function<std::shared_ptr<Drawing::GEVisualEffect>(
+        const Drawing::GEVisualEffectImpl& first, const Drawing::GEVisualEffectImpl& second)>;
+
+    std::string_view name; // Log and test only
+    Drawing::GEFilterType first;
+    Drawing::GEFilterType second;
+    Rewrite rewrite;
+};
+
+/**
+ * @class GEFilterFusionPass
+ * @brief Fuses adjacent GEVisualEffects with a table of GEFilterFusionRule, each fusion saving an offscreen pass
+ * and its full-size intermediate image.
+ *
+ * Composables are scanned left to right and each one is fused with the result accumulated before it, so chains fold
+ * into one effect (e.g. grey, blur, blur becomes one MESA blur). Rules are tried in table order, the first one whose
+ * types match and whose rewrite succeeds wins. HPS effects and effects without impl are never fused. The fused effect
+ * takes the canvas info and headroom of the first effect of the pair, and its cache when both are the same filter.
+ *
+ * Default rules:
+ * - GreyKawaseToMesa, GreyMesaToMesa: grey before a blur becomes the grey stage of a MESA blur. Grey is a non-linear
+ *   curve, so a grey after a blur is not fused.
+ * - KawaseKawase, MesaMesa, KawaseMesa, MesaKawase: consecutive isotropic blurs become one blur whose Gaussian
+ *   variance is the sum of theirs. Directional blurs, and a MESA stretch or grey on the second blur, block fusion.
+ */
+class GEFilterFusionPass : public GEFilterComposerPass {
+public:
+    GEFilterFusionPass();
+    explicit GEFilterFusionPass(std::vector<GEFilterFusionRule> rules);
+
+    std::string_view GetLogName() const override;
+    GEFilterComposerPassResult Run(std::vector<GEFilterComposable>& composables) override;
+
+    // Names of the rules fired by the last Run, in firing order
+    const std::vector<std::string_view>& GetFiredRules() const
+    {
+        return firedRules_;
+    }
+
+    static const std::vector<GEFilterFusionRule>& GetDefaultRules();
+    // The default rules with the given names, in table order
+    static std::vector<GEFilterFusionRule> SelectDefaultRules(std::initializer_list<std::string_view> names);
+    // The default rules GERender applies: the blur + blur rules only approximate the chain they replace, so they are
+    // left out unless IsBlurFusionEnabled
+    static std::vector<GEFilterFusionRule> GetRenderRules();
+    // Set by persist.sys.graphic.effect.blurfusion, off unless it is 1
+    static GE_EXPORT bool IsBlurFusionEnabled();
+
+    // Radius of a single blur equivalent to blurring with radius1 then radius2
+    static int CombineBlurRadius(int radius1, int radius2);
+
+private:
+    std::shared_ptr<Drawing::GEVisualEffect> TryFuse(GEFilterComposable& first, GEFilterComposable& second);
+
+    std::vector<GEFilterFusionRule> rules_;
+    std::vector<std::string_view> firedRules_;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+#endif // GRAPHICS_EFFECT_GE_FILTER_FUSION_PASS_H
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_FILTER_RESULT_CACHE_H
+#define GRAPHICS_EFFECT_GE_FILTER_RESULT_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "ge_filter_type.h"
+#include "image/image.h"
+#include "utils/rect.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @brief LRU cache of GEShaderFilter output images, reused across frames when the inputs of a filter are unchanged.
+ *
+ * An entry is keyed on everything ProcessImage depends on: filter type, params content hash, input image unique ID,
+ * src and dst rects, and a hash of the per-frame state (canvas matrix, canvas info, headroom) computed by the caller.
+ * Entries are evicted least recently used first once the byte size of the cached images exceeds the budget.
+ */
+class GEFilterResultCache {
+public:
+    static constexpr size_t DEFAULT_BYTE_BUDGET = 32 * 1024 * 1024; // 32MB: about four full screen RGBA images
+
+    struct Key {
+        Drawing::GEFilterType type = Drawing::GEFilterType::NONE;
+        uint64_t paramsHash = 0;
+        uint32_t imageId = 0;
+        Drawing::Rect src {};
+        Drawing::Rect dst {};
+        uint64_t stateHash = 0;
+
+        bool operator==(const Key& other) const;
+    };
+
+    explicit GEFilterResultCache(size_t byteBudget = DEFAULT_BYTE_BUDGET) : byteBudget_(byteBudget) {}
+    ~GEFilterResultCache() = default;
+
+    /**
+     * @brief Look up the output image for key, counting a hit or a miss.
+     * @return The cached image, or nullptr on a miss.
+     */
+    std::shared_ptr<Drawing::Image> Find(const Key& key);
+
+    /**
+     * @brief Insert or replace the output image for key, then evict until the budget is met.
+     * @param retained Objects hashed by identity into key.paramsHash, kept alive with the entry.
+     * @return False when image is null or larger than the whole budget.
+     */
+    bool Store(const Key& key, const std::shared_ptr<Drawing::Image>& image,
+        std::vector<std::shared_ptr<const void>> retained = {});
+
+    // Drop every entry computed from the input image imageId
+    void InvalidateImage(uint32_t imageId);
+    // Drop every entry of filter type
+    void InvalidateType(Drawing::GEFilterType type);
+    void Clear();
+
+    void SetByteBudget(size_t byteBudget);
+
+    size_t GetByteBudget() const
+    {
+        return byteBudget_;
+    }
+
+    size_t GetUsedBytes() const
+    {
+        return usedBytes_;
+    }
+
+    size_t GetEntryCount() const
+    {
+        return entries_.size();
+    }
+
+    uint64_t GetHitCount() const
+    {
+        return hitCount_;
+    }
+
+    uint64_t GetMissCount() const
+    {
+        return missCount_;
+    }
+
+    void ResetStats()
+    {
+        hitCount_ = 0;
+        missCount_ = 0;
+    }
+
+    static size_t GetImageBytes(const Drawing::Image& image);
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+
+    struct Entry {
+        Key key;
+        std::shared_ptr<Drawing::Image> image;
+        size_t bytes = 0;
+        std::vector<std::shared_ptr<const void>> retained;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    template<typename Predicate>
+    void EraseIf(Predicate predicate);
+    void EraseEntry(EntryList::iterator it);
+    void EvictToBudget();
+
+    size_t byteBudget_ = DEFAULT_BYTE_BUDGET;
+    size_t usedBytes_ = 0;
+    uint64_t hitCount_ = 0;
+    uint64_t missCount_ = 0;
+    EntryList entries_; // Most recently used first
+    std::unordered_map<Key, EntryList::iterator, KeyHash> index_;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_FILTER_RESULT_CACHE_H
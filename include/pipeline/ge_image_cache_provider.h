@@ -24,6 +24,24 @@ namespace Rosen {
 
 struct GEImageCache : GECache<GEImageCache> {
     std::shared_ptr<Drawing::Image> data;
+
+    size_t GetByteSize() const override
+    {
+        return data != nullptr ? GetImageBytes(*data) : 0;
+    }
+
+    static size_t GetImageBytes(const Drawing::Image& image)
+    {
+        constexpr size_t defaultBytesPerPixel = 4; // RGBA8888
+        int width = image.GetWidth();
+        int height = image.GetHeight();
+        if (width <= 0 || height <= 0) {
+            return 0;
+        }
+        int bytesPerPixel = image.GetImageInfo().GetBytesPerPixel();
+        size_t pixelBytes = bytesPerPixel > 0 ? static_cast<size_t>(bytesPerPixel) : defaultBytesPerPixel;
+        return static_cast<size_t>(width) * static_cast<size_t>(height) * pixelBytes;
+    }
 };
 
 class GEImageCacheProvider : public GECacheProvider<GEImageCacheProvider> {
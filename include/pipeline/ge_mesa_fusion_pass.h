@@ -15,20 +15,16 @@
 
 #ifndef GRAPHICS_EFFECT_GE_MESA_FUSION_PASS_H
 #define GRAPHICS_EFFECT_GE_MESA_FUSION_PASS_H
-#include "ge_filter_composer_pass.h"
+#include "ge_filter_fusion_pass.h"
 
 namespace OHOS {
 namespace Rosen {
 
-class GEMesaFusionPass : public GEFilterComposerPass {
+// GEFilterFusionPass with only its GreyKawaseToMesa rule: adjacent GREY and KAWASE_BLUR become one MESA_BLUR
+class GEMesaFusionPass : public GEFilterFusionPass {
 public:
+    GEMesaFusionPass();
     std::string_view GetLogName() const override;
-    GEFilterComposerPassResult Run(std::vector<GEFilterComposable>& composables) override;
-
-private:
-    static std::shared_ptr<Drawing::GEVisualEffect> ComposeGreyKawase(
-        const std::shared_ptr<Drawing::GEGreyShaderFilterParams>& greyParams,
-        const std::shared_ptr<Drawing::GEKawaseBlurShaderFilterParams>& blurParams);
 };
 } // namespace Rosen
 } // namespace OHOS
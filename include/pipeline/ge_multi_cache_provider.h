@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_MULTI_CACHE_PROVIDER_H
+#define GRAPHICS_EFFECT_GE_MULTI_CACHE_PROVIDER_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+
+#include "ge_cache_provider.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @brief Cache provider holding several caches of any type, each stored under its exact type and a key.
+ *
+ * Stored caches are cloned. The total GetByteSize() of the entries is kept within a byte budget by evicting either
+ * the least recently used entry or the largest one. Store(cache) and GetFirst() keep the single-slot behaviour of
+ * IGECacheProvider: they use DEFAULT_KEY and the most recently used entry respectively.
+ */
+class GEMultiCacheProvider : public GECacheProvider<GEMultiCacheProvider> {
+public:
+    enum class EvictionPolicy {
+        LRU,  // Least recently stored or looked up entry first
+        COST, // Largest entry first, least recently used among equals
+    };
+
+    static constexpr size_t DEFAULT_BYTE_BUDGET = 16 * 1024 * 1024; // 16MB: a few downsampled full screen images
+    static constexpr size_t DEFAULT_MAX_ENTRIES = 16;
+
+    explicit GEMultiCacheProvider(size_t byteBudget = DEFAULT_BYTE_BUDGET, size_t maxEntries = DEFAULT_MAX_ENTRIES,
+        EvictionPolicy policy = EvictionPolicy::LRU)
+        : byteBudget_(byteBudget), maxEntries_(maxEntries), policy_(policy)
+    {}
+    ~GEMultiCacheProvider() override = default;
+
+    const IGECache* GetFirst() const override;
+    bool Store(const IGECache& cache) override;
+    const IGECache* GetByKey(ExactDowncastUtils::TypeID typeId, uint64_t key) const override;
+    bool StoreByKey(const IGECache& cache, uint64_t key) override;
+
+    // Drop the entry of exact type typeId stored under key, returns false if there is none
+    bool Erase(ExactDowncastUtils::TypeID typeId, uint64_t key);
+    void Clear();
+
+    void SetByteBudget(size_t byteBudget);
+    void SetMaxEntries(size_t maxEntries);
+    void SetEvictionPolicy(EvictionPolicy policy);
+
+    size_t GetByteBudget() const
+    {
+        return byteBudget_;
+    }
+
+    size_t GetUsedBytes() const
+    {
+        return usedBytes_;
+    }
+
+    size_t GetEntryCount() const
+    {
+        return entries_.size();
+    }
+
+private:
+    struct Entry {
+        ExactDowncastUtils::TypeID::RawTypeID typeId = 0;
+        uint64_t key = 0;
+        std::shared_ptr<IGECache> cache;
+        size_t bytes = 0;
+    };
+
+    using EntryList = std::list<Entry>;
+
+    EntryList::iterator FindEntry(ExactDowncastUtils::TypeID::RawTypeID typeId, uint64_t key) const;
+    EntryList::iterator PickVictim();
+    void EvictToBudget();
+
+    size_t byteBudget_ = DEFAULT_BYTE_BUDGET;
+    size_t maxEntries_ = DEFAULT_MAX_ENTRIES;
+    EvictionPolicy policy_ = EvictionPolicy::LRU;
+    size_t usedBytes_ = 0;
+    // Most recently used first. Providers hold few entries, a linear scan is enough.
+    // mutable: GetByKey is const to its callers but moves the entry it finds to the front, so a lookup counts as a
+    // use for LRU eviction. Like the rest of the provider this is not thread safe, concurrent lookups need a lock.
+    mutable EntryList entries_;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_MULTI_CACHE_PROVIDER_H
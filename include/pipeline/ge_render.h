@@ -17,6 +17,8 @@
 #define GRAPHICS_EFFECT_GE_RENDER_H
 
 #include <memory>
+#include <optional>
+#include <vector>
 
 #include "ge_cache_provider.h"
 #include "draw/brush.h"
@@ -25,7 +27,9 @@
 #include "effect/color_filter.h"
 #include "effect/runtime_effect.h"
 #include "effect/runtime_shader_builder.h"
+#include "ge_compiled_effect_chain.h"
 #include "ge_filter_composer_pass.h"
+#include "ge_filter_result_cache.h"
 #include "ge_hps_effect_filter.h"
 #include "ge_shader.h"
 #include "ge_shader_filter.h"
@@ -53,6 +57,9 @@ public:
         Drawing::Rect src {};
         Drawing::Rect dst {};
         IGECacheProvider* geCacheProvider {};
+        // Area of image changed since the previous frame, see GEShaderFilter::SetDirtyRect; only the first filter
+        // reading image gets it
+        std::optional<Drawing::Rect> dirtyRect {};
     };
     /**
      * @brief Applies a sequence of visual effects to an image using the GE (Graphics Effect) pipeline.
@@ -61,7 +68,11 @@ public:
      * and applies them sequentially to an input image. Each effect is applied via GEShaderFilter,
      * with the output of one effect serving as the input to the next. It leverages
      * the GEShaderFilter mechanism to handle rendering, with proper cache management and
-     * compatibility handling for legacy use cases.
+     * compatibility handling for legacy use cases. Filters are taken from a GECompiledEffectChain owned by this
+     * GERender, so keeping one GERender per effect chain avoids re-creating unchanged filters on every frame.
+     * Consecutive filters supporting shader chaining (see GEShaderFilter::SupportsShaderChaining) are nested as
+     * shaders and drawn in one pass, without an intermediate image between them. Chaining is off while the filter
+     * result cache is enabled, as it needs the output of each filter.
      *
      * @note The function assumes the input image is valid and non-null. If any effect fails
      *       to generate a valid shader or filter, the process continues but may result in
@@ -165,6 +176,26 @@ public:
         return expansionRect_;
     }
 
+    /**
+     * @brief Enable or disable reusing filter outputs across frames in ApplyImageEffect and ApplyHpsGEImageEffect.
+     *
+     * When enabled, the output image of each effect applied through ProcessShaderFilter is cached, keyed on the filter
+     * type, the params content hash, the input image and the rendering state. An effect whose inputs are unchanged
+     * since a previous frame then skips its filter entirely. Disabled by default; disabling drops every entry.
+     * Effects with params that cannot be hashed, with a cache provider or with filter cache disabled in their canvas
+     * info are never cached.
+     *
+     * @param enabled Whether the cache is used.
+     * @param byteBudget Upper bound of the bytes held by cached images.
+     */
+    void SetFilterResultCacheEnabled(bool enabled, size_t byteBudget = GEFilterResultCache::DEFAULT_BYTE_BUDGET);
+
+    // Null when the filter result cache is disabled
+    GEFilterResultCache* GetFilterResultCache()
+    {
+        return filterResultCache_.get();
+    }
+
     static void SetMesablurAllEnabledByCCM(bool flag);
     static bool IsMesablurAllEnabled() { return isMesablurAllEnable_; }
 
@@ -174,7 +205,8 @@ private:
 
     /**
      * @brief Shader filter creation, set flags and prepare works before execute the shader filter.
-     * This function generates a GEShaderFilter from visualEffect and handle the cache/process/draw pipeline.
+     * This function takes the compiled GEShaderFilter of visualEffect, or generates one when it is not compiled,
+     * and handle the cache/process/draw pipeline.
      * Used as an internal helper of GEShaderFilter pipeline.
      * @see ProcessShaderFilter for drawing on the image.
      * @see DrawShaderFilter for drawing on the canvas.
@@ -193,6 +225,34 @@ private:
     bool AfterApplyShaderFilter(Drawing::Canvas& canvas, const Drawing::GEVisualEffect& visualEffect,
         const ShaderFilterEffectContext& context, const GEShaderFilter& geShaderFilter);
 
+    // Record the expansion area of effects that draw outside of their source (e.g. GASIFY)
+    void UpdateExpansionState(Drawing::GEFilterType type, const Drawing::Rect& src);
+
+    /**
+     * @brief Build the GEFilterResultCache key of visualEffect applied on context.image.
+     * @return False if the output of visualEffect must not be cached.
+     */
+    bool MakeFilterResultCacheKey(Drawing::Canvas& canvas, const Drawing::GEVisualEffect& visualEffect,
+        const ShaderFilterEffectContext& context, GEFilterResultCache::Key& outKey,
+        const Drawing::GEParamsHash*& outParamsHash);
+
+    struct ChainedShaderFilter {
+        std::shared_ptr<Drawing::GEVisualEffect> visualEffect;
+        std::shared_ptr<GEShaderFilter> geShaderFilter;
+    };
+
+    /**
+     * @brief Apply a run of filters supporting shader chaining on resImage, and clear chain.
+     * Filters of chain already went through BeforeApplyShaderFilter. Their shaders are nested and drawn into one
+     * image, a filter failing to make its shader draws the run before it and falls back to ProcessImage.
+     */
+    void ApplyShaderChain(Drawing::Canvas& canvas, std::vector<ChainedShaderFilter>& chain,
+        std::shared_ptr<Drawing::Image>& resImage, const ShaderFilterEffectContext& context);
+
+    // Dirty rect of context for a filter reading image, std::nullopt once an earlier filter changed the image
+    static std::optional<Drawing::Rect> GetDirtyRect(const ShaderFilterEffectContext& context,
+        const std::shared_ptr<Drawing::Image>& image);
+
     // Internal helper for dispatching between ProcessShaderFilter and DrawShaderFilter.
     // Used in ApplyHpsGEImageEffect only.
     ApplyShaderFilterTarget DispatchGEShaderFilter(Drawing::Canvas& canvas, Drawing::Brush& brush,
@@ -230,6 +290,8 @@ private:
 
     bool isNeedExpansionFilter_ = false;
     Drawing::Rect expansionRect_ {};
+    GECompiledEffectChain compiledChain_;
+    std::unique_ptr<GEFilterResultCache> filterResultCache_;
 };
 
 } // namespace GraphicsEffectEngine
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_SHADER_PREWARM_H
+#define GRAPHICS_EFFECT_GE_SHADER_PREWARM_H
+
+#include <cstdint>
+#include <vector>
+
+#include "ge_common.h"
+#include "ge_effect_factory.h"
+#include "ge_filter_type.h"
+#include "ge_runtime_effect_registry.h"
+
+namespace OHOS {
+namespace GraphicsEffectEngine {
+
+/**
+ * @brief Compiles the SkSL programs of every effect registered in GEEffectFactory ahead of their first frame.
+ *
+ * Each registered effect is created with default params and run once on a small raster canvas, which walks its
+ * normal code path and compiles its runtime effects through GERuntimeEffectRegistry. Later uses on any thread then
+ * find them compiled. Effects are spread over a pool of worker threads, each run on its own canvas.
+ *
+ * Effects of UNKNOWN category (implemented by external libraries) are skipped. Code paths not reached with default
+ * params (e.g. blur with radius 0) compile lazily as before.
+ *
+ * @note Run before rendering starts: some effects keep their compiled programs in plain statics.
+ */
+class GE_EXPORT GEShaderPrewarm {
+public:
+    struct EffectReport {
+        Rosen::Drawing::GEFilterType type = Rosen::Drawing::GEFilterType::NONE;
+        GEEffectCategory category = GEEffectCategory::UNKNOWN;
+        bool created = false;
+        uint64_t elapsedNs = 0;     // Creating and running the effect once
+        uint64_t compileCount = 0;  // Programs compiled by the registry for this effect, 0 when already compiled
+        uint64_t failureCount = 0;
+        uint64_t compileTimeNs = 0;
+    };
+
+    struct Report {
+        std::vector<EffectReport> effects; // In GEFilterType order
+        uint64_t wallTimeNs = 0;
+        uint32_t threadCount = 0;
+        Rosen::GERuntimeEffectRegistry::Stats registryStats; // Registry totals when the warm-up finished
+    };
+
+    // Size of the canvas and input image effects are run on, small to keep the raster work negligible
+    static constexpr int32_t CANVAS_SIZE = 16;
+
+    /**
+     * @brief Warm up every registered effect on threadCount worker threads.
+     * @param threadCount Clamped to [1, number of effects], 0 uses std::thread::hardware_concurrency().
+     */
+    static Report Run(uint32_t threadCount = 0);
+
+    // Warm up a single effect on the calling thread
+    static EffectReport RunEffect(Rosen::Drawing::GEFilterType type);
+
+    /**
+     * @brief Compile the programs stored in GEShaderDiskCache by earlier processes on threadCount worker threads.
+     *
+     * Also covers programs Run does not reach, e.g. ones only used with non-default params.
+     * @return Number of programs available in GERuntimeEffectRegistry afterwards, 0 when the disk cache is disabled.
+     */
+    static size_t RunDiskCache(uint32_t threadCount = 0);
+
+private:
+    GEShaderPrewarm() = delete;
+};
+
+} // namespace GraphicsEffectEngine
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_SHADER_PREWARM_H
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_CPU_BLUR_H
+#define GRAPHICS_EFFECT_GE_CPU_BLUR_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draw/canvas.h"
+#include "ge_common.h"
+#include "image/image.h"
+#include "utils/matrix.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @class GECpuBlur
+ * @brief Native passes of the Kawase and MESA blur filters for canvases without a GPU context.
+ *
+ * The raster backend evaluates runtime shaders per pixel through an interpreter. These passes compute the same taps
+ * with 4-lane float vectors, one RGBA pixel per vector (NEON on ARM, SSE on x86, scalar elsewhere), and split the
+ * rows of each pass over worker threads. Sampling is bilinear with clamped edges like the linear image shaders of
+ * the filters, so the filters keep their pass structure and only swap the backend.
+ */
+class GE_EXPORT GECpuBlur {
+public:
+    // Premultiplied RGBA, four floats per pixel, rows packed
+    struct Buffer {
+        int width = 0;
+        int height = 0;
+        std::vector<float> pixels;
+    };
+
+    // Point of the source sampled for a point of the destination, source = destination * scale + trans
+    struct Mapping {
+        float scaleX = 1.0f;
+        float scaleY = 1.0f;
+        float transX = 0.0f;
+        float transY = 0.0f;
+    };
+
+    // Whether the filters use these passes on canvases without a GPU context, set by
+    // persist.sys.graphic.effect.cpublur, on unless it is 0
+    static bool IsEnabled();
+    static bool ShouldUse(Drawing::Canvas& canvas);
+
+    /**
+     * @brief Mapping of an image shader with matrix, which maps the image into the destination.
+     * @return false for matrices with skew or perspective or which can not be inverted.
+     */
+    static bool MakeMapping(const Drawing::Matrix& shaderMatrix, Mapping& mapping);
+
+    // RGBA_F16 images are read as F16, every other one as RGBA_8888
+    static bool ReadImage(const std::shared_ptr<Drawing::Image>& image, Buffer& buffer);
+    // Written as RGBA_F16 when info asks for it, otherwise as RGBA_8888 clamped to [0, 1]
+    static std::shared_ptr<Drawing::Image> MakeImage(const Buffer& buffer, const Drawing::ImageInfo& info);
+
+    static void Resample(const Buffer& src, const Mapping& mapping, int width, int height, Buffer& dst);
+
+    // Center and four diagonal taps at offset, clamped to [0, maxX] x [0, maxY] of the destination first
+    static void KawasePass(const Buffer& src, const Mapping& mapping, float offset, float maxX, float maxY,
+        int width, int height, Buffer& dst);
+
+    // Four taps at (x, y), (-y, x), (-x, -y) and (y, -x) of offset
+    static void MesaPass(const Buffer& src, const Mapping& mapping, float offsetX, float offsetY, int width,
+        int height, Buffer& dst);
+
+    /**
+     * @brief Final pass of both filters: blurred mixed over original by mixFactor, plus the rgb dither noise of
+     * noiseFactor / 255 the mix shaders add.
+     * @param original Sampled only when mixFactor is below 1, may be nullptr otherwise.
+     */
+    static void MixAndDither(const Buffer& blurred, const Mapping& blurredMapping, const Buffer* original,
+        const Mapping& originalMapping, float mixFactor, float noiseFactor, int width, int height, Buffer& dst);
+
+    // Rows handed to a worker at a time
+    static constexpr int ROWS_PER_TASK = 32;
+    static constexpr unsigned int MAX_THREADS = 8;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_CPU_BLUR_H
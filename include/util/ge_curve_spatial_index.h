@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_CURVE_SPATIAL_INDEX_H
+#define GRAPHICS_EFFECT_GE_CURVE_SPATIAL_INDEX_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @class GECurveSpatialIndex
+ * @brief Quadtree partitioning a canvas into cells of few curves, from the pixel bounding box of each curve.
+ *
+ * Nodes live in one flat array in breadth first order, the children of a node contiguous in it, and the curves of
+ * each node are a contiguous range of one shared index buffer. Both buffers keep their capacity across builds, so an
+ * index rebuilt every frame stops allocating once it fits the curves. The curves of a node are in ascending order.
+ *
+ * A node is split when it holds more than maxCurvesPerLeaf curves, is larger than minNodeSize and is shallower than
+ * maxDepth. Each level visits every curve a bounded number of times, so Build is linear in the curve count. Children no
+ * curve touches are not created but recorded as empty cells.
+ */
+class GE_EXPORT GECurveSpatialIndex {
+public:
+    // Pixel space box {xmin, xmax, ymin, ymax}, boxes sharing an edge intersect
+    using Box = std::array<float, 4>;
+
+    static constexpr size_t XMIN_I = 0;
+    static constexpr size_t XMAX_I = 1;
+    static constexpr size_t YMIN_I = 2;
+    static constexpr size_t YMAX_I = 3;
+
+    struct Config {
+        uint32_t maxCurvesPerLeaf = 4;
+        float minNodeSize = 64.0f;
+        uint32_t maxDepth = 16;
+        // Split when either side is above minNodeSize, instead of both
+        bool splitEitherSide = false;
+        // Halve a node along its long side when its short side is at most minNodeSize, instead of in quadrants
+        bool halveThinNodes = false;
+        // Only keep the curves touching the root box in the root, instead of every curve
+        bool clipToRoot = false;
+    };
+
+    struct Node {
+        Box bbox {};
+        uint32_t firstIndex = 0;  // Curves of the node in GetIndices()
+        uint32_t indexCount = 0;
+        uint32_t firstChild = 0;  // Children of the node in GetNodes()
+        uint32_t childCount = 0;
+        uint32_t depth = 0;
+
+        bool IsLeaf() const
+        {
+            return childCount == 0;
+        }
+    };
+
+    GECurveSpatialIndex() = default;
+    explicit GECurveSpatialIndex(const Config& config) : config_(config) {}
+    ~GECurveSpatialIndex() = default;
+
+    const Config& GetConfig() const
+    {
+        return config_;
+    }
+
+    // Drops the nodes, keeping the buffers for the next Build
+    void Clear();
+
+    // Partition rootBox for curveBoxes from scratch
+    void Build(const std::vector<Box>& curveBoxes, const Box& rootBox);
+
+    /**
+     * @brief Move the curves in movedCurves to their new box in curveBoxes, keeping the nodes of the last Build.
+     *
+     * Only the nodes the moved curves enter or leave get their curves rewritten. Fails, leaving the index unchanged,
+     * when a fresh Build would split differently: another curve count or root box, a node crossing maxCurvesPerLeaf,
+     * a leaf left empty or an empty cell entered.
+     * @return true when the index now matches a fresh Build of curveBoxes.
+     */
+    bool Update(const std::vector<Box>& curveBoxes, const std::vector<uint32_t>& movedCurves, const Box& rootBox);
+
+    /**
+     * @brief Bring the index up to date with curveBoxes, with Update when only a few curves moved since the last
+     * Build or Update and with Build otherwise.
+     * @return true when Update was used.
+     */
+    bool Refresh(const std::vector<Box>& curveBoxes, const Box& rootBox);
+
+    const std::vector<Node>& GetNodes() const
+    {
+        return nodes_;
+    }
+
+    const std::vector<uint32_t>& GetIndices() const
+    {
+        return indices_;
+    }
+
+    // Leaf node ids in breadth first order
+    const std::vector<uint32_t>& GetLeaves() const
+    {
+        return leaves_;
+    }
+
+    // Children no curve touches, in creation order
+    const std::vector<Box>& GetEmptyCells() const
+    {
+        return emptyCells_;
+    }
+
+    const uint32_t* CurvesBegin(const Node& node) const
+    {
+        return indices_.data() + node.firstIndex;
+    }
+
+    const uint32_t* CurvesEnd(const Node& node) const
+    {
+        return indices_.data() + node.firstIndex + node.indexCount;
+    }
+
+    static bool Intersect(const Box& a, const Box& b)
+    {
+        return !(a[XMAX_I] < b[XMIN_I] || a[XMIN_I] > b[XMAX_I] || a[YMAX_I] < b[YMIN_I] || a[YMIN_I] > b[YMAX_I]);
+    }
+
+    // At most this fraction of the curves moved for Refresh to use Update
+    static constexpr uint32_t REFRESH_UPDATE_DIVISOR = 8;
+
+private:
+    bool NeedsSplit(const Node& node, size_t curveCount) const;
+    bool Contains(uint32_t nodeId, const Box& curveBox) const;
+    void SplitNode(uint32_t nodeId, const std::vector<Box>& curveBoxes);
+
+    Config config_;
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> indices_;
+    std::vector<uint32_t> leaves_;
+    std::vector<Box> emptyCells_;
+    // Boxes the index was built or updated with, to find the moved curves
+    std::vector<Box> curveBoxes_;
+    // Index buffer size after the last Build, Update appends the rewritten ranges and gives up past twice this
+    size_t builtIndexCount_ = 0;
+
+    // Refresh and Update scratch, kept to reuse their storage
+    std::vector<uint32_t> refreshScratch_;
+    std::vector<uint32_t> movedScratch_;
+    std::vector<std::array<uint32_t, 2>> enterScratch_;
+    std::vector<std::array<uint32_t, 2>> leaveScratch_;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_CURVE_SPATIAL_INDEX_H
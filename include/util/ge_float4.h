@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_FLOAT4_H
+#define GRAPHICS_EFFECT_GE_FLOAT4_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define GE_FLOAT4_NEON
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define GE_FLOAT4_SSE
+#endif
+
+namespace OHOS {
+namespace Rosen {
+
+// 4-lane float vector of the CPU passes: NEON on ARM, SSE on x86, scalar elsewhere
+#if defined(GE_FLOAT4_NEON)
+struct GEFloat4 {
+    static constexpr size_t LANES = 4;
+    float32x4_t v;
+    static GEFloat4 Load(const float* p) { return { vld1q_f32(p) }; }
+    static GEFloat4 Splat(float s) { return { vdupq_n_f32(s) }; }
+    void Store(float* p) const { vst1q_f32(p, v); }
+};
+inline GEFloat4 operator+(GEFloat4 a, GEFloat4 b) { return { vaddq_f32(a.v, b.v) }; }
+inline GEFloat4 operator-(GEFloat4 a, GEFloat4 b) { return { vsubq_f32(a.v, b.v) }; }
+inline GEFloat4 operator*(GEFloat4 a, GEFloat4 b) { return { vmulq_f32(a.v, b.v) }; }
+inline GEFloat4 Min(GEFloat4 a, GEFloat4 b) { return { vminq_f32(a.v, b.v) }; }
+inline GEFloat4 Max(GEFloat4 a, GEFloat4 b) { return { vmaxq_f32(a.v, b.v) }; }
+#if defined(__aarch64__)
+inline GEFloat4 Sqrt(GEFloat4 a) { return { vsqrtq_f32(a.v) }; }
+#else
+// ARMv7 NEON has no vector square root
+inline GEFloat4 Sqrt(GEFloat4 a)
+{
+    float lanes[GEFloat4::LANES];
+    a.Store(lanes);
+    for (float& lane : lanes) {
+        lane = std::sqrt(lane);
+    }
+    return GEFloat4::Load(lanes);
+}
+#endif
+#elif defined(GE_FLOAT4_SSE)
+struct GEFloat4 {
+    static constexpr size_t LANES = 4;
+    __m128 v;
+    static GEFloat4 Load(const float* p) { return { _mm_loadu_ps(p) }; }
+    static GEFloat4 Splat(float s) { return { _mm_set1_ps(s) }; }
+    void Store(float* p) const { _mm_storeu_ps(p, v); }
+};
+inline GEFloat4 operator+(GEFloat4 a, GEFloat4 b) { return { _mm_add_ps(a.v, b.v) }; }
+inline GEFloat4 operator-(GEFloat4 a, GEFloat4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+inline GEFloat4 operator*(GEFloat4 a, GEFloat4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+inline GEFloat4 Min(GEFloat4 a, GEFloat4 b) { return { _mm_min_ps(a.v, b.v) }; }
+inline GEFloat4 Max(GEFloat4 a, GEFloat4 b) { return { _mm_max_ps(a.v, b.v) }; }
+inline GEFloat4 Sqrt(GEFloat4 a) { return { _mm_sqrt_ps(a.v) }; }
+#else
+struct GEFloat4 {
+    static constexpr size_t LANES = 4;
+    float v[LANES];
+    static GEFloat4 Load(const float* p) { return { { p[0], p[1], p[2], p[3] } }; }
+    static GEFloat4 Splat(float s) { return { { s, s, s, s } }; }
+    void Store(float* p) const { std::copy(v, v + LANES, p); }
+};
+inline GEFloat4 operator+(GEFloat4 a, GEFloat4 b)
+{
+    return { { a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3] } };
+}
+inline GEFloat4 operator-(GEFloat4 a, GEFloat4 b)
+{
+    return { { a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3] } };
+}
+inline GEFloat4 operator*(GEFloat4 a, GEFloat4 b)
+{
+    return { { a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3] } };
+}
+inline GEFloat4 Min(GEFloat4 a, GEFloat4 b)
+{
+    return { { std::min(a.v[0], b.v[0]), std::min(a.v[1], b.v[1]), std::min(a.v[2], b.v[2]),
+        std::min(a.v[3], b.v[3]) } };
+}
+inline GEFloat4 Max(GEFloat4 a, GEFloat4 b)
+{
+    return { { std::max(a.v[0], b.v[0]), std::max(a.v[1], b.v[1]), std::max(a.v[2], b.v[2]),
+        std::max(a.v[3], b.v[3]) } };
+}
+inline GEFloat4 Sqrt(GEFloat4 a)
+{
+    return { { std::sqrt(a.v[0]), std::sqrt(a.v[1]), std::sqrt(a.v[2]), std::sqrt(a.v[3]) } };
+}
+#endif
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_FLOAT4_H
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_RUNTIME_EFFECT_REGISTRY_H
+#define GRAPHICS_EFFECT_GE_RUNTIME_EFFECT_REGISTRY_H
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "effect/runtime_effect.h"
+#include "ge_common.h"
+#include "ge_source_location.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @brief Process-wide cache of compiled RuntimeEffects, keyed by a hash of the SkSL source and compile options.
+ *
+ * Each distinct source is compiled once per process, by the first thread asking for it, through
+ * GECreateRuntimeEffectForShader (so shader diagnostics still see every compile). Lookups of already compiled
+ * effects take no lock: entries are published into a fixed-size open-addressing table with release stores and are
+ * never removed. Different sources compile in parallel, threads asking for a source being compiled wait for it.
+ * Compile failures are cached too, a source that fails once is not compiled again.
+ *
+ * RuntimeEffect is immutable once compiled and may be shared across threads. RuntimeShaderBuilder is not, callers
+ * keep building one per use (or per thread) from the shared effect.
+ */
+class GE_EXPORT GERuntimeEffectRegistry {
+public:
+    struct Stats {
+        uint64_t hitCount = 0;
+        uint64_t compileCount = 0;
+        uint64_t failureCount = 0;
+        uint64_t compileTimeNs = 0;
+        size_t entryCount = 0;
+    };
+
+    static GERuntimeEffectRegistry& GetInstance();
+
+    GERuntimeEffectRegistry(const GERuntimeEffectRegistry&) = delete;
+    GERuntimeEffectRegistry& operator=(const GERuntimeEffectRegistry&) = delete;
+
+    /**
+     * @brief Get the effect compiled from shaderSrc, compiling it on first use.
+     * @param srcLoc Forwarded to GECreateRuntimeEffectForShader on a compile, for diagnostics.
+     * @return The shared effect, or nullptr when shaderSrc does not compile.
+     */
+    std::shared_ptr<Drawing::RuntimeEffect> GetOrCreate(
+        const std::string& shaderSrc, const GESourceLocation& srcLoc = GESourceLocation::Current());
+
+    // Same as above, effects compiled with different options are distinct entries
+    std::shared_ptr<Drawing::RuntimeEffect> GetOrCreate(const std::string& shaderSrc,
+        const Drawing::RuntimeEffectOptions& options, const GESourceLocation& srcLoc = GESourceLocation::Current());
+
+    Stats GetStats() const;
+    void ResetStats();
+
+    // Compiles run on the calling thread since it started, only compileCount, failureCount and compileTimeNs are set
+    Stats GetThreadStats() const;
+
+private:
+    // Entries are kept for the process lifetime, the table holds up to this many and later ones go to overflow_
+    static constexpr size_t TABLE_SIZE = 1024;
+
+    struct Entry {
+        uint64_t key = 0;
+        uint32_t optionsKey = 0;
+        std::string source;
+        std::shared_ptr<Drawing::RuntimeEffect> effect;
+    };
+
+    // Source being compiled outside compileMutex_, source points to the compiling caller's string
+    struct PendingCompile {
+        uint64_t key = 0;
+        uint32_t optionsKey = 0;
+        const std::string* source = nullptr;
+    };
+
+    GERuntimeEffectRegistry() = default;
+    ~GERuntimeEffectRegistry() = default;
+
+    std::shared_ptr<Drawing::RuntimeEffect> GetOrCreateImpl(const std::string& shaderSrc,
+        const Drawing::RuntimeEffectOptions* options, const GESourceLocation& srcLoc);
+    const Entry* Find(uint64_t key, uint32_t optionsKey, const std::string& shaderSrc) const;
+    // Also searches overflow_, only called with compileMutex_ held
+    const Entry* FindLocked(uint64_t key, uint32_t optionsKey, const std::string& shaderSrc) const;
+    bool IsPendingLocked(uint64_t key, uint32_t optionsKey, const std::string& shaderSrc) const;
+    const Entry* Compile(uint64_t key, uint32_t optionsKey, const std::string& shaderSrc,
+        const Drawing::RuntimeEffectOptions* options, const GESourceLocation& srcLoc);
+    // Only called with compileMutex_ held, returns false when the table is full
+    bool Publish(const Entry* entry);
+
+    std::array<std::atomic<const Entry*>, TABLE_SIZE> table_ {};
+    std::mutex compileMutex_;
+    std::condition_variable compileDoneCv_;
+    // Guarded by compileMutex_, only used once the table is full
+    std::unordered_multimap<uint64_t, std::unique_ptr<Entry>> overflow_;
+    // Guarded by compileMutex_
+    std::vector<PendingCompile> pending_;
+    std::atomic<size_t> entryCount_ { 0 };
+    std::atomic<uint64_t> hitCount_ { 0 };
+    std::atomic<uint64_t> compileCount_ { 0 };
+    std::atomic<uint64_t> failureCount_ { 0 };
+    std::atomic<uint64_t> compileTimeNs_ { 0 };
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_RUNTIME_EFFECT_REGISTRY_H
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_SDF_CPU_GENERATOR_H
+#define GRAPHICS_EFFECT_GE_SDF_CPU_GENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @class GESDFCpuGenerator
+ * @brief CPU signed distance fields, from quadratic curves or from an alpha mask.
+ *
+ * Fields are row-major planes of width * height distances in pixels, sampled at pixel centers and negative inside.
+ * Nothing is shared between calls, so fields can be generated on worker threads ahead of the frame using them. The
+ * results are also the reference the GPU jump flooding passes are measured against in tests.
+ */
+class GE_EXPORT GESDFCpuGenerator {
+public:
+    enum class FillRule {
+        NON_ZERO,
+        EVEN_ODD,
+    };
+
+    // Quadratic curves as a structure of arrays in pixel space, count entries each. Lines repeat their start point
+    // as control point.
+    struct Curves {
+        const float* startX = nullptr;
+        const float* startY = nullptr;
+        const float* controlX = nullptr;
+        const float* controlY = nullptr;
+        const float* endX = nullptr;
+        const float* endY = nullptr;
+        size_t count = 0;
+    };
+
+    // Largest width * height accepted, a 4K x 4K field
+    static constexpr size_t MAX_PIXELS = 4096 * 4096;
+    // Distance written where the mask has no pixel on the other side of the edge
+    static constexpr float NO_EDGE_DISTANCE = 1e10f;
+
+    /**
+     * @brief Exact distance from each pixel center to the nearest curve, signed by the fill of curves.
+     *
+     * Contours are runs of curves sharing end points, an open contour is closed with a line for the fill like a path
+     * fill would. Only curves whose bounding box can be nearest are evaluated for each 16 x 16 tile.
+     * @return false, leaving distances untouched, for an invalid size or curve array.
+     */
+    static bool ComputeFromCurves(const Curves& curves, FillRule fillRule, int width, int height,
+        std::vector<float>& distances);
+
+    /**
+     * @brief Distance to the 0.5 alpha edge of a coverage mask, with a separable Felzenszwalb distance transform.
+     *
+     * Partial alpha places the edge inside its pixel. The alpha of pixel (x, y) is alpha[y * rowBytes + x *
+     * pixelStride], so the alpha channel of RGBA pixels is read in place.
+     * @return false, leaving distances untouched, for an invalid size or stride.
+     */
+    static bool ComputeFromAlpha(const uint8_t* alpha, size_t pixelStride, size_t rowBytes, int width, int height,
+        std::vector<float>& distances);
+
+    // Bilinear sample of a field at (x, y) in pixel coordinates, pixel centers at +0.5, edges clamped
+    static float Sample(const std::vector<float>& field, int width, int height, float x, float y);
+
+    // Whether the SDF producers use this generator instead of their GPU passes, set by
+    // persist.sys.graphic.effect.cpusdf: -1 for defaultValue, 0 to force off and 1 to force on
+    static bool IsEnabled(bool defaultValue);
+
+private:
+    // In place 1D squared distance transform of the n values of f, with v, z and out holding n + 1 entries
+    static void Transform1D(float* f, int n, std::vector<int>& v, std::vector<float>& z, std::vector<float>& out);
+    // In place 2D squared distance transform of a width x height plane, scratch holds another plane
+    static void Transform2D(std::vector<float>& plane, std::vector<float>& scratch, int width, int height);
+    static void ComputeSigns(const Curves& curves, FillRule fillRule, int width, int height,
+        std::vector<float>& distances);
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_SDF_CPU_GENERATOR_H
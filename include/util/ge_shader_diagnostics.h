@@ -74,6 +74,18 @@ GE_EXPORT std::shared_ptr<Drawing::RuntimeEffect> GECreateRuntimeEffectForShader
 GE_EXPORT std::shared_ptr<Drawing::RuntimeEffect> GECreateRuntimeEffectForShader(const std::string& shaderSrc,
     const Drawing::RuntimeEffectOptions& options, const GESourceLocation& srcLoc = GESourceLocation::Current());
 
+/**
+ * @brief SHA-256 of shaderSrc as lowercase hex, the name of the diagnostics and shader cache files of a source.
+ * @return Empty string if the digest cannot be computed.
+ */
+std::string GEComputeShaderHash(const std::string& shaderSrc);
+
+/**
+ * @brief Create path with O_CREAT|O_EXCL and write data to it, the way diagnostics files are written.
+ * @return False if the file already exists, on I/O errors, or if len exceeds the 128KB write cap.
+ */
+bool GEAtomicWriteFile(const char* path, const void* data, size_t len);
+
 /**
  * @brief Test-only override to force-enable or force-disable shader diagnostics.
  *
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef GRAPHICS_EFFECT_GE_SHADER_DISK_CACHE_H
+#define GRAPHICS_EFFECT_GE_SHADER_DISK_CACHE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "effect/runtime_effect.h"
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+
+constexpr const char* GE_SHADER_DISK_CACHE_DIR = "/data/service/el0/render_service/ge_shader_cache/";
+
+/**
+ * @brief Opt-in persistent cache of the SkSL sources that compiled successfully, so that a restarted process can
+ * compile them on worker threads (GEShaderPrewarm::RunDiskCache) before the render thread first needs them.
+ *
+ * Enabled by the system property "persist.sys.graphic.geShaderDiskCacheEnabled" (set to "1"). Each program is one
+ * file named by the SHA-256 of its source (GEComputeShaderHash) and its options, written once with
+ * GEAtomicWriteFile. A file holds a header (magic, format version, build id, options, source size) and the source.
+ *
+ * - Versioning: the build id hashes the system software version, files written by another build are removed.
+ * - Corruption: files whose header, size or source SHA-256 do not match their name are removed.
+ * - Size cap: programs past the byte budget are not stored.
+ * - Known sources: sources loaded or stored once in this process are skipped before hashing.
+ *
+ * Drawing::RuntimeEffect has no serialized form, so the cache keeps validated sources rather than compiled programs;
+ * the GPU binaries are cached by the GPU context's own persistent cache.
+ */
+class GE_EXPORT GEShaderDiskCache {
+public:
+    struct Record {
+        std::string source;
+        uint32_t optionsKey = 0; // See EncodeOptions
+    };
+
+    struct Stats {
+        uint64_t storeCount = 0;
+        uint64_t loadCount = 0;
+        uint64_t rejectedCount = 0; // Stale or corrupt files removed on load
+        size_t totalBytes = 0;
+    };
+
+    static constexpr size_t DEFAULT_MAX_BYTES = 4 * 1024 * 1024;
+
+    static GEShaderDiskCache& GetInstance();
+
+    GEShaderDiskCache(const GEShaderDiskCache&) = delete;
+    GEShaderDiskCache& operator=(const GEShaderDiskCache&) = delete;
+
+    bool IsEnabled() const;
+
+    /**
+     * @brief Persist a source that compiled, no-op when disabled or when it is already stored.
+     * @return True if a new file was written.
+     */
+    bool Store(const std::string& shaderSrc, uint32_t optionsKey);
+
+    /**
+     * @brief Store on a writer thread, so the caller pays for neither the hash nor the file I/O. Used by
+     * GERuntimeEffectRegistry after each compile, often on the render thread. Known sources are dropped right away.
+     */
+    void StoreAsync(const std::string& shaderSrc, uint32_t optionsKey);
+
+    // Blocks until the writer thread has handled every StoreAsync call made before
+    void WaitForPendingStores();
+
+    // All valid programs in the cache directory, empty when disabled
+    std::vector<Record> Load();
+
+    Stats GetStats() const;
+
+    // Bit set identifying compile options, 0 for a compile without options
+    static uint32_t EncodeOptions(const Drawing::RuntimeEffectOptions* options);
+    static Drawing::RuntimeEffectOptions DecodeOptions(uint32_t optionsKey);
+    static bool HasOptions(uint32_t optionsKey);
+
+    /**
+     * @brief Test-only: enable or disable the cache and point it to directory, bypassing the system property.
+     * @warning UNIT TEST ONLY, not synchronized with concurrent Store or Load calls.
+     */
+    void SetForTest(bool enabled, const std::string& directory, size_t maxBytes = DEFAULT_MAX_BYTES);
+
+private:
+    GEShaderDiskCache();
+    ~GEShaderDiskCache() = default;
+
+    std::string GetPath(const std::string& hash, uint32_t optionsKey) const;
+    // Cheap key of a source and its options, for knownSources_
+    static uint64_t GetSourceKey(const std::string& shaderSrc, uint32_t optionsKey);
+    // Store without the known source check
+    bool Write(const std::string& shaderSrc, uint32_t optionsKey);
+    void DrainPendingStores();
+    bool ReadRecord(const std::string& name, Record& record, size_t& fileSize) const;
+    // Only called with mutex_ held
+    void ScanLocked();
+
+    bool enabled_ = false;
+    std::string directory_ = GE_SHADER_DISK_CACHE_DIR;
+    size_t maxBytes_ = DEFAULT_MAX_BYTES;
+    uint64_t buildId_ = 0;
+
+    mutable std::mutex mutex_;
+    // Guarded by mutex_, bytes of the files in directory_ once scanned
+    bool scanned_ = false;
+    size_t totalBytes_ = 0;
+    std::atomic<uint64_t> storeCount_ { 0 };
+    std::atomic<uint64_t> loadCount_ { 0 };
+    std::atomic<uint64_t> rejectedCount_ { 0 };
+
+    // Never held while taking mutex_, so StoreAsync does not wait for a file write
+    std::mutex pendingMutex_;
+    std::condition_variable pendingDoneCv_;
+    // Guarded by pendingMutex_
+    std::unordered_set<uint64_t> knownSources_;
+    std::deque<Record> pendingStores_;
+    bool isWriterRunning_ = false;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_SHADER_DISK_CACHE_H
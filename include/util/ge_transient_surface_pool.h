@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_TRANSIENT_SURFACE_POOL_H
+#define GRAPHICS_EFFECT_GE_TRANSIENT_SURFACE_POOL_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "draw/canvas.h"
+#include "draw/surface.h"
+#include "effect/runtime_shader_builder.h"
+#include "ge_common.h"
+#include "image/image.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @class GETransientSurfacePool
+ * @brief Offscreen surfaces reused by the intermediate passes of the blur filters.
+ *
+ * RuntimeShaderBuilder::MakeImage allocates a new render target for every pass, so a Kawase or MESA blur churns
+ * several same-sized surfaces per frame. MakeImage draws the shader into a pooled surface of the same size, colour
+ * type, alpha type, colour space and GPU context instead and returns its snapshot. A surface is leased for as long
+ * as that snapshot is referenced and goes back to the pool when the pass reading it drops the image. Stages which
+ * only hand on a shader of the image lease the surface until the frame ends instead. Snapshots stay valid either
+ * way, a surface drawn into while an older snapshot is still sampled is copied first, which costs the allocation the
+ * pool saves but never the content.
+ *
+ * Pools are per thread and only lend inside frames, which nest like GESDFEvaluationCache frames and are opened by
+ * GERender around the filters of a container. A display frame runs one such frame per blurred node, so idle surfaces
+ * are found by time rather than by frame count: the outermost BeginFrame drops surfaces unused for IDLE_TIME, however
+ * many nodes were blurred meanwhile.
+ */
+class GE_EXPORT GETransientSurfacePool {
+public:
+    class GE_EXPORT FrameScope {
+    public:
+        FrameScope() { BeginFrame(); }
+        ~FrameScope() { EndFrame(); }
+        FrameScope(const FrameScope&) = delete;
+        FrameScope& operator=(const FrameScope&) = delete;
+    };
+
+    static void BeginFrame();
+    static void EndFrame();
+    static bool IsInFrame();
+
+    /**
+     * @brief Image of the shader of builder over info, like builder.MakeImage with the GPU context of canvas.
+     * @param holdUntilFrameEnd Keep the surface leased until the outermost EndFrame, for images only sampled
+     * through shaders made from them.
+     * @return An image drawn into a pooled surface inside frames on GPU canvases, otherwise the image of
+     * builder.MakeImage.
+     */
+    static std::shared_ptr<Drawing::Image> MakeImage(Drawing::Canvas& canvas, Drawing::RuntimeShaderBuilder& builder,
+        const Drawing::ImageInfo& info, bool holdUntilFrameEnd = false);
+
+    /**
+     * @brief Surface of info for a caller keeping it across frames, such as an output updated in place.
+     * @return An idle pooled surface of the same info and GPU context, taken out of the pool, otherwise a new one.
+     * nullptr on canvases without a GPU context.
+     */
+    static std::shared_ptr<Drawing::Surface> AcquireSurface(Drawing::Canvas& canvas, const Drawing::ImageInfo& info);
+    /**
+     * @brief Hands a surface of AcquireSurface back to the pool of the calling thread, dropped when it does not fit.
+     * @param snapshot Snapshot of the surface the caller still reads, the surface stays leased while it is alive.
+     */
+    static void ReleaseSurface(Drawing::Canvas& canvas, std::shared_ptr<Drawing::Surface> surface,
+        const Drawing::ImageInfo& info, const std::shared_ptr<Drawing::Image>& snapshot = nullptr);
+
+    // Drops every pooled surface of the calling thread, for memory pressure
+    static void Clear();
+    static size_t GetSurfaceCount();
+    static size_t GetPooledBytes();
+    // Render targets made by the pool of the calling thread so far, pooled or handed out
+    static uint64_t GetMadeSurfaceCount();
+
+    // Set by persist.sys.graphic.effect.blursurfacepool, on unless it is 0
+    static bool IsEnabled();
+
+    static constexpr std::chrono::milliseconds IDLE_TIME { 1000 };
+    // 64MB: about eight full screen RGBA images, surfaces past it are not kept
+    static constexpr size_t MAX_POOL_BYTES = 64 * 1024 * 1024;
+
+private:
+    struct Entry {
+        std::shared_ptr<Drawing::Surface> surface;
+        Drawing::ImageInfo info;
+        const void* context = nullptr;
+        // The surface is leased while its last snapshot is alive
+        std::weak_ptr<Drawing::Image> snapshot;
+        std::shared_ptr<Drawing::Image> frameHold;
+        uint64_t lastUsedFrame = 0;
+        std::chrono::steady_clock::time_point lastUsedTime {};
+        size_t bytes = 0;
+    };
+
+    struct PoolState {
+        uint32_t depth = 0;
+        uint64_t frame = 0;
+        // Start of the outermost frame, the use time of every surface it leases
+        std::chrono::steady_clock::time_point frameStart {};
+        std::vector<Entry> entries;
+        size_t bytes = 0;
+        uint64_t madeSurfaces = 0;
+    };
+
+    static PoolState& GetPoolState();
+    static bool IsSameInfo(const Drawing::ImageInfo& lhs, const Drawing::ImageInfo& rhs);
+    static size_t GetByteSize(const Drawing::ImageInfo& info);
+    static Entry* AcquireEntry(PoolState& state, Drawing::Canvas& canvas, const Drawing::ImageInfo& info);
+    static std::shared_ptr<Drawing::Surface> MakeSurface(PoolState& state, Drawing::Canvas& canvas,
+        const Drawing::ImageInfo& info);
+    static void Trim(PoolState& state, uint64_t minFrame, size_t byteBudget);
+    // Drops the idle surfaces last used before minTime
+    static void TrimIdle(PoolState& state, std::chrono::steady_clock::time_point minTime);
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_TRANSIENT_SURFACE_POOL_H
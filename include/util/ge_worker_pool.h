@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef GRAPHICS_EFFECT_GE_WORKER_POOL_H
+#define GRAPHICS_EFFECT_GE_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "ge_common.h"
+
+namespace OHOS {
+namespace Rosen {
+
+/**
+ * @brief Process-wide pool of persistent worker threads for short data-parallel CPU passes.
+ *
+ * Run splits a batch of tasks between the calling thread and up to helperCount pooled workers and returns once every
+ * task has finished, so callers keep the blocking semantics of spawning and joining threads without paying for the
+ * thread creation on each pass. Workers are started on first demand, up to MAX_WORKERS, and then sleep on a condition
+ * variable between batches. Batches from several threads may be in flight at once; the calling thread always works on
+ * its own batch, so a batch completes even when every worker is busy.
+ */
+class GE_EXPORT GEWorkerPool {
+public:
+    static constexpr unsigned int MAX_WORKERS = 7;
+
+    static GEWorkerPool& GetInstance();
+
+    GEWorkerPool(const GEWorkerPool&) = delete;
+    GEWorkerPool& operator=(const GEWorkerPool&) = delete;
+
+    // Calls task(i) once for each i in [0, taskCount), on the calling thread and up to helperCount workers
+    void Run(int taskCount, unsigned int helperCount, const std::function<void(int)>& task);
+
+    // Workers started so far
+    unsigned int GetWorkerCount();
+
+private:
+    struct Batch {
+        int taskCount = 0;
+        // Only dereferenced while a task index below taskCount is claimed, so while Run is still waiting
+        const std::function<void(int)>* task = nullptr;
+        std::atomic<int> nextTask { 0 };
+        std::atomic<int> finishedTasks { 0 };
+        std::mutex mutex;
+        std::condition_variable doneCv;
+    };
+
+    GEWorkerPool() = default;
+    ~GEWorkerPool() = default;
+
+    static void RunTasks(Batch& batch);
+    void WorkerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable wakeCv_;
+    // Guarded by mutex_, one entry per helper requested by a batch
+    std::deque<std::shared_ptr<Batch>> pending_;
+    unsigned int workerCount_ = 0;
+};
+
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // GRAPHICS_EFFECT_GE_WORKER_POOL_H
@@ -21,8 +21,9 @@ namespace OHOS {
 namespace GraphicsEffectEngine {
 
 std::array<std::optional<GEEffectFactory::EffectCreator>, GEEffectFactory::MAX_EFFECTS> GEEffectFactory::creators_;
+std::array<GEEffectCategory, GEEffectFactory::MAX_EFFECTS> GEEffectFactory::categories_ {};
 
-void GEEffectFactory::Register(Rosen::Drawing::GEFilterType type, EffectCreator&& creator)
+void GEEffectFactory::Register(Rosen::Drawing::GEFilterType type, EffectCreator&& creator, GEEffectCategory category)
 {
     if (type == Rosen::Drawing::GEFilterType::NONE) {
         return;  // NONE is invalid type
@@ -38,6 +39,19 @@ void GEEffectFactory::Register(Rosen::Drawing::GEFilterType type, EffectCreator&
         return;
     }
     creators_[index] = std::forward<EffectCreator>(creator);
+    categories_[index] = category;
+}
+
+bool GEEffectFactory::IsRegistered(Rosen::Drawing::GEFilterType type)
+{
+    const size_t index = static_cast<size_t>(type);
+    return index < MAX_EFFECTS && creators_[index].has_value();
+}
+
+GEEffectCategory GEEffectFactory::GetCategory(Rosen::Drawing::GEFilterType type)
+{
+    const size_t index = static_cast<size_t>(type);
+    return index < MAX_EFFECTS ? categories_[index] : GEEffectCategory::UNKNOWN;
 }
 
 std::shared_ptr<Rosen::Drawing::IGEFilterType> GEEffectFactory::Create(
@@ -151,7 +151,7 @@ GE_FACTORY_REGISTER_EXTERNAL_FALLBACK(VARIABLE_RADIUS_BLUR,
     ::OHOS::Rosen::GEVariableRadiusBlurShaderFilter)
 
 // 1.4 Custom registration
-GE_FACTORY_REGISTER_CUSTOM(KAWASE_BLUR,
+GE_FACTORY_REGISTER_CUSTOM(KAWASE_BLUR, FILTER,
     [](GEEffectFactory::VisualEffectImplPtr ve) -> std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType> {
         if (FactoryCheckNullptr(ve.get(), "KAWASE_BLUR: VisualEffectImpl")) {
             return nullptr;
@@ -177,7 +177,7 @@ GE_FACTORY_REGISTER_CUSTOM(KAWASE_BLUR,
         return std::make_shared<::OHOS::Rosen::GEMESABlurShaderFilter>(*mesaParams);
     })
 
-GE_FACTORY_REGISTER_CUSTOM(LINEAR_GRADIENT_BLUR,
+GE_FACTORY_REGISTER_CUSTOM(LINEAR_GRADIENT_BLUR, FILTER,
     [](GEEffectFactory::VisualEffectImplPtr ve) -> std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType> {
         if (FactoryCheckNullptr(ve.get(), "LINEAR_GRADIENT_BLUR: VisualEffectImpl")) {
             return nullptr;
@@ -280,7 +280,7 @@ GE_FACTORY_REGISTER_SHAPE(GESDFSubOpShaderShape)
 GE_FACTORY_REGISTER_SHAPE(GESDFSmoothSubOpShaderShape)
 
 // 4.2 Custom registration
-GE_FACTORY_REGISTER_CUSTOM(SDF_EMPTY_SHAPE,
+GE_FACTORY_REGISTER_CUSTOM(SDF_EMPTY_SHAPE, SHAPE,
     [](GEEffectFactory::VisualEffectImplPtr ve) -> std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType> {
         if (FactoryCheckNullptr(ve.get(), "SDF_EMPTY_SHAPE")) {
             return nullptr;
@@ -288,7 +288,7 @@ GE_FACTORY_REGISTER_CUSTOM(SDF_EMPTY_SHAPE,
         return std::make_shared<::OHOS::Rosen::Drawing::GESDFEmptyShaderShape>();
     })
 
-GE_FACTORY_REGISTER_CUSTOM(SDF_RRECT_SHAPE,
+GE_FACTORY_REGISTER_CUSTOM(SDF_RRECT_SHAPE, SHAPE,
     [](GEEffectFactory::VisualEffectImplPtr ve) -> std::shared_ptr<::OHOS::Rosen::Drawing::IGEFilterType> {
         if (FactoryCheckNullptr(ve.get(), "SDF_RRECT_SHAPE")) {
             return nullptr;
@@ -156,6 +156,183 @@ void GEVisualEffect::SetParam(const std::string& tag, const Drawing::Path& param
     visualEffectImpl_->SetParam(tag, param);
 }
 
+GEParamTagHandle GEVisualEffect::ResolveParamTag(std::string_view tag)
+{
+    auto memberTag = GEParamsMemberHelper::GEParamsMemberTagFromString(tag);
+    if (memberTag == GEParamsMemberTag::INVALID) {
+        GE_LOGD("GEVisualEffect::ResolveParamTag: unknown tag '%{public}s'", std::string(tag).c_str());
+    }
+    return GEParamTagHandle(static_cast<uint32_t>(memberTag));
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, int32_t param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, int64_t param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, float param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, double param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::shared_ptr<Drawing::Image> param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const Drawing::Matrix param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::pair<float, float>& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::vector<std::pair<float, float>>& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::vector<Vector2f>& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::vector<Vector4f>& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const Drawing::Path& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::array<Drawing::Point, POINT_NUM>& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, bool param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, uint32_t param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::vector<float>& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::shared_ptr<Drawing::GEShaderMask> param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const std::shared_ptr<Drawing::GEShaderShape> param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const Drawing::Color4f& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const Vector3f& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const Vector4f& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const GERRect& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const RectF& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const GESDFBorderParams& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
+void GEVisualEffect::SetParam(GEParamTagHandle tag, const GESDFShadowParams& param)
+{
+    if (tag.IsValid()) {
+        visualEffectImpl_->SetParam(static_cast<GEParamsMemberTag>(tag.GetValue()), param);
+    }
+}
+
 const std::shared_ptr<Drawing::GEShaderShape> GEVisualEffect::GetGEShaderShape(const std::string& tag) const
 {
     return visualEffectImpl_->GetGEShaderShape(tag);
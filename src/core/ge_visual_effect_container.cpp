@@ -85,31 +85,32 @@ void GEVisualEffectContainer::UpdateCachedBlurImage(Drawing::Canvas* canvas,
     std::shared_ptr<Drawing::Image> cachedImage, float left, float top)
 {
     for (auto vef : GetFilters()) {
-        auto impl = vef->GetImpl();
-        if (vef->GetName() == "HarmoniumEffect") {
-            vef->SetParam(GE_SHADER_HARMONIUM_EFFECT_BLURLEFT, left);
-            vef->SetParam(GE_SHADER_HARMONIUM_EFFECT_BLURTOP, top);
-            if (vef->GetImpl() == nullptr) {
-                continue;
-            }
-            std::shared_ptr<GEHarmoniumEffectShaderParams> params = vef->GetImpl()->GetHarmoniumEffectParams();
-            if (params->useEffectMask != nullptr) {
-                GEUseEffectMaskParams maskParam;
-                maskParam.useEffect = params->useEffectMask->GetUseEffect();
-                maskParam.image = cachedImage;
-                std::shared_ptr<GEUseEffectShaderMask> useeffectMask =
-                    std::make_shared<GEUseEffectShaderMask>(maskParam);
-                vef->SetParam(GE_SHADER_HARMONIUM_EFFECT_USEEFFECTMASK, useeffectMask);
-            }
-        }
-        if (vef->GetName() == GE_SHADER_FROSTED_GLASS_EFFECT) {
-            vef->SetParam(GE_SHADER_FROSTED_GLASS_EFFECT_BLURIMAGE, cachedImage);
-        }
+        auto impl = vef ? vef->GetImpl() : nullptr;
         if (impl == nullptr) {
             continue;
         }
-        if (impl->GetFilterType() == GEFilterType::SPATIAL_GLASS_EFFECT) {
-            impl->SetParam(GEParamsMemberTag::SPATIAL_GLASS_EFFECT_BLUR_IMAGE, cachedImage);
+        switch (impl->GetFilterType()) {
+            case GEFilterType::HARMONIUM_EFFECT: {
+                impl->SetParam(GEParamsMemberTag::HARMONIUM_EFFECT_BLUR_LEFT, left);
+                impl->SetParam(GEParamsMemberTag::HARMONIUM_EFFECT_BLUR_TOP, top);
+                std::shared_ptr<GEHarmoniumEffectShaderParams> params = impl->GetHarmoniumEffectParams();
+                if (params != nullptr && params->useEffectMask != nullptr) {
+                    GEUseEffectMaskParams maskParam;
+                    maskParam.useEffect = params->useEffectMask->GetUseEffect();
+                    maskParam.image = cachedImage;
+                    std::shared_ptr<GEShaderMask> useeffectMask = std::make_shared<GEUseEffectShaderMask>(maskParam);
+                    impl->SetParam(GEParamsMemberTag::HARMONIUM_EFFECT_USE_EFFECT_MASK, useeffectMask);
+                }
+                break;
+            }
+            case GEFilterType::FROSTED_GLASS_EFFECT:
+                impl->SetParam(GEParamsMemberTag::FROSTED_GLASS_EFFECT_BLUR_IMAGE, cachedImage);
+                break;
+            case GEFilterType::SPATIAL_GLASS_EFFECT:
+                impl->SetParam(GEParamsMemberTag::SPATIAL_GLASS_EFFECT_BLUR_IMAGE, cachedImage);
+                break;
+            default:
+                break;
         }
     }
 }
@@ -118,9 +119,10 @@ void GEVisualEffectContainer::UpdateFrostedGlassEffectParams(std::shared_ptr<Dra
     float value)
 {
     for (auto vef : GetFilters()) {
-        if (vef->GetName() == GE_SHADER_FROSTED_GLASS_EFFECT) {
-            vef->SetParam(GE_SHADER_FROSTED_GLASS_EFFECT_REFRACTOUTPX, value);
-            vef->SetParam(GE_SHADER_FROSTED_GLASS_EFFECT_BLURIMAGEFOREDGE, blurImageForEdge);
+        auto impl = vef ? vef->GetImpl() : nullptr;
+        if (impl != nullptr && impl->GetFilterType() == GEFilterType::FROSTED_GLASS_EFFECT) {
+            impl->SetParam(GEParamsMemberTag::FROSTED_GLASS_EFFECT_REFRACT_OUT_PX, value);
+            impl->SetParam(GEParamsMemberTag::FROSTED_GLASS_EFFECT_BLUR_IMAGE_FOR_EDGE, blurImageForEdge);
         }
     }
 }
@@ -128,14 +130,13 @@ void GEVisualEffectContainer::UpdateFrostedGlassEffectParams(std::shared_ptr<Dra
 void GEVisualEffectContainer::UpdateSnapshotRect(const Drawing::RectF& snapshot)
 {
     for (auto vef : GetFilters()) {
-        auto impl = vef->GetImpl();
-        if (vef->GetName() == GE_SHADER_FROSTED_GLASS_EFFECT) {
-            vef->SetParam(GE_SHADER_FROSTED_GLASS_EFFECT_SNAPSHOTRECT, snapshot);
-        }
+        auto impl = vef ? vef->GetImpl() : nullptr;
         if (impl == nullptr) {
             continue;
         }
-        if (impl->GetFilterType() == GEFilterType::SPATIAL_GLASS_EFFECT) {
+        if (impl->GetFilterType() == GEFilterType::FROSTED_GLASS_EFFECT) {
+            impl->SetParam(GEParamsMemberTag::FROSTED_GLASS_EFFECT_SNAPSHOT_RECT, snapshot);
+        } else if (impl->GetFilterType() == GEFilterType::SPATIAL_GLASS_EFFECT) {
             impl->SetParam(GEParamsMemberTag::SPATIAL_GLASS_EFFECT_SNAPSHOT_RECT, snapshot);
         }
     }
@@ -144,27 +145,32 @@ void GEVisualEffectContainer::UpdateSnapshotRect(const Drawing::RectF& snapshot)
 void GEVisualEffectContainer::UpdateCornerRadius(float cornerRadius)
 {
     for (auto vef : GetFilters()) {
-        if (vef->GetName() == "HarmoniumEffect") {
-            vef->SetParam(GE_SHADER_HARMONIUM_EFFECT_CORNERRADIUS, cornerRadius);
+        auto impl = vef ? vef->GetImpl() : nullptr;
+        if (impl != nullptr && impl->GetFilterType() == GEFilterType::HARMONIUM_EFFECT) {
+            impl->SetParam(GEParamsMemberTag::HARMONIUM_EFFECT_CORNER_RADIUS, cornerRadius);
         }
-     }
+    }
 }
 
 void GEVisualEffectContainer::UpdateTotalMatrix(Drawing::Matrix totalMatrix)
 {
     for (auto vef : GetFilters()) {
-        auto impl = vef->GetImpl();
-        if (vef->GetName() == "HarmoniumEffect") {
-            vef->SetParam(GE_SHADER_HARMONIUM_EFFECT_TOTALMATRIX, totalMatrix);
-        }
-        if (vef->GetName() == GE_SHADER_FROSTED_GLASS_EFFECT) {
-            vef->SetParam(GE_SHADER_FROSTED_GLASS_EFFECT_SNAPSHOTMATRIX, totalMatrix);
-        }
+        auto impl = vef ? vef->GetImpl() : nullptr;
         if (impl == nullptr) {
             continue;
         }
-        if (impl->GetFilterType() == GEFilterType::SPATIAL_GLASS_EFFECT) {
-            impl->SetParam(GEParamsMemberTag::SPATIAL_GLASS_EFFECT_SNAPSHOT_MATRIX, totalMatrix);
+        switch (impl->GetFilterType()) {
+            case GEFilterType::HARMONIUM_EFFECT:
+                impl->SetParam(GEParamsMemberTag::HARMONIUM_EFFECT_TOTAL_MATRIX, totalMatrix);
+                break;
+            case GEFilterType::FROSTED_GLASS_EFFECT:
+                impl->SetParam(GEParamsMemberTag::FROSTED_GLASS_EFFECT_SNAPSHOT_MATRIX, totalMatrix);
+                break;
+            case GEFilterType::SPATIAL_GLASS_EFFECT:
+                impl->SetParam(GEParamsMemberTag::SPATIAL_GLASS_EFFECT_SNAPSHOT_MATRIX, totalMatrix);
+                break;
+            default:
+                break;
         }
     }
 }
@@ -196,11 +202,14 @@ void GEVisualEffectContainer::SetDisableFilterCache(bool disableFilterCache)
 void GEVisualEffectContainer::UpdateDarkScale(float darkScale)
 {
     for (auto vef : GetFilters()) {
-        if (vef->GetName() == GE_FILTER_FROSTED_GLASS) {
-            vef->SetParam(GE_SHADER_FROSTED_GLASS_DARK_SCALE, darkScale);
+        auto impl = vef ? vef->GetImpl() : nullptr;
+        if (impl == nullptr) {
+            continue;
         }
-        if (vef->GetName() == GE_SHADER_FROSTED_GLASS_EFFECT) {
-            vef->SetParam(GE_SHADER_FROSTED_GLASS_EFFECT_DARK_SCALE, darkScale);
+        if (impl->GetFilterType() == GEFilterType::FROSTED_GLASS) {
+            impl->SetParam(GEParamsMemberTag::FROSTED_GLASS_DARK_SCALE, darkScale);
+        } else if (impl->GetFilterType() == GEFilterType::FROSTED_GLASS_EFFECT) {
+            impl->SetParam(GEParamsMemberTag::FROSTED_GLASS_EFFECT_DARK_SCALE, darkScale);
         }
     }
 }
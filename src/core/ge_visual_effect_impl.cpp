@@ -76,6 +76,14 @@ GEVisualEffectImpl::GEVisualEffectImpl(const std::string& name, const std::optio
     canvasInfo_ = canvasInfo ? *canvasInfo : Drawing::CanvasInfo {};
 }
 
+GEVisualEffectImpl::GEVisualEffectImpl(FilterType filterType, const std::optional<Drawing::CanvasInfo>& canvasInfo)
+    : filterType_(filterType)
+{
+    // Paramless types such as SDF_EMPTY_SHAPE have no params to build
+    params_ = GEParamsBuilder::Build(filterType_);
+    canvasInfo_ = canvasInfo ? *canvasInfo : Drawing::CanvasInfo {};
+}
+
 GEVisualEffectImpl::~GEVisualEffectImpl() {}
 
 const std::shared_ptr<Drawing::GEShaderShape> GEVisualEffectImpl::GetGEShaderShape(const std::string& tag) const
@@ -125,37 +133,79 @@ const std::shared_ptr<Drawing::GEShaderShape> GEVisualEffectImpl::GetGEShaderSha
 }
 
 #define IMPLEMENT_SET_PARAM_INTERNAL(Type)                                                                      \
-    void GEVisualEffectImpl::SetParamInternal(GEFilterParams& params, GEParamsMemberTag tag, const Type& value) \
+    bool GEVisualEffectImpl::SetParamInternal(GEFilterParams& params, GEParamsMemberTag tag, const Type& value) \
     {                                                                                                           \
-        GEParamsMemberHelper::SetParamsMemberByTag(params, tag, value);                                         \
+        return GEParamsMemberHelper::SetParamsMemberByTag(params, tag, value);                                  \
     }
 
 FOR_EACH_PARAM_TYPE(IMPLEMENT_SET_PARAM_INTERNAL)
 #undef IMPLEMENT_SET_PARAM_INTERNAL
 
-void GEVisualEffectImpl::SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long&)
+bool GEVisualEffectImpl::SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long&)
 {
     // Compatibility placeholder, remove this function placeholder if future effects use any long long params
     // It will be generated by IMPLEMENT_SET_PARAM_INTERNAL
+    return false;
 }
 
-void GEVisualEffectImpl::SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long long&)
+bool GEVisualEffectImpl::SetParamInternal(GEFilterParams&, GEParamsMemberTag, const long long&)
 {
     // Compatibility placeholder, remove this function placeholder if future effects use any long long params
     // It will be generated by IMPLEMENT_SET_PARAM_INTERNAL
+    return false;
 }
 
-void GEVisualEffectImpl::SetParamInternal(GEFilterParams&, GEParamsMemberTag, const double&)
+bool GEVisualEffectImpl::SetParamInternal(GEFilterParams&, GEParamsMemberTag, const double&)
 {
     // Compatibility placeholder, remove this function placeholder if future effect use any double params
     // It will be generated by IMPLEMENT_SET_PARAM_INTERNAL
+    return false;
 }
 
-void GEVisualEffectImpl::SetParamInternal(
+bool GEVisualEffectImpl::SetParamInternal(
     GEFilterParams&, GEParamsMemberTag, const std::shared_ptr<Drawing::ColorFilter>)
 {
     // Compatibility placeholder, remove this function placeholder if future effect use any ColorFilter params
     // It will be generated by IMPLEMENT_SET_PARAM_INTERNAL
+    return false;
+}
+
+bool GEVisualEffectImpl::Commit()
+{
+    if (updateDepth_ == 0) {
+        GE_LOGE("GEVisualEffectImpl::Commit: no update in progress");
+        return false;
+    }
+    if (--updateDepth_ > 0 || !pendingDirtyBits_.Any()) {
+        return false;
+    }
+    lastDirtyBits_ = pendingDirtyBits_;
+    pendingDirtyBits_.Reset();
+    ++paramsGeneration_;
+    return true;
+}
+
+void GEVisualEffectImpl::MarkDirty(const GEParamsDirtyBits& dirty)
+{
+    if (updateDepth_ > 0) {
+        pendingDirtyBits_.Merge(dirty);
+        return;
+    }
+    lastDirtyBits_ = dirty;
+    ++paramsGeneration_;
+}
+
+const GEParamsHash* GEVisualEffectImpl::GetParamsHash() const
+{
+    if (paramsHashGeneration_ != paramsGeneration_) {
+        paramsHashGeneration_ = paramsGeneration_;
+        paramsHash_.reset();
+        GEParamsHasher hasher;
+        if (params_ && GEParamsMemberHelper::HashParams(*params_, hasher)) {
+            paramsHash_ = GEParamsHash { hasher.GetResult(), hasher.TakeRetained() };
+        }
+    }
+    return paramsHash_ ? &paramsHash_.value() : nullptr;
 }
 
 void GEVisualEffectImpl::SetSDFEdgeLightParams(const std::string& tag, float param)
@@ -169,6 +219,7 @@ void GEVisualEffectImpl::MakeSDFUnionOpShapeParams(const GESDFUnionOp& op)
     params->op = op;
     filterType_ = FilterType::SDF_UNION_OP;
     params_ = GEFilterParams::Box(params);
+    MarkParamsChanged();
 }
 
 } // namespace Drawing
@@ -17,7 +17,7 @@
 #include <unordered_map>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "include/core/SkTileMode.h"
 #include "include/effects/SkImageFilters.h"
 #include "src/core/SkOpts.h"
@@ -45,9 +45,7 @@ std::shared_ptr<Drawing::Image> GEAIBarShaderFilter::OnProcessImage(Drawing::Can
         return image;
     }
 
-    Drawing::Matrix matrix;
-    auto imageShader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
-        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
+    auto imageShader = MakeChainInputShader(*image);
     float imageWidth = image->GetWidth();
     float imageHeight = image->GetHeight();
     auto builder = MakeBinarizationShader(imageWidth, imageHeight, imageShader);
@@ -68,11 +66,20 @@ std::shared_ptr<Drawing::Image> GEAIBarShaderFilter::OnProcessImage(Drawing::Can
     return invertedImage;
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEAIBarShaderFilter::OnMakeChainedShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    auto builder = MakeBinarizationShader(info.GetWidth(), info.GetHeight(), input);
+    if (builder == nullptr) {
+        LOGE("GEAIBarShaderFilter::OnMakeChainedShader builder is null");
+        return nullptr;
+    }
+    return builder->MakeShader(nullptr, false);
+}
+
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GEAIBarShaderFilter::MakeBinarizationShader(
     float imageWidth, float imageHeight, std::shared_ptr<Drawing::ShaderEffect> imageShader)
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> binarizationShaderEffect_;
-
     // coefficient of saturation borrowed from
     // the saturate filter in RSProperties::GenerateColorFilter()
     static constexpr char prog[] = R"(
@@ -96,15 +103,14 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEAIBarShaderFilter::MakeBinariza
         }
     )";
 
-    if (binarizationShaderEffect_ == nullptr) {
-        binarizationShaderEffect_ = GECreateRuntimeEffectForShader(prog);
-        if (binarizationShaderEffect_ == nullptr) {
-            LOGE("MakeBinarizationShader::RuntimeShader effect error\n");
-            return nullptr;
-        }
+    // The registry compiles the program once per process and is safe to query from any thread
+    auto binarizationShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
+    if (binarizationShaderEffect == nullptr) {
+        LOGE("MakeBinarizationShader::RuntimeShader effect error\n");
+        return nullptr;
     }
     std::shared_ptr<Drawing::RuntimeShaderBuilder> builder =
-        std::make_shared<Drawing::RuntimeShaderBuilder>(binarizationShaderEffect_);
+        std::make_shared<Drawing::RuntimeShaderBuilder>(binarizationShaderEffect);
     builder->SetChild("imageShader", imageShader);
     builder->SetUniform("low", aiBarLow_);               // aiInvertCoef[0] is low
     builder->SetUniform("high", aiBarHigh_);             // aiInvertCoef[1] is high
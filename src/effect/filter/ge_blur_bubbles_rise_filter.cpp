@@ -18,7 +18,7 @@
 #include <algorithm>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -65,7 +65,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GetResampleShaderEffect()
     thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_resampleShader = nullptr;
     if (g_resampleShader == nullptr) {
         LOGD("GetResampleShaderEffect creating resample shader effect");
-        g_resampleShader = GECreateRuntimeEffectForShader(g_shaderStringResample);
+        g_resampleShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringResample);
         if (g_resampleShader == nullptr) {
             LOGE("GetResampleShaderEffect create resample shader effect failed");
         }
@@ -386,7 +386,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GEBlurBubblesRiseFilter::GetBlurShaderEf
     thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_blurShader = nullptr;
     if (g_blurShader == nullptr) {
         LOGD("GEBlurBubblesRiseFilter::GetBlurShaderEffect creating blur shader effect");
-        g_blurShader = GECreateRuntimeEffectForShader(shaderStringGaussianBlur);
+        g_blurShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringGaussianBlur);
         if (g_blurShader == nullptr) {
             LOGE("GEBlurBubblesRiseFilter::GetBlurShaderEffect create blur shader effect failed");
         }
@@ -399,7 +399,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GEBlurBubblesRiseFilter::GetMaskMixShade
     thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_maskMixShader = nullptr;
     if (g_maskMixShader == nullptr) {
         LOGD("GEBlurBubblesRiseFilter::GetMaskMixShaderEffect creating mask mix shader effect");
-        g_maskMixShader = GECreateRuntimeEffectForShader(shaderStringMaskMix);
+        g_maskMixShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringMaskMix);
         if (g_maskMixShader == nullptr) {
             LOGE("GEBlurBubblesRiseFilter::GetMaskMixShaderEffect create mask mix shader effect failed");
         }
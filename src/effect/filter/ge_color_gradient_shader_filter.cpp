@@ -16,7 +16,7 @@
 #include "ge_color_gradient_shader_filter.h"
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_system_properties.h"
 #include "ge_tone_mapping_helper.h"
 
@@ -48,16 +48,9 @@ std::shared_ptr<Drawing::Image> GEColorGradientShaderFilter::OnProcessImage(Draw
         return nullptr;
     }
 
-    float color[ARRAY_SIZE * COLOR_CHANNEL] = {0.0}; // 0.0 default
-    float position[ARRAY_SIZE * POSITION_CHANNEL] = {0.0}; // 0.0 default
-    float strength[ARRAY_SIZE] = {0.0}; // 0.0 default
-    if (!CheckInParams(color, position, strength, ARRAY_SIZE)) { return image; }
-
-    Drawing::Matrix matrix = canvasInfo_.mat;
-    matrix.PostTranslate(-canvasInfo_.tranX, -canvasInfo_.tranY);
+    Drawing::Matrix matrix;
     Drawing::Matrix invertMatrix;
-
-    if (!matrix.Invert(invertMatrix)) {
+    if (!GetGeometryMatrix(matrix, invertMatrix)) {
         LOGE("GEColorGradientShaderFilter::ProcessImage Invert matrix failed");
         return image;
     }
@@ -69,18 +62,10 @@ std::shared_ptr<Drawing::Image> GEColorGradientShaderFilter::OnProcessImage(Draw
         return image;
     }
 
-    std::shared_ptr<Drawing::RuntimeShaderBuilder> builder =
-        PreProcessColorGradientBuilder(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    auto builder = MakeBlendBuilder(srcImageShader);
     if (!builder) {
-        LOGE("GEColorGradientShaderFilter::OnProcessImage mask builder error\n");
         return image;
     }
-    
-    builder->SetChild("srcImageShader", srcImageShader);
-    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    builder->SetUniform("color", color, ARRAY_SIZE * COLOR_CHANNEL);
-    builder->SetUniform("position", position, ARRAY_SIZE * POSITION_CHANNEL);
-    builder->SetUniform("strength", strength, ARRAY_SIZE);
     auto resultImage = builder->MakeImage(canvas.GetGPUContext().get(), &(matrix), image->GetImageInfo(), false);
     if (resultImage == nullptr) {
         LOGE("GEColorGradientShaderFilter::OnProcessImage resultImage is null");
@@ -90,6 +75,57 @@ std::shared_ptr<Drawing::Image> GEColorGradientShaderFilter::OnProcessImage(Draw
     return resultImage;
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEColorGradientShaderFilter::OnMakeChainedShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    Drawing::Matrix matrix;
+    Drawing::Matrix invertMatrix;
+    if (info.GetWidth() < 1 || info.GetHeight() < 1 || !GetGeometryMatrix(matrix, invertMatrix)) {
+        LOGE("GEColorGradientShaderFilter::OnMakeChainedShader input is invalid.");
+        return nullptr;
+    }
+    // The gradient is evaluated in geometry space, sample the input the way OnProcessImage samples its image
+    auto srcImageShader = MakeLocalMatrixShader(input, invertMatrix);
+    if (srcImageShader == nullptr) {
+        return nullptr;
+    }
+    auto builder = MakeBlendBuilder(srcImageShader);
+    if (!builder) {
+        return nullptr;
+    }
+    return builder->MakeShader(&matrix, false);
+}
+
+bool GEColorGradientShaderFilter::GetGeometryMatrix(Drawing::Matrix& matrix, Drawing::Matrix& invertMatrix) const
+{
+    matrix = canvasInfo_.mat;
+    matrix.PostTranslate(-canvasInfo_.tranX, -canvasInfo_.tranY);
+    return matrix.Invert(invertMatrix);
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEColorGradientShaderFilter::MakeBlendBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& srcImageShader)
+{
+    float color[ARRAY_SIZE * COLOR_CHANNEL] = {0.0}; // 0.0 default
+    float position[ARRAY_SIZE * POSITION_CHANNEL] = {0.0}; // 0.0 default
+    float strength[ARRAY_SIZE] = {0.0}; // 0.0 default
+    if (!CheckInParams(color, position, strength, ARRAY_SIZE)) { return nullptr; }
+
+    std::shared_ptr<Drawing::RuntimeShaderBuilder> builder =
+        PreProcessColorGradientBuilder(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    if (!builder) {
+        LOGE("GEColorGradientShaderFilter::MakeBlendBuilder mask builder error\n");
+        return nullptr;
+    }
+
+    builder->SetChild("srcImageShader", srcImageShader);
+    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    builder->SetUniform("color", color, ARRAY_SIZE * COLOR_CHANNEL);
+    builder->SetUniform("position", position, ARRAY_SIZE * POSITION_CHANNEL);
+    builder->SetUniform("strength", strength, ARRAY_SIZE);
+    return builder;
+}
+
 void GEColorGradientShaderFilter::Preprocess(
     Drawing::Canvas& canvas, const Drawing::Rect& src, const Drawing::Rect& dst)
 {
@@ -226,7 +262,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEColorGradientShaderFilter::Make
             }
         )";
 
-        g_colorGradientShaderEffect_ = GECreateRuntimeEffectForShader(prog);
+        g_colorGradientShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
         if (g_colorGradientShaderEffect_ == nullptr) {
             LOGD("GEColorGradientShaderFilter::MakeColorGradientBuilder effect error\n");
             return nullptr;
@@ -322,7 +358,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEColorGradientShaderFilter::Make
             }
         )";
 
-        g_maskColorGradientShaderEffect_ = GECreateRuntimeEffectForShader(withMaskProg);
+        g_maskColorGradientShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(withMaskProg);
         if (g_maskColorGradientShaderEffect_ == nullptr) {
             LOGD("GEColorGradientShaderFilter::MakeMaskColorGradientBuilder effect error\n");
             return nullptr;
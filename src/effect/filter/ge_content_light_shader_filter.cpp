@@ -15,7 +15,7 @@
 
 #include "ge_content_light_shader_filter.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -28,8 +28,6 @@ constexpr size_t NUM_4 = 4;
 constexpr float MIN_LIGHT_POSITION = -10.0f;
 constexpr float MAX_LIGHT_POSITION = 10.0f;
 
-std::shared_ptr<Drawing::RuntimeEffect> GEContentLightFilter::contentLightShaderEffect_ = nullptr;
-
 GEContentLightFilter::GEContentLightFilter(const Drawing::GEContentLightFilterParams& params)
     : lightPosition_(params.position), lightColor_(params.color), lightIntensity_(params.intensity),
     rotationAngle_(params.rotationAngle)
@@ -192,7 +190,7 @@ void GEContentLightFilter::GenerateContentLightEffect()
         }
     )";
     if (contentLightShaderEffect_ == nullptr) {
-        contentLightShaderEffect_ = GECreateRuntimeEffectForShader(shaderStringContentLight);
+        contentLightShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringContentLight);
     }
 }
 } // namespace Rosen
@@ -17,7 +17,7 @@
 #include "ge_mesa_blur_shader_filter.h"
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #undef LOG_TAG
 #define LOG_TAG "GEDepthOcclusionShaderFilter"
 
@@ -72,7 +72,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GEDepthOcclusionShaderFilter::MakeDepthO
         return depthOcclusionShaderEffect;
     }
 
-    depthOcclusionShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringDepthOcclusion);
+    depthOcclusionShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringDepthOcclusion);
     if (depthOcclusionShaderEffect == nullptr) {
         LOGE("MakeDepthOcclusionShaderEffect: depthOcclusionShaderEffect create failed.");
         return nullptr;
@@ -88,7 +88,8 @@ std::shared_ptr<Drawing::RuntimeEffect> GEDepthOcclusionShaderFilter::MakeDepthO
         return depthOcclusionMaskShaderEffect;
     }
 
-    depthOcclusionMaskShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringDepthOcclusionMask);
+    depthOcclusionMaskShaderEffect =
+        GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringDepthOcclusionMask);
     if (depthOcclusionMaskShaderEffect == nullptr) {
         LOGE("MakeDepthOcclusionMaskShaderEffect: depthOcclusionMaskShaderEffect create failed.");
         return nullptr;
@@ -16,7 +16,7 @@
 #include "ge_direction_light_shader_filter.h"
 #include <memory>
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -312,29 +312,17 @@ std::shared_ptr<Drawing::Image> GEDirectionLightShaderFilter::OnProcessImage(Dra
 
 std::shared_ptr<Drawing::RuntimeEffect> GEDirectionLightShaderFilter::GetNormalMaskEffect()
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_normalMaskShaderEffect = nullptr;
-    if (g_normalMaskShaderEffect == nullptr) {
-        g_normalMaskShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringNormalMask);
-    }
-    return g_normalMaskShaderEffect;
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringNormalMask);
 }
 
 std::shared_ptr<Drawing::RuntimeEffect> GEDirectionLightShaderFilter::GetDirectionLightEffect()
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_directionLightShaderEffect = nullptr;
-    if (g_directionLightShaderEffect == nullptr) {
-        g_directionLightShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringDirectionLight);
-    }
-    return g_directionLightShaderEffect;
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringDirectionLight);
 }
 
 std::shared_ptr<Drawing::RuntimeEffect> GEDirectionLightShaderFilter::GetDirectionLightNoNormalEffect()
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_directionLightNoNormalShaderEffect = nullptr;
-    if (g_directionLightNoNormalShaderEffect == nullptr) {
-        g_directionLightNoNormalShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringDirectionLightNoNormal);
-    }
-    return g_directionLightNoNormalShaderEffect;
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringDirectionLightNoNormal);
 }
 
 } // namespace Rosen
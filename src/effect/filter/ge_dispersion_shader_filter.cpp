@@ -18,7 +18,7 @@
 #include <typeinfo>
 #include "ge_log.h"
 #include "effect/runtime_effect.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -37,13 +37,6 @@ std::shared_ptr<Drawing::Image> GEDispersionShaderFilter::OnProcessImage(Drawing
         return nullptr;
     }
 
-    auto dispersionShader = GetDispersionEffect();
-    if (dispersionShader == nullptr) {
-        LOGE("GEDispersionShaderFilter::OnProcessImage dispersionShader init failed.");
-        return image;
-    }
-    Drawing::RuntimeShaderBuilder builder(dispersionShader);
-
     Drawing::Matrix matrix = canvasInfo_.mat;
     matrix.PostTranslate(-canvasInfo_.tranX, -canvasInfo_.tranY);
     Drawing::Matrix invertMatrix;
@@ -52,34 +45,21 @@ std::shared_ptr<Drawing::Image> GEDispersionShaderFilter::OnProcessImage(Drawing
         return image;
     }
 
-    float lowValue = std::min(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    float aspectX = (std::abs(lowValue) > 1e-6f) ? (canvasInfo_.geoWidth / lowValue) : 1.0f;
-    float aspectY = (std::abs(lowValue) > 1e-6f) ? (-canvasInfo_.geoHeight / lowValue) : 1.0f;
-
     auto imageShader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
         Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), invertMatrix);
     if (imageShader == nullptr) {
         LOGE("GEDispersionShaderFilter::OnProcessImage create imageShader failed.");
         return image;
     }
-    builder.SetChild("image", imageShader);
-
-    auto maskShader = params_.mask->GenerateDrawingShader(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    if (maskShader == nullptr) {
-        LOGE("GEDispersionShaderFilter::OnProcessImage mask generate failed.");
+    auto builder = MakeDispersionBuilder(imageShader);
+    if (builder == nullptr) {
         return image;
     }
-    builder.SetChild("mask", maskShader);
-    builder.SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
-    builder.SetUniform("opacity", params_.opacity);
-    builder.SetUniform("redOffset", params_.redOffset.first / aspectX, params_.redOffset.second / aspectY);
-    builder.SetUniform("greenOffset", params_.greenOffset.first / aspectX, params_.greenOffset.second / aspectY);
-    builder.SetUniform("blueOffset", params_.blueOffset.first / aspectX, params_.blueOffset.second / aspectY);
 
 #ifdef RS_ENABLE_GPU
-    auto resultImage = builder.MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
+    auto resultImage = builder->MakeImage(canvas.GetGPUContext().get(), &(matrix), imageInfo, false);
 #else
-    auto resultImage = builder.MakeImage(nullptr, &(matrix), imageInfo, false);
+    auto resultImage = builder->MakeImage(nullptr, &(matrix), imageInfo, false);
 #endif
     if (resultImage == nullptr) {
         LOGE("GEDispersionShaderFilter::OnProcessImage make image failed.");
@@ -88,13 +68,68 @@ std::shared_ptr<Drawing::Image> GEDispersionShaderFilter::OnProcessImage(Drawing
     return resultImage;
 }
 
-std::shared_ptr<Drawing::RuntimeEffect> GEDispersionShaderFilter::GetDispersionEffect()
+std::shared_ptr<Drawing::ShaderEffect> GEDispersionShaderFilter::OnMakeChainedShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    // Same as OnProcessImage returning its input image
+    if (params_.mask == nullptr) { return input; }
+
+    if (info.GetHeight() < 1 || info.GetWidth() < 1) {
+        return nullptr;
+    }
+
+    Drawing::Matrix matrix = canvasInfo_.mat;
+    matrix.PostTranslate(-canvasInfo_.tranX, -canvasInfo_.tranY);
+    Drawing::Matrix invertMatrix;
+    if (!matrix.Invert(invertMatrix)) {
+        LOGE("GEDispersionShaderFilter::OnMakeChainedShader invert Matrix failed.");
+        return nullptr;
+    }
+    // Sample the input in geometry space, the way OnProcessImage samples its image
+    auto imageShader = MakeLocalMatrixShader(input, invertMatrix);
+    if (imageShader == nullptr) {
+        return nullptr;
+    }
+    auto builder = MakeDispersionBuilder(imageShader);
+    if (builder == nullptr) {
+        return nullptr;
+    }
+    return builder->MakeShader(&matrix, false);
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEDispersionShaderFilter::MakeDispersionBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& imageShader)
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_dispersionShader = nullptr;
-    if (g_dispersionShader == nullptr) {
-        g_dispersionShader = GECreateRuntimeEffectForShader(g_shaderStringDispersion);
+    auto dispersionShader = GetDispersionEffect();
+    if (dispersionShader == nullptr) {
+        LOGE("GEDispersionShaderFilter::MakeDispersionBuilder dispersionShader init failed.");
+        return nullptr;
+    }
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(dispersionShader);
+
+    float lowValue = std::min(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    float aspectX = (std::abs(lowValue) > 1e-6f) ? (canvasInfo_.geoWidth / lowValue) : 1.0f;
+    float aspectY = (std::abs(lowValue) > 1e-6f) ? (-canvasInfo_.geoHeight / lowValue) : 1.0f;
+
+    builder->SetChild("image", imageShader);
+
+    auto maskShader = params_.mask->GenerateDrawingShader(canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    if (maskShader == nullptr) {
+        LOGE("GEDispersionShaderFilter::MakeDispersionBuilder mask generate failed.");
+        return nullptr;
     }
-    return g_dispersionShader;
+    builder->SetChild("mask", maskShader);
+    builder->SetUniform("iResolution", canvasInfo_.geoWidth, canvasInfo_.geoHeight);
+    builder->SetUniform("opacity", params_.opacity);
+    builder->SetUniform("redOffset", params_.redOffset.first / aspectX, params_.redOffset.second / aspectY);
+    builder->SetUniform("greenOffset", params_.greenOffset.first / aspectX, params_.greenOffset.second / aspectY);
+    builder->SetUniform("blueOffset", params_.blueOffset.first / aspectX, params_.blueOffset.second / aspectY);
+    return builder;
+}
+
+std::shared_ptr<Drawing::RuntimeEffect> GEDispersionShaderFilter::GetDispersionEffect()
+{
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringDispersion);
 }
 
 } // namespace Rosen
@@ -17,7 +17,7 @@
  
 #include "ge_log.h"
 #include "ge_displacement_distort_shader_filter.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -81,11 +81,7 @@ std::shared_ptr<Drawing::Image> GEDisplacementDistortFilter::OnProcessImage(Draw
 
 std::shared_ptr<Drawing::RuntimeEffect> GEDisplacementDistortFilter::GetDisplacementDistortEffect()
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_displacementdistortShader = nullptr;
-    if (g_displacementdistortShader == nullptr) {
-        g_displacementdistortShader = GECreateRuntimeEffectForShader(shaderStringDisplacementDistort);
-    }
-    return g_displacementdistortShader;
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringDisplacementDistort);
 }
 
 } // namespace Rosen
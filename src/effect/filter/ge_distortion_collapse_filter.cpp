@@ -16,7 +16,7 @@
 #include "ge_distortion_collapse_filter.h"
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS::Rosen {
 namespace {
@@ -148,7 +148,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEDistortionCollapseFilter::MakeE
 {
     Drawing::RuntimeEffectOptions reo;
     reo.useHighpLocalCoords = true;
-    static auto effectShader = GECreateRuntimeEffectForShader(SHADER, reo);
+    static auto effectShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SHADER, reo);
     if (!effectShader) {
         LOGE("MakeEffectShader::RuntimeShader effect error\n");
         return nullptr;
@@ -19,7 +19,7 @@
 #include <vector>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_system_properties.h"
 #include "ge_tone_mapping_helper.h"
 
@@ -193,7 +193,7 @@ bool GEEdgeLightShaderFilter::InitConvertFragShaderEffect()
         return true;
     }
 
-    g_convertShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringConvertFrag);
+    g_convertShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringConvertFrag);
     if (g_convertShaderEffect == nullptr) {
         LOGE("GEEdgeLightShaderFilter::RuntimeShader g_convertShaderEffect create failed.");
         return false;
@@ -208,7 +208,7 @@ bool GEEdgeLightShaderFilter::InitDetectFragShaderEffect()
         return true;
     }
 
-    g_detectShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringDetectFrag);
+    g_detectShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringDetectFrag);
     if (g_detectShaderEffect == nullptr) {
         LOGE("GEEdgeLightShaderFilter::RuntimeShader g_detectShaderEffect create failed.");
         return false;
@@ -223,7 +223,7 @@ bool GEEdgeLightShaderFilter::InitGaussShaderEffect()
         return true;
     }
 
-    g_gaussShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringGaussianFrag);
+    g_gaussShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringGaussianFrag);
     if (g_gaussShaderEffect == nullptr) {
         LOGE("GEEdgeLightShaderFilter::RuntimeShader g_gaussShaderEffect create failed.");
         return false;
@@ -238,7 +238,7 @@ bool GEEdgeLightShaderFilter::InitCompositeShaderEffect()
         return true;
     }
 
-    g_compShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringCompositeFrag);
+    g_compShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringCompositeFrag);
     if (g_compShaderEffect == nullptr) {
         LOGE("GEEdgeLightShaderFilter::RuntimeShader g_compShaderEffect create failed.");
         return false;
@@ -253,7 +253,7 @@ bool GEEdgeLightShaderFilter::InitMaskShaderEffect()
         return true;
     }
 
-    g_addMaskEffect = GECreateRuntimeEffectForShader(g_shaderStringAddMask);
+    g_addMaskEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringAddMask);
     if (g_addMaskEffect == nullptr) {
         LOGE("GEEdgeLightShaderFilter::RuntimeShader g_addMaskEffect create failed.");
         return false;
@@ -268,7 +268,7 @@ bool GEEdgeLightShaderFilter::InitMergeImageShaderEffect()
         return true;
     }
 
-    g_alphaShaderEffect = GECreateRuntimeEffectForShader(g_shaderStringAlphaGradient);
+    g_alphaShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(g_shaderStringAlphaGradient);
     if (g_alphaShaderEffect == nullptr) {
         LOGE("GEEdgeLightShaderFilter::RuntimeShader g_alphaShaderEffect create failed.");
         return false;
@@ -17,6 +17,7 @@
 #include "ge_image_cache_provider.h"
 #include "ge_log.h"
 #include "ge_mesa_blur_shader_filter.h"
+#include "ge_params_hasher.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -52,12 +53,31 @@ std::shared_ptr<Drawing::Image> GEFrostedGlassBlurShaderFilter::OnProcessImage(D
 
     tmp.data = blurFilter.DownSamplingForEdge(canvas, blurImage, src, linear, factor);
     if (cacheProvider_ != nullptr) {
-        cacheProvider_->Store(tmp);
+        // Keyed providers keep one edge image per panel, so several panels do not evict each other
+        cacheProvider_->StoreByKey(tmp, GetEdgeCacheKey(blurParams_.radius, blurParams_.radiusScale, src, dst));
     }
 
     return blurImage;
 }
 
+uint64_t GEFrostedGlassBlurShaderFilter::GetEdgeCacheKey(float radius, float radiusScale, const Drawing::Rect& src,
+    const Drawing::Rect& dst)
+{
+    Drawing::GEParamsHasher hasher;
+    hasher.Combine(radius);
+    hasher.Combine(radiusScale);
+    hasher.Combine(src);
+    hasher.Combine(dst);
+    return hasher.GetResult();
+}
+
+std::shared_ptr<Drawing::Image> GEFrostedGlassBlurShaderFilter::GetEdgeImage(const IGECacheProvider& provider,
+    uint64_t key)
+{
+    auto cache = provider.GetByKeyAs<GEImageCache>(key);
+    return cache != nullptr ? cache->data : nullptr;
+}
+
 void GEFrostedGlassBlurShaderFilter::SetCacheProvider(IGECacheProvider* cacheProvider)
 {
     cacheProvider_ = cacheProvider;
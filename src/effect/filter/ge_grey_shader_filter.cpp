@@ -18,7 +18,7 @@
 #include "effect/runtime_effect.h"
 #include "effect/runtime_shader_builder.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -32,8 +32,6 @@ GEGreyShaderFilter::GEGreyShaderFilter(const Drawing::GEGreyShaderFilterParams&
     }
 }
 
-static std::shared_ptr<Drawing::RuntimeEffect> g_greyAdjustEffect;
-
 std::shared_ptr<Drawing::Image> GEGreyShaderFilter::OnProcessImage(Drawing::Canvas& canvas,
     const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst)
 {
@@ -42,22 +40,15 @@ std::shared_ptr<Drawing::Image> GEGreyShaderFilter::OnProcessImage(Drawing::Canv
         return image;
     }
 
-    if (!g_greyAdjustEffect) {
+    if (!greyAdjustEffect_) {
         LOGE("GEGreyShaderFilter::DrawGreyAdjustment greyAdjustEffect is null");
         return nullptr;
     }
-    Drawing::RuntimeShaderBuilder builder(g_greyAdjustEffect);
-    Drawing::Matrix matrix;
-    auto imageShader = Drawing::ShaderEffect::CreateImageShader(*image, Drawing::TileMode::CLAMP,
-        Drawing::TileMode::CLAMP, Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
-
-    builder.SetChild("imageShader", imageShader);
-    builder.SetUniform("coefficient1", greyCoef1_);
-    builder.SetUniform("coefficient2", greyCoef2_);
+    auto builder = MakeGreyBuilder(MakeChainInputShader(*image));
 #ifdef RS_ENABLE_GPU
-    auto greyImage = builder.MakeImage(canvas.GetGPUContext().get(), nullptr, image->GetImageInfo(), false);
+    auto greyImage = builder->MakeImage(canvas.GetGPUContext().get(), nullptr, image->GetImageInfo(), false);
 #else
-    auto greyImage = builder.MakeImage(nullptr, nullptr, image->GetImageInfo(), false);
+    auto greyImage = builder->MakeImage(nullptr, nullptr, image->GetImageInfo(), false);
 #endif
     if (greyImage == nullptr) {
         LOGE("DrawGreyAdjustment successful");
@@ -66,9 +57,29 @@ std::shared_ptr<Drawing::Image> GEGreyShaderFilter::OnProcessImage(Drawing::Canv
     return greyImage;
 };
 
+std::shared_ptr<Drawing::ShaderEffect> GEGreyShaderFilter::OnMakeChainedShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    if (!greyAdjustEffect_) {
+        LOGE("GEGreyShaderFilter::OnMakeChainedShader greyAdjustEffect is null");
+        return nullptr;
+    }
+    return MakeGreyBuilder(input)->MakeShader(nullptr, false);
+}
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> GEGreyShaderFilter::MakeGreyBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& imageShader) const
+{
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(greyAdjustEffect_);
+    builder->SetChild("imageShader", imageShader);
+    builder->SetUniform("coefficient1", greyCoef1_);
+    builder->SetUniform("coefficient2", greyCoef2_);
+    return builder;
+}
+
 bool GEGreyShaderFilter::InitGreyAdjustmentEffect()
 {
-    if (g_greyAdjustEffect != nullptr) {
+    if (greyAdjustEffect_ != nullptr) {
         return true;
     }
     
@@ -116,8 +127,8 @@ bool GEGreyShaderFilter::InitGreyAdjustmentEffect()
             return vec4(color, 1.0);
         }
     )");
-    g_greyAdjustEffect = GECreateRuntimeEffectForShader(GreyGradationString);
-    if (g_greyAdjustEffect == nullptr) {
+    greyAdjustEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(GreyGradationString);
+    if (greyAdjustEffect_ == nullptr) {
         LOGE("GEGreyShaderFilter::InitGreyAdjustmentEffect blurEffect create failed");
         return false;
     }
@@ -18,7 +18,7 @@
 #include <algorithm>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -92,7 +92,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GEHeatDistortionFilter::GetHeatDistortio
     thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_heatDistortionShader = nullptr;
     if (g_heatDistortionShader == nullptr) {
         LOGD("GEHeatDistortionFilter::GetHeatDistortionEffect creating shader effect");
-        g_heatDistortionShader = GECreateRuntimeEffectForShader(shaderStringHeatDistortion);
+        g_heatDistortionShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringHeatDistortion);
         if (g_heatDistortionShader == nullptr) {
             LOGE("GEHeatDistortionFilter::GetHeatDistortionEffect create shader effect failed");
         }
@@ -15,9 +15,12 @@
 
 #include "ge_kawase_blur_shader_filter.h"
 
+#include "ge_cpu_blur.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_system_properties.h"
+#include "ge_trace.h"
+#include "ge_transient_surface_pool.h"
 #include "src/core/SkOpts.h"
 
 #include "effect/color_matrix.h"
@@ -37,10 +40,6 @@ constexpr int32_t MAX_PASSES_LARGE_RADIUS = 7; // Maximum number of render passe
 constexpr float DILATED_CONVOLUTION_LARGE_RADIUS = 4.6f;
 // To avoid downscaling artifacts, interpolate the blurred fbo with the full composited image, up to this radius
 constexpr float MAX_CROSS_FADE_RADIUS = 10.0f;
-static std::shared_ptr<Drawing::RuntimeEffect> g_blurEffect;
-static std::shared_ptr<Drawing::RuntimeEffect> g_mixEffect;
-static std::shared_ptr<Drawing::RuntimeEffect> g_blurEffectAf;
-static std::shared_ptr<Drawing::RuntimeEffect> g_simpleFilter;
 
 } // namespace
 
@@ -151,14 +150,11 @@ std::shared_ptr<Drawing::ShaderEffect> GEKawaseBlurShaderFilter::ApplySimpleFilt
     const std::shared_ptr<Drawing::Image>& input, const std::shared_ptr<Drawing::ShaderEffect>& prevShader,
     const Drawing::ImageInfo& scaledInfo, const Drawing::SamplingOptions& linear) const
 {
-    Drawing::RuntimeShaderBuilder simpleBlurBuilder(g_simpleFilter);
+    Drawing::RuntimeShaderBuilder simpleBlurBuilder(simpleFilter_);
     simpleBlurBuilder.SetChild("imageInput", prevShader);
-#ifdef RS_ENABLE_GPU
-    std::shared_ptr<Drawing::Image> tmpSimpleBlur(simpleBlurBuilder.MakeImage(
-        canvas.GetGPUContext().get(), nullptr, scaledInfo, false));
-#else
-    std::shared_ptr<Drawing::Image> tmpSimpleBlur(simpleBlurBuilder.MakeImage(nullptr, nullptr, scaledInfo, false));
-#endif
+    // Only a shader of the image leaves, so the surface stays leased for the frame
+    std::shared_ptr<Drawing::Image> tmpSimpleBlur(
+        GETransientSurfacePool::MakeImage(canvas, simpleBlurBuilder, scaledInfo, true));
     if (tmpSimpleBlur == nullptr) {
         LOGE("GEKawaseBlurShaderFilter::ApplySimpleFilter tmpSimpleBlur is nullptr");
         return nullptr;
@@ -184,6 +180,16 @@ std::shared_ptr<Drawing::Image> GEKawaseBlurShaderFilter::OnProcessImage(Drawing
 
     float radiusByPasses = tmpRadius / numberOfPasses;
 
+    // Advanced Filter: check is AF usable only the first time
+    bool isUsingAF = IS_ADVANCED_FILTER_USABLE_CHECK_ONCE && blurEffectAf_ != nullptr;
+    if (!isUsingAF && GECpuBlur::ShouldUse(canvas)) {
+        auto cpuOutput = ProcessImageOnCpu(input, src, dst, numberOfPasses, radiusByPasses);
+        if (cpuOutput) {
+            return cpuOutput;
+        }
+        LOGE("GEKawaseBlurShaderFilter::OnProcessImage CPU blur failed, falling back to the shaders");
+    }
+
     auto width = std::max(static_cast<int>(std::ceil(dst.GetWidth())), input->GetWidth());
     auto height = std::max(static_cast<int>(std::ceil(dst.GetHeight())), input->GetHeight());
     auto originImageInfo = input->GetImageInfo();
@@ -192,23 +198,17 @@ std::shared_ptr<Drawing::Image> GEKawaseBlurShaderFilter::OnProcessImage(Drawing
     Drawing::Matrix blurMatrix = BuildMatrix(src, scaledInfo, input);
     Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
 
-    // Advanced Filter: check is AF usable only the first time
-    bool isUsingAF = IS_ADVANCED_FILTER_USABLE_CHECK_ONCE && g_blurEffectAf != nullptr;
     auto tmpShader = Drawing::ShaderEffect::CreateImageShader(
         *input, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix);
-    Drawing::RuntimeShaderBuilder blurBuilder(isUsingAF ? g_blurEffectAf : g_blurEffect);
-    if (GetBlurExtraFilterEnabled() && g_simpleFilter) {
+    Drawing::RuntimeShaderBuilder blurBuilder(isUsingAF ? blurEffectAf_ : blurEffect_);
+    if (GetBlurExtraFilterEnabled() && simpleFilter_) {
         tmpShader = ApplySimpleFilter(canvas, input, tmpShader, scaledInfo, linear);
     }
     blurBuilder.SetChild("imageInput", tmpShader);
 
     auto offsetXY = radiusByPasses * blurScale_;
     SetBlurBuilderParam(blurBuilder, offsetXY, scaledInfo, width, height);
-#ifdef RS_ENABLE_GPU
-    auto tmpBlur(blurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false));
-#else
-    auto tmpBlur(blurBuilder.MakeImage(nullptr, nullptr, scaledInfo, false));
-#endif
+    auto tmpBlur(GETransientSurfacePool::MakeImage(canvas, blurBuilder, scaledInfo));
 
     if (!tmpBlur) {
         return image;
@@ -224,21 +224,72 @@ std::shared_ptr<Drawing::Image> GEKawaseBlurShaderFilter::OnProcessImage(Drawing
         // Advanced Filter
         auto offsetXYFilter = radiusByPasses * stepScale;
         SetBlurBuilderParam(blurBuilder, offsetXYFilter, scaledInfo, width, height);
-#ifdef RS_ENABLE_GPU
-        tmpBlur = blurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
-#else
-        tmpBlur = blurBuilder.MakeImage(nullptr, nullptr, scaledInfo, false);
-#endif
+        tmpBlur = GETransientSurfacePool::MakeImage(canvas, blurBuilder, scaledInfo);
     }
 
     auto output = ScaleAndAddRandomColor(canvas, input, tmpBlur, src, dst, width, height);
     return output;
 }
 
+std::shared_ptr<Drawing::Image> GEKawaseBlurShaderFilter::ProcessImageOnCpu(
+    const std::shared_ptr<Drawing::Image>& input, const Drawing::Rect& src, const Drawing::Rect& dst,
+    int numberOfPasses, float radiusByPasses)
+{
+    GE_TRACE_NAME_FMT("GEKawaseBlurShaderFilter::ProcessImageOnCpu, Passes: %d", numberOfPasses);
+    auto width = std::max(static_cast<int>(std::ceil(dst.GetWidth())), input->GetWidth());
+    auto height = std::max(static_cast<int>(std::ceil(dst.GetHeight())), input->GetHeight());
+    auto originImageInfo = input->GetImageInfo();
+    auto scaledInfo = Drawing::ImageInfo(std::ceil(width * blurScale_), std::ceil(height * blurScale_),
+        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+    GECpuBlur::Mapping inputMapping;
+    if (scaledInfo.GetWidth() <= 0 || scaledInfo.GetHeight() <= 0 ||
+        !GECpuBlur::MakeMapping(BuildMatrix(src, scaledInfo, input), inputMapping)) {
+        return nullptr;
+    }
+    GECpuBlur::Buffer source;
+    if (!GECpuBlur::ReadImage(input, source)) {
+        return nullptr;
+    }
+
+    // The same passes as the blur shader, the first one sampling the input through the downscale
+    float maxX = width * blurScale_;
+    float maxY = height * blurScale_;
+    GECpuBlur::Buffer blurred;
+    GECpuBlur::Buffer scratch;
+    GECpuBlur::KawasePass(source, inputMapping, radiusByPasses * blurScale_, maxX, maxY, scaledInfo.GetWidth(),
+        scaledInfo.GetHeight(), blurred);
+    for (auto i = 1; i < numberOfPasses; i++) {
+        GECpuBlur::KawasePass(blurred, GECpuBlur::Mapping(), radiusByPasses * i * blurScale_, maxX, maxY,
+            scaledInfo.GetWidth(), scaledInfo.GetHeight(), scratch);
+        std::swap(blurred, scratch);
+    }
+
+    // The mix shader of ScaleAndAddRandomColor
+    GECpuBlur::Mapping blurredMapping;
+    GECpuBlur::Mapping originalMapping;
+    const auto scaleMatrix = GetShaderTransform(
+        nullptr, dst, dst.GetWidth() / blurred.width, dst.GetHeight() / blurred.height);
+    Drawing::Matrix inputMatrix;
+    inputMatrix.Translate(-src.GetLeft(), -src.GetTop());
+    inputMatrix.PostScale(dst.GetWidth() / input->GetWidth(), dst.GetHeight() / input->GetHeight());
+    Drawing::Matrix matrix;
+    matrix.Translate(dst.GetLeft(), dst.GetTop());
+    inputMatrix.PostConcat(matrix);
+    if (!GECpuBlur::MakeMapping(scaleMatrix, blurredMapping) ||
+        !GECpuBlur::MakeMapping(inputMatrix, originalMapping)) {
+        return nullptr;
+    }
+    float mixFactor = (abs(MAX_CROSS_FADE_RADIUS) <= 1e-6) ? 1.f : (blurRadius_ / MAX_CROSS_FADE_RADIUS);
+    GECpuBlur::MixAndDither(blurred, blurredMapping, &source, originalMapping, std::min(1.0f, mixFactor), factor_,
+        width, height, scratch);
+    return GECpuBlur::MakeImage(scratch, Drawing::ImageInfo(width, height, originImageInfo.GetColorType(),
+        originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace()));
+}
+
 bool GEKawaseBlurShaderFilter::IsInputValid(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
     const Drawing::Rect& src, const Drawing::Rect& dst)
 {
-    if (!g_blurEffect || !g_mixEffect || !image) {
+    if (!blurEffect_ || !mixEffect_ || !image) {
         LOGE("GEKawaseBlurShaderFilter::shader error");
         return false;
     }
@@ -258,7 +309,7 @@ void GEKawaseBlurShaderFilter::SetBlurBuilderParam(Drawing::RuntimeShaderBuilder
     const Drawing::ImageInfo& scaledInfo, const int width, const int height)
 {
     // Advanced Filter: check is AF usable only the first time
-    bool isUsingAF = IS_ADVANCED_FILTER_USABLE_CHECK_ONCE && g_blurEffectAf != nullptr;
+    bool isUsingAF = IS_ADVANCED_FILTER_USABLE_CHECK_ONCE && blurEffectAf_ != nullptr;
     if (isUsingAF) {
         SkV2 offsets[BLUR_SAMPLE_COUNT];
         OffsetInfo offsetInfo = { offsetXY, offsetXY, scaledInfo.GetWidth(), scaledInfo.GetHeight() };
@@ -289,7 +340,7 @@ const OHOS::Rosen::Drawing::Matrix GEKawaseBlurShaderFilter::BuildMatrix(
 
 bool GEKawaseBlurShaderFilter::InitBlurEffect()
 {
-    if (g_blurEffect != nullptr) {
+    if (blurEffect_ != nullptr) {
         return true;
     }
 
@@ -311,8 +362,8 @@ bool GEKawaseBlurShaderFilter::InitBlurEffect()
             return half4(c.rgba * 0.2);
         }
     )");
-    g_blurEffect = GECreateRuntimeEffectForShader(blurString);
-    if (g_blurEffect == nullptr) {
+    blurEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(blurString);
+    if (blurEffect_ == nullptr) {
         LOGE("GEKawaseBlurShaderFilter::RuntimeShader blurEffect create failed");
         return false;
     }
@@ -322,7 +373,7 @@ bool GEKawaseBlurShaderFilter::InitBlurEffect()
 
 bool GEKawaseBlurShaderFilter::InitMixEffect()
 {
-    if (g_mixEffect != nullptr) {
+    if (mixEffect_ != nullptr) {
         return true;
     }
 
@@ -344,8 +395,8 @@ bool GEKawaseBlurShaderFilter::InitMixEffect()
             return finalColor;
         }
     )");
-    g_mixEffect = GECreateRuntimeEffectForShader(mixString);
-    if (g_mixEffect == nullptr) {
+    mixEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(mixString);
+    if (mixEffect_ == nullptr) {
         LOGE("GEKawaseBlurShaderFilter::RuntimeShader mixEffect create failed");
         return false;
     }
@@ -355,7 +406,7 @@ bool GEKawaseBlurShaderFilter::InitMixEffect()
 
 bool GEKawaseBlurShaderFilter::InitSimpleFilter()
 {
-    if (g_simpleFilter != nullptr) {
+    if (simpleFilter_ != nullptr) {
         return true;
     }
 
@@ -365,8 +416,8 @@ bool GEKawaseBlurShaderFilter::InitSimpleFilter()
             return imageInput.eval(xy);
         }
     )");
-    g_simpleFilter = GECreateRuntimeEffectForShader(simpleShader);
-    if (g_simpleFilter == nullptr) {
+    simpleFilter_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(simpleShader);
+    if (simpleFilter_ == nullptr) {
         LOGE("GEKawaseBlurShaderFilter::RuntimeShader failed to create simple filter");
         return false;
     }
@@ -377,7 +428,7 @@ bool GEKawaseBlurShaderFilter::InitSimpleFilter()
 // Advanced Filter
 bool GEKawaseBlurShaderFilter::InitBlurEffectForAdvancedFilter()
 {
-    if (g_blurEffectAf != nullptr) {
+    if (blurEffectAf_ != nullptr) {
         return true;
     }
 
@@ -395,8 +446,8 @@ bool GEKawaseBlurShaderFilter::InitBlurEffectForAdvancedFilter()
             return half4(c.rgba * 0.2);
         }
     )");
-    g_blurEffectAf = GECreateRuntimeEffectForShader(blurStringAF, ops);
-    if (g_blurEffectAf == nullptr) {
+    blurEffectAf_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(blurStringAF, ops);
+    if (blurEffectAf_ == nullptr) {
         LOGE("%s: RuntimeShader blurEffectAF create failed", __func__);
         return false;
     }
@@ -476,7 +527,7 @@ std::shared_ptr<Drawing::Image> GEKawaseBlurShaderFilter::ScaleAndAddRandomColor
 
     Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
 
-    Drawing::RuntimeShaderBuilder mixBuilder(g_mixEffect);
+    Drawing::RuntimeShaderBuilder mixBuilder(mixEffect_);
     const auto scaleMatrix = GetShaderTransform(
         &canvas, dst, dst.GetWidth() / blurImage->GetWidth(), dst.GetHeight() / blurImage->GetHeight());
     auto tmpShader = Drawing::ShaderEffect::CreateImageShader(
@@ -15,7 +15,7 @@
 #include "ge_linear_gradient_blur_shader_filter.h"
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_system_properties.h"
 
 namespace OHOS {
@@ -326,7 +326,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GELinearGradientBlurShaderFilter:
                 return vec4(color, 1.0);
             }
         )";
-        maskBlurShaderEffect_ = GECreateRuntimeEffectForShader(prog);
+        maskBlurShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
         if (maskBlurShaderEffect_ == nullptr) {
             return nullptr;
         }
@@ -13,7 +13,7 @@
  * limitations under the License.
  */
 #include "ge_magnifier_shader_filter.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_system_properties.h"
 
 #include "ge_log.h"
@@ -143,8 +143,6 @@ static constexpr char MAGNIFIER_SHADER_WITH_SDF_PROG[] = R"(
 )";
 } // namespace
 
-std::shared_ptr<Drawing::RuntimeEffect> GEMagnifierShaderFilter::g_magnifierShaderEffectWithSDF = nullptr;
-
 GEMagnifierShaderFilter::GEMagnifierShaderFilter(const Drawing::GEMagnifierShaderFilterParams& params)
 {
     magnifierPara_ = std::make_shared<GEMagnifierParams>();
@@ -247,12 +245,11 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEMagnifierShaderFilter::MakeMagn
         return nullptr;
     }
 
-    if (g_magnifierShaderEffectWithSDF == nullptr) {
-        g_magnifierShaderEffectWithSDF = GECreateRuntimeEffectForShader(MAGNIFIER_SHADER_WITH_SDF_PROG);
-        if (g_magnifierShaderEffectWithSDF == nullptr) {
-            LOGE("GEMagnifierShaderFilter::MakeMagnifierShaderWithSDFShape failed to create RuntimeEffect");
-            return nullptr;
-        }
+    static const std::string magnifierShaderWithSDFProg(MAGNIFIER_SHADER_WITH_SDF_PROG);
+    auto magnifierShaderEffectWithSDF = GERuntimeEffectRegistry::GetInstance().GetOrCreate(magnifierShaderWithSDFProg);
+    if (magnifierShaderEffectWithSDF == nullptr) {
+        LOGE("GEMagnifierShaderFilter::MakeMagnifierShaderWithSDFShape failed to create RuntimeEffect");
+        return nullptr;
     }
 
     auto sdfShader = sdfShape_->GenerateDrawingShaderHasNormal(imageWidth, imageHeight);
@@ -263,7 +260,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEMagnifierShaderFilter::MakeMagn
     }
 
     std::shared_ptr<Drawing::RuntimeShaderBuilder> builder =
-        std::make_shared<Drawing::RuntimeShaderBuilder>(g_magnifierShaderEffectWithSDF);
+        std::make_shared<Drawing::RuntimeShaderBuilder>(magnifierShaderEffectWithSDF);
 
     builder->SetChild("imageShader", imageShader);
     builder->SetChild("sdfShader", sdfShader);
@@ -15,14 +15,19 @@
 
 #include "ge_mesa_blur_shader_filter.h"
 
+#include "ge_cpu_blur.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_params_hasher.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_system_properties.h"
+#include "ge_trace.h"
+#include "ge_transient_surface_pool.h"
 #include "src/core/SkOpts.h"
 
 #include "effect/color_matrix.h"
+#include <algorithm>
 #include <array>
-#include <vector>
+#include <cmath>
 
 namespace OHOS {
 namespace Rosen {
@@ -44,7 +49,7 @@ static constexpr float BLUR_SCALE_4 = 0.03125f; // 0.03125 : downSample scale fo
 static constexpr float PI_F = 3.14159265358979323846f; // convert to radians
 static constexpr float ANGLE_MIN_VAL = 0.0f;
 static constexpr float ANGLE_MAX_VAL = 180.0f;
-static const std::array BLUR_RADIUS = {
+constexpr std::array<int, 6> BLUR_RADIUS = {
     8,  // 8: BLUR_RADIUS_1
     20,     // 20: BLUR_RADIUS_1P5
     24,     // 24: BLUR_RADIUS_20
@@ -52,44 +57,153 @@ static const std::array BLUR_RADIUS = {
     100,    // 100: BLUR_RADIUS_2
     200     // 200: BLUR_RADIUS_3
 };
-static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_blurEffect;
-static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_directionBlurEffect;
-static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_mixEffect;
-static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_simpleFilter;
-static thread_local std::shared_ptr<Drawing::RuntimeEffect> g_greyAdjustEffect;
-
-static const std::vector<std::vector<float>> offsetTableFourPasses = {
-    /*
-        sampling offsets and weights for different blur radius in 4-pass algorithm
-    */
-    {{1.421365322425756, 1.421365322425756, 2.52888420687976, 1.6983888474288191,
-      0.5060327516701945, 2.477687296510791, 2.645538868459866, 0.4675865935441517}},
-    {{1.5532466535764577, 1.5532466535764577, 3.260647277662576, 2.6149639458271343,
-      1.492416795484721, 3.3432890011050254, 2.559487807195717, 0.362113179598861}}
+
+constexpr int OFFSET_STRIDE = 2; // 2: x and y of every pass
+constexpr int FOUR_PASS_OFFSETS = 8; // 8: four passes of x and y
+constexpr int FIVE_PASS_OFFSETS = 10; // 10: five passes of x and y
+constexpr int FOUR_PASS_ROWS = 2;
+constexpr int FIVE_PASS_ROWS = 8;
+constexpr int MAX_OFFSETS = 12;
+
+/*
+    sampling offsets and weights for different blur radius in 4-pass algorithm
+*/
+constexpr float OFFSET_TABLE_FOUR_PASSES[FOUR_PASS_ROWS][FOUR_PASS_OFFSETS] = {
+    {1.421365322425756, 1.421365322425756, 2.52888420687976, 1.6983888474288191,
+     0.5060327516701945, 2.477687296510791, 2.645538868459866, 0.4675865935441517},
+    {1.5532466535764577, 1.5532466535764577, 3.260647277662576, 2.6149639458271343,
+     1.492416795484721, 3.3432890011050254, 2.559487807195717, 0.362113179598861}
+};
+
+/*
+    sampling offsets and weights for different blur radius in 5-pass algorithm
+*/
+constexpr float OFFSET_TABLE_FIVE_PASSES[FIVE_PASS_ROWS][FIVE_PASS_OFFSETS] = {
+    {1.29351593, 1.29351593, 0.53793921, 1.5822416, 1.58224067,
+     0.53794761, 1.58223699, 0.5379565, 0.53795194, 1.58223997},
+    {1.4925693309454728, 1.4925693309454728, 1.248431515423821, 2.1609475057344536, 2.3006446212434306,
+     0.38158524446502357, 2.160947472355003, 1.248431447998051, 0.3815852898151447, 2.300644665028775},
+    {2.461169146598135, 2.461169146598135, 1.5094283743591717, 1.5185693547666796, 3.2470361889434103,
+     0.5465662643903497, 2.6710526969877204, 1.456340654010302, 0.47564642926095513, 2.5790346948641893},
+    {2.7877137008630277, 2.7877137008630277, 1.368781571748399, 1.3779906041976446, 4.275711858457529,
+     1.5175122219974202, 2.779896417187395, 1.5946441694737459, 0.6545369425231907, 3.5714310651049317},
+    {3.409158646436388, 3.409158646436388, 1.3807194929023436, 1.6494765647589356, 4.638321454662683,
+     2.304041644534522, 2.6625386778188735, 1.554841535232042, 0.5313373875839217, 4.660706115409412},
+    {4.425333740948246, 4.425333740948246, 1.1845267031766928, 1.4500896889624584, 5.313559133773294,
+     2.4323499776778643, 2.606322065282447, 1.2553675953527443, 1.1729490480100304, 5.166409017496668},
+    {4.710484187853573, 4.710484187853573, 1.4007370136555897, 1.2562595222759485, 6.5684867433401495,
+     2.4384921005985807, 3.2541990928397246, 1.4465647404038315, 1.436550871193364, 5.52173166041527},
+    {5.561630104245352, 5.561630104245352, 1.419409904905922, 1.556544555489513, 6.592301531601723,
+     3.277577833641203, 3.3151278290421873, 1.573561193200789, 1.3588630736274054, 6.361664806350875},
 };
 
-static const std::vector<std::vector<float>> offsetTableFivePasses = {
-    /*
-        sampling offsets and weights for different blur radius in 5-pass algorithm
-    */
-    {{1.29351593, 1.29351593, 0.53793921, 1.5822416, 1.58224067,
-      0.53794761, 1.58223699, 0.5379565, 0.53795194, 1.58223997}},
-    {{1.4925693309454728, 1.4925693309454728, 1.248431515423821, 2.1609475057344536, 2.3006446212434306,
-      0.38158524446502357, 2.160947472355003, 1.248431447998051, 0.3815852898151447, 2.300644665028775}},
-    {{2.461169146598135, 2.461169146598135, 1.5094283743591717, 1.5185693547666796, 3.2470361889434103,
-      0.5465662643903497, 2.6710526969877204, 1.456340654010302, 0.47564642926095513, 2.5790346948641893}},
-    {{2.7877137008630277, 2.7877137008630277, 1.368781571748399, 1.3779906041976446, 4.275711858457529,
-      1.5175122219974202, 2.779896417187395, 1.5946441694737459, 0.6545369425231907, 3.5714310651049317}},
-    {{3.409158646436388, 3.409158646436388, 1.3807194929023436, 1.6494765647589356, 4.638321454662683,
-      2.304041644534522, 2.6625386778188735, 1.554841535232042, 0.5313373875839217, 4.660706115409412}},
-    {{4.425333740948246, 4.425333740948246, 1.1845267031766928, 1.4500896889624584, 5.313559133773294,
-      2.4323499776778643, 2.606322065282447, 1.2553675953527443, 1.1729490480100304, 5.166409017496668}},
-    {{4.710484187853573, 4.710484187853573, 1.4007370136555897, 1.2562595222759485, 6.5684867433401495,
-      2.4384921005985807, 3.2541990928397246, 1.4465647404038315, 1.436550871193364, 5.52173166041527}},
-    {{5.561630104245352, 5.561630104245352, 1.419409904905922, 1.556544555489513, 6.592301531601723,
-      3.277577833641203, 3.3151278290421873, 1.573561193200789, 1.3588630736274054, 6.361664806350875}},
+// Pass count, downsample scale and offsets of one blur radius
+struct MesaBlurPlan {
+    int numberOfPasses = 0;
+    float blurScale = 0.0f;
+    float offsets[MAX_OFFSETS] = {};
 };
 
+// Offsets of row, or of the rows around findex interpolated, scaled; [st, ed] spans the rows evenly
+template<int ROWS, int OFFSETS>
+constexpr void InterpolateOffsets(MesaBlurPlan& plan, const float (&offsetTable)[ROWS][OFFSETS], float radius,
+    float st, float ed)
+{
+    int index = 0;
+    float scale = 1.f;
+    float w1 = 0.f;
+    if (radius < st) {
+        scale = radius / st;
+    } else if (radius > ed) {
+        scale = radius / ed;
+        index = ROWS - 1;
+    } else {
+        float dist = (ed - st) / (ROWS - 1);
+        float findex = (radius - st) / dist;
+        index = static_cast<int>(findex); // findex is not negative here, the cast is its floor
+        w1 = findex - index;
+    }
+    // Using interpolation to get the blur params.
+    if (w1 < 1e-6) {
+        for (int i = 0; i < plan.numberOfPasses * OFFSET_STRIDE; i++) {
+            plan.offsets[i] = scale * offsetTable[index][i];
+        }
+    } else {
+        float w2 = 1 - w1;
+        for (int i = 0; i < plan.numberOfPasses * OFFSET_STRIDE; i++) {
+            plan.offsets[i] = w2 * offsetTable[index][i] + w1 * offsetTable[index + 1][i];
+        }
+    }
+}
+
+// Radii from BLUR_RADIUS_2 on are one row of the five pass table scaled, see SetBlurParamsFivePassLarge
+constexpr MesaBlurPlan MakeMesaBlurPlan(int radius)
+{
+    MesaBlurPlan plan;
+    float blurRadius = static_cast<float>(radius);
+    if (blurRadius < BLUR_RADIUS[0]) {     // 0: BLUR_RADIUS_1 = 8
+        // Case1. numberOfPasses = 2, 3, or 4; blur scale = 0.5; offsets interpolated from the four pass table.
+        // 2: min number of pass, 4: fixed four passes
+        plan.numberOfPasses = std::clamp(radius, 2, 4);
+        plan.blurScale = BASE_BLUR_SCALE;
+        // 8, 10: the range of blur radius.
+        InterpolateOffsets(plan, OFFSET_TABLE_FOUR_PASSES, blurRadius, 8, 10);
+        if (blurRadius >= BLUR_RADIUS[0] - OFFSET_STRIDE) {
+            // 3: pre-filtering when the radius is larger than the calculated value
+            // 0.33333333: scaling rate.
+            // 1.8: blur param
+            float blurParam = 1.8;
+            float perf = (blurRadius - BLUR_RADIUS[0]) * 0.33333333 + 1;
+            plan.offsets[OFFSET_STRIDE * plan.numberOfPasses] = blurParam * perf;
+            plan.offsets[OFFSET_STRIDE * plan.numberOfPasses + 1] = blurParam * perf;
+            plan.numberOfPasses++;
+        }
+        return plan;
+    }
+    if (blurRadius < BLUR_RADIUS[1]) {     // 1: BLUR_RADIUS_1P5 = 20
+        // Case2. numberOfPasses = 4; blur scale = 0.25; offsets scaled from the four pass table.
+        plan.numberOfPasses = 4; // 4: four passes
+        plan.blurScale = BLUR_SCALE_1;
+        float scale = blurRadius * BLUR_SCALE_3;
+        for (int i = 0; i < FOUR_PASS_OFFSETS; i++) {
+            plan.offsets[i] = scale * OFFSET_TABLE_FOUR_PASSES[0][i];
+        }
+        int newStride = 3;
+        constexpr float BLUR_PARAM_A = 0.4;
+        constexpr float BLUR_PARAM_B = 0.35;
+        if (blurRadius >= BLUR_RADIUS[1] - newStride) {
+            // 4: pre-filtering when the radius is larger than the calculated value
+            float perf = (blurRadius - BLUR_RADIUS[1] + newStride + 1);
+            plan.offsets[OFFSET_STRIDE * plan.numberOfPasses] = BLUR_PARAM_A * perf + BLUR_PARAM_B;
+            plan.offsets[OFFSET_STRIDE * plan.numberOfPasses + 1] = BLUR_PARAM_A * perf + BLUR_PARAM_B;
+            plan.numberOfPasses++;
+        }
+        return plan;
+    }
+    // Case3. numberOfPasses = 5; blur scale = 0.125; offsets interpolated from the five pass table.
+    plan.numberOfPasses = 5;  // 5: five passes
+    plan.blurScale = BLUR_SCALE_2;
+    // 3: BLUR_RADIUS_21 = 80; 2: BLUR_RADIUS_20 = 24
+    InterpolateOffsets(plan, OFFSET_TABLE_FIVE_PASSES, blurRadius, BLUR_RADIUS[2], BLUR_RADIUS[3]);
+    return plan;
+}
+
+// Every radius below BLUR_RADIUS_2, generated at build time so a blur only copies its row
+constexpr int MESA_BLUR_PLAN_COUNT = BLUR_RADIUS[4]; // 4: BLUR_RADIUS_2 = 100
+
+constexpr std::array<MesaBlurPlan, MESA_BLUR_PLAN_COUNT> MakeMesaBlurPlans()
+{
+    std::array<MesaBlurPlan, MESA_BLUR_PLAN_COUNT> plans {};
+    for (int radius = 0; radius < MESA_BLUR_PLAN_COUNT; radius++) {
+        plans[radius] = MakeMesaBlurPlan(radius);
+    }
+    return plans;
+}
+
+constexpr std::array<MesaBlurPlan, MESA_BLUR_PLAN_COUNT> MESA_BLUR_PLANS = MakeMesaBlurPlans();
+static_assert(MESA_BLUR_PLANS[1].numberOfPasses == 2 && MESA_BLUR_PLANS[7].numberOfPasses == 5 &&
+    MESA_BLUR_PLANS[10].numberOfPasses == 4 && MESA_BLUR_PLANS[19].numberOfPasses == 5 &&
+    MESA_BLUR_PLANS[MESA_BLUR_PLAN_COUNT - 1].numberOfPasses == 5, "MESA blur plans do not match the cases");
 } // namespace
 
 static bool GetKawaseOriginalEnabled()
@@ -150,52 +264,8 @@ bool GEMESABlurShaderFilter::SetBlurParams(NewBlurParams& bParam)
     return isSuccess;
 }
 
-bool GEMESABlurShaderFilter::SetBlurParamsHelper(NewBlurParams& bParam,
-    const std::vector<std::vector<float>>& offsetTable, float st, float ed)
-{
-    if (st <= 0 || ed <= st || offsetTable.size() < 2) {    // 2: to avoid divided by zero
-        return false;
-    }
-    int stride = 2;     // 2: stride
-    size_t index;
-    float scale = 1.f;
-    float w1;
-    if (blurRadius_ < st) {
-        scale = blurRadius_ / (st > 0 ? st : 1);
-        index = 0;
-        w1 = 0;
-    } else if (blurRadius_ > ed) {
-        scale = blurRadius_ / (ed > 0 ? ed : 1);
-        index = offsetTable.size() - 1;
-        w1 = 0;
-    } else {
-        // The denominator will not be zero.
-        float dist = (ed - st) / (offsetTable.size() - 1);
-        float findex = (blurRadius_ - st) / dist;
-        index = floor(findex);
-        w1 = findex - index;
-    }
-    // Using interpolation to get the blur params.
-    if (fabs(w1) < 1e-6) {
-        for (int i = 0; i < bParam.numberOfPasses; i++) {
-            bParam.offsets[stride * i] = scale * offsetTable[index][stride * i];
-            bParam.offsets[stride * i + 1] = scale * offsetTable[index][stride * i + 1];
-        }
-    } else {
-        float w2 = 1 - w1;
-        for (int i = 0; i < bParam.numberOfPasses; i++) {
-            bParam.offsets[stride * i] = w2 * offsetTable[index][stride * i] +
-                w1 * offsetTable[index + 1][stride * i];
-            bParam.offsets[stride * i + 1] = w2 * offsetTable[index][stride * i + 1] +
-                w1 * offsetTable[index + 1][stride * i + 1];
-        }
-    }
-    return true;
-}
-
 bool GEMESABlurShaderFilter::SetBlurParamsFivePassLarge(NewBlurParams& bParam)
 {
-    int stride = 2; // 2: stride
     // 5: five passes
     int numberOfPasses = 5;
     float scale;
@@ -207,9 +277,8 @@ bool GEMESABlurShaderFilter::SetBlurParamsFivePassLarge(NewBlurParams& bParam)
         scale = blurRadius_ / static_cast<float>(BLUR_RADIUS[3]) * BLUR_SCALE_1;    // 3: BLUR_RADIUS_21 = 80
     }
     int index = (BLUR_RADIUS[3] - BLUR_RADIUS[2]) * BLUR_SCALE_2;   // 3: BLUR_RADIUS_21 = 80; 2: BLUR_RADIUS_20 = 24
-    for (int i = 0; i < numberOfPasses; i++) {
-        bParam.offsets[stride * i] = scale * offsetTableFivePasses[index][stride * i];
-        bParam.offsets[stride * i + 1] = scale * offsetTableFivePasses[index][stride * i + 1];
+    for (int i = 0; i < numberOfPasses * OFFSET_STRIDE; i++) {
+        bParam.offsets[i] = scale * OFFSET_TABLE_FIVE_PASSES[index][i];
     }
     bParam.numberOfPasses = numberOfPasses;
     return true;
@@ -218,59 +287,15 @@ bool GEMESABlurShaderFilter::SetBlurParamsFivePassLarge(NewBlurParams& bParam)
 bool GEMESABlurShaderFilter::SetGeneralBlurParams(NewBlurParams& bParam)
 {
     blurRadius_ = static_cast<float>(radius_);
-    int stride = 2;     // 2: stride
-    if (blurRadius_ < BLUR_RADIUS[0]) {     // 0: BLUR_RADIUS_1 = 8
-        // Case1. numberOfPasses = 2, 3, or 4; blur scale = 0.5; offsets interpolated from offsetTableFourPasses.
-        // 2: min number of pass, 4: fixed four passes
-        bParam.numberOfPasses = std::clamp(static_cast<int>(blurRadius_), 2, 4);
-        blurScale_ = BASE_BLUR_SCALE;
-        // 8, 10: the range of blur radius.
-        bool isSetParamSuccess = SetBlurParamsHelper(bParam, offsetTableFourPasses, 8, 10);
-        if (blurRadius_ >= BLUR_RADIUS[0] - stride) {
-            // 3: pre-filtering when the radius is larger than the calculated value
-            // 0.33333333: scaling rate.
-            // 1.8: blur param
-            float blurParam = 1.8;
-            float perf = (blurRadius_ - BLUR_RADIUS[0]) * 0.33333333 + 1;
-            bParam.offsets[stride * bParam.numberOfPasses] = blurParam * perf;
-            bParam.offsets[stride * bParam.numberOfPasses + 1] = blurParam * perf;
-            bParam.numberOfPasses++;
-        }
-        return isSetParamSuccess;
-    }
-    if (blurRadius_ < BLUR_RADIUS[1]) {     // 1: BLUR_RADIUS_1P5 = 20
-        // Case2. numberOfPasses = 4; blur scale = 0.25; offsets interpolated from offsetTableFourPasses.
-        // 4: four passes
-        int numberOfPasses = 4;
-        blurScale_ = BLUR_SCALE_1;
-        float scale = blurRadius_ * BLUR_SCALE_3;
-        for (int i = 0; i < numberOfPasses; i++) {
-            bParam.offsets[stride * i] = scale * offsetTableFourPasses[0][stride * i];
-            bParam.offsets[stride * i + 1] = scale * offsetTableFourPasses[0][stride * i + 1];
-        }
-
-        int newStride = 3;
-        static constexpr float BLUR_PARAM_A = 0.4;
-        static constexpr float BLUR_PARAM_B = 0.35;
-        if (blurRadius_ >= BLUR_RADIUS[1] - newStride) {
-            // 4: pre-filtering when the radius is larger than the calculated value
-            float perf = (blurRadius_ - BLUR_RADIUS[1] + newStride + 1);
-            bParam.offsets[stride * numberOfPasses] = BLUR_PARAM_A * perf + BLUR_PARAM_B;
-            bParam.offsets[stride * numberOfPasses + 1] = BLUR_PARAM_A * perf + BLUR_PARAM_B;
-            numberOfPasses++;
-        }
-        bParam.numberOfPasses = numberOfPasses;
-        return true;
-    }
-    if (blurRadius_ < BLUR_RADIUS[4]) {     // 4: BLUR_RADIUS_2 = 100
-        // Case3. numberOfPasses = 5; blur scale = 0.125; offsets interpolated from offsetTableFivePasses.
-        bParam.numberOfPasses = 5;  // 5: five passes
-        blurScale_ = BLUR_SCALE_2;
-        // 3: BLUR_RADIUS_21 = 80; 2: BLUR_RADIUS_20 = 24
-        return SetBlurParamsHelper(bParam, offsetTableFivePasses, BLUR_RADIUS[2], BLUR_RADIUS[3]);
+    if (radius_ >= MESA_BLUR_PLAN_COUNT) {
+        // Case4. numberOfPasses = 5; blur scale < 0.125; offsets scaled from the five pass table.
+        return SetBlurParamsFivePassLarge(bParam);
     }
-    // Case4. numberOfPasses = 5; blur scale < 0.125; offsets interpolated from offsetTableFivePasses.
-    return SetBlurParamsFivePassLarge(bParam);
+    const auto& plan = MESA_BLUR_PLANS[std::max(radius_, 0)];
+    bParam.numberOfPasses = plan.numberOfPasses;
+    blurScale_ = plan.blurScale;
+    std::copy(std::begin(plan.offsets), std::end(plan.offsets), std::begin(bParam.offsets));
+    return true;
 }
 
 int GEMESABlurShaderFilter::GetRadius() const
@@ -285,7 +310,7 @@ std::shared_ptr<Drawing::ShaderEffect> GEMESABlurShaderFilter::ApplyFuzedFilter(
 {
     std::shared_ptr<Drawing::Image> tmpBlur;
     if (isGreyX_) {
-        Drawing::RuntimeShaderBuilder builder(g_greyAdjustEffect);
+        Drawing::RuntimeShaderBuilder builder(greyAdjustEffect_);
         if (prevShader) {
             builder.SetChild("imageShader", prevShader);
         } else {
@@ -294,20 +319,12 @@ std::shared_ptr<Drawing::ShaderEffect> GEMESABlurShaderFilter::ApplyFuzedFilter(
         }
         builder.SetUniform("coefficient1", greyCoef1_);
         builder.SetUniform("coefficient2", greyCoef2_);
-#ifdef RS_ENABLE_GPU
-        tmpBlur = builder.MakeImage(canvas.GetGPUContext().get(), nullptr, middleInfo, false);
-#else
-        tmpBlur = builder.MakeImage(nullptr, nullptr, middleInfo, false);
-#endif
+        tmpBlur = GETransientSurfacePool::MakeImage(canvas, builder, middleInfo, true);
     } else {
         if (prevShader) {
             return prevShader;
         }
-#ifdef RS_ENABLE_GPU
-        tmpBlur = blurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, middleInfo, false);
-#else
-        tmpBlur = blurBuilder.MakeImage(nullptr, nullptr, middleInfo, false);
-#endif
+        tmpBlur = GETransientSurfacePool::MakeImage(canvas, blurBuilder, middleInfo, true);
     }
     if (!tmpBlur) {
         return nullptr;
@@ -319,13 +336,9 @@ std::shared_ptr<Drawing::ShaderEffect> GEMESABlurShaderFilter::ApplyFuzedFilter(
     Drawing::Matrix inputMatrix = BuildStretchMatrix(middleInfo, input);
     inputMatrix.PostConcat(matrix);
     auto tmpShader = Drawing::ShaderEffect::CreateImageShader(*tmpBlur, tileMode_, tileMode_, linear, inputMatrix);
-    Drawing::RuntimeShaderBuilder simpleBlurBuilder(g_simpleFilter);
+    Drawing::RuntimeShaderBuilder simpleBlurBuilder(simpleFilter_);
     simpleBlurBuilder.SetChild("imageInput", tmpShader);
-#ifdef RS_ENABLE_GPU
-    tmpBlur = simpleBlurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
-#else
-    tmpBlur = simpleBlurBuilder.MakeImage(nullptr, nullptr, scaledInfo, false);
-#endif
+    tmpBlur = GETransientSurfacePool::MakeImage(canvas, simpleBlurBuilder, scaledInfo, true);
     if (!tmpBlur) {
         return nullptr;
     }
@@ -349,7 +362,7 @@ std::shared_ptr<Drawing::ShaderEffect> GEMESABlurShaderFilter::DownSampling4X(Dr
 {
     const auto& blurMatrix = BuildMatrix(src, scaledInfo, input);
     if (isEasySampling) {
-        Drawing::RuntimeShaderBuilder simpleBlurBuilder(g_simpleFilter);
+        Drawing::RuntimeShaderBuilder simpleBlurBuilder(simpleFilter_);
         simpleBlurBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*input,
             Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix));
         return ApplyFuzedFilter(canvas, simpleBlurBuilder, input, nullptr, scaledInfo, scaledInfo, linear);
@@ -368,24 +381,16 @@ std::shared_ptr<Drawing::ShaderEffect> GEMESABlurShaderFilter::DownSampling8X(Dr
 {
     std::shared_ptr<Drawing::Image> tmpBlur_pre;
     Drawing::Matrix blurMatrix = BuildMatrix(src, middleInfo, input);
-    Drawing::RuntimeShaderBuilder simpleBlurBuilder(g_simpleFilter);
+    Drawing::RuntimeShaderBuilder simpleBlurBuilder(simpleFilter_);
     if (!isEasySampling) {
         blurBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*input,
             Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix));
         blurBuilder.SetUniform("in_blurOffset", BLUR_SCALE_1, BLUR_SCALE_1);
-#ifdef RS_ENABLE_GPU
-        tmpBlur_pre = blurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, middleInfo, false);
-#else
-        tmpBlur_pre = blurBuilder.MakeImage(nullptr, nullptr, middleInfo, false);
-#endif
+        tmpBlur_pre = GETransientSurfacePool::MakeImage(canvas, blurBuilder, middleInfo);
     } else {
         simpleBlurBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*input,
             Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix));
-#ifdef RS_ENABLE_GPU
-        tmpBlur_pre = simpleBlurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, middleInfo, false);
-#else
-        tmpBlur_pre = simpleBlurBuilder.MakeImage(nullptr, nullptr, middleInfo, false);
-#endif
+        tmpBlur_pre = GETransientSurfacePool::MakeImage(canvas, simpleBlurBuilder, middleInfo);
     }
     if (!tmpBlur_pre) {
         return nullptr;
@@ -408,20 +413,12 @@ std::shared_ptr<Drawing::ShaderEffect> GEMESABlurShaderFilter::DownSamplingMoreX
         blurBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*input,
             Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix));
         blurBuilder.SetUniform("in_blurOffset", BLUR_SCALE_1, BLUR_SCALE_1);
-#ifdef RS_ENABLE_GPU
-        tmpBlur_pre = blurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, middleInfo, false);
-#else
-        tmpBlur_pre = blurBuilder.MakeImage(nullptr, nullptr, middleInfo, false);
-#endif
+        tmpBlur_pre = GETransientSurfacePool::MakeImage(canvas, blurBuilder, middleInfo);
     } else {
-        Drawing::RuntimeShaderBuilder simpleBlurBuilder(g_simpleFilter);
+        Drawing::RuntimeShaderBuilder simpleBlurBuilder(simpleFilter_);
         simpleBlurBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*input,
             Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix));
-#ifdef RS_ENABLE_GPU
-        tmpBlur_pre = simpleBlurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, middleInfo, false);
-#else
-        tmpBlur_pre = simpleBlurBuilder.MakeImage(nullptr, nullptr, middleInfo, false);
-#endif
+        tmpBlur_pre = GETransientSurfacePool::MakeImage(canvas, simpleBlurBuilder, middleInfo);
     }
     if (!tmpBlur_pre) {
         return nullptr;
@@ -460,11 +457,7 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::DownSamplingFuzedBlur(Dr
     }
     blurBuilder.SetChild("imageInput", tmpShader);
     blurBuilder.SetUniform("in_blurOffset", blur.offsets[0], blur.offsets[1]);
-#ifdef RS_ENABLE_GPU
-    return blurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
-#else
-    return blurBuilder.MakeImage(nullptr, nullptr, scaledInfo, false);
-#endif
+    return GETransientSurfacePool::MakeImage(canvas, blurBuilder, scaledInfo);
 }
 
 std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::PingPongBlur(Drawing::Canvas& canvas,
@@ -478,11 +471,7 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::PingPongBlur(Drawing::Ca
         blurBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*tmpBlur,
             Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, Drawing::Matrix()));
         blurBuilder.SetUniform("in_blurOffset", blur.offsets[stride * i], blur.offsets[stride * i + 1]);
-#ifdef RS_ENABLE_GPU
-        tmpBlur = blurBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
-#else
-        tmpBlur = blurBuilder.MakeImage(nullptr, nullptr, scaledInfo, false);
-#endif
+        tmpBlur = GETransientSurfacePool::MakeImage(canvas, blurBuilder, scaledInfo);
         if (!tmpBlur) {
             return nullptr;
         }
@@ -542,11 +531,11 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::OnProcessImageWithoutUpS
     auto width = std::max(static_cast<int>(std::ceil(dst.GetWidth())), input->GetWidth());
     auto height = std::max(static_cast<int>(std::ceil(dst.GetHeight())), input->GetHeight());
     auto scaledInfo = ComputeImageInfo(originImageInfo, width, height);
-    Drawing::RuntimeShaderBuilder blurBuilder(g_blurEffect);
+    Drawing::RuntimeShaderBuilder blurBuilder(blurEffect_);
 
     if (isDirection_) {
         // 1.1. Set the direction of the blur width angle.
-        blurBuilder = Drawing::RuntimeShaderBuilder(g_directionBlurEffect);
+        blurBuilder = Drawing::RuntimeShaderBuilder(directionBlurEffect_);
         auto dirXY = GEMESABlurShaderFilter::AngleToDirection(angle_);
         blurBuilder.SetUniform("in_dir", dirXY.first, dirXY.second);
     }
@@ -560,7 +549,7 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::OnProcessImageWithoutUpS
     }
 
     // Step3. Blur iteration.
-    Drawing::RuntimeShaderBuilder simpleBlurBuilder(g_simpleFilter);
+    Drawing::RuntimeShaderBuilder simpleBlurBuilder(simpleFilter_);
     tmpBlur = PingPongBlur(canvas, blurBuilder, simpleBlurBuilder, tmpBlur, input, scaledInfo, linear, blur);
     return tmpBlur;
 }
@@ -579,7 +568,7 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::DownSamplingForEdge(Draw
         originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
     const auto& blurMatrix = BuildMatrix(src, scaledInfo, input);
 
-    Drawing::RuntimeShaderBuilder simpleBlurBuilder(g_simpleFilter);
+    Drawing::RuntimeShaderBuilder simpleBlurBuilder(simpleFilter_);
     simpleBlurBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*input,
         Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix));
 
@@ -604,6 +593,17 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::OnProcessImage(Drawing::
     if (radius_ <= 0 || radius_ >= 8000 || GetKawaseOriginalEnabled()) {  // 8000 experienced value
         return OutputImageWithoutBlur(canvas, image, src, dst);
     }
+    auto temporalOutput = ProcessImageTemporally(canvas, image, src, dst);
+    if (temporalOutput) {
+        return temporalOutput;
+    }
+    if (!isGreyX_ && !isDirection_ && GECpuBlur::ShouldUse(canvas)) {
+        auto cpuOutput = ProcessImageOnCpu(image, src, dst);
+        if (cpuOutput) {
+            return cpuOutput;
+        }
+        LOGD("GEMESABlurShaderFilter::OnProcessImage CPU blur not applicable, using the shaders");
+    }
     auto tmpBlur = OnProcessImageWithoutUpSampling(canvas, image, src, dst);
     if (!tmpBlur) {
         LOGE("GEMESABlurShaderFilter::OnProcessImage make image error in PingPongBlur");
@@ -617,10 +617,332 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::OnProcessImage(Drawing::
     return output;
 }
 
+std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::ProcessImageTemporally(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src, const Drawing::Rect& dst)
+{
+    NewBlurParams blur;
+    // Without a dirty rect no frame could reuse the output, keeping it would only cost a surface
+    if (!dirtyRect_.has_value() || isTemporalStoreRejected_ || !CanProcessTemporally(canvas, image, src, dst) ||
+        !SetBlurParams(blur) || isStretchX_ != PixelStretchFuzedMode::AFTER_BLUR || blurScale_ < 1e-6) {
+        return nullptr;
+    }
+    // Blurred at a multiple of the downsampling, so every patch starts on a texel of the downsampled image
+    int grid = static_cast<int>(std::round(1.0f / blurScale_));
+    int width = image->GetWidth();
+    int height = image->GetHeight();
+    int alignedWidth = (width + grid - 1) / grid * grid;
+    int alignedHeight = (height + grid - 1) / grid * grid;
+    Drawing::RectI area(0, 0, alignedWidth, alignedHeight);
+    Drawing::RectI patch = area;
+    const auto& info = image->GetImageInfo();
+    uint64_t key = GetTemporalCacheKey(info);
+    const void* context = canvas.GetGPUContext().get();
+    GEMESABlurTemporalCache newCache;
+    newCache.context = context;
+    newCache.width = width;
+    newCache.height = height;
+    newCache.bytesPerPixel = info.GetBytesPerPixel();
+    auto cache = cacheProvider_->GetByKeyAs<GEMESABlurTemporalCache>(key);
+    std::shared_ptr<Drawing::Surface> frontSurface;
+    std::shared_ptr<Drawing::Surface> surface;
+    Drawing::RectI stalePatch(0, 0, width, height);
+    bool isPatched = false;
+    if (cache != nullptr && cache->surface != nullptr && cache->context == context && cache->width == width &&
+        cache->height == height) {
+        Drawing::RectI dirty(std::max(0, static_cast<int>(std::floor(dirtyRect_->GetLeft()))),
+            std::max(0, static_cast<int>(std::floor(dirtyRect_->GetTop()))),
+            std::min(width, static_cast<int>(std::ceil(dirtyRect_->GetRight()))),
+            std::min(height, static_cast<int>(std::ceil(dirtyRect_->GetBottom()))));
+        if (dirty.GetWidth() <= 0 || dirty.GetHeight() <= 0) {
+            LOGD("GEMESABlurShaderFilter::ProcessImageTemporally input unchanged, reuse the previous output");
+            return cache->surface->GetImageSnapshot();
+        }
+        // The outputs the dirty rect reaches, then the inputs those outputs read
+        int support = GetTemporalSupport(blur);
+        auto patchOutputs = OutsetToGrid(dirty, support, grid, alignedWidth, alignedHeight);
+        auto patchInputs = OutsetToGrid(patchOutputs, support, grid, alignedWidth, alignedHeight);
+        // Larger patches blur the whole image again
+        isPatched = static_cast<float>(patchInputs.GetWidth()) * patchInputs.GetHeight() <=
+            TEMPORAL_MAX_AREA_RATIO * alignedWidth * alignedHeight;
+        if (isPatched) {
+            area = patchInputs;
+            patch = patchOutputs;
+        }
+        frontSurface = cache->surface;
+        surface = cache->backSurface;
+        if (surface != nullptr) {
+            stalePatch = cache->stalePatch;
+        }
+    } else if (!cacheProvider_->StoreByKey(newCache, key)) {
+        // Asked with the size of both surfaces before paying for either
+        LOGD("GEMESABlurShaderFilter::ProcessImageTemporally cache provider rejects the output, not kept");
+        isTemporalStoreRejected_ = true;
+        return nullptr;
+    }
+    bool isNewSurface = surface == nullptr;
+    Drawing::ImageInfo surfaceInfo(width, height, info.GetColorType(), info.GetAlphaType(), info.GetColorSpace());
+    if (isNewSurface) {
+        surface = GETransientSurfacePool::AcquireSurface(canvas, surfaceInfo);
+    }
+    if (surface == nullptr || (isPatched && !CopyTemporalPatch(*frontSurface, *surface, stalePatch)) ||
+        !BlurTemporalArea(canvas, image, area, patch, *surface)) {
+        // The kept output no longer matches the input, the next frame blurs the whole image again
+        LOGE("GEMESABlurShaderFilter::ProcessImageTemporally blur failed");
+        cacheProvider_->StoreByKey(GEMESABlurTemporalCache(), key);
+        if (isNewSurface) {
+            GETransientSurfacePool::ReleaseSurface(canvas, surface, surfaceInfo);
+        }
+        return nullptr;
+    }
+    auto output = surface->GetImageSnapshot();
+    // The next frame draws over the output before, which the caller no longer reads by then
+    newCache.surface = surface;
+    newCache.backSurface = frontSurface;
+    newCache.stalePatch = patch;
+    if (!cacheProvider_->StoreByKey(newCache, key)) {
+        LOGD("GEMESABlurShaderFilter::ProcessImageTemporally cache provider rejects the output, not kept");
+        isTemporalStoreRejected_ = true;
+        cacheProvider_->StoreByKey(GEMESABlurTemporalCache(), key);
+        if (isNewSurface) {
+            GETransientSurfacePool::ReleaseSurface(canvas, surface, surfaceInfo, output);
+        }
+    }
+    return output;
+}
+
+bool GEMESABlurShaderFilter::CanProcessTemporally(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src, const Drawing::Rect& dst) const
+{
+#ifdef RS_ENABLE_GPU
+    if (cacheProvider_ == nullptr || canvas.GetGPUContext() == nullptr || isFrostedGlassBlur_ ||
+        !IsTemporalEnabled()) {
+        return false;
+    }
+    bool hasStretch = std::abs(offsetX_) > 1e-6 || std::abs(offsetY_) > 1e-6 || std::abs(offsetZ_) > 1e-6 ||
+        std::abs(offsetW_) > 1e-6;
+    // Patches are placed in output pixels, which are input pixels only when the image is blurred in place
+    Drawing::Rect bounds(0.0f, 0.0f, static_cast<float>(image->GetWidth()), static_cast<float>(image->GetHeight()));
+    return !hasStretch && src == bounds && dst == bounds;
+#else
+    return false;
+#endif
+}
+
+int GEMESABlurShaderFilter::GetTemporalSupport(const NewBlurParams& blur) const
+{
+    // In texels of the downsampled image: the downsampling stages and the upsampling with their taps, then the
+    // taps of every pass and their bilinear footprint
+    float texels = 5.0f; // 5: three downsampling stages of 1.25 texels and the upsampling
+    int stride = 2;     // 2: stride
+    for (int i = 0; i < blur.numberOfPasses; i++) {
+        texels += std::abs(blur.offsets[stride * i]) + std::abs(blur.offsets[stride * i + 1]) + 1.0f;
+    }
+    return static_cast<int>(std::ceil(texels / blurScale_));
+}
+
+Drawing::RectI GEMESABlurShaderFilter::OutsetToGrid(const Drawing::RectI& rect, int outset, int grid, int width,
+    int height)
+{
+    // width and height are multiples of grid, clamping keeps the edges on it
+    int left = std::max(0, rect.GetLeft() - outset) / grid * grid;
+    int top = std::max(0, rect.GetTop() - outset) / grid * grid;
+    int right = (std::min(width, rect.GetRight() + outset) + grid - 1) / grid * grid;
+    int bottom = (std::min(height, rect.GetBottom() + outset) + grid - 1) / grid * grid;
+    return Drawing::RectI(left, top, right, bottom);
+}
+
+uint64_t GEMESABlurShaderFilter::GetTemporalCacheKey(const Drawing::ImageInfo& info) const
+{
+    Drawing::GEParamsHasher hasher;
+    hasher.Combine(radius_);
+    hasher.Combine(greyCoef1_);
+    hasher.Combine(greyCoef2_);
+    hasher.Combine(isDirection_);
+    hasher.Combine(angle_);
+    hasher.Combine(static_cast<int32_t>(tileMode_));
+    hasher.Combine(info.GetWidth());
+    hasher.Combine(info.GetHeight());
+    hasher.Combine(static_cast<int32_t>(info.GetColorType()));
+    hasher.Combine(static_cast<int32_t>(info.GetAlphaType()));
+    return hasher.GetResult();
+}
+
+bool GEMESABlurShaderFilter::BlurTemporalArea(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
+    const Drawing::RectI& area, const Drawing::RectI& patch, Drawing::Surface& surface)
+{
+    GE_TRACE_NAME_FMT("GEMESABlurShaderFilter::BlurTemporalArea, Width: %d, Height: %d, Patch: %d x %d",
+        area.GetWidth(), area.GetHeight(), patch.GetWidth(), patch.GetHeight());
+    auto surfaceCanvas = surface.GetCanvas();
+    if (surfaceCanvas == nullptr) {
+        return false;
+    }
+    Drawing::Rect areaRect(0.0f, 0.0f, static_cast<float>(area.GetWidth()), static_cast<float>(area.GetHeight()));
+    auto input = image;
+    if (area.GetLeft() != 0 || area.GetTop() != 0 || area.GetWidth() != image->GetWidth() ||
+        area.GetHeight() != image->GetHeight()) {
+        // Clamped like the image shaders of the blur read the edges of the whole image
+        Drawing::Matrix areaMatrix;
+        areaMatrix.Translate(-area.GetLeft(), -area.GetTop());
+        Drawing::SamplingOptions nearest(Drawing::FilterMode::NEAREST, Drawing::MipmapMode::NONE);
+        Drawing::RuntimeShaderBuilder areaBuilder(simpleFilter_);
+        areaBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(*image,
+            Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, nearest, areaMatrix));
+        const auto& info = image->GetImageInfo();
+        input = GETransientSurfacePool::MakeImage(canvas, areaBuilder, Drawing::ImageInfo(area.GetWidth(),
+            area.GetHeight(), info.GetColorType(), info.GetAlphaType(), info.GetColorSpace()));
+        if (!input) {
+            return false;
+        }
+    }
+    auto blurred = OnProcessImageWithoutUpSampling(canvas, input, areaRect, areaRect);
+    if (!blurred) {
+        return false;
+    }
+    Drawing::RuntimeShaderBuilder mixBuilder(mixEffect_);
+    SetMixInput(mixBuilder, blurred, areaRect);
+    Drawing::Brush brush;
+    brush.SetShaderEffect(mixBuilder.MakeShader(nullptr, false));
+    // Every pixel of the patch is replaced, the rest of the surface keeps the previous output
+    brush.SetBlendMode(Drawing::BlendMode::SRC);
+    surfaceCanvas->Save();
+    surfaceCanvas->ClipRect(Drawing::Rect(patch.GetLeft(), patch.GetTop(), patch.GetRight(), patch.GetBottom()));
+    surfaceCanvas->Translate(area.GetLeft(), area.GetTop());
+    surfaceCanvas->AttachBrush(brush);
+    surfaceCanvas->DrawRect(areaRect);
+    surfaceCanvas->DetachBrush();
+    surfaceCanvas->Restore();
+    return true;
+}
+
+bool GEMESABlurShaderFilter::CopyTemporalPatch(Drawing::Surface& from, Drawing::Surface& to,
+    const Drawing::RectI& patch)
+{
+    auto image = from.GetImageSnapshot();
+    auto toCanvas = to.GetCanvas();
+    if (image == nullptr || toCanvas == nullptr) {
+        return false;
+    }
+    // Patches are aligned to the downsampling and may reach past the image
+    Drawing::Rect rect(static_cast<float>(std::max(patch.GetLeft(), 0)),
+        static_cast<float>(std::max(patch.GetTop(), 0)),
+        static_cast<float>(std::min(patch.GetRight(), image->GetWidth())),
+        static_cast<float>(std::min(patch.GetBottom(), image->GetHeight())));
+    if (rect.IsEmpty()) {
+        return true;
+    }
+    Drawing::Brush brush;
+    brush.SetBlendMode(Drawing::BlendMode::SRC);
+    toCanvas->AttachBrush(brush);
+    toCanvas->DrawImageRect(*image, rect, rect, Drawing::SamplingOptions());
+    toCanvas->DetachBrush();
+    return true;
+}
+
+bool GEMESABlurShaderFilter::IsTemporalEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.mesatemporal", "1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 1) != 0;
+#else
+    return true;
+#endif
+}
+
+std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::ProcessImageOnCpu(
+    const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src, const Drawing::Rect& dst)
+{
+    NewBlurParams blur;
+    if (!SetBlurParams(blur) || isStretchX_ != PixelStretchFuzedMode::AFTER_BLUR) {
+        return nullptr;
+    }
+    bool hasStretch = std::abs(offsetX_) > 1e-6 || std::abs(offsetY_) > 1e-6 || std::abs(offsetZ_) > 1e-6 ||
+        std::abs(offsetW_) > 1e-6;
+    if (hasStretch && tileMode_ != Drawing::TileMode::CLAMP) {
+        return nullptr;
+    }
+    GE_TRACE_NAME_FMT("GEMESABlurShaderFilter::ProcessImageOnCpu, Passes: %d", blur.numberOfPasses);
+    auto originImageInfo = image->GetImageInfo();
+    auto width = std::max(static_cast<int>(std::ceil(dst.GetWidth())), image->GetWidth());
+    auto height = std::max(static_cast<int>(std::ceil(dst.GetHeight())), image->GetHeight());
+    auto scaledInfo = ComputeImageInfo(originImageInfo, width, height);
+    auto middleInfo = Drawing::ImageInfo(std::ceil(width * BLUR_SCALE_1), std::ceil(height * BLUR_SCALE_1),
+        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+    auto middleInfo2 = Drawing::ImageInfo(std::ceil(width * BLUR_SCALE_3), std::ceil(height * BLUR_SCALE_3),
+        originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+    int scaledWidth = scaledInfo.GetWidth();
+    int scaledHeight = scaledInfo.GetHeight();
+    if (scaledWidth <= 0 || scaledHeight <= 0 || middleInfo2.GetWidth() <= 0 || middleInfo2.GetHeight() <= 0) {
+        return nullptr;
+    }
+    GECpuBlur::Buffer source;
+    if (!GECpuBlur::ReadImage(image, source)) {
+        return nullptr;
+    }
+
+    // The downsampling of DownSamplingFuzedBlur, step by step, then its blur pass
+    GECpuBlur::Buffer blurred;
+    GECpuBlur::Buffer scratch;
+    GECpuBlur::Mapping mapping;
+    if (GE_GNE(blurScale_, BLUR_SCALE_1)) {
+        if (!GECpuBlur::MakeMapping(BuildMatrix(src, scaledInfo, image), mapping)) {
+            return nullptr;
+        }
+    } else if (GE_GNE(blurScale_, BLUR_SCALE_2)) {
+        if (!GECpuBlur::MakeMapping(BuildMatrix(src, scaledInfo, image), mapping)) {
+            return nullptr;
+        }
+        GECpuBlur::MesaPass(source, mapping, BLUR_SCALE_1, BLUR_SCALE_1, scaledWidth, scaledHeight, scratch);
+        std::swap(source, scratch);
+        mapping = GECpuBlur::Mapping();
+    } else {
+        if (!GECpuBlur::MakeMapping(BuildMatrix(src, middleInfo, image), mapping)) {
+            return nullptr;
+        }
+        GECpuBlur::MesaPass(source, mapping, BLUR_SCALE_1, BLUR_SCALE_1, middleInfo.GetWidth(),
+            middleInfo.GetHeight(), scratch);
+        std::swap(source, scratch);
+        if (GE_GNE(blurScale_, BLUR_SCALE_3)) {
+            GECpuBlur::MakeMapping(BuildMiddleMatrix(scaledInfo, middleInfo), mapping);
+            GECpuBlur::Resample(source, mapping, scaledWidth, scaledHeight, scratch);
+            std::swap(source, scratch);
+            mapping = GECpuBlur::Mapping();
+        } else {
+            GECpuBlur::MakeMapping(BuildMiddleMatrix(middleInfo2, middleInfo), mapping);
+            GECpuBlur::MesaPass(source, mapping, BLUR_SCALE_1, BLUR_SCALE_1, middleInfo2.GetWidth(),
+                middleInfo2.GetHeight(), scratch);
+            std::swap(source, scratch);
+            GECpuBlur::MakeMapping(BuildMiddleMatrix(scaledInfo, middleInfo2), mapping);
+        }
+    }
+    GECpuBlur::MesaPass(source, mapping, blur.offsets[0], blur.offsets[1], scaledWidth, scaledHeight, blurred);
+
+    // PingPongBlur
+    int stride = 2;     // 2: stride
+    for (auto i = 1; i < blur.numberOfPasses; i++) {
+        GECpuBlur::MesaPass(blurred, GECpuBlur::Mapping(), blur.offsets[stride * i], blur.offsets[stride * i + 1],
+            scaledWidth, scaledHeight, scratch);
+        std::swap(blurred, scratch);
+    }
+
+    // The mix shader of ScaleAndAddRandomColor
+    width = std::max(static_cast<int>(std::ceil(dst.GetWidth())), image->GetWidth());
+    height = std::max(static_cast<int>(std::ceil(dst.GetHeight())), image->GetHeight());
+    Drawing::Rect blurredRect(0.0f, 0.0f, static_cast<float>(blurred.width), static_cast<float>(blurred.height));
+    if (!GECpuBlur::MakeMapping(BuildStretchMatrixFull(blurredRect, dst, blurred.width, blurred.height), mapping)) {
+        return nullptr;
+    }
+    static auto factor = 1.75; // 1.75 from experience
+    GECpuBlur::MixAndDither(blurred, mapping, nullptr, GECpuBlur::Mapping(), 1.0f, factor, width, height, scratch);
+    return GECpuBlur::MakeImage(scratch, Drawing::ImageInfo(width, height, originImageInfo.GetColorType(),
+        originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace()));
+}
+
 bool GEMESABlurShaderFilter::IsInputValid(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
     const Drawing::Rect& src, const Drawing::Rect& dst)
 {
-    if (!g_blurEffect || !g_mixEffect || !image || !g_simpleFilter || (isGreyX_ && !g_greyAdjustEffect)) {
+    if (!blurEffect_ || !mixEffect_ || !image || !simpleFilter_ || (isGreyX_ && !greyAdjustEffect_)) {
         LOGE("GEMESABlurShaderFilter::IsInputValid invalid shader or image");
         return false;
     }
@@ -701,7 +1023,7 @@ Drawing::Matrix GEMESABlurShaderFilter::BuildStretchMatrix(const Drawing::ImageI
 
 bool GEMESABlurShaderFilter::InitBlurEffect()
 {
-    if (g_blurEffect != nullptr) {
+    if (blurEffect_ != nullptr) {
         return true;
     }
 
@@ -718,8 +1040,8 @@ bool GEMESABlurShaderFilter::InitBlurEffect()
         }
     )");
 
-    g_blurEffect = GECreateRuntimeEffectForShader(blurStringMESA);
-    if (g_blurEffect == nullptr) {
+    blurEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(blurStringMESA);
+    if (blurEffect_ == nullptr) {
         LOGE("GEMESABlurShaderFilter::RuntimeShader blurEffect create failed");
         return false;
     }
@@ -729,7 +1051,7 @@ bool GEMESABlurShaderFilter::InitBlurEffect()
 
 bool GEMESABlurShaderFilter::InitDirectionBlurEffect()
 {
-    if (g_directionBlurEffect != nullptr) {
+    if (directionBlurEffect_ != nullptr) {
         return true;
     }
 
@@ -745,8 +1067,8 @@ bool GEMESABlurShaderFilter::InitDirectionBlurEffect()
         }
     )");
 
-    g_directionBlurEffect = GECreateRuntimeEffectForShader(directionBlurStringMESA);
-    if (g_directionBlurEffect == nullptr) {
+    directionBlurEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(directionBlurStringMESA);
+    if (directionBlurEffect_ == nullptr) {
         LOGE("GEMESABlurShaderFilter::RuntimeShader directionBlurEffect create failed");
         return false;
     }
@@ -756,7 +1078,7 @@ bool GEMESABlurShaderFilter::InitDirectionBlurEffect()
 
 bool GEMESABlurShaderFilter::InitMixEffect()
 {
-    if (g_mixEffect != nullptr) {
+    if (mixEffect_ != nullptr) {
         return true;
     }
 
@@ -778,8 +1100,8 @@ bool GEMESABlurShaderFilter::InitMixEffect()
         }
     )");
 
-    g_mixEffect = GECreateRuntimeEffectForShader(mixStringMESA);
-    if (g_mixEffect == nullptr) {
+    mixEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(mixStringMESA);
+    if (mixEffect_ == nullptr) {
         LOGE("GEMESABlurShaderFilter::RuntimeShader mixEffect create failed");
         return false;
     }
@@ -789,7 +1111,7 @@ bool GEMESABlurShaderFilter::InitMixEffect()
 
 bool GEMESABlurShaderFilter::InitSimpleFilter()
 {
-    if (g_simpleFilter != nullptr) {
+    if (simpleFilter_ != nullptr) {
         return true;
     }
 
@@ -799,8 +1121,8 @@ bool GEMESABlurShaderFilter::InitSimpleFilter()
             return imageInput.eval(xy);
         }
     )");
-    g_simpleFilter = GECreateRuntimeEffectForShader(simpleShader);
-    if (g_simpleFilter == nullptr) {
+    simpleFilter_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(simpleShader);
+    if (simpleFilter_ == nullptr) {
         LOGE("GEMESABlurShaderFilter::RuntimeShader simpleFilter create failed");
         return false;
     }
@@ -838,9 +1160,9 @@ bool GEMESABlurShaderFilter::InitGreyAdjustmentEffect()
             return vec4(color+dY, 1.0);
         }
     )");
-    if (g_greyAdjustEffect == nullptr) {
-        g_greyAdjustEffect = GECreateRuntimeEffectForShader(greyXShader);
-        if (g_greyAdjustEffect == nullptr) {
+    if (greyAdjustEffect_ == nullptr) {
+        greyAdjustEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(greyXShader);
+        if (greyAdjustEffect_ == nullptr) {
             LOGE("GEMESABlurShaderFilter::RuntimeShader greyAdjustEffect create failed");
             return false;
         }
@@ -889,7 +1211,7 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::OutputImageWithoutBlur(D
 
     std::shared_ptr<Drawing::Image> output;
     if (isGreyX_) {
-        Drawing::RuntimeShaderBuilder builder(g_greyAdjustEffect);
+        Drawing::RuntimeShaderBuilder builder(greyAdjustEffect_);
         auto inputShader = Drawing::ShaderEffect::CreateImageShader(*image, tileMode_, tileMode_, linear, inputMatrix);
         builder.SetChild("imageShader", inputShader);
         builder.SetUniform("coefficient1", greyCoef1_);
@@ -900,7 +1222,7 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::OutputImageWithoutBlur(D
         output = builder.MakeImage(nullptr, nullptr, imageInfo, false);
 #endif
     } else {
-        Drawing::RuntimeShaderBuilder builder(g_simpleFilter);
+        Drawing::RuntimeShaderBuilder builder(simpleFilter_);
         auto inputShader = Drawing::ShaderEffect::CreateImageShader(*image, tileMode_, tileMode_, linear, inputMatrix);
         builder.SetChild("imageInput", inputShader);
 #ifdef RS_ENABLE_GPU
@@ -927,10 +1249,22 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::ScaleAndAddRandomColor(D
         return blurImage;
     }
 
-    Drawing::RuntimeShaderBuilder mixBuilder(g_mixEffect);
-    Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
+    Drawing::RuntimeShaderBuilder mixBuilder(mixEffect_);
     auto scaledInfo = Drawing::ImageInfo(width, height, blurImage->GetImageInfo().GetColorType(),
         blurImage->GetImageInfo().GetAlphaType(), blurImage->GetImageInfo().GetColorSpace());
+    SetMixInput(mixBuilder, blurImage, dst);
+#ifdef RS_ENABLE_GPU
+    auto output = mixBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
+#else
+    auto output = mixBuilder.MakeImage(nullptr, nullptr, scaledInfo, false);
+#endif
+    return output;
+}
+
+void GEMESABlurShaderFilter::SetMixInput(Drawing::RuntimeShaderBuilder& mixBuilder,
+    const std::shared_ptr<Drawing::Image>& blurImage, const Drawing::Rect& dst) const
+{
+    Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
     if (isStretchX_ != PixelStretchFuzedMode::AFTER_BLUR) {
         Drawing::Matrix scaleMatrix;
         // blurImage->GetWidth() and blurImage->GetHeight() are larger than zero, checked before
@@ -954,12 +1288,6 @@ std::shared_ptr<Drawing::Image> GEMESABlurShaderFilter::ScaleAndAddRandomColor(D
     static auto factor = 1.75; // 1.75 from experience
 
     mixBuilder.SetUniform("inColorFactor", factor);
-#ifdef RS_ENABLE_GPU
-    auto output = mixBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
-#else
-    auto output = mixBuilder.MakeImage(nullptr, nullptr, scaledInfo, false);
-#endif
-    return output;
 }
 
 std::string GEMESABlurShaderFilter::GetDescription() const
@@ -20,7 +20,7 @@
 
 #include "draw/surface.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -80,7 +80,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GEMotionBlurShaderFilter::GetMotionBlurE
                 return color;
             }
         )";
-        g_motionBlurEffect = GECreateRuntimeEffectForShader(motionBlurProg);
+        g_motionBlurEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(motionBlurProg);
         if (g_motionBlurEffect == nullptr) {
             LOGE("GEMotionBlurShaderFilter::GetMotionBlurEffect create failed");
             return nullptr;
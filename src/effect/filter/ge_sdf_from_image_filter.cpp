@@ -15,24 +15,55 @@
 
 #include "ge_sdf_from_image_filter.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "draw/surface.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_cpu_generator.h"
 #include "ge_system_properties.h"
 #include "src/core/SkOpts.h"
 #include "ge_mesa_blur_shader_filter.h"
 #include "ge_trace.h"
+#include "image/bitmap.h"
 
 namespace OHOS {
 namespace Rosen {
 namespace {
 constexpr int MAX_SPREAD_FACTOR = 4096;
 constexpr int TWO = 2;
-} // namespace
+// Reach of the fake blur plus the largest fill deriv step, rounded up
+constexpr int DERIV_TILE_MARGIN = 12;
+// Larger margins leave tiles hardly smaller than the output
+constexpr int MAX_TILE_MARGIN = GESDFFromImageFilter::TILE_SIZE / 2;
+constexpr size_t RGBA_CHANNELS = 4;
+constexpr size_t ALPHA_CHANNEL = 3;
+constexpr float PIXEL_CENTER = 0.5f;
+constexpr float CHANNEL_MAX = 255.0f;
+// Constants of the fill deriv shader
+constexpr float DERIV_WIDTH = 64.0f;
+constexpr float DERIV_MIN_STEP = 2.0f;
+constexpr float DERIV_STEP_SCALE = 0.2f;
+constexpr float DERIV_MAX_EXTRA_STEP = 8.0f;
+constexpr float DERIV_FLAT_HIGH = 0.95f;
+constexpr float DERIV_FLAT_LOW = 0.05f;
+constexpr float DERIV_FLAT_GRAD_SQ = 0.0001f;
+constexpr float DERIV_SPINE_START = 0.2f;
+constexpr float DERIV_BIAS = 0.0001f;
+
+float SmoothStep(float edge0, float edge1, float x)
+{
+    float t = std::clamp((x - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+    return t * t * (3.0f - 2.0f * t); // 3.0, 2.0: Hermite smoothstep
+}
 
-static std::shared_ptr<Drawing::RuntimeEffect> g_JFAPrepareEffect;
-static std::shared_ptr<Drawing::RuntimeEffect> g_jfaIterationEffect;
-static std::shared_ptr<Drawing::RuntimeEffect> g_jfaProcessResultEffect;
-static std::shared_ptr<Drawing::RuntimeEffect> g_sdfFillDerivEffect;
+uint8_t ToChannel(float value)
+{
+    return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) * CHANNEL_MAX));
+}
+} // namespace
 
 GESDFFromImageFilter::GESDFFromImageFilter(const Drawing::GESDFFromImageFilterParams& params)
     : spreadFactor_(params.spreadFactor), generateDerivs_(params.generateDerivs)
@@ -82,7 +113,7 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::FakeBlur(Drawing::Canvas &
 {
     GE_TRACE_NAME_FMT("GESDFFromImageFilter::FakeBlur Run FakeBlur function.");
     if (!g_sampleShaderEffect) {
-        g_sampleShaderEffect = GECreateRuntimeEffectForShader(BOX_BLUR_PROG);
+        g_sampleShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(BOX_BLUR_PROG);
         if (g_sampleShaderEffect == nullptr) {
             GE_LOGE("GEEdgeLightShaderFilter::RuntimeShader g_gaussShaderEffect create failed.");
             return nullptr;
@@ -128,32 +159,56 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::OnProcessImage(Drawing::Ca
     const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst)
 {
     GE_TRACE_NAME_FMT("GESDFFromImageFilter::OnProcessImage Convert image to SDF once");
+    if (image != nullptr && GESDFCpuGenerator::IsEnabled(false)) {
+        auto cpuOutput = ProcessImageOnCpu(image, src, dst);
+        if (cpuOutput) {
+            return cpuOutput;
+        }
+        GE_LOGE("GESDFFromImageFilter::OnProcessImage CPU SDF failed, falling back to GPU");
+    }
     if (!IsInputValid(canvas, image, src, dst)) {
         return image;
     }
 
+    int outputWidth = std::max(static_cast<int>(std::ceil(dst.GetWidth())), image->GetWidth());
+    int outputHeight = std::max(static_cast<int>(std::ceil(dst.GetHeight())), image->GetHeight());
+    if (canvas.GetGPUContext() != nullptr && UseTiles(outputWidth, outputHeight)) {
+        auto tiledOutput = ProcessImageTiled(canvas, image, src, dst);
+        if (tiledOutput) {
+            return tiledOutput;
+        }
+        GE_LOGE("GESDFFromImageFilter::OnProcessImage tiled SDF failed, falling back to the full output");
+    }
+    auto output = ProcessArea(canvas, image, src, dst, Drawing::RectI(0, 0, outputWidth, outputHeight));
+    return output ? output : image;
+}
+
+std::shared_ptr<Drawing::Image> GESDFFromImageFilter::ProcessArea(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src, const Drawing::Rect& dst,
+    const Drawing::RectI& area)
+{
     static const Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
     static const Drawing::SamplingOptions nearest(Drawing::FilterMode::NEAREST, Drawing::MipmapMode::NONE);
 
     std::shared_ptr<Drawing::Image> initOutput = nullptr;
-    initOutput = RunJFAPrepareEffect(canvas, image, linear, src, dst, Drawing::ColorType::COLORTYPE_RGBA_F16);
+    initOutput = RunJFAPrepareEffect(canvas, image, linear, src, dst, area, Drawing::ColorType::COLORTYPE_RGBA_F16);
     if (!initOutput) {
         GE_LOGE("GESDFFromImageFilter::OnProcessImage Init make image error");
-        return image;
+        return nullptr;
     }
 
     std::shared_ptr<Drawing::Image> iterationsOutput = nullptr;
     iterationsOutput = RunJfaIterationsEffect(canvas, initOutput, nearest, Drawing::ColorType::COLORTYPE_RGBA_F16);
     if (!iterationsOutput) {
         GE_LOGE("GESDFFromImageFilter::OnProcessImage Iterations make image error");
-        return image;
+        return nullptr;
     }
 
     std::shared_ptr<Drawing::Image> sdfOutput = nullptr;
     sdfOutput = RunJfaProcessResultEffect(canvas, iterationsOutput, nearest, image->GetColorType());
     if (!sdfOutput) {
         GE_LOGE("GESDFFromImageFilter::OnProcessImage ProcessResult make image error");
-        return image;
+        return nullptr;
     }
 
     if (!generateDerivs_) {
@@ -176,9 +231,102 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::OnProcessImage(Drawing::Ca
     return derivOutput;
 }
 
+int GESDFFromImageFilter::GetTileMargin() const
+{
+    // 1: the prepare pass reads the gradient half a pixel around each pixel
+    return spreadFactor_ + (generateDerivs_ ? DERIV_TILE_MARGIN : 0) + 1;
+}
+
+bool GESDFFromImageFilter::UseTiles(int outputWidth, int outputHeight) const
+{
+    if (outputWidth <= MAX_UNTILED_SIZE && outputHeight <= MAX_UNTILED_SIZE) {
+        return false;
+    }
+    return GetTileMargin() <= MAX_TILE_MARGIN && IsTilingEnabled();
+}
+
+std::vector<GESDFFromImageFilter::Tile> GESDFFromImageFilter::MakeTiles(int outputWidth, int outputHeight) const
+{
+    std::vector<Tile> tiles;
+    if (outputWidth <= 0 || outputHeight <= 0) {
+        return tiles;
+    }
+    // Cores split the output evenly, so no tile is left with a sliver the blur pass would skip
+    int columns = (outputWidth + TILE_SIZE - 1) / TILE_SIZE;
+    int rows = (outputHeight + TILE_SIZE - 1) / TILE_SIZE;
+    int coreWidth = (outputWidth + columns - 1) / columns;
+    int coreHeight = (outputHeight + rows - 1) / rows;
+    int margin = GetTileMargin();
+    tiles.reserve(static_cast<size_t>(columns) * static_cast<size_t>(rows));
+    for (int top = 0; top < outputHeight; top += coreHeight) {
+        int bottom = std::min(top + coreHeight, outputHeight);
+        for (int left = 0; left < outputWidth; left += coreWidth) {
+            int right = std::min(left + coreWidth, outputWidth);
+            Tile tile;
+            tile.core = Drawing::RectI(left, top, right, bottom);
+            tile.area = Drawing::RectI(std::max(left - margin, 0), std::max(top - margin, 0),
+                std::min(right + margin, outputWidth), std::min(bottom + margin, outputHeight));
+            tiles.push_back(tile);
+        }
+    }
+    return tiles;
+}
+
+std::shared_ptr<Drawing::Image> GESDFFromImageFilter::ProcessImageTiled(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::Image>& image, const Drawing::Rect& src, const Drawing::Rect& dst)
+{
+#ifdef RS_ENABLE_GPU
+    int outputWidth = std::max(static_cast<int>(std::ceil(dst.GetWidth())), image->GetWidth());
+    int outputHeight = std::max(static_cast<int>(std::ceil(dst.GetHeight())), image->GetHeight());
+    auto tiles = MakeTiles(outputWidth, outputHeight);
+    GE_TRACE_NAME_FMT("GESDFFromImageFilter::ProcessImageTiled, Width: %d, Height: %d, Tiles: %zu",
+        outputWidth, outputHeight, tiles.size());
+    auto imageInfo = image->GetImageInfo();
+    auto outputImageInfo = Drawing::ImageInfo(
+        outputWidth, outputHeight, image->GetColorType(), imageInfo.GetAlphaType(), imageInfo.GetColorSpace());
+    auto outputSurface = Drawing::Surface::MakeRenderTarget(canvas.GetGPUContext().get(), false, outputImageInfo);
+    auto outputCanvas = outputSurface ? outputSurface->GetCanvas() : nullptr;
+    if (!outputCanvas) {
+        GE_LOGE("GESDFFromImageFilter::ProcessImageTiled create output surface failed");
+        return nullptr;
+    }
+    static const Drawing::SamplingOptions nearest(Drawing::FilterMode::NEAREST, Drawing::MipmapMode::NONE);
+    Drawing::Brush brush;
+    brush.SetBlendMode(Drawing::BlendMode::SRC);
+    for (const auto& tile : tiles) {
+        // Only the area of this tile is alive, its images are released before the next one is made
+        auto tileOutput = ProcessArea(canvas, image, src, dst, tile.area);
+        if (!tileOutput) {
+            return nullptr;
+        }
+        Drawing::Rect coreInTile(tile.core.GetLeft() - tile.area.GetLeft(), tile.core.GetTop() - tile.area.GetTop(),
+            tile.core.GetRight() - tile.area.GetLeft(), tile.core.GetBottom() - tile.area.GetTop());
+        Drawing::Rect core(tile.core.GetLeft(), tile.core.GetTop(), tile.core.GetRight(), tile.core.GetBottom());
+        outputCanvas->AttachBrush(brush);
+        outputCanvas->DrawImageRect(*tileOutput, coreInTile, core, nearest);
+        outputCanvas->DetachBrush();
+    }
+    return outputSurface->GetImageSnapshot();
+#else
+    return nullptr;
+#endif
+}
+
+bool GESDFFromImageFilter::IsTilingEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.sdftile", "1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 1) != 0;
+#else
+    return true;
+#endif
+}
+
 bool GESDFFromImageFilter::InitJFAPrepareEffect()
 {
-    if (g_JFAPrepareEffect != nullptr) {
+    if (jfaPrepareEffect_ != nullptr) {
         return true;
     }
 
@@ -220,8 +368,8 @@ bool GESDFFromImageFilter::InitJFAPrepareEffect()
         }
     )");
 
-    g_JFAPrepareEffect = GECreateRuntimeEffectForShader(shaderString);
-    if (g_JFAPrepareEffect == nullptr) {
+    jfaPrepareEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderString);
+    if (jfaPrepareEffect_ == nullptr) {
         GE_LOGE("GESDFFromImageFilter::InitJFAPrepareEffect failed");
         return false;
     }
@@ -280,12 +428,12 @@ inline static const std::string JFA_ITERATION_PROG = R"(
 
 bool GESDFFromImageFilter::InitJfaIterationEffect()
 {
-    if (g_jfaIterationEffect != nullptr) {
+    if (jfaIterationEffect_ != nullptr) {
         return true;
     }
 
-    g_jfaIterationEffect = GECreateRuntimeEffectForShader(JFA_ITERATION_PROG);
-    if (g_jfaIterationEffect == nullptr) {
+    jfaIterationEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(JFA_ITERATION_PROG);
+    if (jfaIterationEffect_ == nullptr) {
         GE_LOGE("GESDFFromImageFilter::InitJfaIterationEffect failed");
         return false;
     }
@@ -295,7 +443,7 @@ bool GESDFFromImageFilter::InitJfaIterationEffect()
 
 bool GESDFFromImageFilter::InitJfaProcessResultEffect()
 {
-    if (g_jfaProcessResultEffect != nullptr) {
+    if (jfaProcessResultEffect_ != nullptr) {
         return true;
     }
 
@@ -316,8 +464,8 @@ bool GESDFFromImageFilter::InitJfaProcessResultEffect()
         }
     )");
 
-    g_jfaProcessResultEffect = GECreateRuntimeEffectForShader(shaderString);
-    if (g_jfaProcessResultEffect == nullptr) {
+    jfaProcessResultEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderString);
+    if (jfaProcessResultEffect_ == nullptr) {
         GE_LOGE("GESDFFromImageFilter::InitJfaProcessResultEffect failed");
         return false;
     }
@@ -327,7 +475,7 @@ bool GESDFFromImageFilter::InitJfaProcessResultEffect()
 
 bool GESDFFromImageFilter::InitFillDerivEffect()
 {
-    if (g_sdfFillDerivEffect != nullptr || !generateDerivs_) {
+    if (sdfFillDerivEffect_ != nullptr || !generateDerivs_) {
         return true;
     }
 
@@ -366,8 +514,8 @@ bool GESDFFromImageFilter::InitFillDerivEffect()
         }
     )");
 
-    g_sdfFillDerivEffect = GECreateRuntimeEffectForShader(shaderString);
-    if (g_sdfFillDerivEffect == nullptr) {
+    sdfFillDerivEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderString);
+    if (sdfFillDerivEffect_ == nullptr) {
         GE_LOGE("GESDFFromImageFilter::InitFillDerivEffect failed");
         return false;
     }
@@ -377,22 +525,24 @@ bool GESDFFromImageFilter::InitFillDerivEffect()
 
 std::shared_ptr<Drawing::Image> GESDFFromImageFilter::RunJFAPrepareEffect(Drawing::Canvas& canvas,
     const std::shared_ptr<Drawing::Image> image, const Drawing::SamplingOptions& samplingOptions,
-    const Drawing::Rect& src, const Drawing::Rect& dst, const Drawing::ColorType& outputColorType)
+    const Drawing::Rect& src, const Drawing::Rect& dst, const Drawing::RectI& area,
+    const Drawing::ColorType& outputColorType)
 {
     GE_TRACE_NAME_FMT("GESDFFromImageFilter::RunJFAPrepareEffect Run JFA Prepare Function.");
     auto imageInfo = image->GetImageInfo();
     auto width = image->GetWidth();
     auto height = image->GetHeight();
 
-    auto outputWidth = std::max(static_cast<int>(std::ceil(dst.GetWidth())), width);
-    auto outputHeight = std::max(static_cast<int>(std::ceil(dst.GetHeight())), height);
     Drawing::Matrix stretchMatrix = BuildStretchMatrix(src, dst, width, height);
+    Drawing::Matrix areaMatrix;
+    areaMatrix.Translate(-area.GetLeft(), -area.GetTop());
+    stretchMatrix.PostConcat(areaMatrix);
     auto outputImageInfo = Drawing::ImageInfo(
-        outputWidth, outputHeight, outputColorType, imageInfo.GetAlphaType(), imageInfo.GetColorSpace());
+        area.GetWidth(), area.GetHeight(), outputColorType, imageInfo.GetAlphaType(), imageInfo.GetColorSpace());
 
     auto imageShader = Drawing::ShaderEffect::CreateImageShader(
         *image, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, samplingOptions, stretchMatrix);
-    Drawing::RuntimeShaderBuilder JFAPrepareBuilder(g_JFAPrepareEffect);
+    Drawing::RuntimeShaderBuilder JFAPrepareBuilder(jfaPrepareEffect_);
     JFAPrepareBuilder.SetChild("imageInput", imageShader);
     JFAPrepareBuilder.SetUniform("spreadFactor", static_cast<float>(spreadFactor_));
 #ifdef RS_ENABLE_GPU
@@ -418,7 +568,7 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::RunJfaIterationsEffect(Dra
     int jfaIterationCount = static_cast<int>(std::log2(spreadFactor_)) + 1;
     int jfaRadius = spreadFactor_;
     for (int jfaIteration = 0; jfaIteration < jfaIterationCount; ++jfaIteration) {
-        Drawing::RuntimeShaderBuilder jfaIterationBuilder(g_jfaIterationEffect);
+        Drawing::RuntimeShaderBuilder jfaIterationBuilder(jfaIterationEffect_);
         auto imageInputShader = Drawing::ShaderEffect::CreateImageShader(
             *input, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, samplingOptions, identityMatrix);
         jfaIterationBuilder.SetChild("imageInput", imageInputShader);
@@ -451,7 +601,7 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::RunJfaProcessResultEffect(
     Drawing::Matrix identityMatrix;
     auto imageShader = Drawing::ShaderEffect::CreateImageShader(
         *image, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, samplingOptions, identityMatrix);
-    Drawing::RuntimeShaderBuilder jfaProcessResultBuilder(g_jfaProcessResultEffect);
+    Drawing::RuntimeShaderBuilder jfaProcessResultBuilder(jfaProcessResultEffect_);
     jfaProcessResultBuilder.SetChild("imageInput", imageShader);
 #ifdef RS_ENABLE_GPU
     return jfaProcessResultBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, outputImageInfo, false);
@@ -473,7 +623,7 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::RunFillDerivEffect(Drawing
         *image, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, samplingOptions, identityMatrix);
     auto blurredSDFInputShader = Drawing::ShaderEffect::CreateImageShader(
         *blurredSDFImage, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, samplingOptions, identityMatrix);
-    Drawing::RuntimeShaderBuilder fillDerivBuilder(g_sdfFillDerivEffect);
+    Drawing::RuntimeShaderBuilder fillDerivBuilder(sdfFillDerivEffect_);
     fillDerivBuilder.SetChild("imageInput", imageInputShader);
     fillDerivBuilder.SetChild("blurredSDFInput", blurredSDFInputShader);
 #ifdef RS_ENABLE_GPU
@@ -483,11 +633,99 @@ std::shared_ptr<Drawing::Image> GESDFFromImageFilter::RunFillDerivEffect(Drawing
 #endif
 }
 
+std::shared_ptr<Drawing::Image> GESDFFromImageFilter::ProcessImageOnCpu(const std::shared_ptr<Drawing::Image>& image,
+    const Drawing::Rect& src, const Drawing::Rect& dst) const
+{
+    GE_TRACE_NAME_FMT("GESDFFromImageFilter::ProcessImageOnCpu");
+    int width = image->GetWidth();
+    int height = image->GetHeight();
+    if (width <= 0 || height <= 0 || dst.GetWidth() <= 0.0f || dst.GetHeight() <= 0.0f) {
+        return nullptr;
+    }
+    Drawing::ImageInfo readInfo(width, height, Drawing::ColorType::COLORTYPE_RGBA_8888,
+        Drawing::AlphaType::ALPHATYPE_PREMUL);
+    std::vector<uint8_t> pixels(static_cast<size_t>(width) * static_cast<size_t>(height) * RGBA_CHANNELS);
+    if (!image->ReadPixels(readInfo, pixels.data(), static_cast<size_t>(width) * RGBA_CHANNELS, 0, 0)) {
+        GE_LOGE("GESDFFromImageFilter::ProcessImageOnCpu read pixels failed");
+        return nullptr;
+    }
+
+    // Coverage on the output grid, the image stretched from src to dst as in the prepare pass
+    int outputWidth = std::max(static_cast<int>(std::ceil(dst.GetWidth())), width);
+    int outputHeight = std::max(static_cast<int>(std::ceil(dst.GetHeight())), height);
+    std::vector<float> coverage(static_cast<size_t>(width) * static_cast<size_t>(height));
+    for (size_t i = 0; i < coverage.size(); ++i) {
+        coverage[i] = pixels[i * RGBA_CHANNELS + ALPHA_CHANNEL];
+    }
+    float scaleW = dst.GetWidth() / width;
+    float scaleH = dst.GetHeight() / height;
+    std::vector<uint8_t> alpha(static_cast<size_t>(outputWidth) * static_cast<size_t>(outputHeight));
+    for (int y = 0; y < outputHeight; ++y) {
+        float srcY = (y + PIXEL_CENTER - dst.GetTop()) / scaleH + src.GetTop();
+        for (int x = 0; x < outputWidth; ++x) {
+            float srcX = (x + PIXEL_CENTER - dst.GetLeft()) / scaleW + src.GetLeft();
+            float value = GESDFCpuGenerator::Sample(coverage, width, height, srcX, srcY);
+            alpha[static_cast<size_t>(y) * outputWidth + x] = static_cast<uint8_t>(std::lround(value));
+        }
+    }
+    std::vector<float> distances;
+    if (!GESDFCpuGenerator::ComputeFromAlpha(alpha.data(), 1, outputWidth, outputWidth, outputHeight, distances)) {
+        return nullptr;
+    }
+
+    // 0.5 on the edge and spreadFactor_ pixels to 0 inside or 1 outside, like the JFA result pass
+    std::vector<float> encoded(distances.size());
+    float invSpread = 1.0f / (TWO * spreadFactor_);
+    for (size_t i = 0; i < distances.size(); ++i) {
+        encoded[i] = std::clamp(PIXEL_CENTER + distances[i] * invSpread, 0.0f, 1.0f);
+    }
+    Drawing::Bitmap bitmap;
+    Drawing::ImageInfo outputInfo(outputWidth, outputHeight, Drawing::ColorType::COLORTYPE_RGBA_8888,
+        image->GetAlphaType());
+    if (!bitmap.Build(outputInfo) || bitmap.GetPixels() == nullptr) {
+        GE_LOGE("GESDFFromImageFilter::ProcessImageOnCpu bitmap build failed");
+        return nullptr;
+    }
+    auto* output = static_cast<uint8_t*>(bitmap.GetPixels());
+    auto rowBytes = static_cast<size_t>(bitmap.GetRowBytes());
+    for (int y = 0; y < outputHeight; ++y) {
+        uint8_t* row = output + static_cast<size_t>(y) * rowBytes;
+        float py = y + PIXEL_CENTER;
+        for (int x = 0; x < outputWidth; ++x) {
+            float sdfRaw = encoded[static_cast<size_t>(y) * outputWidth + x];
+            uint8_t* out = row + static_cast<size_t>(x) * RGBA_CHANNELS;
+            out[0] = 0;
+            out[1] = 0;
+            out[2] = 0; // 2: blue
+            out[ALPHA_CHANNEL] = ToChannel(sdfRaw);
+            if (!generateDerivs_) {
+                continue;
+            }
+            // The fill deriv pass on the exact field, which needs no blur first
+            float px = x + PIXEL_CENTER;
+            float dist = std::abs(sdfRaw * TWO - 1.0f) * DERIV_WIDTH;
+            float h = DERIV_MIN_STEP + std::clamp(dist * DERIV_STEP_SCALE, 0.0f, DERIV_MAX_EXTRA_STEP);
+            float gradX = GESDFCpuGenerator::Sample(encoded, outputWidth, outputHeight, px + h, py) -
+                GESDFCpuGenerator::Sample(encoded, outputWidth, outputHeight, px - h, py);
+            float gradY = GESDFCpuGenerator::Sample(encoded, outputWidth, outputHeight, px, py + h) -
+                GESDFCpuGenerator::Sample(encoded, outputWidth, outputHeight, px, py - h);
+            bool isInvalid = (sdfRaw > DERIV_FLAT_HIGH || sdfRaw < DERIV_FLAT_LOW) &&
+                (gradX * gradX + gradY * gradY < DERIV_FLAT_GRAD_SQ);
+            float spineSmooth = SmoothStep(DERIV_WIDTH, DERIV_WIDTH * DERIV_SPINE_START, dist);
+            float dirX = isInvalid ? 0.0f : (gradX + DERIV_BIAS) * spineSmooth;
+            float dirY = isInvalid ? 0.0f : (gradY + DERIV_BIAS) * spineSmooth;
+            out[0] = ToChannel((dirX + 1.0f) / TWO);
+            out[1] = ToChannel((dirY + 1.0f) / TWO);
+        }
+    }
+    return bitmap.MakeImage();
+}
+
 bool GESDFFromImageFilter::IsInputValid(Drawing::Canvas& canvas, const std::shared_ptr<Drawing::Image>& image,
     const Drawing::Rect& src, const Drawing::Rect& dst)
 {
-    if (!image || !g_JFAPrepareEffect || !g_jfaIterationEffect || !g_jfaProcessResultEffect ||
-        (!g_sdfFillDerivEffect && generateDerivs_)) {
+    if (!image || !jfaPrepareEffect_ || !jfaIterationEffect_ || !jfaProcessResultEffect_ ||
+        (!sdfFillDerivEffect_ && generateDerivs_)) {
         GE_LOGE("GESDFFromImageFilter::IsInputValid invalid shader or image");
         return false;
     }
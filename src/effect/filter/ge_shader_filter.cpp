@@ -13,11 +13,39 @@
  * limitations under the License.
  */
 #include "ge_shader_filter.h"
+
+#include "ge_log.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_trace.h"
 
+#include "effect/runtime_shader_builder.h"
+
 namespace OHOS {
 namespace Rosen {
 
+namespace {
+static constexpr char PASS_THROUGH_PROG[] = R"(
+    uniform shader inputShader;
+
+    half4 main(float2 coord) {
+        return inputShader.eval(coord);
+    }
+)";
+
+std::shared_ptr<Drawing::RuntimeShaderBuilder> MakePassThroughBuilder(
+    const std::shared_ptr<Drawing::ShaderEffect>& input)
+{
+    auto effect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(PASS_THROUGH_PROG);
+    if (effect == nullptr || input == nullptr) {
+        LOGE("GEShaderFilter::MakePassThroughBuilder effect or input is null");
+        return nullptr;
+    }
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
+    builder->SetChild("inputShader", input);
+    return builder;
+}
+} // namespace
+
 std::shared_ptr<Drawing::Image> GEShaderFilter::ProcessImage(Drawing::Canvas& canvas,
     const std::shared_ptr<Drawing::Image> image, const Drawing::Rect& src, const Drawing::Rect& dst)
 {
@@ -34,5 +62,48 @@ bool GEShaderFilter::DrawImage(Drawing::Canvas& canvas, const std::shared_ptr<Dr
     return OnDrawImage(canvas, image, src, dst, brush);
 }
 
+std::shared_ptr<Drawing::ShaderEffect> GEShaderFilter::MakeChainedShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::ImageInfo& info)
+{
+    GE_TRACE_NAME_FMT("GEShaderFilter::MakeChainedShader, Type: %s, Width: %d, Height: %d",
+        TypeName().data(), info.GetWidth(), info.GetHeight());
+    if (input == nullptr) {
+        return nullptr;
+    }
+    return OnMakeChainedShader(input, info);
+}
+
+std::shared_ptr<Drawing::ShaderEffect> GEShaderFilter::MakeChainInputShader(const Drawing::Image& image)
+{
+    Drawing::Matrix matrix;
+    return Drawing::ShaderEffect::CreateImageShader(image, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP,
+        Drawing::SamplingOptions(Drawing::FilterMode::LINEAR), matrix);
+}
+
+std::shared_ptr<Drawing::Image> GEShaderFilter::MakeChainedImage(Drawing::Canvas& canvas,
+    const std::shared_ptr<Drawing::ShaderEffect>& shader, const Drawing::ImageInfo& info)
+{
+    GE_TRACE_NAME_FMT("GEShaderFilter::MakeChainedImage, Width: %d, Height: %d", info.GetWidth(), info.GetHeight());
+    auto builder = MakePassThroughBuilder(shader);
+    if (builder == nullptr) {
+        return nullptr;
+    }
+#ifdef RS_ENABLE_GPU
+    return builder->MakeImage(canvas.GetGPUContext().get(), nullptr, info, false);
+#else
+    return builder->MakeImage(nullptr, nullptr, info, false);
+#endif
+}
+
+std::shared_ptr<Drawing::ShaderEffect> GEShaderFilter::MakeLocalMatrixShader(
+    const std::shared_ptr<Drawing::ShaderEffect>& input, const Drawing::Matrix& localMatrix)
+{
+    auto builder = MakePassThroughBuilder(input);
+    if (builder == nullptr) {
+        return nullptr;
+    }
+    return builder->MakeShader(&localMatrix, false);
+}
+
 } // namespace Rosen
 } // namespace OHOS
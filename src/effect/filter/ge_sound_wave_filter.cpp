@@ -19,7 +19,7 @@
 #include <chrono>
  
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_tone_mapping_helper.h"
  
 namespace OHOS {
@@ -141,11 +141,7 @@ void GESoundWaveFilter::CheckSoundWaveColor4f(Drawing::Color4f& color)
 
 std::shared_ptr<Drawing::RuntimeEffect> GESoundWaveFilter::GetSoundWaveEffect()
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_soundWaveShader = nullptr;
-    if (g_soundWaveShader == nullptr) {
-        g_soundWaveShader = GECreateRuntimeEffectForShader(shaderStringSoundWave);
-    }
-    return g_soundWaveShader;
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringSoundWave);
 }
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -14,8 +14,10 @@
  */
 #include "ge_variable_radius_blur_shader_filter.h"
 
+#include <cmath>
+
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_system_properties.h"
 #include "ge_trace.h"
 
@@ -26,6 +28,12 @@ namespace {
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> horizontalBoxBlurShaderEffect_ = nullptr;
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> verticalBoxBlurShaderEffect_ = nullptr;
 thread_local static std::shared_ptr<Drawing::RuntimeEffect> textureShaderEffect_ = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> pyramidDownEffect_ = nullptr;
+thread_local static std::shared_ptr<Drawing::RuntimeEffect> pyramidCompositeEffect_ = nullptr;
+
+const char* const PYRAMID_LEVEL_NAMES[GEVariableRadiusBlurShaderFilter::MAX_PYRAMID_LEVELS + 1] = {
+    "level0", "level1", "level2", "level3", "level4", "level5"
+};
 } // namespace
 
 GEVariableRadiusBlurShaderFilter::GEVariableRadiusBlurShaderFilter(
@@ -51,7 +59,117 @@ std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::OnProcessImage
     MakeHorizontalBoxBlurEffect(params_.applyInsideMask);
     MakeVerticalBoxBlurEffect(params_.applyInsideMask);
     MakeTextureShaderEffect();
-    return DrawBoxLinearGradientBlur(image, canvas, radius, maskShader, dst);
+    bool usePyramid = UsePyramid(radius);
+    if (usePyramid) {
+        MakePyramidEffects();
+    }
+    return DrawBoxLinearGradientBlur(image, canvas, radius, maskShader, dst, usePyramid);
+}
+
+bool GEVariableRadiusBlurShaderFilter::UsePyramid(float radius) const
+{
+    // Masked blurs only average taps inside the mask, which levels built over the whole image can not reproduce
+    return !params_.applyInsideMask && radius >= PYRAMID_MIN_RADIUS && IsPyramidEnabled();
+}
+
+bool GEVariableRadiusBlurShaderFilter::IsPyramidEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.vrbpyramid", "1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 1) != 0;
+#else
+    return true;
+#endif
+}
+
+// The level blurring like the box passes of a half radius R is log2(R). Per axis the two box passes of R have a
+// variance of 2 * R^2 / 3, a sigma of about 0.82 * R. Every downsample adds 0.75 squared pixels of the previous
+// level, 0.5 from its taps and 0.25 from sampling between two pixels, so level L holds 0.25 * (4^L - 1). The tent of
+// the composite adds 0.25 * 4^L and its bilinear upscale about 4^L / 6, which gives a sigma of about 0.82 * 2^L.
+int GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(float radius, int width, int height)
+{
+    int levels = static_cast<int>(std::ceil(std::log2(std::max(radius, 1.0f))));
+    levels = std::clamp(levels, 1, MAX_PYRAMID_LEVELS);
+    // Every level keeps at least two pixels on each side
+    while (levels > 0 && ((width >> levels) < 2 || (height >> levels) < 2)) { // 2: smallest level side
+        levels--;
+    }
+    return levels;
+}
+
+void GEVariableRadiusBlurShaderFilter::MakePyramidEffects()
+{
+    if (pyramidDownEffect_ != nullptr && pyramidCompositeEffect_ != nullptr) {
+        return;
+    }
+    // Halves the previous level, whose shader is scaled by 0.5, so the taps are one source pixel off center
+    static const std::string pyramidDownString(R"(
+        uniform shader imageInput;
+        half4 main(float2 xy)
+        {
+            half4 sum = imageInput.eval(xy) * 4.0;
+            sum += imageInput.eval(xy + float2(0.5, 0.5));
+            sum += imageInput.eval(xy - float2(0.5, 0.5));
+            sum += imageInput.eval(xy + float2(0.5, -0.5));
+            sum += imageInput.eval(xy - float2(0.5, -0.5));
+            return sum * 0.125;
+        }
+    )");
+    // Every level is sampled in the coordinates of the input, a tent of four taps hides the bilinear upscale
+    static const std::string pyramidCompositeString(R"(
+        uniform half r;
+        uniform float maxLevel;
+        uniform shader gradientShader;
+        uniform shader level0;
+        uniform shader level1;
+        uniform shader level2;
+        uniform shader level3;
+        uniform shader level4;
+        uniform shader level5;
+        half4 SampleLevel(float level, float2 coord)
+        {
+            float2 a = float2(0.5, 0.5) * exp2(level);
+            float2 b = float2(a.x, -a.y);
+            if (level < 0.5) {
+                return level0.eval(coord);
+            } else if (level < 1.5) {
+                return (level1.eval(coord + a) + level1.eval(coord - a) + level1.eval(coord + b) +
+                    level1.eval(coord - b)) * 0.25;
+            } else if (level < 2.5) {
+                return (level2.eval(coord + a) + level2.eval(coord - a) + level2.eval(coord + b) +
+                    level2.eval(coord - b)) * 0.25;
+            } else if (level < 3.5) {
+                return (level3.eval(coord + a) + level3.eval(coord - a) + level3.eval(coord + b) +
+                    level3.eval(coord - b)) * 0.25;
+            } else if (level < 4.5) {
+                return (level4.eval(coord + a) + level4.eval(coord - a) + level4.eval(coord + b) +
+                    level4.eval(coord - b)) * 0.25;
+            }
+            return (level5.eval(coord + a) + level5.eval(coord - a) + level5.eval(coord + b) +
+                level5.eval(coord - b)) * 0.25;
+        }
+        half4 main(float2 coord)
+        {
+            float radius = r * gradientShader.eval(coord).a;
+            if (radius < 1.0) {
+                return level0.eval(coord);
+            }
+            // Same level as GetPyramidLevelCount picks for the radius
+            float level = clamp(log2(radius), 0.0, maxLevel);
+            float lower = floor(level);
+            float upper = min(lower + 1.0, maxLevel);
+            half4 color = mix(SampleLevel(lower, coord), SampleLevel(upper, coord), level - lower);
+            return half4(color.rgb, 1.0);
+        }
+    )");
+    auto& registry = GERuntimeEffectRegistry::GetInstance();
+    pyramidDownEffect_ = registry.GetOrCreate(pyramidDownString);
+    pyramidCompositeEffect_ = registry.GetOrCreate(pyramidCompositeString);
+    if (pyramidDownEffect_ == nullptr || pyramidCompositeEffect_ == nullptr) {
+        LOGE("GEVariableRadiusBlurShaderFilter::RuntimeShader pyramid effects create failed");
+    }
 }
 
 void GEVariableRadiusBlurShaderFilter::MakeTextureShaderEffect()
@@ -65,7 +183,7 @@ void GEVariableRadiusBlurShaderFilter::MakeTextureShaderEffect()
             return imageInput.eval(xy);
         }
     )");
-    textureShaderEffect_ = GECreateRuntimeEffectForShader(generateTextureShader);
+    textureShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(generateTextureShader);
     if (textureShaderEffect_ == nullptr) {
         LOGE("GEVariableRadiusBlurShaderFilter::RuntimeShader textureShaderEffect create failed");
     }
@@ -140,8 +258,9 @@ void GEVariableRadiusBlurShaderFilter::MakeHorizontalBoxBlurEffect(bool applyIns
             return boxFilter(coord, radius);
         }
     )");
-    horizontalBoxBlurShaderEffect_ = applyInsideMask ? GECreateRuntimeEffectForShader(HorizontalBlurMaskedString)
-                                                     : GECreateRuntimeEffectForShader(HorizontalBlurString);
+    auto& registry = GERuntimeEffectRegistry::GetInstance();
+    horizontalBoxBlurShaderEffect_ = applyInsideMask ? registry.GetOrCreate(HorizontalBlurMaskedString)
+                                                     : registry.GetOrCreate(HorizontalBlurString);
     if (horizontalBoxBlurShaderEffect_ == nullptr) {
         LOGE("GEVariableRadiusBlurShaderFilter::RuntimeShader horizontalBoxBlurShaderEffect create failed");
     }
@@ -216,8 +335,9 @@ void GEVariableRadiusBlurShaderFilter::MakeVerticalBoxBlurEffect(bool applyInsid
             return boxFilter(coord, radius);
         }
     )");
-    verticalBoxBlurShaderEffect_ = applyInsideMask ? GECreateRuntimeEffectForShader(VerticalBlurMaskedString)
-                                                   : GECreateRuntimeEffectForShader(VerticalBlurString);
+    auto& registry = GERuntimeEffectRegistry::GetInstance();
+    verticalBoxBlurShaderEffect_ = applyInsideMask ? registry.GetOrCreate(VerticalBlurMaskedString)
+                                                   : registry.GetOrCreate(VerticalBlurString);
     if (verticalBoxBlurShaderEffect_ == nullptr) {
         LOGE("GEVariableRadiusBlurShaderFilter::RuntimeShader verticalBoxBlurShaderEffect create failed");
     }
@@ -225,7 +345,7 @@ void GEVariableRadiusBlurShaderFilter::MakeVerticalBoxBlurEffect(bool applyInsid
 
 std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::DrawBoxLinearGradientBlur(
     const std::shared_ptr<Drawing::Image>& image, Drawing::Canvas& canvas, float radius,
-    std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader, const Drawing::Rect& dst)
+    std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader, const Drawing::Rect& dst, bool usePyramid)
 {
     GE_TRACE_NAME_FMT("GEVariableRadiusBlurShaderFilter::DrawBoxLinearGradientBlur, Type: %s, radius: %g "\
         "Width: %g, Height: %g", Drawing::GE_FILTER_VARIABLE_RADIUS_BLUR, radius, dst.GetWidth(), dst.GetHeight());
@@ -235,7 +355,13 @@ std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::DrawBoxLinearG
     Drawing::Matrix blurMatrix;
     blurMatrix.PostTranslate(dst.GetLeft(), dst.GetTop());
     Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
-    auto tmpBlur4 = BuildBoxLinearGradientBlur(image, canvas, radius, alphaGradientShader, blurMatrix);
+    std::shared_ptr<Drawing::Image> tmpBlur4 = nullptr;
+    if (usePyramid) {
+        tmpBlur4 = BuildPyramidLinearGradientBlur(image, canvas, radius, alphaGradientShader, blurMatrix);
+    }
+    if (tmpBlur4 == nullptr) {
+        tmpBlur4 = BuildBoxLinearGradientBlur(image, canvas, radius, alphaGradientShader, blurMatrix);
+    }
     Drawing::Matrix invBlurMatrix;
     auto blurShader = Drawing::ShaderEffect::CreateImageShader(
         *tmpBlur4, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, invBlurMatrix);
@@ -298,6 +424,75 @@ std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::BuildBoxLinear
     return localImage;
 }
 
+std::shared_ptr<Drawing::Image> GEVariableRadiusBlurShaderFilter::BuildPyramidLinearGradientBlur(
+    const std::shared_ptr<Drawing::Image>& image, Drawing::Canvas& canvas, float radius,
+    std::shared_ptr<Drawing::ShaderEffect> alphaGradientShader, const Drawing::Matrix& blurMatrix)
+{
+    if (!pyramidDownEffect_ || !pyramidCompositeEffect_) {
+        return nullptr;
+    }
+    auto width = image->GetWidth();
+    auto height = image->GetHeight();
+    int levelCount = GetPyramidLevelCount(radius, width, height);
+    if (levelCount <= 0) {
+        return nullptr;
+    }
+    GE_TRACE_NAME_FMT("GEVariableRadiusBlurShaderFilter::BuildPyramidLinearGradientBlur, Levels: %d", levelCount);
+    auto originImageInfo = image->GetImageInfo();
+    Drawing::SamplingOptions linear(Drawing::FilterMode::LINEAR, Drawing::MipmapMode::NONE);
+    // Shaders of every level in the coordinates of the box passes, level 0 is the input itself
+    std::shared_ptr<Drawing::ShaderEffect> levelShaders[MAX_PYRAMID_LEVELS + 1];
+    levelShaders[0] = Drawing::ShaderEffect::CreateImageShader(
+        *image, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, blurMatrix);
+    auto prevImage = image;
+    Drawing::Matrix prevMatrix = blurMatrix;
+    for (int level = 1; level <= levelCount; level++) {
+        float levelScale = static_cast<float>(1 << level);
+        auto levelInfo = Drawing::ImageInfo(std::ceil(width / levelScale), std::ceil(height / levelScale),
+            originImageInfo.GetColorType(), originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+        prevMatrix.PostScale(0.5f, 0.5f); // 0.5: every level halves the previous one
+        Drawing::RuntimeShaderBuilder downBuilder(pyramidDownEffect_);
+        downBuilder.SetChild("imageInput", Drawing::ShaderEffect::CreateImageShader(
+            *prevImage, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, prevMatrix));
+#ifdef RS_ENABLE_GPU
+        auto levelImage = downBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, levelInfo, false);
+#else
+        auto levelImage = downBuilder.MakeImage(nullptr, nullptr, levelInfo, false);
+#endif
+        if (!levelImage) {
+            LOGE("GEVariableRadiusBlurShaderFilter::BuildPyramidLinearGradientBlur fail to make level %{public}d",
+                level);
+            return nullptr;
+        }
+        prevImage = levelImage;
+        prevMatrix = Drawing::Matrix();
+        Drawing::Matrix levelMatrix;
+        levelMatrix.SetScale(levelScale, levelScale);
+        levelShaders[level] = Drawing::ShaderEffect::CreateImageShader(
+            *levelImage, Drawing::TileMode::CLAMP, Drawing::TileMode::CLAMP, linear, levelMatrix);
+    }
+
+    Drawing::RuntimeShaderBuilder compositeBuilder(pyramidCompositeEffect_);
+    compositeBuilder.SetUniform("r", radius);
+    compositeBuilder.SetUniform("maxLevel", static_cast<float>(levelCount));
+    compositeBuilder.SetChild("gradientShader", alphaGradientShader);
+    for (int level = 0; level <= MAX_PYRAMID_LEVELS; level++) {
+        // Levels past the top are never sampled but every child needs a shader
+        compositeBuilder.SetChild(PYRAMID_LEVEL_NAMES[level], levelShaders[std::min(level, levelCount)]);
+    }
+    auto scaledInfo = Drawing::ImageInfo(width, height, originImageInfo.GetColorType(),
+        originImageInfo.GetAlphaType(), originImageInfo.GetColorSpace());
+#ifdef RS_ENABLE_GPU
+    auto blurImage = compositeBuilder.MakeImage(canvas.GetGPUContext().get(), nullptr, scaledInfo, false);
+#else
+    auto blurImage = compositeBuilder.MakeImage(nullptr, nullptr, scaledInfo, false);
+#endif
+    if (!blurImage) {
+        LOGE("GEVariableRadiusBlurShaderFilter::BuildPyramidLinearGradientBlur fail to make blur image");
+    }
+    return blurImage;
+}
+
 std::string GEVariableRadiusBlurShaderFilter::GetDescription()
 {
     return "GEVariableRadiusBlurShaderFilter";
@@ -17,7 +17,7 @@
  
 #include "ge_log.h"
 #include "ge_water_ripple_filter.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
  
 namespace OHOS {
 namespace Rosen {
@@ -109,31 +109,19 @@ std::shared_ptr<Drawing::RuntimeEffect> GEWaterRippleFilter::GetWaterRippleEffec
 
 std::shared_ptr<Drawing::RuntimeEffect> GEWaterRippleFilter::GetWaterRippleEffectSM(const int rippleMode)
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_waterRippleEffectSM = nullptr;
-    if (g_waterRippleEffectSM == nullptr) {
-        g_waterRippleEffectSM = (rippleMode == SMALL2MEDIUM_SEND) ?
-            GECreateRuntimeEffectForShader(shaderStringSMsend) :
-            GECreateRuntimeEffectForShader(shaderStringSMrecv);
-    }
-    return g_waterRippleEffectSM;
+    return (rippleMode == SMALL2MEDIUM_SEND) ?
+        GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringSMsend) :
+        GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringSMrecv);
 }
 
 std::shared_ptr<Drawing::RuntimeEffect> GEWaterRippleFilter::GetWaterRippleEffectSS()
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_waterRippleEffectSS = nullptr;
-    if (g_waterRippleEffectSS == nullptr) {
-        g_waterRippleEffectSS = GECreateRuntimeEffectForShader(shaderStringSSmutual);
-    }
-    return g_waterRippleEffectSS;
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringSSmutual);
 }
 
 std::shared_ptr<Drawing::RuntimeEffect> GEWaterRippleFilter::GetWaterRippleEffectMR()
 {
-    static std::shared_ptr<Drawing::RuntimeEffect> g_waterRippleEffectMR = nullptr;
-    if (g_waterRippleEffectMR == nullptr) {
-        g_waterRippleEffectMR = GECreateRuntimeEffectForShader(shaderStringMiniRecv);
-    }
-    return g_waterRippleEffectMR;
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderStringMiniRecv);
 }
 
 } // namespace Rosen
@@ -18,10 +18,12 @@
 
 #include "ge_params_reflection.h"
 
-#include <unordered_map>
+#include <array>
 
 #include "ge_filter_params.h"
 #include "ge_log.h"
+#include "ge_params_dirty_bits.h"
+#include "ge_params_hasher.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -123,108 +125,156 @@ std::unique_ptr<GEFilterParams> GEParamsBuilder::Build(GEFilterType filterType)
 
 #undef GE_BUILD_PARAMS_CASE
 
-GEFilterType GEParamsBuilder::GetFilterTypeFromString(const std::string& str)
+namespace {
+// 64-bit FNV-1a, gen_metadata.py sorts the name tables below by this hash
+constexpr uint64_t GENameHash(std::string_view str)
 {
-    static const std::unordered_map<std::string, GEFilterType> map = {
-#define GE_FILTER_NAME_TO_TYPE_ENTRY(Struct)                                                        \
-    {                                                                                               \
-        std::string(GEFilterParamsTypeInfo<Struct>::FilterName), GEFilterParamsTypeInfo<Struct>::ID \
-    }
-
-#define GE_FILTER_NAME_TO_TYPE_ALIAS(Struct, Alias) { #Alias, GEFilterParamsTypeInfo<Struct>::ID }
-
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEAIBarShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEAuroraNoiseShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEBezierWarpShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEBlurBubblesRiseFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEBlurShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEBorderLightShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEBorderSDFLGColorShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEBorderSDFShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GECircleFlowlightEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEColorGradientShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEContentLightFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEContentDiagonalFlowLightShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEDepthOcclusionShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEDirectionLightShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEDispersionShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEDisplacementDistortFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEDistortionCollapseFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEDotMatrixShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEDoubleRippleShaderMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEEdgeLightShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEFrameGradientMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEFrostedGlassBlurShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEFrostedGlassEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEFrostedGlassShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEGasifyBlurFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEGasifyFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEGasifyScaleTwistFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEGreyShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEGridWarpShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEHarmoniumEffectShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEHeatDistortionFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEImageMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEKawaseBlurShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GELinearGradientBlurShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GELinearGradientShaderMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEMagnifierShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEMapColorByBrightnessFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEMaskTransitionShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEMESABlurShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEMotionBlurShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEParticleAblationFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEParticleCircularHaloShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEPixelMapMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GERadialGradientShaderMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GERippleShaderMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFBorderShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFClipShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFColorShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFDistortOpShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFEdgeLightEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFEdgeLightFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFEllipseShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFFromImageFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFPathShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFPixelmapShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFRRectShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFShadowShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFSmoothSubOpShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFSubOpShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFTransformShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFTriangleShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESDFUnionOpShapeParams),
-        GE_FILTER_NAME_TO_TYPE_ALIAS(GESDFUnionOpShapeParams, SDFSmoothUnionOpShape),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESoundWaveFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESpatialGlassEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GESpatialPointLightShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEUseEffectMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEVariableRadiusBlurShaderFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEWaterDropletTransitionFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEWaterRippleFilterParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEWaveDisturbanceShaderMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEWaveGradientShaderMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEWavyRippleLightShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXAIBarGlowEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXAIBarRectHaloEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXColorGradientEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXDistortChromaEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXDupoliNoiseMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXGradientFlowColorsEffectParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXLightCaveShaderParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXNoisyFrameGradientMaskParams),
-        GE_FILTER_NAME_TO_TYPE_ENTRY(GEXRoundedRectFlowlightEffectParams),
-    };
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    constexpr uint64_t basis = 0xcbf29ce484222325ULL;
+    uint64_t hash = basis;
+    for (char c : str) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= prime;
+    }
+    return hash;
+}
+
+template<typename Value>
+struct GENameTableEntry {
+    uint64_t nameHash;
+    std::string_view name;
+    Value value;
+};
+
+// Checked at compile time: every hash matches its name and hashes are strictly increasing (no collision)
+template<typename Value, size_t N>
+constexpr bool IsNameTableValid(const std::array<GENameTableEntry<Value>, N>& table)
+{
+    for (size_t i = 0; i < N; ++i) {
+        if (table[i].nameHash != GENameHash(table[i].name) ||
+            (i > 0 && table[i - 1].nameHash >= table[i].nameHash)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Binary search on the hash, then a single string compare. No allocation and no std::hash of a std::string.
+template<typename Value, size_t N>
+Value FindInNameTable(const std::array<GENameTableEntry<Value>, N>& table, std::string_view name, Value notFound)
+{
+    uint64_t hash = GENameHash(name);
+    auto it = std::lower_bound(table.begin(), table.end(), hash,
+        [](const GENameTableEntry<Value>& entry, uint64_t value) { return entry.nameHash < value; });
+    if (it != table.end() && it->nameHash == hash && it->name == name) {
+        return it->value;
+    }
+    return notFound;
+}
+} // namespace
+
+#define GE_FILTER_NAME_TO_TYPE_ENTRY(Hash, Struct)                                           \
+    GENameTableEntry<GEFilterType> {                                                         \
+        Hash, GEFilterParamsTypeInfo<Struct>::FilterName, GEFilterParamsTypeInfo<Struct>::ID \
+    }
+
+#define GE_FILTER_NAME_TO_TYPE_ALIAS(Hash, Struct, Alias)                               \
+    GENameTableEntry<GEFilterType> { Hash, #Alias, GEFilterParamsTypeInfo<Struct>::ID }
+
+// Sorted by GENameHash of the name
+constexpr std::array<GENameTableEntry<GEFilterType>, 82> GE_FILTER_TYPE_TABLE = {
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x03cf111991e2270bULL, GEDispersionShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x08a5762ca4fc0bb1ULL, GEFrostedGlassBlurShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x0ee6d534bef8851dULL, GEGasifyBlurFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x1053637da7fbfda6ULL, GEGreyShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x12a79a648eaac9deULL, GEContentDiagonalFlowLightShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x245771574035185dULL, GESDFTriangleShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x2a1d75972181f4f4ULL, GEBezierWarpShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x2b6d9ded7018e553ULL, GECircleFlowlightEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x2e13455e2c268bceULL, GESDFEdgeLightEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x3b3b372d1fdbb518ULL, GESDFShadowShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x4a38595f2bf50f85ULL, GESDFDistortOpShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x4c5a7e25c5c6707aULL, GEXNoisyFrameGradientMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x4ccc5e2e882bc2a4ULL, GEXRoundedRectFlowlightEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x4e88a0e3208fd3e6ULL, GEContentLightFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x51cabb186a137832ULL, GERadialGradientShaderMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x5c1a4f68e6a17b98ULL, GESDFSmoothSubOpShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x5e07e805c463a89cULL, GEDotMatrixShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x60cf8de667e4e7e4ULL, GEGasifyFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x6805dbbebc989ff3ULL, GEBorderSDFShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x6822ee92bdb448c4ULL, GESDFPathShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x68b212fcce44c420ULL, GEAIBarShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x6a4a75257063d292ULL, GESDFBorderShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x6bbfcbabfc51e08aULL, GEDoubleRippleShaderMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x6e655f607bdfd507ULL, GEMagnifierShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x701d9e5993ce7880ULL, GEEdgeLightShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x720e619ed73fa862ULL, GEImageMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x80b782484af02aaeULL, GEDirectionLightShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x841cc208cd9581c8ULL, GEColorGradientShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x8ab36439f8f9176cULL, GEWaveGradientShaderMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x8f10615a2f8d4192ULL, GEMotionBlurShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x925d8017ea890f5fULL, GESDFFromImageFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x9272a994535d8960ULL, GESpatialGlassEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x935d7bbc6f2df46fULL, GEDepthOcclusionShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x95c2f73dc782c911ULL, GEMESABlurShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x972d80d4e7122874ULL, GELinearGradientShaderMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x97a740e80cbfab11ULL, GEBorderLightShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x99ce3466e0b4284aULL, GEBlurBubblesRiseFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x9abe934f1a81252fULL, GEWaterRippleFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0x9f0a4f355226a40aULL, GEXLightCaveShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xa003f4e409a152feULL, GEWavyRippleLightShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xa37cb33c0ce672c3ULL, GEGridWarpShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xa845856623eed359ULL, GESDFUnionOpShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xa84819e4e53d37d9ULL, GEParticleAblationFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xa8884e014c6b4bd3ULL, GERippleShaderMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xab6f8a92f6e55297ULL, GELinearGradientBlurShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xab7108b8526b129dULL, GEDistortionCollapseFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xaeb6024e2c60177bULL, GEKawaseBlurShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xb079d72f04e72e0eULL, GEMaskTransitionShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ALIAS(0xb360c72c0d498203ULL, GESDFUnionOpShapeParams, SDFSmoothUnionOpShape),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xb851460825bda33fULL, GESDFEllipseShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xb91523d6731a821cULL, GEHeatDistortionFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xbc5861c7c5a1ec6eULL, GEBorderSDFLGColorShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xc2281e08006527adULL, GEAuroraNoiseShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xc30645adfbd8f681ULL, GEXGradientFlowColorsEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xc5978606a0d9c723ULL, GESDFColorShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xc5ad2f872c96cacaULL, GESDFSubOpShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xc65a6ee98005ebafULL, GESDFPixelmapShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xc786c76356aa250cULL, GEDisplacementDistortFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xcaa6f11cdf9874e1ULL, GEWaterDropletTransitionFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xcc5af6a36de791a0ULL, GEXAIBarRectHaloEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xcd81d68a79a3d2edULL, GESDFRRectShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xcf5840b4b1841876ULL, GEMapColorByBrightnessFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xcfc4224297267001ULL, GEGasifyScaleTwistFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xd1192b96cca25515ULL, GESpatialPointLightShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xdb2acaf044320e6aULL, GEFrameGradientMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xdc1b0a3b439ec8ebULL, GESDFEdgeLightFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xe2c32e52b3cef619ULL, GEXColorGradientEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xe3a06ac9ea1dee41ULL, GEXAIBarGlowEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xe5a91e12e19781d9ULL, GEFrostedGlassEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xe976f9735951db3dULL, GESDFTransformShapeParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xecf3bca7c1691718ULL, GEBlurShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xee13057883f38c26ULL, GEXDupoliNoiseMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xf030ccfd9ddf51ccULL, GEWaveDisturbanceShaderMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xf156495d4539e301ULL, GEUseEffectMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xf719912c644d0b5aULL, GEXDistortChromaEffectParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xf7a80d50137faa76ULL, GEHarmoniumEffectShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xf7e0aca1ba7fd888ULL, GEFrostedGlassShaderFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xf99022194bdb543aULL, GESDFClipShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xfa345a08021d8b8dULL, GESoundWaveFilterParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xfc258b5457cff5b3ULL, GEPixelMapMaskParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xfcffd4050c27d7a4ULL, GEParticleCircularHaloShaderParams),
+    GE_FILTER_NAME_TO_TYPE_ENTRY(0xfeb1f6c0366f3b9eULL, GEVariableRadiusBlurShaderFilterParams),
+};
 
 #undef GE_FILTER_NAME_TO_TYPE_ENTRY
 #undef GE_FILTER_NAME_TO_TYPE_ALIAS
 
-    auto it = map.find(str);
-    if (it != map.end()) {
-        return it->second;
-    }
-    return GEFilterType::NONE;
+static_assert(IsNameTableValid(GE_FILTER_TYPE_TABLE), "Regenerate with gen_metadata.py");
+
+GEFilterType GEParamsBuilder::GetFilterTypeFromString(std::string_view str)
+{
+    return FindInNameTable(GE_FILTER_TYPE_TABLE, str, GEFilterType::NONE);
 }
 
 GEFilterType GEParamsMemberHelper::GetFilterTypeFromTag(GEParamsMemberTag tag)
@@ -889,701 +939,1897 @@ GEFilterType GEParamsMemberHelper::GetFilterTypeFromTag(GEParamsMemberTag tag)
 
 #undef GE_GET_FILTER_TYPE_CASE
 
-GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(const std::string& str)
+namespace {
+// Indexed by GEParamsMemberTag, tags of one params type are numbered from 0 in declaration order
+constexpr std::array<uint8_t, 648> GE_TAG_INDEX_IN_PARAMS = {
+    64, 0, 1, 2, 3, 4, 0, 1, 2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 0, 1, 2, 3, 4, 5, 6, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 1, 2, 3, 0, 1, 2, 3,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 1, 2, 3, 4, 5, 6, 0, 1,
+    2, 3, 4, 0, 1, 2, 3, 4, 0, 1, 0, 1, 2, 3, 4, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+    27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 0, 1,
+    2, 0, 1, 2, 0, 1, 2, 3, 0, 1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9,
+    10, 11, 12, 13, 14, 15, 16, 17, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 0, 1, 2, 3, 0, 0, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 14, 15, 16, 0, 1, 0, 1, 2, 0, 1, 2, 3, 4, 5, 6,
+    7, 8, 9, 10, 11, 0, 1, 2, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 0, 1, 2, 0, 1, 2, 3, 0, 1, 2, 3, 4, 0, 1, 2, 3, 0, 1,
+    0, 0, 1, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
+    11, 12, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 0, 1, 0,
+    1, 2, 0, 0, 0, 1, 0, 1, 2, 0, 1, 0, 1, 2, 3, 4, 5, 6, 0, 1,
+    2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 0, 1, 2, 3, 4, 0, 1, 0, 1, 2,
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 1, 2, 3, 4, 0,
+    1, 2, 3, 0, 1, 2, 3, 4, 0, 1, 2, 0, 1, 2, 3, 4, 5, 6, 7, 8,
+    9, 10, 11, 12, 13, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2,
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22,
+    23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 0, 1,
+    2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 0, 1, 2, 3, 4, 5, 6,
+    7, 0, 1, 2, 3, 4, 5, 0, 1, 2, 3, 4, 5, 6, 7, 8, 0, 1, 2, 3,
+    4, 5, 6, 7, 8, 9, 10, 11,
+};
+} // namespace
+
+static_assert(GEParamsDirtyBits::CAPACITY == 64, "Update DIRTY_BITS_CAPACITY in gen_metadata.py");
+
+uint32_t GEParamsMemberHelper::GetTagIndexInParams(GEParamsMemberTag tag)
 {
-    static const std::unordered_map<std::string, GEParamsMemberTag> map = {
-#define GE_STRING_TO_TAG_ENTRY(Tag)                                                 \
-    {                                                                               \
-        GEParamsFieldAccessor<GEParamsMemberTag::Tag>::name, GEParamsMemberTag::Tag \
-    }
-
-#define GE_STRING_TO_TAG_ALIAS(Tag, Alias) { #Alias, GEParamsMemberTag::Tag }
-
-        GE_STRING_TO_TAG_ENTRY(AIBAR_AI_BAR_LOW),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_AI_BAR_HIGH),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_AI_BAR_THRESHOLD),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_AI_BAR_OPACITY),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_AI_BAR_SATURATION),
-        GE_STRING_TO_TAG_ENTRY(AURORA_NOISE_NOISE),
-        GE_STRING_TO_TAG_ENTRY(AURORA_NOISE_FREQ_X),
-        GE_STRING_TO_TAG_ENTRY(AURORA_NOISE_FREQ_Y),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH0),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH1),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH2),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH3),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH4),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH5),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH6),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH7),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH8),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH9),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH10),
-        GE_STRING_TO_TAG_ENTRY(BEZIER_WARP_DESTINATION_PATCH11),
-        GE_STRING_TO_TAG_ENTRY(BLUR_BUBBLES_RISE_BLUR_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(BLUR_BUBBLES_RISE_MIX_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(BLUR_BUBBLES_RISE_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(BLUR_BUBBLES_RISE_MASK_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(BLUR_RADIUS_X),
-        GE_STRING_TO_TAG_ENTRY(BLUR_RADIUS_Y),
-        GE_STRING_TO_TAG_ENTRY(BLUR_DISABLE_SYSTEM_ADAPTATION),
-        GE_STRING_TO_TAG_ENTRY(BLUR_EXPAND_DRAW_REGION),
-        GE_STRING_TO_TAG_ENTRY(BORDER_LIGHT_POSITION),
-        GE_STRING_TO_TAG_ENTRY(BORDER_LIGHT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(BORDER_LIGHT_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(BORDER_LIGHT_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(BORDER_LIGHT_ROTATION_ANGLE),
-        GE_STRING_TO_TAG_ENTRY(BORDER_LIGHT_CORNER_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_ANGLE),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_IS_OUTLINE),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_COLOR_NUMBER),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_COLOR0),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_COLOR1),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_COLOR2),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_COLOR3),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_COLOR4),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_POSITION0),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_POSITION1),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_POSITION2),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_POSITION3),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_POSITION4),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_LG_COLOR_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_SHADER_COLOR),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_SHADER_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_SHADER_IS_OUTLINE),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_SHADER_STYLE),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_SHADER_DASH_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_SHADER_DASH_GAP),
-        GE_STRING_TO_TAG_ENTRY(BORDER_SDF_SHADER_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_COLORS0),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_COLORS1),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_COLORS2),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_COLORS3),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_ROTATION_FREQUENCY),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_ROTATION_AMPLITUDE),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_ROTATION_SEED),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_GRADIENT_X),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_GRADIENT_Y),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_DISTORT_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_BLEND_GRADIENT),
-        GE_STRING_TO_TAG_ENTRY(CIRCLE_FLOWLIGHT_MASK),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_COLORS),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_POSITIONS),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_STRENGTHS),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_MASK),
-        GE_STRING_TO_TAG_ENTRY(CONTENT_LIGHT_POSITION),
-        GE_STRING_TO_TAG_ENTRY(CONTENT_LIGHT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(CONTENT_LIGHT_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(CONTENT_LIGHT_ROTATION_ANGLE),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_CONTOUR),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_START),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_LENGTH),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_COLOR),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_START),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_LENGTH),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_COLOR),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_THICKNESS),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_LIGHT_WEIGHT),
-        GE_STRING_TO_TAG_ENTRY(CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_WEIGHT),
-        GE_STRING_TO_TAG_ENTRY(DEPTH_OCCLUSION_DEPTH_PLANE),
-        GE_STRING_TO_TAG_ENTRY(DEPTH_OCCLUSION_MATRIX),
-        GE_STRING_TO_TAG_ENTRY(DEPTH_OCCLUSION_DEPTH_MAP),
-        GE_STRING_TO_TAG_ENTRY(DEPTH_OCCLUSION_WEIGHT),
-        GE_STRING_TO_TAG_ENTRY(DEPTH_OCCLUSION_NEAR),
-        GE_STRING_TO_TAG_ENTRY(DEPTH_OCCLUSION_FAR),
-        GE_STRING_TO_TAG_ENTRY(DEPTH_OCCLUSION_IS_REVERSE),
-        GE_STRING_TO_TAG_ENTRY(DIRECTION_LIGHT_MASK),
-        GE_STRING_TO_TAG_ENTRY(DIRECTION_LIGHT_MASK_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(DIRECTION_LIGHT_LIGHT_DIRECTION),
-        GE_STRING_TO_TAG_ENTRY(DIRECTION_LIGHT_LIGHT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(DIRECTION_LIGHT_LIGHT_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(DISPERSION_MASK),
-        GE_STRING_TO_TAG_ENTRY(DISPERSION_OPACITY),
-        GE_STRING_TO_TAG_ENTRY(DISPERSION_RED_OFFSET),
-        GE_STRING_TO_TAG_ENTRY(DISPERSION_GREEN_OFFSET),
-        GE_STRING_TO_TAG_ENTRY(DISPERSION_BLUE_OFFSET),
-        GE_STRING_TO_TAG_ENTRY(DISPLACEMENT_DISTORT_FILTER_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(DISPLACEMENT_DISTORT_FILTER_MASK),
-        GE_STRING_TO_TAG_ENTRY(DISTORTION_COLLAPSE_L_U_CORNER),
-        GE_STRING_TO_TAG_ENTRY(DISTORTION_COLLAPSE_R_U_CORNER),
-        GE_STRING_TO_TAG_ENTRY(DISTORTION_COLLAPSE_R_B_CORNER),
-        GE_STRING_TO_TAG_ENTRY(DISTORTION_COLLAPSE_L_B_CORNER),
-        GE_STRING_TO_TAG_ENTRY(DISTORTION_COLLAPSE_BARREL_DISTORTION),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_PATH_DIRECTION),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_EFFECT_COLORS),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_COLOR_FRACTIONS),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_START_POINTS),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_PATH_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_INVERSE_EFFECT),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_DOT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_DOT_SPACING),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_DOT_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_BG_COLOR),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_EFFECT_TYPE),
-        GE_STRING_TO_TAG_ENTRY(DOT_MATRIX_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(DOUBLE_RIPPLE_MASK_CENTER1),
-        GE_STRING_TO_TAG_ENTRY(DOUBLE_RIPPLE_MASK_CENTER2),
-        GE_STRING_TO_TAG_ENTRY(DOUBLE_RIPPLE_MASK_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(DOUBLE_RIPPLE_MASK_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(DOUBLE_RIPPLE_MASK_TURBULENCE),
-        GE_STRING_TO_TAG_ENTRY(DOUBLE_RIPPLE_MASK_HALO_THICKNESS),
-        GE_STRING_TO_TAG_ENTRY(EDGE_LIGHT_ALPHA),
-        GE_STRING_TO_TAG_ENTRY(EDGE_LIGHT_BLOOM),
-        GE_STRING_TO_TAG_ENTRY(EDGE_LIGHT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(EDGE_LIGHT_MASK),
-        GE_STRING_TO_TAG_ENTRY(EDGE_LIGHT_USE_RAW_COLOR),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_INNER_BEZIER),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_OUTER_BEZIER),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_CORNER_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_OUTER_FRAME_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_RECT_W_H),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_RECT_POS),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_AXIAL_FEATHER_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_AXIAL_CENTER),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_AXIAL_CORE_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_AXIAL_DIRECTION),
-        GE_STRING_TO_TAG_ENTRY(FRAME_GRADIENT_MASK_BOX_ANGLE_DEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BLUR_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BLUR_RADIUS_SCALE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BLUR_REFRACT_OUT_PX),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_WEIGHTS_EMBOSS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_WEIGHTS_EDL),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ANTI_ALIAS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_MAX_COLOR),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_BG_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_BG_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_BG_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_BG_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_BG_ALPHA),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_REFRACT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SD_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SD_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SD_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SD_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SD_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ENV_LIGHT_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_ANGLES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_DIR),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ED_LIGHT_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SDF_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_WAVE_DISTURBANCE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_BLUR_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_BLUR_IMAGE_FOR_EDGE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SNAPSHOT_RECT),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_SNAPSHOT_MATRIX),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_REFRACT_OUT_PX),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_MATERIAL_COLOR),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_WEIGHTS_EMBOSS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_BG_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_ANGLES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_DARK_SCALE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_EFFECT_ENABLE_S_D_F_CACHE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BLUR_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_WEIGHTS_EMBOSS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_WEIGHTS_EDL),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_SDF_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_WAVE_DISTURBANCE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_MAX_COLOR),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BG_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BG_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BG_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BG_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BG_ALPHA),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_REFRACT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_SD_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_SD_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_SD_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_SD_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_SD_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ENV_LIGHT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ENV_LIGHT_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ENV_LIGHT_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ENV_LIGHT_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ENV_LIGHT_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ED_LIGHT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ED_LIGHT_ANGLES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ED_LIGHT_DIR),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ED_LIGHT_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ED_LIGHT_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ED_LIGHT_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_ED_LIGHT_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_BLUR_PARAM),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_WEIGHTS_EMBOSS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_BG_RATES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_BG_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_BG_POS),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_BG_NEG),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_ED_LIGHT_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_MODE_ED_LIGHT_ANGLES),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_DARK_SCALE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BASE_VIBRANCY_ENABLED),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_BASE_MATERIAL_TYPE),
-        GE_STRING_TO_TAG_ENTRY(FROSTED_GLASS_MATERIAL_COLOR),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_BLUR_SOURCE_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_BLUR_MASK_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_BLUR_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_SOURCE_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_MASK_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_SCALE_TWIST_SCALE),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_SCALE_TWIST_SOURCE_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_SCALE_TWIST_MASK_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(GASIFY_SCALE_TWIST_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(GREY_GREY_COEF1),
-        GE_STRING_TO_TAG_ENTRY(GREY_GREY_COEF2),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS0),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS1),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS2),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS3),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS4),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS5),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS6),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS7),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_GRID_POINTS8),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES0),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES1),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES2),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES3),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES4),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES5),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES6),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES7),
-        GE_STRING_TO_TAG_ENTRY(GRID_WARP_ROTATION_ANGLES8),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_MASK),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_MASK_CLOCK),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_MASK_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_USE_EFFECT_MASK),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_TINT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_RIPPLE_POSITION),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_RIPPLE_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_DISTORT_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_DISTORT_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_REFLECTION_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_REFRACTION_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_BLUR_LEFT),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_BLUR_TOP),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_MATERIAL_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_CORNER_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_RATE),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_LIGHT_UP_DEGREE),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_CUBIC_COEFF),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_QUAD_COEFF),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_SATURATION),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_POS_R_G_B),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_NEG_R_G_B),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_FRACTION),
-        GE_STRING_TO_TAG_ENTRY(HARMONIUM_EFFECT_TOTAL_MATRIX),
-        GE_STRING_TO_TAG_ENTRY(HEAT_DISTORTION_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(HEAT_DISTORTION_NOISE_SCALE),
-        GE_STRING_TO_TAG_ENTRY(HEAT_DISTORTION_RISE_WEIGHT),
-        GE_STRING_TO_TAG_ENTRY(HEAT_DISTORTION_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(IMAGE_MASK_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(KAWASE_BLUR_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_BLUR_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_FRACTION_STOPS),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_DIRECTION),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_GEO_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_GEO_HEIGHT),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_MAT),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_TRAN_X),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_TRAN_Y),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_IS_OFFSCREEN_CANVAS),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_BLUR_IS_RADIUS_GRADIENT),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_MASK_FRACTION_STOPS),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_MASK_START_POSITION),
-        GE_STRING_TO_TAG_ENTRY(LINEAR_GRADIENT_MASK_END_POSITION),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_HEIGHT),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_CORNER_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_BORDER_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_ZOOM_OFFSET_X),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_ZOOM_OFFSET_Y),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_SHADOW_OFFSET_X),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_SHADOW_OFFSET_Y),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_SHADOW_SIZE),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_SHADOW_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_GRADIENT_MASK_COLOR1),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_GRADIENT_MASK_COLOR2),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_OUTER_CONTOUR_COLOR1),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_OUTER_CONTOUR_COLOR2),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_ROTATE_DEGREE),
-        GE_STRING_TO_TAG_ENTRY(MAGNIFIER_SDF_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(MAP_COLOR_BY_BRIGHTNESS_COLORS),
-        GE_STRING_TO_TAG_ENTRY(MAP_COLOR_BY_BRIGHTNESS_POSITIONS),
-        GE_STRING_TO_TAG_ENTRY(MASK_TRANSITION_MASK),
-        GE_STRING_TO_TAG_ENTRY(MASK_TRANSITION_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(MASK_TRANSITION_INVERSE),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_GREY_COEF1),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_GREY_COEF2),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_OFFSET_X),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_OFFSET_Y),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_OFFSET_Z),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_OFFSET_W),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_TILE_MODE),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_HEIGHT),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_IS_DIRECTION),
-        GE_STRING_TO_TAG_ENTRY(MESA_BLUR_ANGLE),
-        GE_STRING_TO_TAG_ENTRY(MOTION_BLUR_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(MOTION_BLUR_ANCHOR),
-        GE_STRING_TO_TAG_ENTRY(MOTION_BLUR_SAMPLE_COUNT),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_ABLATION_RATE),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_CENTERS0),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_CENTERS1),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_CENTERS2),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_CENTERS3),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_GLOW_LEVEL),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_GLOW_BRIGHTNESS),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_MAX_PARTICLE_COUNT),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_WIND),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_TURB_SCALE),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_TURB_EVO),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_TURB_AMP),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_ABLATION_EXPANSION_SIZE),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_CIRCULAR_HALO_CENTER),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_CIRCULAR_HALO_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(PARTICLE_CIRCULAR_HALO_NOISE),
-        GE_STRING_TO_TAG_ENTRY(PIXEL_MAP_MASK_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(PIXEL_MAP_MASK_SRC),
-        GE_STRING_TO_TAG_ENTRY(PIXEL_MAP_MASK_DST),
-        GE_STRING_TO_TAG_ENTRY(PIXEL_MAP_MASK_FILL_COLOR),
-        GE_STRING_TO_TAG_ENTRY(RADIAL_GRADIENT_MASK_CENTER),
-        GE_STRING_TO_TAG_ENTRY(RADIAL_GRADIENT_MASK_RADIUS_X),
-        GE_STRING_TO_TAG_ENTRY(RADIAL_GRADIENT_MASK_RADIUS_Y),
-        GE_STRING_TO_TAG_ENTRY(RADIAL_GRADIENT_MASK_COLORS),
-        GE_STRING_TO_TAG_ENTRY(RADIAL_GRADIENT_MASK_POSITIONS),
-        GE_STRING_TO_TAG_ENTRY(RIPPLE_MASK_CENTER),
-        GE_STRING_TO_TAG_ENTRY(RIPPLE_MASK_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(RIPPLE_MASK_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(RIPPLE_MASK_WIDTH_CENTER_OFFSET),
-        GE_STRING_TO_TAG_ENTRY(SDF_BORDER_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_BORDER_BORDER),
-        GE_STRING_TO_TAG_ENTRY(SDF_CLIP_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_COLOR_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_COLOR_COLOR),
-        GE_STRING_TO_TAG_ENTRY(SDF_DISTORT_OP_SHAPE_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_DISTORT_OP_SHAPE_L_U_CORNER),
-        GE_STRING_TO_TAG_ENTRY(SDF_DISTORT_OP_SHAPE_R_U_CORNER),
-        GE_STRING_TO_TAG_ENTRY(SDF_DISTORT_OP_SHAPE_R_B_CORNER),
-        GE_STRING_TO_TAG_ENTRY(SDF_DISTORT_OP_SHAPE_L_B_CORNER),
-        GE_STRING_TO_TAG_ENTRY(SDF_DISTORT_OP_SHAPE_BARREL_DISTORTION),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_SDF_SPREAD_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_BLOOM_INTENSITY_CUTOFF),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_MAX_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_MAX_BLOOM_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_BLOOM_FALLOFF_POW),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_MIN_BORDER_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_MAX_BORDER_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_INNER_BORDER_BLOOM_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_OUTER_BORDER_BLOOM_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_SDF_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_LIGHT_MASK),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_EFFECT_SDF_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_SDF_SPREAD_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_BLOOM_INTENSITY_CUTOFF),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_MAX_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_MAX_BLOOM_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_BLOOM_FALLOFF_POW),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_MIN_BORDER_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_MAX_BORDER_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_INNER_BORDER_BLOOM_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_OUTER_BORDER_BLOOM_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_SDF_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_LIGHT_MASK),
-        GE_STRING_TO_TAG_ENTRY(SDF_EDGE_LIGHT_SDF_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_ELLIPSE_SHAPE_CENTER),
-        GE_STRING_TO_TAG_ENTRY(SDF_ELLIPSE_SHAPE_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_ELLIPSE_SHAPE_HEIGHT),
-        GE_STRING_TO_TAG_ENTRY(SDF_FROM_IMAGE_SPREAD_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(SDF_FROM_IMAGE_GENERATE_DERIVS),
-        GE_STRING_TO_TAG_ENTRY(SDF_PATH_SHAPE_PATH),
-        GE_STRING_TO_TAG_ENTRY(SDF_PATH_SHAPE_OFFSET),
-        GE_STRING_TO_TAG_ENTRY(SDF_PATH_SHAPE_SCALE),
-        GE_STRING_TO_TAG_ENTRY(SDF_PIXELMAP_SHAPE_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(SDF_RRECT_SHAPE_RRECT),
-        GE_STRING_TO_TAG_ENTRY(SDF_SHADOW_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_SHADOW_SHADOW),
-        GE_STRING_TO_TAG_ENTRY(SDF_SMOOTH_SUB_OP_SHAPE_SPACING),
-        GE_STRING_TO_TAG_ENTRY(SDF_SMOOTH_SUB_OP_SHAPE_LEFT),
-        GE_STRING_TO_TAG_ENTRY(SDF_SMOOTH_SUB_OP_SHAPE_RIGHT),
-        GE_STRING_TO_TAG_ENTRY(SDF_SUB_OP_SHAPE_LEFT),
-        GE_STRING_TO_TAG_ENTRY(SDF_SUB_OP_SHAPE_RIGHT),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRANSFORM_SHAPE_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRANSFORM_SHAPE_MATRIX),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRANSFORM_SHAPE_WARP_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRANSFORM_SHAPE_UNION_MODE),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRANSFORM_SHAPE_SPACING),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRANSFORM_SHAPE_HOT_ZONE),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRANSFORM_SHAPE_CENTER_POSITION),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRIANGLE_SHAPE_VERTEX0),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRIANGLE_SHAPE_VERTEX1),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRIANGLE_SHAPE_VERTEX2),
-        GE_STRING_TO_TAG_ENTRY(SDF_TRIANGLE_SHAPE_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(SDF_UNION_OP_SPACING),
-        GE_STRING_TO_TAG_ENTRY(SDF_UNION_OP_LEFT),
-        GE_STRING_TO_TAG_ALIAS(SDF_UNION_OP_LEFT, SDFSmoothUnionOpShape_ShapeX),
-        GE_STRING_TO_TAG_ENTRY(SDF_UNION_OP_RIGHT),
-        GE_STRING_TO_TAG_ALIAS(SDF_UNION_OP_RIGHT, SDFSmoothUnionOpShape_ShapeY),
-        GE_STRING_TO_TAG_ENTRY(SDF_UNION_OP_OP),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_COLOR_A),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_COLOR_B),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_COLOR_C),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_COLOR_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_SOUND_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_SHOCK_WAVE_ALPHA_A),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_SHOCK_WAVE_ALPHA_B),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_SHOCK_WAVE_PROGRESS_A),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_SHOCK_WAVE_PROGRESS_B),
-        GE_STRING_TO_TAG_ENTRY(SOUND_WAVE_SHOCK_WAVE_TOTAL_ALPHA),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_LEFT_TOP),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_LEFT_BOT),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_RIGHT_TOP),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_RIGHT_BOT),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_CAMERA_POSITION),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_CAMERA_INTRINSICS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_LIGHT_DIR),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_THICK_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_GLASS_BASE_COLOR),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_COLOR),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_FRESNEL_ENV_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_BG_RATES),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_BG_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_BG_POS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_BG_NEG),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_REFRACT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_WEIGHTS_EDL),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_RATES),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_POS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_ENV_LIGHT_NEG),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SD_PARAMS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SD_RATES),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SD_K_B_S),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SD_POS),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SD_NEG),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SDF_SHAPE),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_BLUR_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_DEPTH_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SNAPSHOT_RECT),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_SNAPSHOT_MATRIX),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_REFRACT_OUT_PX),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_GLASS_EFFECT_ENABLE_S_D_F_CACHE),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_POINT_LIGHT_LIGHT_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_POINT_LIGHT_LIGHT_POSITION),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_POINT_LIGHT_ATTENUATION),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_POINT_LIGHT_LIGHT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(SPATIAL_POINT_LIGHT_MASK),
-        GE_STRING_TO_TAG_ENTRY(USE_EFFECT_MASK_IMAGE),
-        GE_STRING_TO_TAG_ENTRY(USE_EFFECT_MASK_USE_EFFECT),
-        GE_STRING_TO_TAG_ENTRY(VARIABLE_RADIUS_BLUR_MASK),
-        GE_STRING_TO_TAG_ENTRY(VARIABLE_RADIUS_BLUR_BLUR_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_TOP_LAYER),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_INVERSE),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_TRANSITION_FADE_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_DISTORTION_INTENSITY),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_DISTORTION_THICKNESS),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_LIGHT_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_LIGHT_SOFTNESS),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_NOISE_SCALE_X),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_NOISE_SCALE_Y),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_X),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_NOISE_STRENGTH_Y),
-        GE_STRING_TO_TAG_ENTRY(WATER_DROPLET_TRANSITION_POSITION),
-        GE_STRING_TO_TAG_ENTRY(WATER_RIPPLE_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(WATER_RIPPLE_WAVE_COUNT),
-        GE_STRING_TO_TAG_ENTRY(WATER_RIPPLE_RIPPLE_CENTER_X),
-        GE_STRING_TO_TAG_ENTRY(WATER_RIPPLE_RIPPLE_CENTER_Y),
-        GE_STRING_TO_TAG_ENTRY(WATER_RIPPLE_RIPPLE_MODE),
-        GE_STRING_TO_TAG_ENTRY(WAVE_DISTURBANCE_MASK_CLICK_POS),
-        GE_STRING_TO_TAG_ENTRY(WAVE_DISTURBANCE_MASK_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(WAVE_DISTURBANCE_MASK_WAVE_R_D),
-        GE_STRING_TO_TAG_ENTRY(WAVE_DISTURBANCE_MASK_WAVE_L_W_H),
-        GE_STRING_TO_TAG_ENTRY(WAVE_GRADIENT_MASK_CENTER),
-        GE_STRING_TO_TAG_ENTRY(WAVE_GRADIENT_MASK_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(WAVE_GRADIENT_MASK_PROPAGATION_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(WAVE_GRADIENT_MASK_BLUR_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(WAVE_GRADIENT_MASK_TURBULENCE_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(WAVY_RIPPLE_LIGHT_CENTER),
-        GE_STRING_TO_TAG_ENTRY(WAVY_RIPPLE_LIGHT_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(WAVY_RIPPLE_LIGHT_THICKNESS),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_L_T_W_H),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_STRETCH_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_BAR_ANGLE),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_COLORS0),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_COLORS1),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_COLORS2),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_COLORS3),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_POSITIONS0),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_POSITIONS1),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_POSITIONS2),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_POSITIONS3),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_STRENGTHS),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_BRIGHTNESS),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_GLOW_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_L_T_W_H),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_COLORS0),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_COLORS1),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_COLORS2),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_COLORS3),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_POSITIONS0),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_POSITIONS1),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_POSITIONS2),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_POSITIONS3),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_STRENGTHS),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_BRIGHTNESS),
-        GE_STRING_TO_TAG_ENTRY(AIBAR_RECT_HALO_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS0),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS1),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS2),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS3),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS4),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS5),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS6),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS7),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS8),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS9),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS10),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLORS11),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS0),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS1),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS2),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS3),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS4),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS5),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS6),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS7),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS8),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS9),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS10),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_POSITIONS11),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS0),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS1),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS2),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS3),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS4),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS5),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS6),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS7),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS8),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS9),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS10),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_STRENGTHS11),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_COLOR_NUM),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_BLEND),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_BLENDK),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_MASK),
-        GE_STRING_TO_TAG_ENTRY(COLOR_GRADIENT_EFFECT_BRIGHTNESS),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_TURBULENT_MASK),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_FREQUENCY),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_SHARPNESS),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_BRIGHTNESS),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_DISPERSION),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_SATURATION),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_VERTICAL_MOVE_DISTANCE),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_GRANULARITY),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_DISTORT_FACTOR),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_COLOR_STRENGTH),
-        GE_STRING_TO_TAG_ENTRY(DISTORT_CHROMA_MASK),
-        GE_STRING_TO_TAG_ENTRY(DUPOLI_NOISE_MASK_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(DUPOLI_NOISE_MASK_GRANULARITY),
-        GE_STRING_TO_TAG_ENTRY(DUPOLI_NOISE_MASK_VERTICAL_MOVE_DISTANCE),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_COLORS0),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_COLORS1),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_COLORS2),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_COLORS3),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_GRADIENT_BEGIN),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_GRADIENT_END),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_EFFECT_ALPHA),
-        GE_STRING_TO_TAG_ENTRY(GRADIENT_FLOW_COLORS_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(LIGHT_CAVE_COLOR_A),
-        GE_STRING_TO_TAG_ENTRY(LIGHT_CAVE_COLOR_B),
-        GE_STRING_TO_TAG_ENTRY(LIGHT_CAVE_COLOR_C),
-        GE_STRING_TO_TAG_ENTRY(LIGHT_CAVE_POSITION),
-        GE_STRING_TO_TAG_ENTRY(LIGHT_CAVE_RADIUS_X_Y),
-        GE_STRING_TO_TAG_ENTRY(LIGHT_CAVE_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_GRADIENT_BEZIER_CONTROL_POINTS),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_CORNER_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_MIDDLE_FRAME_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_OUTSIDE_FRAME_WIDTH),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_R_RECT_W_H),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_R_RECT_POS),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_SLOPE),
-        GE_STRING_TO_TAG_ENTRY(NOISY_FRAME_GRADIENT_MASK_PROGRESS),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_START_END_POSITION),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_WAVE_LENGTH),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_WAVE_TOP),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_CORNER_RADIUS),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_BRIGHTNESS),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_SCALE),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_SHARPING),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_FEATHERING),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_FEATHERING_BEZIER_CONTROL_POINTS),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_GRADIENT_BEZIER_CONTROL_POINTS),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_COLOR),
-        GE_STRING_TO_TAG_ENTRY(ROUNDED_RECT_FLOWLIGHT_PROGRESS),
-    };
+    auto value = static_cast<uint32_t>(tag);
+    return value < GE_TAG_INDEX_IN_PARAMS.size() ? GE_TAG_INDEX_IN_PARAMS[value] : GEParamsDirtyBits::CAPACITY;
+}
+
+#define GE_STRING_TO_TAG_ENTRY(Hash, Tag)                                                 \
+    GENameTableEntry<GEParamsMemberTag> {                                                 \
+        Hash, GEParamsFieldAccessor<GEParamsMemberTag::Tag>::name, GEParamsMemberTag::Tag \
+    }
+
+#define GE_STRING_TO_TAG_ALIAS(Hash, Tag, Alias)                                 \
+    GENameTableEntry<GEParamsMemberTag> { Hash, #Alias, GEParamsMemberTag::Tag }
+
+// Sorted by GENameHash of the name
+constexpr std::array<GENameTableEntry<GEParamsMemberTag>, 649> GE_PARAMS_MEMBER_TAG_TABLE = {
+    GE_STRING_TO_TAG_ENTRY(0x0006f423ee903f23ULL, SPATIAL_GLASS_EFFECT_ENV_LIGHT_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x003e7c4cf4de7420ULL, RIPPLE_MASK_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x00806fa76dcc5229ULL, SDF_COLOR_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x008b029c981b5b1bULL, AIBAR_GLOW_STRENGTHS),
+    GE_STRING_TO_TAG_ENTRY(0x00ca182ecc1a7d3bULL, MAP_COLOR_BY_BRIGHTNESS_COLORS),
+    GE_STRING_TO_TAG_ENTRY(0x011dd78b4382a460ULL, SPATIAL_GLASS_EFFECT_SD_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x0160a6ce609834caULL, FROSTED_GLASS_EFFECT_ENABLE_S_D_F_CACHE),
+    GE_STRING_TO_TAG_ENTRY(0x01feafe5d9149cfcULL, SDF_EDGE_LIGHT_OUTER_BORDER_BLOOM_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x0227e0b226847b1cULL, MESA_BLUR_IS_DIRECTION),
+    GE_STRING_TO_TAG_ENTRY(0x023294d5966494a1ULL, DISTORTION_COLLAPSE_BARREL_DISTORTION),
+    GE_STRING_TO_TAG_ENTRY(0x038013531074afc2ULL, AIBAR_RECT_HALO_BRIGHTNESS),
+    GE_STRING_TO_TAG_ENTRY(0x03ff2d588b8fd361ULL, HARMONIUM_EFFECT_QUAD_COEFF),
+    GE_STRING_TO_TAG_ENTRY(0x040538561c223fc8ULL, LINEAR_GRADIENT_BLUR_FRACTION_STOPS),
+    GE_STRING_TO_TAG_ENTRY(0x0465a2bd72cecde9ULL, SDF_FROM_IMAGE_GENERATE_DERIVS),
+    GE_STRING_TO_TAG_ENTRY(0x053fa2f523890d25ULL, DEPTH_OCCLUSION_DEPTH_PLANE),
+    GE_STRING_TO_TAG_ENTRY(0x05b67b47610b5b8cULL, SPATIAL_GLASS_EFFECT_THICK_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x0637b6001d435d1fULL, MESA_BLUR_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x0656f1dc0b9f2401ULL, SPATIAL_GLASS_EFFECT_GLASS_BASE_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x06a34920bc6e75ccULL, FROSTED_GLASS_EFFECT_DARK_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0x07d836c62f6d1776ULL, FROSTED_GLASS_ENV_LIGHT_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x087cd6278d9e2846ULL, NOISY_FRAME_GRADIENT_MASK_R_RECT_W_H),
+    GE_STRING_TO_TAG_ENTRY(0x08ec27c6d7f19ee1ULL, WAVE_GRADIENT_MASK_TURBULENCE_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x0949d6c3b30928f4ULL, NOISY_FRAME_GRADIENT_MASK_CORNER_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x0b730ac5bcfbd773ULL, SDF_FROM_IMAGE_SPREAD_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x0c812fe3cfe5fd0aULL, SDF_EDGE_LIGHT_EFFECT_BLOOM_FALLOFF_POW),
+    GE_STRING_TO_TAG_ENTRY(0x0d63fe14e08e34b0ULL, AIBAR_RECT_HALO_POSITIONS2),
+    GE_STRING_TO_TAG_ENTRY(0x0d63ff14e08e3663ULL, AIBAR_RECT_HALO_POSITIONS3),
+    GE_STRING_TO_TAG_ENTRY(0x0d640014e08e3816ULL, AIBAR_RECT_HALO_POSITIONS0),
+    GE_STRING_TO_TAG_ENTRY(0x0d640114e08e39c9ULL, AIBAR_RECT_HALO_POSITIONS1),
+    GE_STRING_TO_TAG_ENTRY(0x0e3709d1d1fe86abULL, FROSTED_GLASS_EFFECT_SNAPSHOT_MATRIX),
+    GE_STRING_TO_TAG_ENTRY(0x0ead8f92d4c2d888ULL, MESA_BLUR_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x0f5024177921b8bcULL, FROSTED_GLASS_BG_POS),
+    GE_STRING_TO_TAG_ENTRY(0x10e631b980440eafULL, PARTICLE_ABLATION_GLOW_LEVEL),
+    GE_STRING_TO_TAG_ENTRY(0x124b7c6d2d9b0bedULL, NOISY_FRAME_GRADIENT_MASK_OUTSIDE_FRAME_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x131dc027db87a4c4ULL, DUPOLI_NOISE_MASK_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x131f48bff0ef9a8aULL, DISTORTION_COLLAPSE_R_U_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0x1321d2eefdb5abe1ULL, SDF_BORDER_BORDER),
+    GE_STRING_TO_TAG_ENTRY(0x134453e6bcadb3fcULL, FROSTED_GLASS_EFFECT_ED_LIGHT_DIR),
+    GE_STRING_TO_TAG_ENTRY(0x13c23056c8e681e3ULL, WAVE_DISTURBANCE_MASK_CLICK_POS),
+    GE_STRING_TO_TAG_ENTRY(0x14be6d0dd3f3f409ULL, CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_LENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x1690bfbc66405169ULL, SDF_DISTORT_OP_SHAPE_BARREL_DISTORTION),
+    GE_STRING_TO_TAG_ENTRY(0x18810fbfc67e8a4dULL, DOUBLE_RIPPLE_MASK_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x18954212c0c384d4ULL, PARTICLE_ABLATION_GLOW_BRIGHTNESS),
+    GE_STRING_TO_TAG_ENTRY(0x1965ebdf274146eeULL, LINEAR_GRADIENT_BLUR_BLUR_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x1aade775e9095e89ULL, FROSTED_GLASS_DARK_MODE_ED_LIGHT_ANGLES),
+    GE_STRING_TO_TAG_ENTRY(0x1ad96cbf9b5a7519ULL, GASIFY_SOURCE_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x1afd9bb171028c45ULL, FROSTED_GLASS_BG_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x1b38f00db0b2d48dULL, DISTORT_CHROMA_GRANULARITY),
+    GE_STRING_TO_TAG_ENTRY(0x1b66ff4ac3bcb142ULL, MAGNIFIER_BORDER_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x1b84568b52955434ULL, SPATIAL_GLASS_EFFECT_SD_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfb51a5f6f15f6ULL, GRID_WARP_GRID_POINTS8),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfbb1a5f6f2028ULL, GRID_WARP_GRID_POINTS2),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfbc1a5f6f21dbULL, GRID_WARP_GRID_POINTS3),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfbd1a5f6f238eULL, GRID_WARP_GRID_POINTS0),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfbe1a5f6f2541ULL, GRID_WARP_GRID_POINTS1),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfbf1a5f6f26f4ULL, GRID_WARP_GRID_POINTS6),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfc01a5f6f28a7ULL, GRID_WARP_GRID_POINTS7),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfc11a5f6f2a5aULL, GRID_WARP_GRID_POINTS4),
+    GE_STRING_TO_TAG_ENTRY(0x1bdfc21a5f6f2c0dULL, GRID_WARP_GRID_POINTS5),
+    GE_STRING_TO_TAG_ENTRY(0x1bf2b91b65b469fcULL, BORDER_SDF_SHADER_DASH_GAP),
+    GE_STRING_TO_TAG_ENTRY(0x1cdbfb79a18add49ULL, BORDER_LIGHT_CORNER_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x1d0216075fc8236aULL, ROUNDED_RECT_FLOWLIGHT_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x1db5895294f1752bULL, SDF_EDGE_LIGHT_EFFECT_SDF_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x1e24730756f6383aULL, SDF_RRECT_SHAPE_RRECT),
+    GE_STRING_TO_TAG_ENTRY(0x1ebcaf2a1f638fe2ULL, SDF_EDGE_LIGHT_EFFECT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x1f0c29fafc8f6b12ULL, DISPLACEMENT_DISTORT_FILTER_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x1fad96ec3d026d94ULL, CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x207106cfbfca5d6bULL, GRADIENT_FLOW_COLORS_GRADIENT_END),
+    GE_STRING_TO_TAG_ENTRY(0x20851e5ea37c1bedULL, CIRCLE_FLOWLIGHT_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x215cccf418501e41ULL, DOUBLE_RIPPLE_MASK_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x21a44746eafc47f0ULL, LINEAR_GRADIENT_MASK_START_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0x21a65b48a7887885ULL, FRAME_GRADIENT_MASK_BOX_ANGLE_DEG),
+    GE_STRING_TO_TAG_ENTRY(0x21cd3716a41ce759ULL, SDF_EDGE_LIGHT_BLOOM_INTENSITY_CUTOFF),
+    GE_STRING_TO_TAG_ENTRY(0x2204d93dbf3fcdd4ULL, BORDER_SDF_SHADER_DASH_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x239dbd4edff3ef23ULL, CONTOUR_DIAGONAL_FLOW_LIGHT_LINE2_START),
+    GE_STRING_TO_TAG_ENTRY(0x2458a04770bca639ULL, FROSTED_GLASS_EFFECT_SD_POS),
+    GE_STRING_TO_TAG_ENTRY(0x2492847c38090222ULL, SPATIAL_GLASS_EFFECT_CAMERA_INTRINSICS),
+    GE_STRING_TO_TAG_ENTRY(0x24a0ec95d73f690bULL, WATER_RIPPLE_RIPPLE_MODE),
+    GE_STRING_TO_TAG_ENTRY(0x259670c97201ead5ULL, ROUNDED_RECT_FLOWLIGHT_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0x2628c573fc1b38d2ULL, WATER_DROPLET_TRANSITION_DISTORTION_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x2720a30e77254377ULL, DIRECTION_LIGHT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x275c3286206bfbb7ULL, DOT_MATRIX_PATH_DIRECTION),
+    GE_STRING_TO_TAG_ENTRY(0x2766f5ae5581d05dULL, HARMONIUM_EFFECT_DISTORT_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x27aa877742b5a662ULL, MESA_BLUR_HEIGHT),
+    GE_STRING_TO_TAG_ENTRY(0x28c68a5ffef5b955ULL, NOISY_FRAME_GRADIENT_MASK_MIDDLE_FRAME_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x29aa00ee22f07a3cULL, HEAT_DISTORTION_RISE_WEIGHT),
+    GE_STRING_TO_TAG_ENTRY(0x29c44fe0a29ddc3eULL, AIBAR_RECT_HALO_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x2a18022974d05082ULL, BORDER_SDF_LG_COLOR_ANGLE),
+    GE_STRING_TO_TAG_ENTRY(0x2a1e55c86f22982bULL, BEZIER_WARP_DESTINATION_PATCH),
+    GE_STRING_TO_TAG_ENTRY(0x2a728fd030dde697ULL, SPATIAL_GLASS_EFFECT_DEPTH_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x2a934fa5cc15aa0eULL, SPATIAL_POINT_LIGHT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x2aa0d1e76e4abab0ULL, DOT_MATRIX_START_POINTS),
+    GE_STRING_TO_TAG_ENTRY(0x2ad8c723f19f164bULL, DOT_MATRIX_DOT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x2ae6dcf372c88fe9ULL, MESA_BLUR_ANGLE),
+    GE_STRING_TO_TAG_ENTRY(0x2b28b0ba5cbbd781ULL, FRAME_GRADIENT_MASK_AXIAL_CENTER),
+    GE_STRING_TO_TAG_ENTRY(0x2b4e370a21d0e483ULL, MAGNIFIER_CORNER_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x2c2fdec5daf4182eULL, HARMONIUM_EFFECT_TOTAL_MATRIX),
+    GE_STRING_TO_TAG_ENTRY(0x2c43f3968c50373aULL, FROSTED_GLASS_REFRACT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x2c9f6f81496b683dULL, ROUNDED_RECT_FLOWLIGHT_SHARPING),
+    GE_STRING_TO_TAG_ENTRY(0x2cc8bb17e6ed9a9bULL, FROSTED_GLASS_EFFECT_MAX_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x2de8278a99e3750cULL, SDF_DISTORT_OP_SHAPE_L_U_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0x2e78e0038d828c23ULL, ROUNDED_RECT_FLOWLIGHT_START_END_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0x2ef3f8f99987b5b9ULL, SDF_ELLIPSE_SHAPE_CENTER),
+    GE_STRING_TO_TAG_ENTRY(0x2fdbd0446f32b5d6ULL, NOISY_FRAME_GRADIENT_MASK_GRADIENT_BEZIER_CONTROL_POINTS),
+    GE_STRING_TO_TAG_ENTRY(0x2fdfae056185f8e1ULL, PARTICLE_ABLATION_TURB_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0x303e06ea1c756576ULL, BORDER_LIGHT_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x3165e152a9751ff1ULL, HARMONIUM_EFFECT_BLUR_TOP),
+    GE_STRING_TO_TAG_ENTRY(0x31b6ac79dc08c999ULL, FROSTED_GLASS_EFFECT_ED_LIGHT_ANGLES),
+    GE_STRING_TO_TAG_ENTRY(0x3340be1f5b9d2ce1ULL, AIBAR_AI_BAR_SATURATION),
+    GE_STRING_TO_TAG_ENTRY(0x334b7a4802fdcc45ULL, DOT_MATRIX_BG_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x337a79b2f3cce4bcULL, LINEAR_GRADIENT_MASK_FRACTION_STOPS),
+    GE_STRING_TO_TAG_ENTRY(0x34c4c242529545f4ULL, PARTICLE_ABLATION_CENTERS0),
+    GE_STRING_TO_TAG_ENTRY(0x34c4c342529547a7ULL, PARTICLE_ABLATION_CENTERS1),
+    GE_STRING_TO_TAG_ENTRY(0x34c4c4425295495aULL, PARTICLE_ABLATION_CENTERS2),
+    GE_STRING_TO_TAG_ENTRY(0x34c4c54252954b0dULL, PARTICLE_ABLATION_CENTERS3),
+    GE_STRING_TO_TAG_ENTRY(0x35071e9ab2455161ULL, FROSTED_GLASS_DARK_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0x351ec2f3a8d2d8a2ULL, WAVE_DISTURBANCE_MASK_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x357b27762b00fdfbULL, SDF_EDGE_LIGHT_EFFECT_MAX_BLOOM_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x3602e23b50c616a5ULL, AIBAR_GLOW_L_T_W_H),
+    GE_STRING_TO_TAG_ENTRY(0x364e758282b87a50ULL, DOUBLE_RIPPLE_MASK_CENTER2),
+    GE_STRING_TO_TAG_ENTRY(0x364e788282b87f69ULL, DOUBLE_RIPPLE_MASK_CENTER1),
+    GE_STRING_TO_TAG_ENTRY(0x3682637335178e2bULL, DISTORT_CHROMA_SATURATION),
+    GE_STRING_TO_TAG_ENTRY(0x36eeb61e072456dbULL, SDF_COLOR_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x37261777142200b5ULL, SPATIAL_GLASS_EFFECT_LEFT_BOT),
+    GE_STRING_TO_TAG_ENTRY(0x37a326ebec4a675cULL, FROSTED_GLASS_DARK_MODE_WEIGHTS_EMBOSS),
+    GE_STRING_TO_TAG_ENTRY(0x37a8759861421174ULL, ROUNDED_RECT_FLOWLIGHT_WAVE_LENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x38523960231f531eULL, FROSTED_GLASS_BLUR_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x389e01c1be328901ULL, SPATIAL_GLASS_EFFECT_SD_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x395e87620f4b7abaULL, COLOR_GRADIENT_EFFECT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x3a8a1259a36ea260ULL, FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_ANGLES),
+    GE_STRING_TO_TAG_ENTRY(0x3af09169afcbc36fULL, FROSTED_GLASS_EFFECT_SDF_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x3ba6a9d6dc44d1fbULL, FROSTED_GLASS_ENV_LIGHT_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x3bdab6203ca82789ULL, FROSTED_GLASS_DARK_MODE_ED_LIGHT_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x3be96212b15aa83cULL, WATER_DROPLET_TRANSITION_NOISE_STRENGTH_Y),
+    GE_STRING_TO_TAG_ENTRY(0x3be96312b15aa9efULL, WATER_DROPLET_TRANSITION_NOISE_STRENGTH_X),
+    GE_STRING_TO_TAG_ENTRY(0x3bfc88c8e9320595ULL, MAGNIFIER_SHADOW_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x3c826a51ca5cfae5ULL, SDF_TRANSFORM_SHAPE_SPACING),
+    GE_STRING_TO_TAG_ENTRY(0x3caac8e11e4ab5eeULL, FROSTED_GLASS_EFFECT_DARK_MODE_ED_LIGHT_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x3cae3a4f57ed3e47ULL, VARIABLE_RADIUS_BLUR_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x3d8c2f70237a803fULL, SDF_EDGE_LIGHT_EFFECT_SDF_SPREAD_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x3dd53191a4461f97ULL, FROSTED_GLASS_ED_LIGHT_DIR),
+    GE_STRING_TO_TAG_ENTRY(0x3e09fcb52acab2eeULL, HEAT_DISTORTION_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x3e242ca0d1e7b8beULL, PARTICLE_ABLATION_ABLATION_RATE),
+    GE_STRING_TO_TAG_ENTRY(0x3e811afd30c59668ULL, CONTENT_LIGHT_ROTATION_ANGLE),
+    GE_STRING_TO_TAG_ENTRY(0x3f210cd9a125068dULL, SPATIAL_GLASS_EFFECT_FRESNEL_ENV_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x3faa228d6067fa29ULL, COLOR_GRADIENT_EFFECT_BLEND),
+    GE_STRING_TO_TAG_ENTRY(0x4069281f268acab6ULL, FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x40eca7888f1deb36ULL, FROSTED_GLASS_SDF_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x416fb43c34f73062ULL, COLOR_GRADIENT_EFFECT_STRENGTHS10),
+    GE_STRING_TO_TAG_ENTRY(0x416fb53c34f73215ULL, COLOR_GRADIENT_EFFECT_STRENGTHS11),
+    GE_STRING_TO_TAG_ENTRY(0x4196e5afc040b542ULL, SDF_EDGE_LIGHT_EFFECT_INNER_BORDER_BLOOM_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x41b1fae07f0e9892ULL, HEAT_DISTORTION_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x432e92aace1945c0ULL, COLOR_GRADIENT_EFFECT_STRENGTHS3),
+    GE_STRING_TO_TAG_ENTRY(0x432e93aace194773ULL, COLOR_GRADIENT_EFFECT_STRENGTHS2),
+    GE_STRING_TO_TAG_ENTRY(0x432e94aace194926ULL, COLOR_GRADIENT_EFFECT_STRENGTHS1),
+    GE_STRING_TO_TAG_ENTRY(0x432e95aace194ad9ULL, COLOR_GRADIENT_EFFECT_STRENGTHS0),
+    GE_STRING_TO_TAG_ENTRY(0x432e96aace194c8cULL, COLOR_GRADIENT_EFFECT_STRENGTHS7),
+    GE_STRING_TO_TAG_ENTRY(0x432e97aace194e3fULL, COLOR_GRADIENT_EFFECT_STRENGTHS6),
+    GE_STRING_TO_TAG_ENTRY(0x432e98aace194ff2ULL, COLOR_GRADIENT_EFFECT_STRENGTHS5),
+    GE_STRING_TO_TAG_ENTRY(0x432e99aace1951a5ULL, COLOR_GRADIENT_EFFECT_STRENGTHS4),
+    GE_STRING_TO_TAG_ENTRY(0x432e9caace1956beULL, COLOR_GRADIENT_EFFECT_STRENGTHS9),
+    GE_STRING_TO_TAG_ENTRY(0x432e9daace195871ULL, COLOR_GRADIENT_EFFECT_STRENGTHS8),
+    GE_STRING_TO_TAG_ENTRY(0x43afa34db62aac56ULL, GASIFY_BLUR_MASK_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x44988ba28d427adcULL, SOUND_WAVE_SHOCK_WAVE_TOTAL_ALPHA),
+    GE_STRING_TO_TAG_ENTRY(0x44dc6a19887becf2ULL, SPATIAL_GLASS_EFFECT_REFRACT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x4555d20cf0a60526ULL, SDF_SHADOW_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x4582b682e32d6fd3ULL, HARMONIUM_EFFECT_USE_EFFECT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x463718a0e281916dULL, PARTICLE_ABLATION_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x47156eab90c91391ULL, VARIABLE_RADIUS_BLUR_APPLY_INSIDE_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x478754c36cfabe06ULL, WATER_RIPPLE_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x47e9d67535996ae8ULL, FROSTED_GLASS_EFFECT_BLUR_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x47f9b86ff2c2441dULL, DOUBLE_RIPPLE_MASK_HALO_THICKNESS),
+    GE_STRING_TO_TAG_ENTRY(0x48e19989221900b9ULL, HARMONIUM_EFFECT_TINT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x4922111368839a61ULL, VARIABLE_RADIUS_BLUR_BLUR_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x4a5042847bb02ee0ULL, EDGE_LIGHT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x4b95c5610fd28490ULL, AIBAR_RECT_HALO_COLORS0),
+    GE_STRING_TO_TAG_ENTRY(0x4b95c6610fd28643ULL, AIBAR_RECT_HALO_COLORS1),
+    GE_STRING_TO_TAG_ENTRY(0x4b95c7610fd287f6ULL, AIBAR_RECT_HALO_COLORS2),
+    GE_STRING_TO_TAG_ENTRY(0x4b95c8610fd289a9ULL, AIBAR_RECT_HALO_COLORS3),
+    GE_STRING_TO_TAG_ENTRY(0x4bb0bbbf4cab5c7eULL, SDF_PATH_SHAPE_OFFSET),
+    GE_STRING_TO_TAG_ENTRY(0x4c1d45c470ba3854ULL, RADIAL_GRADIENT_MASK_RADIUS_Y),
+    GE_STRING_TO_TAG_ENTRY(0x4c1d46c470ba3a07ULL, RADIAL_GRADIENT_MASK_RADIUS_X),
+    GE_STRING_TO_TAG_ENTRY(0x4c5cd3dc45f65ce1ULL, DISTORT_CHROMA_DISTORT_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x4c985a0c9b40d5a4ULL, SOUND_WAVE_SHOCK_WAVE_ALPHA_B),
+    GE_STRING_TO_TAG_ENTRY(0x4c985d0c9b40dabdULL, SOUND_WAVE_SHOCK_WAVE_ALPHA_A),
+    GE_STRING_TO_TAG_ENTRY(0x4ccf916f3bc14acfULL, FROSTED_GLASS_EFFECT_REFRACT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x4cee65f0df1eae54ULL, CIRCLE_FLOWLIGHT_ROTATION_FREQUENCY),
+    GE_STRING_TO_TAG_ENTRY(0x4d0bb3a4895743b4ULL, DISTORTION_COLLAPSE_L_U_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0x4d13cfe3b7021c4dULL, FROSTED_GLASS_EFFECT_ENV_LIGHT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x4d94f7ef4fcfeed0ULL, GASIFY_BLUR_SOURCE_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x4e5e58aa9568380cULL, FROSTED_GLASS_EFFECT_SD_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x4e7314f59ef3ce0aULL, HARMONIUM_EFFECT_RIPPLE_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x4f4975869242857bULL, MAGNIFIER_ROTATE_DEGREE),
+    GE_STRING_TO_TAG_ENTRY(0x50f4a16f13cdb1a3ULL, SDF_EDGE_LIGHT_EFFECT_SDF_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x51df66329b5c9eb8ULL, AIBAR_GLOW_STRETCH_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x52489f1cf2e0a30dULL, DEPTH_OCCLUSION_WEIGHT),
+    GE_STRING_TO_TAG_ENTRY(0x5316774ef8aca87cULL, CIRCLE_FLOWLIGHT_GRADIENT_X),
+    GE_STRING_TO_TAG_ENTRY(0x5316784ef8acaa2fULL, CIRCLE_FLOWLIGHT_GRADIENT_Y),
+    GE_STRING_TO_TAG_ENTRY(0x5317ddcc01e602b9ULL, HARMONIUM_EFFECT_REFLECTION_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x531dd4a84cac52cdULL, RIPPLE_MASK_CENTER),
+    GE_STRING_TO_TAG_ENTRY(0x53a3c7ad47f2110aULL, FRAME_GRADIENT_MASK_INNER_BEZIER),
+    GE_STRING_TO_TAG_ENTRY(0x5451dd68075e465fULL, SDF_EDGE_LIGHT_INNER_BORDER_BLOOM_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x550ccef59309ee25ULL, MASK_TRANSITION_INVERSE),
+    GE_STRING_TO_TAG_ENTRY(0x5564ced13d30121fULL, FROSTED_GLASS_EFFECT_ENV_LIGHT_POS),
+    GE_STRING_TO_TAG_ENTRY(0x55c08e59c9bec78aULL, DISTORT_CHROMA_SHARPNESS),
+    GE_STRING_TO_TAG_ENTRY(0x58f5ce6ed43ee100ULL, DIRECTION_LIGHT_LIGHT_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x596335e071028b6dULL, FRAME_GRADIENT_MASK_OUTER_FRAME_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x596639cdd7ca8026ULL, NOISY_FRAME_GRADIENT_MASK_INNER_FRAME_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x59757c2139f092c8ULL, SPATIAL_GLASS_EFFECT_SD_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x597e8a3e7961d45dULL, SPATIAL_POINT_LIGHT_LIGHT_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0x59da065bdaacc31cULL, DISPERSION_GREEN_OFFSET),
+    GE_STRING_TO_TAG_ENTRY(0x5aa32f6273d83743ULL, EDGE_LIGHT_ALPHA),
+    GE_STRING_TO_TAG_ENTRY(0x5bf6b11c1b98bae1ULL, FROSTED_GLASS_DARK_MODE_BG_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x5bf822b37095dbccULL, SPATIAL_GLASS_EFFECT_SNAPSHOT_MATRIX),
+    GE_STRING_TO_TAG_ENTRY(0x5c10f93fc608336dULL, FRAME_GRADIENT_MASK_OUTER_BEZIER),
+    GE_STRING_TO_TAG_ENTRY(0x5c2e512401a2d063ULL, FROSTED_GLASS_EFFECT_REFRACT_OUT_PX),
+    GE_STRING_TO_TAG_ENTRY(0x5c45680e1c22732cULL, DIRECTION_LIGHT_MASK_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x5c4d7e1cd9a6444aULL, LINEAR_GRADIENT_BLUR_DIRECTION),
+    GE_STRING_TO_TAG_ENTRY(0x5cf2fe345de01c03ULL, HARMONIUM_EFFECT_BLUR_LEFT),
+    GE_STRING_TO_TAG_ENTRY(0x5e53cc2b35522effULL, HARMONIUM_EFFECT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x5e679d8570a530d0ULL, AIBAR_AI_BAR_THRESHOLD),
+    GE_STRING_TO_TAG_ENTRY(0x5eb2b86613d9674eULL, SPATIAL_POINT_LIGHT_ATTENUATION),
+    GE_STRING_TO_TAG_ENTRY(0x5f418bdab1b8ef9cULL, DOT_MATRIX_EFFECT_COLORS),
+    GE_STRING_TO_TAG_ENTRY(0x5f83ff6a653ad568ULL, FROSTED_GLASS_SD_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x60eee2d102220c48ULL, SPATIAL_GLASS_EFFECT_BG_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x61a80ed33e305075ULL, AIBAR_AI_BAR_HIGH),
+    GE_STRING_TO_TAG_ENTRY(0x63f7d633f75bbd64ULL, CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_LENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x6459597d4051c837ULL, DUPOLI_NOISE_MASK_VERTICAL_MOVE_DISTANCE),
+    GE_STRING_TO_TAG_ENTRY(0x646a80d9516fa5ccULL, BORDER_SDF_LG_COLOR_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x64aadde70b746d7aULL, DOT_MATRIX_INVERSE_EFFECT),
+    GE_STRING_TO_TAG_ENTRY(0x64fee99bf9300ac4ULL, MAGNIFIER_SDF_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x6583a4d195ef3734ULL, SPATIAL_GLASS_EFFECT_BG_POS),
+    GE_STRING_TO_TAG_ENTRY(0x66e72cd1472830efULL, FROSTED_GLASS_EFFECT_ENV_LIGHT_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x6958cd7cd25d245bULL, SDF_ELLIPSE_SHAPE_HEIGHT),
+    GE_STRING_TO_TAG_ENTRY(0x69b31cf25a7c64ffULL, LINEAR_GRADIENT_BLUR_IS_RADIUS_GRADIENT),
+    GE_STRING_TO_TAG_ENTRY(0x6a0caf42fb7b7412ULL, DOT_MATRIX_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x6a4a004158a3fa8aULL, FRAME_GRADIENT_MASK_AXIAL_FEATHER_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x6aebb0649ab24bd0ULL, BLUR_BUBBLES_RISE_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x6af46db96885d600ULL, FROSTED_GLASS_DARK_MODE_BLUR_PARAM),
+    GE_STRING_TO_TAG_ENTRY(0x6b79051768c2bd20ULL, PARTICLE_ABLATION_WIND),
+    GE_STRING_TO_TAG_ENTRY(0x6c0db20e1f556b89ULL, SPATIAL_GLASS_EFFECT_SDF_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x6c34c79ffd1ce871ULL, WATER_DROPLET_TRANSITION_TRANSITION_FADE_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x6c36038f7660199bULL, BLUR_BUBBLES_RISE_BLUR_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x6c9b07e7bd318633ULL, MAGNIFIER_HEIGHT),
+    GE_STRING_TO_TAG_ALIAS(0x6c9e7730b7656470ULL, SDF_UNION_OP_RIGHT, SDFSmoothUnionOpShape_ShapeY),
+    GE_STRING_TO_TAG_ALIAS(0x6c9e7830b7656623ULL, SDF_UNION_OP_LEFT, SDFSmoothUnionOpShape_ShapeX),
+    GE_STRING_TO_TAG_ENTRY(0x6d3279d25bbbbf7aULL, AIBAR_RECT_HALO_L_T_W_H),
+    GE_STRING_TO_TAG_ENTRY(0x6d6c3e56049f216bULL, BORDER_SDF_SHADER_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x6db0034b949e3583ULL, FROSTED_GLASS_ED_LIGHT_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x6ee401b7711cf872ULL, WAVE_GRADIENT_MASK_BLUR_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x6f244fdb5816f346ULL, WAVE_DISTURBANCE_MASK_WAVE_R_D),
+    GE_STRING_TO_TAG_ENTRY(0x6f521a5d71810302ULL, BEZIER_WARP_DESTINATION_PATCH11),
+    GE_STRING_TO_TAG_ENTRY(0x6f521b5d718104b5ULL, BEZIER_WARP_DESTINATION_PATCH10),
+    GE_STRING_TO_TAG_ENTRY(0x6fa30f4c5407f65eULL, LINEAR_GRADIENT_BLUR_GEO_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x7004eb6453768782ULL, FROSTED_GLASS_EFFECT_ENV_LIGHT_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x7018b92b834f96dbULL, FROSTED_GLASS_EFFECT_BG_ALPHA),
+    GE_STRING_TO_TAG_ENTRY(0x70c570036ae1b46cULL, FROSTED_GLASS_EFFECT_SNAPSHOT_RECT),
+    GE_STRING_TO_TAG_ENTRY(0x713dabb07dc914a6ULL, SDF_EDGE_LIGHT_EFFECT_MAX_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x71ffb80d270b4063ULL, DEPTH_OCCLUSION_NEAR),
+    GE_STRING_TO_TAG_ENTRY(0x72798157b98c61d9ULL, BORDER_SDF_SHADER_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x727b021b1db00954ULL, MOTION_BLUR_SAMPLE_COUNT),
+    GE_STRING_TO_TAG_ENTRY(0x728399c93dc084e3ULL, SDF_TRANSFORM_SHAPE_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x72aa99b065c99853ULL, GRADIENT_FLOW_COLORS_GRADIENT_BEGIN),
+    GE_STRING_TO_TAG_ENTRY(0x732bca7693002a0eULL, DOUBLE_RIPPLE_MASK_TURBULENCE),
+    GE_STRING_TO_TAG_ENTRY(0x739ce6cce221beacULL, DISPERSION_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x73f6c25e2aa6e58cULL, FROSTED_GLASS_EFFECT_BG_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x741d92cd60e1a0b2ULL, SOUND_WAVE_COLOR_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0x742e7175a286b14dULL, SDF_PIXELMAP_SHAPE_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x74b97dca9a0f6442ULL, SDF_UNION_OP_OP),
+    GE_STRING_TO_TAG_ENTRY(0x74c12206cd469b48ULL, HARMONIUM_EFFECT_CORNER_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x75533abbc43e3994ULL, SDF_EDGE_LIGHT_SDF_SPREAD_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x765a3699493820abULL, FROSTED_GLASS_BASE_VIBRANCY_ENABLED),
+    GE_STRING_TO_TAG_ENTRY(0x76aa8ce99dee16a7ULL, DISTORT_CHROMA_FREQUENCY),
+    GE_STRING_TO_TAG_ENTRY(0x77c0a4d6b2adc8faULL, DOT_MATRIX_DOT_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x7801f81c2c1062b1ULL, FROSTED_GLASS_DARK_MODE_BG_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x780ad962998fc5e3ULL, FROSTED_GLASS_EFFECT_SD_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x7876a55c331b131eULL, DEPTH_OCCLUSION_IS_REVERSE),
+    GE_STRING_TO_TAG_ENTRY(0x787ee9ed1e08f26bULL, CIRCLE_FLOWLIGHT_ROTATION_AMPLITUDE),
+    GE_STRING_TO_TAG_ENTRY(0x79265a67a1d78685ULL, FROSTED_GLASS_EFFECT_DARK_MODE_BG_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x7aba937a14832c22ULL, GASIFY_SCALE_TWIST_MASK_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x7ae5391f8fd6585fULL, SDF_EDGE_LIGHT_MAX_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x7b032791c714e9aeULL, FROSTED_GLASS_ED_LIGHT_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x7b1dcf544ca875e2ULL, SDF_EDGE_LIGHT_MAX_BLOOM_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x7b7e478e8d310dd9ULL, FROSTED_GLASS_SD_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x7b9c5e6a75bd305cULL, FROSTED_GLASS_SD_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x7bde8422635facf4ULL, AIBAR_GLOW_COLORS1),
+    GE_STRING_TO_TAG_ENTRY(0x7bde8522635faea7ULL, AIBAR_GLOW_COLORS0),
+    GE_STRING_TO_TAG_ENTRY(0x7bde8622635fb05aULL, AIBAR_GLOW_COLORS3),
+    GE_STRING_TO_TAG_ENTRY(0x7bde8722635fb20dULL, AIBAR_GLOW_COLORS2),
+    GE_STRING_TO_TAG_ENTRY(0x7c21523c56707b09ULL, WAVE_GRADIENT_MASK_CENTER),
+    GE_STRING_TO_TAG_ENTRY(0x7d396b81628964cfULL, BORDER_SDF_LG_COLOR_COLOR_NUMBER),
+    GE_STRING_TO_TAG_ENTRY(0x7d3ceb2219528726ULL, SPATIAL_GLASS_EFFECT_ENV_LIGHT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0x7d46227cd6e67d46ULL, WATER_RIPPLE_RIPPLE_CENTER_X),
+    GE_STRING_TO_TAG_ENTRY(0x7d46237cd6e67ef9ULL, WATER_RIPPLE_RIPPLE_CENTER_Y),
+    GE_STRING_TO_TAG_ENTRY(0x7dca077eff722965ULL, MOTION_BLUR_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0x7e66853f4d67bdfaULL, SDF_PATH_SHAPE_PATH),
+    GE_STRING_TO_TAG_ENTRY(0x7f0ea475a0f2a0f1ULL, CONTOUR_DIAGONAL_FLOW_LIGHT_LIGHT_WEIGHT),
+    GE_STRING_TO_TAG_ENTRY(0x7f8ee94106b806e1ULL, LINEAR_GRADIENT_MASK_END_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0x806f62cc04b89c51ULL, HARMONIUM_EFFECT_RATE),
+    GE_STRING_TO_TAG_ENTRY(0x809379e5bab893f9ULL, DISTORT_CHROMA_DISPERSION),
+    GE_STRING_TO_TAG_ENTRY(0x80b47b6a39310c91ULL, PIXEL_MAP_MASK_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x813d9293bd4de505ULL, DISPLACEMENT_DISTORT_FILTER_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x814c83d15638e9cbULL, FROSTED_GLASS_EFFECT_ENV_LIGHT_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x81557dde37289af1ULL, FROSTED_GLASS_EFFECT_BG_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x8267691d3eff83dcULL, FROSTED_GLASS_DARK_MODE_BG_RATES),
+    GE_STRING_TO_TAG_ENTRY(0x826d8b4458eab489ULL, COLOR_GRADIENT_STRENGTHS),
+    GE_STRING_TO_TAG_ENTRY(0x82715f5e3bccdc34ULL, EDGE_LIGHT_BLOOM),
+    GE_STRING_TO_TAG_ENTRY(0x82c3f3b31887db9bULL, BORDER_LIGHT_ROTATION_ANGLE),
+    GE_STRING_TO_TAG_ENTRY(0x830720d875253bc5ULL, SDF_TRANSFORM_SHAPE_HOT_ZONE),
+    GE_STRING_TO_TAG_ENTRY(0x83d142c3710bf145ULL, SDF_TRANSFORM_SHAPE_WARP_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0x83e1923cc9748accULL, SDF_ELLIPSE_SHAPE_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x8506f1eb6d8c257cULL, SDF_EDGE_LIGHT_SDF_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x8517292f7020b5cdULL, SDF_UNION_OP_SPACING),
+    GE_STRING_TO_TAG_ENTRY(0x8911c192338b491cULL, GASIFY_SCALE_TWIST_SOURCE_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x892af523edaa30d1ULL, HEAT_DISTORTION_NOISE_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0x899d6401d2f49a00ULL, LINEAR_GRADIENT_BLUR_TRAN_X),
+    GE_STRING_TO_TAG_ENTRY(0x899d6501d2f49bb3ULL, LINEAR_GRADIENT_BLUR_TRAN_Y),
+    GE_STRING_TO_TAG_ENTRY(0x8a1566c9266de4f8ULL, CONTENT_LIGHT_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x8a618659e6d4c950ULL, AURORA_NOISE_NOISE),
+    GE_STRING_TO_TAG_ENTRY(0x8bab3f338f966da3ULL, SDF_DISTORT_OP_SHAPE_R_B_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0x8c9373d11af28cfcULL, SPATIAL_GLASS_EFFECT_BG_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x8d807b27012b8860ULL, COLOR_GRADIENT_EFFECT_COLOR_NUM),
+    GE_STRING_TO_TAG_ENTRY(0x8ef0bafcc54a6d42ULL, SDF_UNION_OP_RIGHT),
+    GE_STRING_TO_TAG_ENTRY(0x8ef0bbfcc54a6ef5ULL, SDF_UNION_OP_LEFT),
+    GE_STRING_TO_TAG_ENTRY(0x8f06b72cf8a8556cULL, USE_EFFECT_MASK_USE_EFFECT),
+    GE_STRING_TO_TAG_ENTRY(0x8fb24b0eeec5c97dULL, DOT_MATRIX_DOT_SPACING),
+    GE_STRING_TO_TAG_ENTRY(0x9019bcac353da8b5ULL, SDF_TRANSFORM_SHAPE_CENTER_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0x907bf0357d09c8a9ULL, FRAME_GRADIENT_MASK_AXIAL_DIRECTION),
+    GE_STRING_TO_TAG_ENTRY(0x90c81a99e0ed95fcULL, WAVE_GRADIENT_MASK_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x9182059f5aafa339ULL, FRAME_GRADIENT_MASK_AXIAL_CORE_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x92127e8353f0c593ULL, DISPERSION_BLUE_OFFSET),
+    GE_STRING_TO_TAG_ENTRY(0x9298fb3d35d07fd9ULL, SDF_EDGE_LIGHT_EFFECT_OUTER_BORDER_BLOOM_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x92b3edac2389e52eULL, MOTION_BLUR_ANCHOR),
+    GE_STRING_TO_TAG_ENTRY(0x9414934f3df22612ULL, PIXEL_MAP_MASK_SRC),
+    GE_STRING_TO_TAG_ENTRY(0x942dc531f03d418fULL, MESA_BLUR_OFFSET_Z),
+    GE_STRING_TO_TAG_ENTRY(0x942dc631f03d4342ULL, MESA_BLUR_OFFSET_Y),
+    GE_STRING_TO_TAG_ENTRY(0x942dc731f03d44f5ULL, MESA_BLUR_OFFSET_X),
+    GE_STRING_TO_TAG_ENTRY(0x942dc831f03d46a8ULL, MESA_BLUR_OFFSET_W),
+    GE_STRING_TO_TAG_ENTRY(0x94445f37ff42c6b7ULL, SDF_EDGE_LIGHT_EFFECT_MAX_BORDER_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0x946ae6750275b705ULL, WATER_DROPLET_TRANSITION_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0x949cd691d578d1aeULL, FROSTED_GLASS_ED_LIGHT_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x9525de499738f8f8ULL, SDF_EDGE_LIGHT_LIGHT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0x95545bcbbc8c133cULL, AIBAR_GLOW_POSITIONS1),
+    GE_STRING_TO_TAG_ENTRY(0x95545ccbbc8c14efULL, AIBAR_GLOW_POSITIONS0),
+    GE_STRING_TO_TAG_ENTRY(0x95545dcbbc8c16a2ULL, AIBAR_GLOW_POSITIONS3),
+    GE_STRING_TO_TAG_ENTRY(0x95545ecbbc8c1855ULL, AIBAR_GLOW_POSITIONS2),
+    GE_STRING_TO_TAG_ENTRY(0x95a4446657cdc190ULL, FROSTED_GLASS_EFFECT_DARK_MODE_BG_NEG),
+    GE_STRING_TO_TAG_ENTRY(0x95ba3d19a223299aULL, CONTENT_LIGHT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0x9613183ad0ae7486ULL, COLOR_GRADIENT_EFFECT_BLENDK),
+    GE_STRING_TO_TAG_ENTRY(0x96dca794b2436d64ULL, CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_START),
+    GE_STRING_TO_TAG_ENTRY(0x972b25f1f658b5e3ULL, SDF_TRANSFORM_SHAPE_MATRIX),
+    GE_STRING_TO_TAG_ENTRY(0x9734c537c6d2ae16ULL, SPATIAL_GLASS_EFFECT_RIGHT_BOT),
+    GE_STRING_TO_TAG_ENTRY(0x986e4ffc9177c2e7ULL, BLUR_EXPAND_DRAW_REGION),
+    GE_STRING_TO_TAG_ENTRY(0x98e45aa9f0356130ULL, SDF_EDGE_LIGHT_SDF_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0x99142ccb40f29a1fULL, DOT_MATRIX_COLOR_FRACTIONS),
+    GE_STRING_TO_TAG_ENTRY(0x997fdbff5ade8483ULL, HARMONIUM_EFFECT_REFRACTION_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0x9a89effea7afb53bULL, DISTORTION_COLLAPSE_R_B_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0x9ad3e4de457540e1ULL, FROSTED_GLASS_EFFECT_BG_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0x9b14d3dcdf119530ULL, BLUR_BUBBLES_RISE_MASK_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x9d78a69d8a0b809cULL, COLOR_GRADIENT_EFFECT_POSITIONS9),
+    GE_STRING_TO_TAG_ENTRY(0x9d78a79d8a0b824fULL, COLOR_GRADIENT_EFFECT_POSITIONS8),
+    GE_STRING_TO_TAG_ENTRY(0x9d78aa9d8a0b8768ULL, COLOR_GRADIENT_EFFECT_POSITIONS5),
+    GE_STRING_TO_TAG_ENTRY(0x9d78ab9d8a0b891bULL, COLOR_GRADIENT_EFFECT_POSITIONS4),
+    GE_STRING_TO_TAG_ENTRY(0x9d78ac9d8a0b8aceULL, COLOR_GRADIENT_EFFECT_POSITIONS7),
+    GE_STRING_TO_TAG_ENTRY(0x9d78ad9d8a0b8c81ULL, COLOR_GRADIENT_EFFECT_POSITIONS6),
+    GE_STRING_TO_TAG_ENTRY(0x9d78ae9d8a0b8e34ULL, COLOR_GRADIENT_EFFECT_POSITIONS1),
+    GE_STRING_TO_TAG_ENTRY(0x9d78af9d8a0b8fe7ULL, COLOR_GRADIENT_EFFECT_POSITIONS0),
+    GE_STRING_TO_TAG_ENTRY(0x9d78b09d8a0b919aULL, COLOR_GRADIENT_EFFECT_POSITIONS3),
+    GE_STRING_TO_TAG_ENTRY(0x9d78b19d8a0b934dULL, COLOR_GRADIENT_EFFECT_POSITIONS2),
+    GE_STRING_TO_TAG_ENTRY(0x9de915b453fd8393ULL, BORDER_SDF_LG_COLOR_IS_OUTLINE),
+    GE_STRING_TO_TAG_ENTRY(0x9eab87db1aa9e3fdULL, GASIFY_MASK_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0x9f0d87e2e059bb1bULL, BORDER_LIGHT_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0x9f9eb9b191a250ccULL, COLOR_GRADIENT_EFFECT_POSITIONS10),
+    GE_STRING_TO_TAG_ENTRY(0x9f9ebab191a2527fULL, COLOR_GRADIENT_EFFECT_POSITIONS11),
+    GE_STRING_TO_TAG_ENTRY(0xa0696c10a82a1bfeULL, BLUR_RADIUS_Y),
+    GE_STRING_TO_TAG_ENTRY(0xa0696d10a82a1db1ULL, BLUR_RADIUS_X),
+    GE_STRING_TO_TAG_ENTRY(0xa06be43a40d4955eULL, WATER_DROPLET_TRANSITION_TOP_LAYER),
+    GE_STRING_TO_TAG_ENTRY(0xa087111d57ec5a08ULL, SOUND_WAVE_SHOCK_WAVE_PROGRESS_A),
+    GE_STRING_TO_TAG_ENTRY(0xa087141d57ec5f21ULL, SOUND_WAVE_SHOCK_WAVE_PROGRESS_B),
+    GE_STRING_TO_TAG_ENTRY(0xa11051ce792ba84dULL, WATER_DROPLET_TRANSITION_DISTORTION_THICKNESS),
+    GE_STRING_TO_TAG_ENTRY(0xa2928fd58b231400ULL, HARMONIUM_EFFECT_MASK_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xa2beb16046057575ULL, EDGE_LIGHT_USE_RAW_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xa2d50cc686f30442ULL, FROSTED_GLASS_ENV_LIGHT_POS),
+    GE_STRING_TO_TAG_ENTRY(0xa3e61cd1c4632410ULL, COLOR_GRADIENT_EFFECT_COLORS5),
+    GE_STRING_TO_TAG_ENTRY(0xa3e61dd1c46325c3ULL, COLOR_GRADIENT_EFFECT_COLORS4),
+    GE_STRING_TO_TAG_ENTRY(0xa3e61ed1c4632776ULL, COLOR_GRADIENT_EFFECT_COLORS7),
+    GE_STRING_TO_TAG_ENTRY(0xa3e61fd1c4632929ULL, COLOR_GRADIENT_EFFECT_COLORS6),
+    GE_STRING_TO_TAG_ENTRY(0xa3e620d1c4632adcULL, COLOR_GRADIENT_EFFECT_COLORS1),
+    GE_STRING_TO_TAG_ENTRY(0xa3e621d1c4632c8fULL, COLOR_GRADIENT_EFFECT_COLORS0),
+    GE_STRING_TO_TAG_ENTRY(0xa3e622d1c4632e42ULL, COLOR_GRADIENT_EFFECT_COLORS3),
+    GE_STRING_TO_TAG_ENTRY(0xa3e623d1c4632ff5ULL, COLOR_GRADIENT_EFFECT_COLORS2),
+    GE_STRING_TO_TAG_ENTRY(0xa3e628d1c4633874ULL, COLOR_GRADIENT_EFFECT_COLORS9),
+    GE_STRING_TO_TAG_ENTRY(0xa3e629d1c4633a27ULL, COLOR_GRADIENT_EFFECT_COLORS8),
+    GE_STRING_TO_TAG_ENTRY(0xa40671baebf15c30ULL, PIXEL_MAP_MASK_FILL_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xa43ebdf3b622a4a7ULL, WATER_DROPLET_TRANSITION_LIGHT_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0xa45d8b184655e5dfULL, GREY_GREY_COEF2),
+    GE_STRING_TO_TAG_ENTRY(0xa45d8c184655e792ULL, GREY_GREY_COEF1),
+    GE_STRING_TO_TAG_ENTRY(0xa4bfdf12cdc97ab8ULL, MAGNIFIER_ZOOM_OFFSET_X),
+    GE_STRING_TO_TAG_ENTRY(0xa4bfe012cdc97c6bULL, MAGNIFIER_ZOOM_OFFSET_Y),
+    GE_STRING_TO_TAG_ENTRY(0xa50c5d5b9c685dd1ULL, LINEAR_GRADIENT_BLUR_GEO_HEIGHT),
+    GE_STRING_TO_TAG_ENTRY(0xa575b4699ca24708ULL, SDF_CLIP_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0xa65e76c53f2f9890ULL, LIGHT_CAVE_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xa6852f743ba8e986ULL, SDF_EDGE_LIGHT_EFFECT_BLOOM_INTENSITY_CUTOFF),
+    GE_STRING_TO_TAG_ENTRY(0xa6ec1c91e01fe11aULL, FROSTED_GLASS_ED_LIGHT_POS),
+    GE_STRING_TO_TAG_ENTRY(0xa7074d230f486b48ULL, FROSTED_GLASS_BLUR_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xa7279ed4f088b9eaULL, BORDER_SDF_SHADER_IS_OUTLINE),
+    GE_STRING_TO_TAG_ENTRY(0xa7deb7b110072f4bULL, COLOR_GRADIENT_POSITIONS),
+    GE_STRING_TO_TAG_ENTRY(0xa961a54f36732d92ULL, CIRCLE_FLOWLIGHT_DISTORT_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0xa9d628b47ed83181ULL, MAP_COLOR_BY_BRIGHTNESS_POSITIONS),
+    GE_STRING_TO_TAG_ENTRY(0xaa4d1217d0a7ce50ULL, FROSTED_GLASS_BG_NEG),
+    GE_STRING_TO_TAG_ENTRY(0xaa6fe8cce0299709ULL, DISPERSION_OPACITY),
+    GE_STRING_TO_TAG_ENTRY(0xaae4225ce4fa1732ULL, FROSTED_GLASS_EFFECT_WEIGHTS_EDL),
+    GE_STRING_TO_TAG_ENTRY(0xab8b5bc629647a2aULL, BLUR_BUBBLES_RISE_MIX_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0xac1363000668dc1bULL, ROUNDED_RECT_FLOWLIGHT_FEATHERING_BEZIER_CONTROL_POINTS),
+    GE_STRING_TO_TAG_ENTRY(0xac38cc3d95c780f9ULL, FROSTED_GLASS_WEIGHTS_EDL),
+    GE_STRING_TO_TAG_ENTRY(0xacc961fd6d992416ULL, SPATIAL_GLASS_EFFECT_LIGHT_DIR),
+    GE_STRING_TO_TAG_ENTRY(0xad3347d38b76a16fULL, USE_EFFECT_MASK_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0xad7d628ddb7fbc4fULL, CONTOUR_DIAGONAL_FLOW_LIGHT_CONTOUR),
+    GE_STRING_TO_TAG_ENTRY(0xae0d222d3e6b859eULL, FROSTED_GLASS_ENV_LIGHT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0xaecee7865e0659ceULL, FRAME_GRADIENT_MASK_RECT_W_H),
+    GE_STRING_TO_TAG_ENTRY(0xaed0506a9285fbd8ULL, FROSTED_GLASS_SD_POS),
+    GE_STRING_TO_TAG_ENTRY(0xaf79ccf4c5cffb81ULL, COLOR_GRADIENT_COLORS),
+    GE_STRING_TO_TAG_ENTRY(0xb015d28480f11de5ULL, CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_WEIGHT),
+    GE_STRING_TO_TAG_ENTRY(0xb05176b17837fa65ULL, GASIFY_SCALE_TWIST_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xb0a85c8fe69b5a84ULL, SDF_TRIANGLE_SHAPE_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xb1be3ba5ab629e20ULL, NOISY_FRAME_GRADIENT_MASK_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xb1bf8b28ce5d8e4dULL, SPATIAL_GLASS_EFFECT_BG_RATES),
+    GE_STRING_TO_TAG_ENTRY(0xb259271c4c761ce9ULL, FROSTED_GLASS_DARK_MODE_BG_POS),
+    GE_STRING_TO_TAG_ENTRY(0xb32387670ea8f416ULL, FROSTED_GLASS_EFFECT_MATERIAL_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xb3ed1308cb4d06bbULL, FROSTED_GLASS_BLUR_REFRACT_OUT_PX),
+    GE_STRING_TO_TAG_ENTRY(0xb446b1869f0a4e41ULL, SPATIAL_GLASS_EFFECT_WEIGHTS_EDL),
+    GE_STRING_TO_TAG_ENTRY(0xb4a53d0cf33add17ULL, DISTORT_CHROMA_COLOR_STRENGTH),
+    GE_STRING_TO_TAG_ENTRY(0xb4fd824ff7a268ebULL, FROSTED_GLASS_EFFECT_ED_LIGHT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0xb5289ac8832ebcf2ULL, SDF_DISTORT_OP_SHAPE_R_U_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0xb5384ea7145d9238ULL, AIBAR_RECT_HALO_STRENGTHS),
+    GE_STRING_TO_TAG_ENTRY(0xb55cf8f5a11c365cULL, ROUNDED_RECT_FLOWLIGHT_GRADIENT_BEZIER_CONTROL_POINTS),
+    GE_STRING_TO_TAG_ENTRY(0xb631378feb89e9ceULL, SPATIAL_GLASS_EFFECT_ENV_LIGHT_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0xb669596a74643420ULL, FROSTED_GLASS_ED_LIGHT_ANGLES),
+    GE_STRING_TO_TAG_ENTRY(0xb7b23818572a665fULL, WATER_RIPPLE_WAVE_COUNT),
+    GE_STRING_TO_TAG_ENTRY(0xb832000753c892e7ULL, FROSTED_GLASS_EFFECT_WAVE_DISTURBANCE),
+    GE_STRING_TO_TAG_ENTRY(0xb914eefe17aa37ecULL, DIRECTION_LIGHT_LIGHT_DIRECTION),
+    GE_STRING_TO_TAG_ENTRY(0xb9ab6313024aa069ULL, DEPTH_OCCLUSION_MATRIX),
+    GE_STRING_TO_TAG_ENTRY(0xbb159ccdebd5b679ULL, DUPOLI_NOISE_MASK_GRANULARITY),
+    GE_STRING_TO_TAG_ENTRY(0xbb7d6236c5ae17cfULL, CONTOUR_DIAGONAL_FLOW_LIGHT_LINE1_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xbba09572bc272495ULL, PARTICLE_ABLATION_MAX_PARTICLE_COUNT),
+    GE_STRING_TO_TAG_ENTRY(0xbbc4a8e58086b782ULL, LIGHT_CAVE_RADIUS_X_Y),
+    GE_STRING_TO_TAG_ENTRY(0xbbf7e6479bb87f94ULL, FROSTED_GLASS_WAVE_DISTURBANCE),
+    GE_STRING_TO_TAG_ENTRY(0xbc58dc3e1b129b8cULL, ROUNDED_RECT_FLOWLIGHT_FEATHERING),
+    GE_STRING_TO_TAG_ENTRY(0xbc7c2d02a9276de6ULL, HARMONIUM_EFFECT_RIPPLE_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0xbcba17ff4da1249aULL, SDF_SMOOTH_SUB_OP_SHAPE_LEFT),
+    GE_STRING_TO_TAG_ENTRY(0xbcba18ff4da1264dULL, SDF_SMOOTH_SUB_OP_SHAPE_RIGHT),
+    GE_STRING_TO_TAG_ENTRY(0xbd6eedc3efef0658ULL, DOT_MATRIX_EFFECT_TYPE),
+    GE_STRING_TO_TAG_ENTRY(0xbd7efbb08a695cabULL, WAVY_RIPPLE_LIGHT_THICKNESS),
+    GE_STRING_TO_TAG_ENTRY(0xbd85f260224e4bd1ULL, SDF_DISTORT_OP_SHAPE_L_B_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0xbd98701467b6f5e5ULL, GRADIENT_FLOW_COLORS_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xbe1478ceed0c0e74ULL, CIRCLE_FLOWLIGHT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0xbe50f3fe91b11a1cULL, IMAGE_MASK_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0xbe6baf059364b953ULL, WAVE_GRADIENT_MASK_PROPAGATION_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xbe853191bbc3ad67ULL, SPATIAL_GLASS_EFFECT_SNAPSHOT_RECT),
+    GE_STRING_TO_TAG_ENTRY(0xbf21edaae1a88c7cULL, BEZIER_WARP_DESTINATION_PATCH8),
+    GE_STRING_TO_TAG_ENTRY(0xbf21eeaae1a88e2fULL, BEZIER_WARP_DESTINATION_PATCH9),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f1aae1a89348ULL, BEZIER_WARP_DESTINATION_PATCH4),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f2aae1a894fbULL, BEZIER_WARP_DESTINATION_PATCH5),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f3aae1a896aeULL, BEZIER_WARP_DESTINATION_PATCH6),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f4aae1a89861ULL, BEZIER_WARP_DESTINATION_PATCH7),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f5aae1a89a14ULL, BEZIER_WARP_DESTINATION_PATCH0),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f6aae1a89bc7ULL, BEZIER_WARP_DESTINATION_PATCH1),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f7aae1a89d7aULL, BEZIER_WARP_DESTINATION_PATCH2),
+    GE_STRING_TO_TAG_ENTRY(0xbf21f8aae1a89f2dULL, BEZIER_WARP_DESTINATION_PATCH3),
+    GE_STRING_TO_TAG_ENTRY(0xbf957d454b11340cULL, LIGHT_CAVE_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0xbfa315cca29c16aaULL, GASIFY_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xbfd382bc72cea1c5ULL, WATER_DROPLET_TRANSITION_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xc06282d03de9cad5ULL, RADIAL_GRADIENT_MASK_POSITIONS),
+    GE_STRING_TO_TAG_ENTRY(0xc0a490e71eeb9151ULL, FROSTED_GLASS_EFFECT_ED_LIGHT_POS),
+    GE_STRING_TO_TAG_ENTRY(0xc0de9eaeb8d3ee97ULL, SDF_EDGE_LIGHT_BLOOM_FALLOFF_POW),
+    GE_STRING_TO_TAG_ENTRY(0xc118a505eb3f1a5fULL, PARTICLE_CIRCULAR_HALO_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xc133a7e06b182bafULL, CONTOUR_DIAGONAL_FLOW_LIGHT_HALO_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xc148f566709e78a4ULL, FROSTED_GLASS_EFFECT_DARK_MODE_BG_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0xc18cb2c590ed0f2dULL, SPATIAL_GLASS_EFFECT_BLUR_IMAGE),
+    GE_STRING_TO_TAG_ENTRY(0xc1ecbe5876de0004ULL, ROUNDED_RECT_FLOWLIGHT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xc20924b3aaf340eaULL, MAGNIFIER_SHADOW_OFFSET_Y),
+    GE_STRING_TO_TAG_ENTRY(0xc20925b3aaf3429dULL, MAGNIFIER_SHADOW_OFFSET_X),
+    GE_STRING_TO_TAG_ENTRY(0xc25681c0a413fa4cULL, SDF_TRIANGLE_SHAPE_VERTEX0),
+    GE_STRING_TO_TAG_ENTRY(0xc25682c0a413fbffULL, SDF_TRIANGLE_SHAPE_VERTEX1),
+    GE_STRING_TO_TAG_ENTRY(0xc25683c0a413fdb2ULL, SDF_TRIANGLE_SHAPE_VERTEX2),
+    GE_STRING_TO_TAG_ENTRY(0xc28048058013eb61ULL, DEPTH_OCCLUSION_DEPTH_MAP),
+    GE_STRING_TO_TAG_ENTRY(0xc287f3ddcb0517b9ULL, FROSTED_GLASS_EFFECT_BG_POS),
+    GE_STRING_TO_TAG_ENTRY(0xc3d75da9c2deadc0ULL, SPATIAL_GLASS_EFFECT_REFRACT_OUT_PX),
+    GE_STRING_TO_TAG_ENTRY(0xc3e038e3b8b3a470ULL, GASIFY_SCALE_TWIST_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0xc4c3988b21689650ULL, SPATIAL_GLASS_EFFECT_SD_POS),
+    GE_STRING_TO_TAG_ENTRY(0xc585de86495faa30ULL, HARMONIUM_EFFECT_LIGHT_UP_DEGREE),
+    GE_STRING_TO_TAG_ENTRY(0xc5a024819b3b2059ULL, FROSTED_GLASS_BASE_MATERIAL_TYPE),
+    GE_STRING_TO_TAG_ENTRY(0xc5b1dc891334ee80ULL, DISTORT_CHROMA_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xc686047468749a95ULL, HARMONIUM_EFFECT_MATERIAL_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0xc75ab1e78c1a96f9ULL, COLOR_GRADIENT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0xc7e0d48232f5f3aaULL, SDF_EDGE_LIGHT_MIN_BORDER_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0xc8496fe1397f0bb9ULL, AIBAR_AI_BAR_LOW),
+    GE_STRING_TO_TAG_ENTRY(0xc853a0d59d2be160ULL, BORDER_SDF_LG_COLOR_POSITION0),
+    GE_STRING_TO_TAG_ENTRY(0xc853a1d59d2be313ULL, BORDER_SDF_LG_COLOR_POSITION1),
+    GE_STRING_TO_TAG_ENTRY(0xc853a2d59d2be4c6ULL, BORDER_SDF_LG_COLOR_POSITION2),
+    GE_STRING_TO_TAG_ENTRY(0xc853a3d59d2be679ULL, BORDER_SDF_LG_COLOR_POSITION3),
+    GE_STRING_TO_TAG_ENTRY(0xc853a4d59d2be82cULL, BORDER_SDF_LG_COLOR_POSITION4),
+    GE_STRING_TO_TAG_ENTRY(0xc922db54737d7779ULL, GRADIENT_FLOW_COLORS_EFFECT_ALPHA),
+    GE_STRING_TO_TAG_ENTRY(0xc9441f28c88ed15bULL, DISTORT_CHROMA_MASK),
+    GE_STRING_TO_TAG_ENTRY(0xc99518fc87f5d081ULL, SDF_SHADOW_SHADOW),
+    GE_STRING_TO_TAG_ENTRY(0xc9f22ee4e66b8857ULL, MASK_TRANSITION_MASK),
+    GE_STRING_TO_TAG_ENTRY(0xcb14330c61403ce6ULL, LINEAR_GRADIENT_BLUR_IS_OFFSCREEN_CANVAS),
+    GE_STRING_TO_TAG_ENTRY(0xcc87b057d290970fULL, MAGNIFIER_GRADIENT_MASK_COLOR2),
+    GE_STRING_TO_TAG_ENTRY(0xcc87b157d29098c2ULL, MAGNIFIER_GRADIENT_MASK_COLOR1),
+    GE_STRING_TO_TAG_ENTRY(0xcc8aaf8b44c983c2ULL, DIRECTION_LIGHT_LIGHT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xcce1e90774636f5aULL, SDF_TRANSFORM_SHAPE_UNION_MODE),
+    GE_STRING_TO_TAG_ENTRY(0xccf07bcacfd7cc04ULL, FRAME_GRADIENT_MASK_CORNER_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xcd4aff4ecd7a1a07ULL, PIXEL_MAP_MASK_DST),
+    GE_STRING_TO_TAG_ENTRY(0xcd978df507fee940ULL, BORDER_SDF_SHADER_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0xce0b918ffcfeb30cULL, FROSTED_GLASS_EFFECT_WEIGHTS_EMBOSS),
+    GE_STRING_TO_TAG_ENTRY(0xce23faf696a84a07ULL, PARTICLE_ABLATION_TURB_EVO),
+    GE_STRING_TO_TAG_ENTRY(0xce3323b596a4ec98ULL, CONTENT_LIGHT_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0xce5c0c7a614a8c68ULL, CIRCLE_FLOWLIGHT_COLORS3),
+    GE_STRING_TO_TAG_ENTRY(0xce5c0d7a614a8e1bULL, CIRCLE_FLOWLIGHT_COLORS2),
+    GE_STRING_TO_TAG_ENTRY(0xce5c0e7a614a8fceULL, CIRCLE_FLOWLIGHT_COLORS1),
+    GE_STRING_TO_TAG_ENTRY(0xce5c0f7a614a9181ULL, CIRCLE_FLOWLIGHT_COLORS0),
+    GE_STRING_TO_TAG_ENTRY(0xd05928b129349b72ULL, FROSTED_GLASS_EFFECT_BLUR_IMAGE_FOR_EDGE),
+    GE_STRING_TO_TAG_ENTRY(0xd082d5467d7a71c5ULL, SPATIAL_GLASS_EFFECT_ENABLE_S_D_F_CACHE),
+    GE_STRING_TO_TAG_ENTRY(0xd0bf292cd5c76f58ULL, WATER_DROPLET_TRANSITION_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xd18771785b186accULL, SDF_EDGE_LIGHT_MAX_BORDER_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0xd1c1aea51de18318ULL, DISPERSION_RED_OFFSET),
+    GE_STRING_TO_TAG_ENTRY(0xd1f7dc1ef181066fULL, RADIAL_GRADIENT_MASK_COLORS),
+    GE_STRING_TO_TAG_ENTRY(0xd257a68ffc189d4eULL, SPATIAL_GLASS_EFFECT_ENV_LIGHT_NEG),
+    GE_STRING_TO_TAG_ENTRY(0xd27af1776bf26a23ULL, SPATIAL_GLASS_EFFECT_LEFT_TOP),
+    GE_STRING_TO_TAG_ENTRY(0xd28a73ef6f173811ULL, SDF_EDGE_LIGHT_EFFECT_LIGHT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0xd3d1b5b98bcb25e4ULL, MAGNIFIER_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0xd44efb1b1759b50cULL, MASK_TRANSITION_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0xd463ffb72fdace63ULL, WAVE_DISTURBANCE_MASK_WAVE_L_W_H),
+    GE_STRING_TO_TAG_ENTRY(0xd471ffd27d84d5f5ULL, HARMONIUM_EFFECT_DISTORT_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xd55708a6169a4091ULL, EDGE_LIGHT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0xd58b62fd3fd02112ULL, WATER_DROPLET_TRANSITION_NOISE_SCALE_X),
+    GE_STRING_TO_TAG_ENTRY(0xd58b63fd3fd022c5ULL, WATER_DROPLET_TRANSITION_NOISE_SCALE_Y),
+    GE_STRING_TO_TAG_ENTRY(0xd59576882bc96115ULL, BORDER_LIGHT_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0xd5b9c79ddba5a0f4ULL, FROSTED_GLASS_EFFECT_ED_LIGHT_RATES),
+    GE_STRING_TO_TAG_ENTRY(0xd5c6905aff798660ULL, SDF_BORDER_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0xd5f0c317e976d264ULL, FROSTED_GLASS_BG_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0xd5f5f87cc2a320b6ULL, WAVY_RIPPLE_LIGHT_CENTER),
+    GE_STRING_TO_TAG_ENTRY(0xd69a86aaa6c5708eULL, SPATIAL_GLASS_EFFECT_FRESNEL_ENV_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xd7131234b2e7e8b1ULL, AIBAR_GLOW_BRIGHTNESS),
+    GE_STRING_TO_TAG_ENTRY(0xd72019b0319576c0ULL, AURORA_NOISE_FREQ_X),
+    GE_STRING_TO_TAG_ENTRY(0xd7201ab031957873ULL, AURORA_NOISE_FREQ_Y),
+    GE_STRING_TO_TAG_ENTRY(0xd737cd863d8a6252ULL, KAWASE_BLUR_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xd755306f5dbd6049ULL, BORDER_SDF_SHADER_STYLE),
+    GE_STRING_TO_TAG_ENTRY(0xd93aa2c6449ecdcfULL, CIRCLE_FLOWLIGHT_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xdaa658902933f9f6ULL, DISTORT_CHROMA_TURBULENT_MASK),
+    GE_STRING_TO_TAG_ENTRY(0xdacc15b968568890ULL, GRID_WARP_ROTATION_ANGLES1),
+    GE_STRING_TO_TAG_ENTRY(0xdacc16b968568a43ULL, GRID_WARP_ROTATION_ANGLES0),
+    GE_STRING_TO_TAG_ENTRY(0xdacc17b968568bf6ULL, GRID_WARP_ROTATION_ANGLES3),
+    GE_STRING_TO_TAG_ENTRY(0xdacc18b968568da9ULL, GRID_WARP_ROTATION_ANGLES2),
+    GE_STRING_TO_TAG_ENTRY(0xdacc19b968568f5cULL, GRID_WARP_ROTATION_ANGLES5),
+    GE_STRING_TO_TAG_ENTRY(0xdacc1ab96856910fULL, GRID_WARP_ROTATION_ANGLES4),
+    GE_STRING_TO_TAG_ENTRY(0xdacc1bb9685692c2ULL, GRID_WARP_ROTATION_ANGLES7),
+    GE_STRING_TO_TAG_ENTRY(0xdacc1cb968569475ULL, GRID_WARP_ROTATION_ANGLES6),
+    GE_STRING_TO_TAG_ENTRY(0xdacc1eb9685697dbULL, GRID_WARP_ROTATION_ANGLES8),
+    GE_STRING_TO_TAG_ENTRY(0xdb3e4f375d18bd94ULL, SPATIAL_GLASS_EFFECT_RIGHT_TOP),
+    GE_STRING_TO_TAG_ENTRY(0xdc4f840e28908d2cULL, FROSTED_GLASS_MAX_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xdcb02e4f90b7d6faULL, RIPPLE_MASK_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xdd01ce5477a186b6ULL, ROUNDED_RECT_FLOWLIGHT_BRIGHTNESS),
+    GE_STRING_TO_TAG_ENTRY(0xddad2bd040957f9bULL, HARMONIUM_EFFECT_MASK_CLOCK),
+    GE_STRING_TO_TAG_ENTRY(0xde8f5d358adcdd8dULL, NOISY_FRAME_GRADIENT_MASK_R_RECT_POS),
+    GE_STRING_TO_TAG_ENTRY(0xde959f53929e0933ULL, SPATIAL_POINT_LIGHT_LIGHT_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0xdfe3761bb3a3c2aeULL, FROSTED_GLASS_BG_ALPHA),
+    GE_STRING_TO_TAG_ENTRY(0xe0424cb35b644254ULL, LIGHT_CAVE_COLOR_B),
+    GE_STRING_TO_TAG_ENTRY(0xe0424db35b644407ULL, LIGHT_CAVE_COLOR_C),
+    GE_STRING_TO_TAG_ENTRY(0xe0424fb35b64476dULL, LIGHT_CAVE_COLOR_A),
+    GE_STRING_TO_TAG_ENTRY(0xe04954067e6151f2ULL, HARMONIUM_EFFECT_POS_R_G_B),
+    GE_STRING_TO_TAG_ENTRY(0xe04b5da309402a4dULL, PARTICLE_CIRCULAR_HALO_NOISE),
+    GE_STRING_TO_TAG_ENTRY(0xe07b79b618f45659ULL, COLOR_GRADIENT_EFFECT_BRIGHTNESS),
+    GE_STRING_TO_TAG_ENTRY(0xe0bdc22e2b44bc1fULL, RIPPLE_MASK_WIDTH_CENTER_OFFSET),
+    GE_STRING_TO_TAG_ENTRY(0xe1276ae6a0d249a9ULL, FROSTED_GLASS_EFFECT_ED_LIGHT_NEG),
+    GE_STRING_TO_TAG_ENTRY(0xe13fec9003dad0baULL, SPATIAL_GLASS_EFFECT_ENV_LIGHT_POS),
+    GE_STRING_TO_TAG_ENTRY(0xe15cdacdbda2a99aULL, ROUNDED_RECT_FLOWLIGHT_CORNER_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xe1784b81430c9906ULL, FROSTED_GLASS_ED_LIGHT_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0xe3262a47dce02971ULL, FROSTED_GLASS_EFFECT_SD_NEG),
+    GE_STRING_TO_TAG_ENTRY(0xe334b070b481ef04ULL, COLOR_GRADIENT_EFFECT_COLORS10),
+    GE_STRING_TO_TAG_ENTRY(0xe334b170b481f0b7ULL, COLOR_GRADIENT_EFFECT_COLORS11),
+    GE_STRING_TO_TAG_ENTRY(0xe4129ad9cbd06b15ULL, BORDER_SDF_LG_COLOR_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0xe4344951abe8d145ULL, FRAME_GRADIENT_MASK_RECT_POS),
+    GE_STRING_TO_TAG_ENTRY(0xe4ff820671fe2a6aULL, FROSTED_GLASS_EFFECT_ANTI_ALIAS),
+    GE_STRING_TO_TAG_ENTRY(0xe5df53dfcfaff0e0ULL, SDF_SUB_OP_SHAPE_LEFT),
+    GE_STRING_TO_TAG_ENTRY(0xe5df54dfcfaff293ULL, SDF_SUB_OP_SHAPE_RIGHT),
+    GE_STRING_TO_TAG_ENTRY(0xe65cf8eda8591b41ULL, WAVY_RIPPLE_LIGHT_RADIUS),
+    GE_STRING_TO_TAG_ENTRY(0xe6cf850d0e81c7a5ULL, AIBAR_GLOW_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xe769caf4f1872472ULL, WATER_DROPLET_TRANSITION_INVERSE),
+    GE_STRING_TO_TAG_ENTRY(0xe7c55e840196d042ULL, DEPTH_OCCLUSION_FAR),
+    GE_STRING_TO_TAG_ENTRY(0xe8275c6207d85b1cULL, MAGNIFIER_OUTER_CONTOUR_COLOR2),
+    GE_STRING_TO_TAG_ENTRY(0xe8275f6207d86035ULL, MAGNIFIER_OUTER_CONTOUR_COLOR1),
+    GE_STRING_TO_TAG_ENTRY(0xe9544c5125ccad8bULL, SDF_DISTORT_OP_SHAPE_SHAPE),
+    GE_STRING_TO_TAG_ENTRY(0xe9e9ab234e34cf1dULL, BORDER_LIGHT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xed6edc13c66823b5ULL, SPATIAL_POINT_LIGHT_LIGHT_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xedaf849097788351ULL, WATER_DROPLET_TRANSITION_LIGHT_SOFTNESS),
+    GE_STRING_TO_TAG_ENTRY(0xedbbdf4f9b2f4fbaULL, RADIAL_GRADIENT_MASK_CENTER),
+    GE_STRING_TO_TAG_ENTRY(0xee232cc977817b4aULL, AIBAR_GLOW_BAR_ANGLE),
+    GE_STRING_TO_TAG_ENTRY(0xee3ec7c621099c36ULL, FROSTED_GLASS_ENV_LIGHT_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0xef08ba97258b55dbULL, MAGNIFIER_FACTOR),
+    GE_STRING_TO_TAG_ENTRY(0xef69f4ddf87ef02fULL, MESA_BLUR_GREY_COEF1),
+    GE_STRING_TO_TAG_ENTRY(0xef69f5ddf87ef1e2ULL, MESA_BLUR_GREY_COEF2),
+    GE_STRING_TO_TAG_ENTRY(0xf012b01b1e3f8862ULL, HARMONIUM_EFFECT_NEG_R_G_B),
+    GE_STRING_TO_TAG_ENTRY(0xf0638c250a6fd587ULL, FROSTED_GLASS_MATERIAL_COLOR),
+    GE_STRING_TO_TAG_ENTRY(0xf10706531054767eULL, DOT_MATRIX_PATH_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0xf128ac69f73a01e5ULL, MAGNIFIER_SHADOW_SIZE),
+    GE_STRING_TO_TAG_ENTRY(0xf13849766fe34a10ULL, BORDER_SDF_LG_COLOR_COLOR2),
+    GE_STRING_TO_TAG_ENTRY(0xf1384a766fe34bc3ULL, BORDER_SDF_LG_COLOR_COLOR3),
+    GE_STRING_TO_TAG_ENTRY(0xf1384b766fe34d76ULL, BORDER_SDF_LG_COLOR_COLOR0),
+    GE_STRING_TO_TAG_ENTRY(0xf1384c766fe34f29ULL, BORDER_SDF_LG_COLOR_COLOR1),
+    GE_STRING_TO_TAG_ENTRY(0xf1384f766fe35442ULL, BORDER_SDF_LG_COLOR_COLOR4),
+    GE_STRING_TO_TAG_ENTRY(0xf18848fa799a0823ULL, ROUNDED_RECT_FLOWLIGHT_WAVE_TOP),
+    GE_STRING_TO_TAG_ENTRY(0xf1aa0f9e6e0430e8ULL, SOUND_WAVE_COLOR_A),
+    GE_STRING_TO_TAG_ENTRY(0xf1aa119e6e04344eULL, SOUND_WAVE_COLOR_C),
+    GE_STRING_TO_TAG_ENTRY(0xf1aa129e6e043601ULL, SOUND_WAVE_COLOR_B),
+    GE_STRING_TO_TAG_ENTRY(0xf1cde26674a7f770ULL, PARTICLE_CIRCULAR_HALO_CENTER),
+    GE_STRING_TO_TAG_ENTRY(0xf23ba29ba6203385ULL, HARMONIUM_EFFECT_FRACTION),
+    GE_STRING_TO_TAG_ENTRY(0xf249c412c2f2b92bULL, CIRCLE_FLOWLIGHT_BLEND_GRADIENT),
+    GE_STRING_TO_TAG_ENTRY(0xf27985f6abb6fe89ULL, PARTICLE_ABLATION_TURB_AMP),
+    GE_STRING_TO_TAG_ENTRY(0xf3229f5d17a1a167ULL, SOUND_WAVE_SOUND_INTENSITY),
+    GE_STRING_TO_TAG_ENTRY(0xf36a30449d23adc1ULL, LINEAR_GRADIENT_BLUR_MAT),
+    GE_STRING_TO_TAG_ENTRY(0xf4a005cda6ddc4c9ULL, GASIFY_BLUR_PROGRESS),
+    GE_STRING_TO_TAG_ENTRY(0xf507815cfb4562d3ULL, FROSTED_GLASS_BLUR_RADIUS_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0xf5641a9e084eaf29ULL, MESA_BLUR_TILE_MODE),
+    GE_STRING_TO_TAG_ENTRY(0xf68fe4592d66328bULL, CONTOUR_DIAGONAL_FLOW_LIGHT_THICKNESS),
+    GE_STRING_TO_TAG_ENTRY(0xf8ca9a7cc6d96d6dULL, FROSTED_GLASS_WEIGHTS_EMBOSS),
+    GE_STRING_TO_TAG_ENTRY(0xf975aa9c40b39ebfULL, BLUR_DISABLE_SYSTEM_ADAPTATION),
+    GE_STRING_TO_TAG_ENTRY(0xf9adcd8c203e8619ULL, DISTORTION_COLLAPSE_L_B_CORNER),
+    GE_STRING_TO_TAG_ENTRY(0xf9ccf1e6ae673539ULL, FROSTED_GLASS_EFFECT_ED_LIGHT_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0xf9d63e4b024e4adeULL, SDF_SMOOTH_SUB_OP_SHAPE_SPACING),
+    GE_STRING_TO_TAG_ENTRY(0xf9de6f5b2d46b424ULL, DISTORT_CHROMA_BRIGHTNESS),
+    GE_STRING_TO_TAG_ENTRY(0xf9ef34788df735eeULL, NOISY_FRAME_GRADIENT_MASK_SLOPE),
+    GE_STRING_TO_TAG_ENTRY(0xfa1d63a673675cf5ULL, SDF_PATH_SHAPE_SCALE),
+    GE_STRING_TO_TAG_ENTRY(0xfa413722fa02c08eULL, AIBAR_AI_BAR_OPACITY),
+    GE_STRING_TO_TAG_ENTRY(0xfaa756660047abfcULL, FROSTED_GLASS_EFFECT_DARK_MODE_BG_POS),
+    GE_STRING_TO_TAG_ENTRY(0xfb109facb409c2b1ULL, SPATIAL_GLASS_EFFECT_CAMERA_POSITION),
+    GE_STRING_TO_TAG_ENTRY(0xfb472f24f49a4a00ULL, FROSTED_GLASS_SD_PARAMS),
+    GE_STRING_TO_TAG_ENTRY(0xfc003bf5dd516f83ULL, CIRCLE_FLOWLIGHT_ROTATION_SEED),
+    GE_STRING_TO_TAG_ENTRY(0xfc481ccd96c0ac2aULL, PARTICLE_ABLATION_EXPANSION_SIZE),
+    GE_STRING_TO_TAG_ENTRY(0xfc75a35270e4e1c4ULL, HARMONIUM_EFFECT_CUBIC_COEFF),
+    GE_STRING_TO_TAG_ENTRY(0xfca49147eb2ccf61ULL, FROSTED_GLASS_EFFECT_SD_K_B_S),
+    GE_STRING_TO_TAG_ENTRY(0xfcc3f6c6b23f7269ULL, SDF_EDGE_LIGHT_EFFECT_MIN_BORDER_WIDTH),
+    GE_STRING_TO_TAG_ENTRY(0xfe34180e3ceadbdbULL, DISTORT_CHROMA_VERTICAL_MOVE_DISTANCE),
+    GE_STRING_TO_TAG_ENTRY(0xfe6479245c0b687fULL, HARMONIUM_EFFECT_SATURATION),
+    GE_STRING_TO_TAG_ENTRY(0xfe74fc327e79b7adULL, FROSTED_GLASS_EFFECT_DARK_MODE_WEIGHTS_EMBOSS),
+    GE_STRING_TO_TAG_ENTRY(0xff9cd1143ab67eb4ULL, GRADIENT_FLOW_COLORS_COLORS1),
+    GE_STRING_TO_TAG_ENTRY(0xff9cd2143ab68067ULL, GRADIENT_FLOW_COLORS_COLORS0),
+    GE_STRING_TO_TAG_ENTRY(0xff9cd3143ab6821aULL, GRADIENT_FLOW_COLORS_COLORS3),
+    GE_STRING_TO_TAG_ENTRY(0xff9cd4143ab683cdULL, GRADIENT_FLOW_COLORS_COLORS2),
+};
 
 #undef GE_STRING_TO_TAG_ENTRY
 #undef GE_STRING_TO_TAG_ALIAS
 
-    auto it = map.find(str);
-    if (it != map.end()) {
-        return it->second;
+static_assert(IsNameTableValid(GE_PARAMS_MEMBER_TAG_TABLE), "Regenerate with gen_metadata.py");
+
+GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(std::string_view str)
+{
+    return FindInNameTable(GE_PARAMS_MEMBER_TAG_TABLE, str, GEParamsMemberTag::INVALID);
+}
+
+bool GEParamsMemberHelper::HashParams(const GEFilterParams& params, GEParamsHasher& hasher)
+{
+    hasher.Combine(params.GetType());
+    switch (params.GetType()) {
+        case GEFilterType::AIBAR: {
+            auto unboxed = GEFilterParams::Unbox<GEAIBarShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->aiBarLow);
+            hasher.Combine(unboxed->aiBarHigh);
+            hasher.Combine(unboxed->aiBarThreshold);
+            hasher.Combine(unboxed->aiBarOpacity);
+            hasher.Combine(unboxed->aiBarSaturation);
+            break;
+        }
+        case GEFilterType::AURORA_NOISE: {
+            auto unboxed = GEFilterParams::Unbox<GEAuroraNoiseShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->noise_);
+            hasher.Combine(unboxed->freqX_);
+            hasher.Combine(unboxed->freqY_);
+            break;
+        }
+        case GEFilterType::BEZIER_WARP: {
+            auto unboxed = GEFilterParams::Unbox<GEBezierWarpShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->destinationPatch);
+            break;
+        }
+        case GEFilterType::BLUR_BUBBLES_RISE: {
+            auto unboxed = GEFilterParams::Unbox<GEBlurBubblesRiseFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->blurIntensity);
+            hasher.Combine(unboxed->mixStrength);
+            hasher.Combine(unboxed->progress);
+            hasher.Combine(unboxed->maskImage);
+            break;
+        }
+        case GEFilterType::BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GEBlurShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->radiusX);
+            hasher.Combine(unboxed->radiusY);
+            hasher.Combine(unboxed->disableSystemAdaptation);
+            hasher.Combine(unboxed->expandDrawRegion);
+            break;
+        }
+        case GEFilterType::BORDER_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GEBorderLightShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->position);
+            hasher.Combine(unboxed->color);
+            hasher.Combine(unboxed->intensity);
+            hasher.Combine(unboxed->width);
+            hasher.Combine(unboxed->rotationAngle);
+            hasher.Combine(unboxed->cornerRadius);
+            break;
+        }
+        case GEFilterType::BORDER_SDF_LG_COLOR: {
+            auto unboxed = GEFilterParams::Unbox<GEBorderSDFLGColorShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->angle);
+            hasher.Combine(unboxed->width);
+            hasher.Combine(unboxed->isOutline);
+            hasher.Combine(unboxed->colorNumber);
+            hasher.Combine(unboxed->color0);
+            hasher.Combine(unboxed->color1);
+            hasher.Combine(unboxed->color2);
+            hasher.Combine(unboxed->color3);
+            hasher.Combine(unboxed->color4);
+            hasher.Combine(unboxed->position0);
+            hasher.Combine(unboxed->position1);
+            hasher.Combine(unboxed->position2);
+            hasher.Combine(unboxed->position3);
+            hasher.Combine(unboxed->position4);
+            hasher.Combine(unboxed->shape);
+            break;
+        }
+        case GEFilterType::BORDER_SDF_SHADER: {
+            auto unboxed = GEFilterParams::Unbox<GEBorderSDFShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->color);
+            hasher.Combine(unboxed->width);
+            hasher.Combine(unboxed->isOutline);
+            hasher.Combine(unboxed->style);
+            hasher.Combine(unboxed->dashWidth);
+            hasher.Combine(unboxed->dashGap);
+            hasher.Combine(unboxed->shape);
+            break;
+        }
+        case GEFilterType::CIRCLE_FLOWLIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GECircleFlowlightEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->colors);
+            hasher.Combine(unboxed->rotationFrequency);
+            hasher.Combine(unboxed->rotationAmplitude);
+            hasher.Combine(unboxed->rotationSeed);
+            hasher.Combine(unboxed->gradientX);
+            hasher.Combine(unboxed->gradientY);
+            hasher.Combine(unboxed->progress);
+            hasher.Combine(unboxed->strength);
+            hasher.Combine(unboxed->distortStrength);
+            hasher.Combine(unboxed->blendGradient);
+            hasher.Combine(unboxed->mask);
+            break;
+        }
+        case GEFilterType::COLOR_GRADIENT: {
+            auto unboxed = GEFilterParams::Unbox<GEColorGradientShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->colors);
+            hasher.Combine(unboxed->positions);
+            hasher.Combine(unboxed->strengths);
+            hasher.Combine(unboxed->mask);
+            break;
+        }
+        case GEFilterType::CONTENT_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GEContentLightFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->position);
+            hasher.Combine(unboxed->color);
+            hasher.Combine(unboxed->intensity);
+            hasher.Combine(unboxed->rotationAngle);
+            break;
+        }
+        case GEFilterType::CONTOUR_DIAGONAL_FLOW_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GEContentDiagonalFlowLightShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->contour_);
+            hasher.Combine(unboxed->line1Start_);
+            hasher.Combine(unboxed->line1Length_);
+            hasher.Combine(unboxed->line1Color_);
+            hasher.Combine(unboxed->line2Start_);
+            hasher.Combine(unboxed->line2Length_);
+            hasher.Combine(unboxed->line2Color_);
+            hasher.Combine(unboxed->thickness_);
+            hasher.Combine(unboxed->haloRadius_);
+            hasher.Combine(unboxed->lightWeight_);
+            hasher.Combine(unboxed->haloWeight_);
+            break;
+        }
+        case GEFilterType::DEPTH_OCCLUSION: {
+            auto unboxed = GEFilterParams::Unbox<GEDepthOcclusionShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->depthPlane);
+            hasher.Combine(unboxed->matrix);
+            hasher.Combine(unboxed->depthMap);
+            hasher.Combine(unboxed->weight);
+            hasher.Combine(unboxed->near);
+            hasher.Combine(unboxed->far);
+            hasher.Combine(unboxed->isReverse);
+            break;
+        }
+        case GEFilterType::DIRECTION_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GEDirectionLightShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->mask);
+            hasher.Combine(unboxed->maskFactor);
+            hasher.Combine(unboxed->lightDirection);
+            hasher.Combine(unboxed->lightColor);
+            hasher.Combine(unboxed->lightIntensity);
+            break;
+        }
+        case GEFilterType::DISPERSION: {
+            auto unboxed = GEFilterParams::Unbox<GEDispersionShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->mask);
+            hasher.Combine(unboxed->opacity);
+            hasher.Combine(unboxed->redOffset);
+            hasher.Combine(unboxed->greenOffset);
+            hasher.Combine(unboxed->blueOffset);
+            break;
+        }
+        case GEFilterType::DISPLACEMENT_DISTORT_FILTER: {
+            auto unboxed = GEFilterParams::Unbox<GEDisplacementDistortFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->factor_);
+            hasher.Combine(unboxed->mask_);
+            break;
+        }
+        case GEFilterType::DISTORTION_COLLAPSE: {
+            auto unboxed = GEFilterParams::Unbox<GEDistortionCollapseFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->LUCorner_);
+            hasher.Combine(unboxed->RUCorner_);
+            hasher.Combine(unboxed->RBCorner_);
+            hasher.Combine(unboxed->LBCorner_);
+            hasher.Combine(unboxed->barrelDistortion_);
+            break;
+        }
+        case GEFilterType::DOT_MATRIX: {
+            auto unboxed = GEFilterParams::Unbox<GEDotMatrixShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->pathDirection_);
+            hasher.Combine(unboxed->effectColors_);
+            hasher.Combine(unboxed->colorFractions_);
+            hasher.Combine(unboxed->startPoints_);
+            hasher.Combine(unboxed->pathWidth_);
+            hasher.Combine(unboxed->inverseEffect_);
+            hasher.Combine(unboxed->dotColor_);
+            hasher.Combine(unboxed->dotSpacing_);
+            hasher.Combine(unboxed->dotRadius_);
+            hasher.Combine(unboxed->bgColor_);
+            hasher.Combine(unboxed->effectType_);
+            hasher.Combine(unboxed->progress_);
+            break;
+        }
+        case GEFilterType::DOUBLE_RIPPLE_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEDoubleRippleShaderMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->center1_);
+            hasher.Combine(unboxed->center2_);
+            hasher.Combine(unboxed->radius_);
+            hasher.Combine(unboxed->width_);
+            hasher.Combine(unboxed->turbulence_);
+            hasher.Combine(unboxed->haloThickness_);
+            break;
+        }
+        case GEFilterType::EDGE_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GEEdgeLightShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->alpha);
+            hasher.Combine(unboxed->bloom);
+            hasher.Combine(unboxed->color);
+            hasher.Combine(unboxed->mask);
+            hasher.Combine(unboxed->useRawColor);
+            break;
+        }
+        case GEFilterType::FRAME_GRADIENT_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEFrameGradientMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->innerBezier);
+            hasher.Combine(unboxed->outerBezier);
+            hasher.Combine(unboxed->cornerRadius);
+            hasher.Combine(unboxed->innerFrameWidth);
+            hasher.Combine(unboxed->outerFrameWidth);
+            hasher.Combine(unboxed->rectWH);
+            hasher.Combine(unboxed->rectPos);
+            hasher.Combine(unboxed->axialFeatherStrength);
+            hasher.Combine(unboxed->axialCenter);
+            hasher.Combine(unboxed->axialCoreWidth);
+            hasher.Combine(unboxed->axialDirection);
+            hasher.Combine(unboxed->boxAngleDeg);
+            break;
+        }
+        case GEFilterType::FROSTED_GLASS_BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GEFrostedGlassBlurShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->radius);
+            hasher.Combine(unboxed->radiusScale);
+            hasher.Combine(unboxed->refractOutPx);
+            break;
+        }
+        case GEFilterType::FROSTED_GLASS_EFFECT: {
+            auto unboxed = GEFilterParams::Unbox<GEFrostedGlassEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->weightsEmboss);
+            hasher.Combine(unboxed->weightsEdl);
+            hasher.Combine(unboxed->antiAlias);
+            hasher.Combine(unboxed->maxColor);
+            hasher.Combine(unboxed->bgRates);
+            hasher.Combine(unboxed->bgKBS);
+            hasher.Combine(unboxed->bgPos);
+            hasher.Combine(unboxed->bgNeg);
+            hasher.Combine(unboxed->bgAlpha);
+            hasher.Combine(unboxed->refractParams);
+            hasher.Combine(unboxed->sdParams);
+            hasher.Combine(unboxed->sdRates);
+            hasher.Combine(unboxed->sdKBS);
+            hasher.Combine(unboxed->sdPos);
+            hasher.Combine(unboxed->sdNeg);
+            hasher.Combine(unboxed->envLightParams);
+            hasher.Combine(unboxed->envLightRates);
+            hasher.Combine(unboxed->envLightKBS);
+            hasher.Combine(unboxed->envLightPos);
+            hasher.Combine(unboxed->envLightNeg);
+            hasher.Combine(unboxed->edLightParams);
+            hasher.Combine(unboxed->edLightAngles);
+            hasher.Combine(unboxed->edLightDir);
+            hasher.Combine(unboxed->edLightRates);
+            hasher.Combine(unboxed->edLightKBS);
+            hasher.Combine(unboxed->edLightPos);
+            hasher.Combine(unboxed->edLightNeg);
+            hasher.Combine(unboxed->sdfShape);
+            hasher.Combine(unboxed->waveDisturbance);
+            hasher.Combine(unboxed->blurImage);
+            hasher.Combine(unboxed->blurImageForEdge);
+            hasher.Combine(unboxed->snapshotRect);
+            hasher.Combine(unboxed->snapshotMatrix);
+            hasher.Combine(unboxed->refractOutPx);
+            hasher.Combine(unboxed->materialColor);
+            hasher.Combine(unboxed->darkModeWeightsEmboss);
+            hasher.Combine(unboxed->darkModeBgRates);
+            hasher.Combine(unboxed->darkModeBgKBS);
+            hasher.Combine(unboxed->darkModeBgPos);
+            hasher.Combine(unboxed->darkModeBgNeg);
+            hasher.Combine(unboxed->darkModeEdLightKBS);
+            hasher.Combine(unboxed->darkModeEdLightAngles);
+            hasher.Combine(unboxed->darkScale);
+            hasher.Combine(unboxed->enableSDFCache);
+            break;
+        }
+        case GEFilterType::FROSTED_GLASS: {
+            auto unboxed = GEFilterParams::Unbox<GEFrostedGlassShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->blurParams);
+            hasher.Combine(unboxed->weightsEmboss);
+            hasher.Combine(unboxed->weightsEdl);
+            hasher.Combine(unboxed->sdfShape);
+            hasher.Combine(unboxed->waveDisturbance);
+            hasher.Combine(unboxed->maxColor);
+            hasher.Combine(unboxed->bgRates);
+            hasher.Combine(unboxed->bgKBS);
+            hasher.Combine(unboxed->bgPos);
+            hasher.Combine(unboxed->bgNeg);
+            hasher.Combine(unboxed->bgAlpha);
+            hasher.Combine(unboxed->refractParams);
+            hasher.Combine(unboxed->sdParams);
+            hasher.Combine(unboxed->sdRates);
+            hasher.Combine(unboxed->sdKBS);
+            hasher.Combine(unboxed->sdPos);
+            hasher.Combine(unboxed->sdNeg);
+            hasher.Combine(unboxed->envLightParams);
+            hasher.Combine(unboxed->envLightRates);
+            hasher.Combine(unboxed->envLightKBS);
+            hasher.Combine(unboxed->envLightPos);
+            hasher.Combine(unboxed->envLightNeg);
+            hasher.Combine(unboxed->edLightParams);
+            hasher.Combine(unboxed->edLightAngles);
+            hasher.Combine(unboxed->edLightDir);
+            hasher.Combine(unboxed->edLightRates);
+            hasher.Combine(unboxed->edLightKBS);
+            hasher.Combine(unboxed->edLightPos);
+            hasher.Combine(unboxed->edLightNeg);
+            hasher.Combine(unboxed->darkModeBlurParam);
+            hasher.Combine(unboxed->darkModeWeightsEmboss);
+            hasher.Combine(unboxed->darkModeBgRates);
+            hasher.Combine(unboxed->darkModeBgKBS);
+            hasher.Combine(unboxed->darkModeBgPos);
+            hasher.Combine(unboxed->darkModeBgNeg);
+            hasher.Combine(unboxed->darkModeEdLightKBS);
+            hasher.Combine(unboxed->darkModeEdLightAngles);
+            hasher.Combine(unboxed->darkScale);
+            hasher.Combine(unboxed->baseVibrancyEnabled);
+            hasher.Combine(unboxed->baseMaterialType);
+            hasher.Combine(unboxed->materialColor);
+            break;
+        }
+        case GEFilterType::GASIFY_BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GEGasifyBlurFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->sourceImage_);
+            hasher.Combine(unboxed->maskImage_);
+            hasher.Combine(unboxed->progress_);
+            break;
+        }
+        case GEFilterType::GASIFY: {
+            auto unboxed = GEFilterParams::Unbox<GEGasifyFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->sourceImage_);
+            hasher.Combine(unboxed->maskImage_);
+            hasher.Combine(unboxed->progress_);
+            break;
+        }
+        case GEFilterType::GASIFY_SCALE_TWIST: {
+            auto unboxed = GEFilterParams::Unbox<GEGasifyScaleTwistFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->scale_);
+            hasher.Combine(unboxed->sourceImage_);
+            hasher.Combine(unboxed->maskImage_);
+            hasher.Combine(unboxed->progress_);
+            break;
+        }
+        case GEFilterType::GREY: {
+            auto unboxed = GEFilterParams::Unbox<GEGreyShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->greyCoef1);
+            hasher.Combine(unboxed->greyCoef2);
+            break;
+        }
+        case GEFilterType::GRID_WARP: {
+            auto unboxed = GEFilterParams::Unbox<GEGridWarpShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->gridPoints);
+            hasher.Combine(unboxed->rotationAngles);
+            break;
+        }
+        case GEFilterType::HARMONIUM_EFFECT: {
+            auto unboxed = GEFilterParams::Unbox<GEHarmoniumEffectShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->mask);
+            hasher.Combine(unboxed->maskClock);
+            hasher.Combine(unboxed->maskProgress);
+            hasher.Combine(unboxed->useEffectMask);
+            hasher.Combine(unboxed->tintColor);
+            hasher.Combine(unboxed->ripplePosition);
+            hasher.Combine(unboxed->rippleProgress);
+            hasher.Combine(unboxed->distortProgress);
+            hasher.Combine(unboxed->distortFactor);
+            hasher.Combine(unboxed->reflectionFactor);
+            hasher.Combine(unboxed->refractionFactor);
+            hasher.Combine(unboxed->blurLeft);
+            hasher.Combine(unboxed->blurTop);
+            hasher.Combine(unboxed->materialFactor);
+            hasher.Combine(unboxed->cornerRadius);
+            hasher.Combine(unboxed->rate);
+            hasher.Combine(unboxed->lightUpDegree);
+            hasher.Combine(unboxed->cubicCoeff);
+            hasher.Combine(unboxed->quadCoeff);
+            hasher.Combine(unboxed->saturation);
+            hasher.Combine(unboxed->posRGB);
+            hasher.Combine(unboxed->negRGB);
+            hasher.Combine(unboxed->fraction);
+            hasher.Combine(unboxed->totalMatrix);
+            break;
+        }
+        case GEFilterType::HEAT_DISTORTION: {
+            auto unboxed = GEFilterParams::Unbox<GEHeatDistortionFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->intensity);
+            hasher.Combine(unboxed->noiseScale);
+            hasher.Combine(unboxed->riseWeight);
+            hasher.Combine(unboxed->progress);
+            break;
+        }
+        case GEFilterType::IMAGE_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEImageMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->image);
+            break;
+        }
+        case GEFilterType::KAWASE_BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GEKawaseBlurShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->radius);
+            break;
+        }
+        case GEFilterType::LINEAR_GRADIENT_BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GELinearGradientBlurShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->blurRadius);
+            hasher.Combine(unboxed->fractionStops);
+            hasher.Combine(unboxed->direction);
+            hasher.Combine(unboxed->geoWidth);
+            hasher.Combine(unboxed->geoHeight);
+            hasher.Combine(unboxed->mat);
+            hasher.Combine(unboxed->tranX);
+            hasher.Combine(unboxed->tranY);
+            hasher.Combine(unboxed->isOffscreenCanvas);
+            hasher.Combine(unboxed->isRadiusGradient);
+            break;
+        }
+        case GEFilterType::LINEAR_GRADIENT_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GELinearGradientShaderMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->fractionStops);
+            hasher.Combine(unboxed->startPosition);
+            hasher.Combine(unboxed->endPosition);
+            break;
+        }
+        case GEFilterType::MAGNIFIER: {
+            auto unboxed = GEFilterParams::Unbox<GEMagnifierShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->factor);
+            hasher.Combine(unboxed->width);
+            hasher.Combine(unboxed->height);
+            hasher.Combine(unboxed->cornerRadius);
+            hasher.Combine(unboxed->borderWidth);
+            hasher.Combine(unboxed->zoomOffsetX);
+            hasher.Combine(unboxed->zoomOffsetY);
+            hasher.Combine(unboxed->shadowOffsetX);
+            hasher.Combine(unboxed->shadowOffsetY);
+            hasher.Combine(unboxed->shadowSize);
+            hasher.Combine(unboxed->shadowStrength);
+            hasher.Combine(unboxed->gradientMaskColor1);
+            hasher.Combine(unboxed->gradientMaskColor2);
+            hasher.Combine(unboxed->outerContourColor1);
+            hasher.Combine(unboxed->outerContourColor2);
+            hasher.Combine(unboxed->rotateDegree);
+            hasher.Combine(unboxed->sdfShape);
+            break;
+        }
+        case GEFilterType::MAP_COLOR_BY_BRIGHTNESS: {
+            auto unboxed = GEFilterParams::Unbox<GEMapColorByBrightnessFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->colors);
+            hasher.Combine(unboxed->positions);
+            break;
+        }
+        case GEFilterType::MASK_TRANSITION: {
+            auto unboxed = GEFilterParams::Unbox<GEMaskTransitionShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->mask);
+            hasher.Combine(unboxed->factor);
+            hasher.Combine(unboxed->inverse);
+            break;
+        }
+        case GEFilterType::MESA_BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GEMESABlurShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->radius);
+            hasher.Combine(unboxed->greyCoef1);
+            hasher.Combine(unboxed->greyCoef2);
+            hasher.Combine(unboxed->offsetX);
+            hasher.Combine(unboxed->offsetY);
+            hasher.Combine(unboxed->offsetZ);
+            hasher.Combine(unboxed->offsetW);
+            hasher.Combine(unboxed->tileMode);
+            hasher.Combine(unboxed->width);
+            hasher.Combine(unboxed->height);
+            hasher.Combine(unboxed->isDirection);
+            hasher.Combine(unboxed->angle);
+            break;
+        }
+        case GEFilterType::MOTION_BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GEMotionBlurShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->radius);
+            hasher.Combine(unboxed->anchor);
+            hasher.Combine(unboxed->sampleCount);
+            break;
+        }
+        case GEFilterType::PARTICLE_ABLATION: {
+            auto unboxed = GEFilterParams::Unbox<GEParticleAblationFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->progress_);
+            hasher.Combine(unboxed->ablationRate_);
+            hasher.Combine(unboxed->centers0_);
+            hasher.Combine(unboxed->centers1_);
+            hasher.Combine(unboxed->centers2_);
+            hasher.Combine(unboxed->centers3_);
+            hasher.Combine(unboxed->glowLevel_);
+            hasher.Combine(unboxed->glowBrightness_);
+            hasher.Combine(unboxed->maxParticleCount_);
+            hasher.Combine(unboxed->wind_);
+            hasher.Combine(unboxed->turbScale_);
+            hasher.Combine(unboxed->turbEvo_);
+            hasher.Combine(unboxed->turbAmp_);
+            hasher.Combine(unboxed->expansionSize_);
+            break;
+        }
+        case GEFilterType::PARTICLE_CIRCULAR_HALO: {
+            auto unboxed = GEFilterParams::Unbox<GEParticleCircularHaloShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->center_);
+            hasher.Combine(unboxed->radius_);
+            hasher.Combine(unboxed->noise_);
+            break;
+        }
+        case GEFilterType::PIXEL_MAP_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEPixelMapMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->image);
+            hasher.Combine(unboxed->src);
+            hasher.Combine(unboxed->dst);
+            hasher.Combine(unboxed->fillColor);
+            break;
+        }
+        case GEFilterType::RADIAL_GRADIENT_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GERadialGradientShaderMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->center_);
+            hasher.Combine(unboxed->radiusX_);
+            hasher.Combine(unboxed->radiusY_);
+            hasher.Combine(unboxed->colors_);
+            hasher.Combine(unboxed->positions_);
+            break;
+        }
+        case GEFilterType::RIPPLE_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GERippleShaderMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->center_);
+            hasher.Combine(unboxed->radius_);
+            hasher.Combine(unboxed->width_);
+            hasher.Combine(unboxed->widthCenterOffset_);
+            break;
+        }
+        case GEFilterType::SDF_BORDER: {
+            auto unboxed = GEFilterParams::Unbox<GESDFBorderShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->shape);
+            hasher.Combine(unboxed->border);
+            break;
+        }
+        case GEFilterType::SDF_CLIP: {
+            auto unboxed = GEFilterParams::Unbox<GESDFClipShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->shape);
+            break;
+        }
+        case GEFilterType::SDF_COLOR: {
+            auto unboxed = GEFilterParams::Unbox<GESDFColorShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->shape);
+            hasher.Combine(unboxed->color);
+            break;
+        }
+        case GEFilterType::SDF_DISTORT_OP_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFDistortOpShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->shape);
+            hasher.Combine(unboxed->LUCorner);
+            hasher.Combine(unboxed->RUCorner);
+            hasher.Combine(unboxed->RBCorner);
+            hasher.Combine(unboxed->LBCorner);
+            hasher.Combine(unboxed->barrelDistortion);
+            break;
+        }
+        case GEFilterType::SDF_EDGE_LIGHT_EFFECT: {
+            auto unboxed = GEFilterParams::Unbox<GESDFEdgeLightEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->sdfSpreadFactor);
+            hasher.Combine(unboxed->bloomIntensityCutoff);
+            hasher.Combine(unboxed->maxIntensity);
+            hasher.Combine(unboxed->maxBloomIntensity);
+            hasher.Combine(unboxed->bloomFalloffPow);
+            hasher.Combine(unboxed->minBorderWidth);
+            hasher.Combine(unboxed->maxBorderWidth);
+            hasher.Combine(unboxed->innerBorderBloomWidth);
+            hasher.Combine(unboxed->outerBorderBloomWidth);
+            hasher.Combine(unboxed->color);
+            hasher.Combine(unboxed->sdfImage);
+            hasher.Combine(unboxed->lightMask);
+            hasher.Combine(unboxed->sdfShape);
+            break;
+        }
+        case GEFilterType::SDF_EDGE_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GESDFEdgeLightFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->sdfSpreadFactor);
+            hasher.Combine(unboxed->bloomIntensityCutoff);
+            hasher.Combine(unboxed->maxIntensity);
+            hasher.Combine(unboxed->maxBloomIntensity);
+            hasher.Combine(unboxed->bloomFalloffPow);
+            hasher.Combine(unboxed->minBorderWidth);
+            hasher.Combine(unboxed->maxBorderWidth);
+            hasher.Combine(unboxed->innerBorderBloomWidth);
+            hasher.Combine(unboxed->outerBorderBloomWidth);
+            hasher.Combine(unboxed->sdfImage);
+            hasher.Combine(unboxed->lightMask);
+            hasher.Combine(unboxed->sdfShape);
+            break;
+        }
+        case GEFilterType::SDF_ELLIPSE_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFEllipseShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->center);
+            hasher.Combine(unboxed->width);
+            hasher.Combine(unboxed->height);
+            break;
+        }
+        case GEFilterType::SDF_FROM_IMAGE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFFromImageFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->spreadFactor);
+            hasher.Combine(unboxed->generateDerivs);
+            break;
+        }
+        case GEFilterType::SDF_PATH_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFPathShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->path);
+            hasher.Combine(unboxed->offset);
+            hasher.Combine(unboxed->scale);
+            break;
+        }
+        case GEFilterType::SDF_PIXELMAP_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFPixelmapShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->image);
+            break;
+        }
+        case GEFilterType::SDF_RRECT_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFRRectShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->rrect);
+            break;
+        }
+        case GEFilterType::SDF_SHADOW: {
+            auto unboxed = GEFilterParams::Unbox<GESDFShadowShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->shape);
+            hasher.Combine(unboxed->shadow);
+            break;
+        }
+        case GEFilterType::SDF_SMOOTH_SUB_OP_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFSmoothSubOpShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->spacing);
+            hasher.Combine(unboxed->left);
+            hasher.Combine(unboxed->right);
+            break;
+        }
+        case GEFilterType::SDF_SUB_OP_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFSubOpShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->left);
+            hasher.Combine(unboxed->right);
+            break;
+        }
+        case GEFilterType::SDF_TRANSFORM_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFTransformShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->shape);
+            hasher.Combine(unboxed->matrix);
+            hasher.Combine(unboxed->warpStrength);
+            hasher.Combine(unboxed->unionMode);
+            hasher.Combine(unboxed->spacing);
+            hasher.Combine(unboxed->hotZone);
+            hasher.Combine(unboxed->centerPosition);
+            break;
+        }
+        case GEFilterType::SDF_TRIANGLE_SHAPE: {
+            auto unboxed = GEFilterParams::Unbox<GESDFTriangleShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->vertex0);
+            hasher.Combine(unboxed->vertex1);
+            hasher.Combine(unboxed->vertex2);
+            hasher.Combine(unboxed->radius);
+            break;
+        }
+        case GEFilterType::SDF_UNION_OP: {
+            auto unboxed = GEFilterParams::Unbox<GESDFUnionOpShapeParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->spacing);
+            hasher.Combine(unboxed->left);
+            hasher.Combine(unboxed->right);
+            hasher.Combine(unboxed->op);
+            break;
+        }
+        case GEFilterType::SOUND_WAVE: {
+            auto unboxed = GEFilterParams::Unbox<GESoundWaveFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->colorA);
+            hasher.Combine(unboxed->colorB);
+            hasher.Combine(unboxed->colorC);
+            hasher.Combine(unboxed->colorProgress);
+            hasher.Combine(unboxed->soundIntensity);
+            hasher.Combine(unboxed->shockWaveAlphaA);
+            hasher.Combine(unboxed->shockWaveAlphaB);
+            hasher.Combine(unboxed->shockWaveProgressA);
+            hasher.Combine(unboxed->shockWaveProgressB);
+            hasher.Combine(unboxed->shockWaveTotalAlpha);
+            break;
+        }
+        case GEFilterType::SPATIAL_GLASS_EFFECT: {
+            auto unboxed = GEFilterParams::Unbox<GESpatialGlassEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->leftTop);
+            hasher.Combine(unboxed->leftBot);
+            hasher.Combine(unboxed->rightTop);
+            hasher.Combine(unboxed->rightBot);
+            hasher.Combine(unboxed->cameraPosition);
+            hasher.Combine(unboxed->cameraIntrinsics);
+            hasher.Combine(unboxed->lightDir);
+            hasher.Combine(unboxed->thickParams);
+            hasher.Combine(unboxed->glassBaseColor);
+            hasher.Combine(unboxed->fresnelEnvColor);
+            hasher.Combine(unboxed->fresnelEnvParams);
+            hasher.Combine(unboxed->bgRates);
+            hasher.Combine(unboxed->bgKBS);
+            hasher.Combine(unboxed->bgPos);
+            hasher.Combine(unboxed->bgNeg);
+            hasher.Combine(unboxed->refractParams);
+            hasher.Combine(unboxed->weightsEdl);
+            hasher.Combine(unboxed->envLightParams);
+            hasher.Combine(unboxed->envLightRates);
+            hasher.Combine(unboxed->envLightKBS);
+            hasher.Combine(unboxed->envLightPos);
+            hasher.Combine(unboxed->envLightNeg);
+            hasher.Combine(unboxed->sdParams);
+            hasher.Combine(unboxed->sdRates);
+            hasher.Combine(unboxed->sdKBS);
+            hasher.Combine(unboxed->sdPos);
+            hasher.Combine(unboxed->sdNeg);
+            hasher.Combine(unboxed->sdfShape);
+            hasher.Combine(unboxed->blurImage);
+            hasher.Combine(unboxed->depthImage);
+            hasher.Combine(unboxed->snapshotRect);
+            hasher.Combine(unboxed->snapshotMatrix);
+            hasher.Combine(unboxed->refractOutPx);
+            hasher.Combine(unboxed->enableSDFCache);
+            break;
+        }
+        case GEFilterType::SPATIAL_POINT_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GESpatialPointLightShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->lightIntensity);
+            hasher.Combine(unboxed->lightPosition);
+            hasher.Combine(unboxed->attenuation);
+            hasher.Combine(unboxed->lightColor);
+            hasher.Combine(unboxed->mask);
+            break;
+        }
+        case GEFilterType::USE_EFFECT_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEUseEffectMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->image);
+            hasher.Combine(unboxed->useEffect);
+            break;
+        }
+        case GEFilterType::VARIABLE_RADIUS_BLUR: {
+            auto unboxed = GEFilterParams::Unbox<GEVariableRadiusBlurShaderFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->mask);
+            hasher.Combine(unboxed->blurRadius);
+            hasher.Combine(unboxed->applyInsideMask);
+            break;
+        }
+        case GEFilterType::WATER_DROPLET_TRANSITION: {
+            auto unboxed = GEFilterParams::Unbox<GEWaterDropletTransitionFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->topLayer);
+            hasher.Combine(unboxed->inverse);
+            hasher.Combine(unboxed->progress);
+            hasher.Combine(unboxed->radius);
+            hasher.Combine(unboxed->transitionFadeWidth);
+            hasher.Combine(unboxed->distortionIntensity);
+            hasher.Combine(unboxed->distortionThickness);
+            hasher.Combine(unboxed->lightStrength);
+            hasher.Combine(unboxed->lightSoftness);
+            hasher.Combine(unboxed->noiseScaleX);
+            hasher.Combine(unboxed->noiseScaleY);
+            hasher.Combine(unboxed->noiseStrengthX);
+            hasher.Combine(unboxed->noiseStrengthY);
+            hasher.Combine(unboxed->position);
+            break;
+        }
+        case GEFilterType::WATER_RIPPLE: {
+            auto unboxed = GEFilterParams::Unbox<GEWaterRippleFilterParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->progress);
+            hasher.Combine(unboxed->waveCount);
+            hasher.Combine(unboxed->rippleCenterX);
+            hasher.Combine(unboxed->rippleCenterY);
+            hasher.Combine(unboxed->rippleMode);
+            break;
+        }
+        case GEFilterType::WAVE_DISTURBANCE_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEWaveDisturbanceShaderMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->clickPos);
+            hasher.Combine(unboxed->progress);
+            hasher.Combine(unboxed->waveRD);
+            hasher.Combine(unboxed->waveLWH);
+            break;
+        }
+        case GEFilterType::WAVE_GRADIENT_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEWaveGradientShaderMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->center_);
+            hasher.Combine(unboxed->width_);
+            hasher.Combine(unboxed->propagationRadius_);
+            hasher.Combine(unboxed->blurRadius_);
+            hasher.Combine(unboxed->turbulenceStrength_);
+            break;
+        }
+        case GEFilterType::WAVY_RIPPLE_LIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GEWavyRippleLightShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->center_);
+            hasher.Combine(unboxed->radius_);
+            hasher.Combine(unboxed->thickness_);
+            break;
+        }
+        case GEFilterType::AIBAR_GLOW: {
+            auto unboxed = GEFilterParams::Unbox<GEXAIBarGlowEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->LTWH);
+            hasher.Combine(unboxed->stretchFactor);
+            hasher.Combine(unboxed->barAngle);
+            hasher.Combine(unboxed->colors);
+            hasher.Combine(unboxed->positions);
+            hasher.Combine(unboxed->strengths);
+            hasher.Combine(unboxed->brightness);
+            hasher.Combine(unboxed->progress);
+            break;
+        }
+        case GEFilterType::AIBAR_RECT_HALO: {
+            auto unboxed = GEFilterParams::Unbox<GEXAIBarRectHaloEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->LTWH);
+            hasher.Combine(unboxed->colors);
+            hasher.Combine(unboxed->positions);
+            hasher.Combine(unboxed->strengths);
+            hasher.Combine(unboxed->brightness);
+            hasher.Combine(unboxed->progress);
+            break;
+        }
+        case GEFilterType::COLOR_GRADIENT_EFFECT: {
+            auto unboxed = GEFilterParams::Unbox<GEXColorGradientEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->colors_);
+            hasher.Combine(unboxed->positions_);
+            hasher.Combine(unboxed->strengths_);
+            hasher.Combine(unboxed->colorNum_);
+            hasher.Combine(unboxed->blend_);
+            hasher.Combine(unboxed->blendk_);
+            hasher.Combine(unboxed->mask_);
+            hasher.Combine(unboxed->brightness_);
+            break;
+        }
+        case GEFilterType::DISTORT_CHROMA: {
+            auto unboxed = GEFilterParams::Unbox<GEXDistortChromaEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->progress);
+            hasher.Combine(unboxed->turbulentMask);
+            hasher.Combine(unboxed->frequency);
+            hasher.Combine(unboxed->sharpness);
+            hasher.Combine(unboxed->brightness);
+            hasher.Combine(unboxed->dispersion);
+            hasher.Combine(unboxed->saturation);
+            hasher.Combine(unboxed->verticalMoveDistance);
+            hasher.Combine(unboxed->granularity);
+            hasher.Combine(unboxed->distortFactor);
+            hasher.Combine(unboxed->colorStrength);
+            hasher.Combine(unboxed->mask);
+            break;
+        }
+        case GEFilterType::DUPOLI_NOISE_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEXDupoliNoiseMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->progress);
+            hasher.Combine(unboxed->granularity);
+            hasher.Combine(unboxed->verticalMoveDistance);
+            break;
+        }
+        case GEFilterType::GRADIENT_FLOW_COLORS: {
+            auto unboxed = GEFilterParams::Unbox<GEXGradientFlowColorsEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->colors);
+            hasher.Combine(unboxed->gradientBegin);
+            hasher.Combine(unboxed->gradientEnd);
+            hasher.Combine(unboxed->effectAlpha);
+            hasher.Combine(unboxed->progress);
+            break;
+        }
+        case GEFilterType::LIGHT_CAVE: {
+            auto unboxed = GEFilterParams::Unbox<GEXLightCaveShaderParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->colorA);
+            hasher.Combine(unboxed->colorB);
+            hasher.Combine(unboxed->colorC);
+            hasher.Combine(unboxed->position);
+            hasher.Combine(unboxed->radiusXY);
+            hasher.Combine(unboxed->progress);
+            break;
+        }
+        case GEFilterType::NOISY_FRAME_GRADIENT_MASK: {
+            auto unboxed = GEFilterParams::Unbox<GEXNoisyFrameGradientMaskParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->gradientBezierControlPoints);
+            hasher.Combine(unboxed->cornerRadius);
+            hasher.Combine(unboxed->innerFrameWidth);
+            hasher.Combine(unboxed->middleFrameWidth);
+            hasher.Combine(unboxed->outsideFrameWidth);
+            hasher.Combine(unboxed->RRectWH);
+            hasher.Combine(unboxed->RRectPos);
+            hasher.Combine(unboxed->slope);
+            hasher.Combine(unboxed->progress);
+            break;
+        }
+        case GEFilterType::ROUNDED_RECT_FLOWLIGHT: {
+            auto unboxed = GEFilterParams::Unbox<GEXRoundedRectFlowlightEffectParams>(params);
+            if (unboxed == nullptr) {
+                return false;
+            }
+            hasher.Combine(unboxed->startEndPosition);
+            hasher.Combine(unboxed->waveLength);
+            hasher.Combine(unboxed->waveTop);
+            hasher.Combine(unboxed->cornerRadius);
+            hasher.Combine(unboxed->brightness);
+            hasher.Combine(unboxed->scale);
+            hasher.Combine(unboxed->sharping);
+            hasher.Combine(unboxed->feathering);
+            hasher.Combine(unboxed->featheringBezierControlPoints);
+            hasher.Combine(unboxed->gradientBezierControlPoints);
+            hasher.Combine(unboxed->color);
+            hasher.Combine(unboxed->progress);
+            break;
+        }
+        default:
+            return false;
     }
-    return GEParamsMemberTag::INVALID;
+    return hasher.IsHashable();
 }
 
 // Helper macro to validate and set parameter
-#define GE_VALIDATE_AND_SET(Tag)                                                                                      \
-    case GEParamsMemberTag::Tag: {                                                                                    \
-        using ParamsType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::ParamsType;                                 \
-        using FieldType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::FieldType;                                   \
-        using SetterType = std::remove_cv_t<std::remove_reference_t<decltype(value)>>;                                \
-        auto unboxed = GEFilterParams::Unbox<ParamsType>(params);                                                     \
-        if (unboxed == nullptr) {                                                                                     \
-            return;                                                                                                   \
-        }                                                                                                             \
-        auto& actualParams = *unboxed;                                                                                \
-        FieldType transformed;                                                                                        \
-        if (GEParamsValueTransformer<GEParamsMemberTag::Tag, SetterType, FieldType>::Transform(value, transformed)) { \
-            GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Set(actualParams, transformed);                            \
-        }                                                                                                             \
-        break;                                                                                                        \
-    }
-
-void GEParamsMemberHelper::SetParamsMemberByTag(
+#define GE_VALIDATE_AND_SET(Tag)                                                                                       \
+    case GEParamsMemberTag::Tag: {                                                                                     \
+        using ParamsType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::ParamsType;                                  \
+        using FieldType = GEParamsFieldAccessor<GEParamsMemberTag::Tag>::FieldType;                                    \
+        using SetterType = std::remove_cv_t<std::remove_reference_t<decltype(value)>>;                                 \
+        auto unboxed = GEFilterParams::Unbox<ParamsType>(params);                                                      \
+        if (unboxed == nullptr) {                                                                                      \
+            return false;                                                                                              \
+        }                                                                                                              \
+        auto& actualParams = *unboxed;                                                                                 \
+        FieldType transformed;                                                                                         \
+        if (!GEParamsValueTransformer<GEParamsMemberTag::Tag, SetterType, FieldType>::Transform(value, transformed)) { \
+            return false;                                                                                              \
+        }                                                                                                              \
+        if (GEParamsFieldEqual(GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Get(actualParams), transformed)) {       \
+            return false;                                                                                              \
+        }                                                                                                              \
+        GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Set(actualParams, transformed);                                 \
+        return true;                                                                                                   \
+    }
+
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixDirection& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1593,16 +2839,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const DotMatrixEffectType& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1612,16 +2858,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Color4f& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1645,16 +2891,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Matrix& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1669,16 +2915,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Path& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1688,16 +2934,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const Drawing::Point& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1740,16 +2986,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const GEBezierWarpShaderFilterControlPointArray& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1759,15 +3005,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u (filter type %{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GERRect& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const GERRect& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1777,16 +3023,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const GESDFBorderParams& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1796,16 +3042,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const GESDFShadowParams& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1815,16 +3061,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const GESDFUnionOp& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1834,15 +3080,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const RectF& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const RectF& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1855,15 +3101,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector2f& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector2f& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -1922,15 +3168,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector3f& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector3f& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2006,15 +3252,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector4f& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const Vector4f& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2100,15 +3346,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const bool& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const bool& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2136,15 +3382,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const float& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const float& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2393,15 +3639,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const int32_t& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const int32_t& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2426,16 +3672,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::pair<float, float>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2578,16 +3824,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<Drawing::GEShaderShape>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2616,16 +3862,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u (filter type %{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<Drawing::Image>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2653,16 +3899,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "(filter type %{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::shared_ptr<GEShaderMask>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2690,16 +3936,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "type %{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector2f>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2711,16 +3957,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::vector<Vector4f>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2731,16 +3977,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::vector<float>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2755,16 +4001,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "%{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::vector<std::pair<float, float>>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2775,16 +4021,16 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "(filter type %{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(
+bool GEParamsMemberHelper::SetParamsMemberByTag(
     GEFilterParams& params, GEParamsMemberTag tag, const std::weak_ptr<Drawing::Image>& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2798,15 +4044,15 @@ void GEParamsMemberHelper::SetParamsMemberByTag(
                     "type %{public}u, params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
-void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const uint32_t& value)
+bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParamsMemberTag tag, const uint32_t& value)
 {
     auto expectedFilterType = GetFilterTypeFromTag(tag);
     if (params.GetType() != expectedFilterType) {
-        return;
+        return false;
     }
 
     switch (tag) {
@@ -2822,7 +4068,7 @@ void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params, GEParams
                     "params type %{public}u)",
                 static_cast<uint32_t>(tag), static_cast<uint32_t>(expectedFilterType),
                 static_cast<uint32_t>(params.GetType()));
-            break;
+            return false;
     }
 }
 
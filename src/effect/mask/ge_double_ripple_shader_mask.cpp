@@ -15,7 +15,7 @@
 
 #include <chrono>
 #include "ge_double_ripple_shader_mask.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -132,7 +132,7 @@ static constexpr char prog[] = R"(
         }
     )";
 
-    auto rippleShaderMaskEffect = GECreateRuntimeEffectForShader(prog);
+    auto rippleShaderMaskEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!rippleShaderMaskEffect) {
         return nullptr;
     }
@@ -254,7 +254,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEDoubleRippleShaderMask::GetDoub
         }
     )";
 
-    auto rippleShaderMaskNormalEffect = GECreateRuntimeEffectForShader(prog);
+    auto rippleShaderMaskNormalEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!rippleShaderMaskNormalEffect) {
         LOGE("GEDoubleRippleShaderMask::GetRippleShaderNormalMaskBuilder effect error");
         return nullptr;
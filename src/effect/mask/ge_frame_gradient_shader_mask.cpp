@@ -16,7 +16,7 @@
 #include <chrono>
 #include "ge_log.h"
 #include "ge_frame_gradient_shader_mask.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -262,7 +262,7 @@ void GEFrameGradientShaderMask::MakeFrameGradientMaskShaderEffect() const
         return;
     }
 
-    frameGradientMaskShaderEffect_ = GECreateRuntimeEffectForShader(maskString);
+    frameGradientMaskShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(maskString);
     if (frameGradientMaskShaderEffect_ == nullptr) {
         GE_LOGE("GEFrameGradientShaderMask::MakeFrameGradientMaskShaderEffect error");
     }
@@ -18,7 +18,7 @@
 #include "effect/shader_effect.h"
 #include "ge_log.h"
 #include "ge_pixel_map_shader_mask.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_shader_filter_params.h"
 #include "platform/common/rs_log.h"
 #include "utils/matrix.h"
@@ -124,7 +124,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEPixelMapShaderMask::GetPixelMap
         }
     )";
 
-    auto pixelMapShaderMaskEffect = GECreateRuntimeEffectForShader(prog);
+    auto pixelMapShaderMaskEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (pixelMapShaderMaskEffect == nullptr) {
         LOGE("GEPixelMapShaderMask::GetPixelMapShaderMaskBuilder effect error");
         return nullptr;
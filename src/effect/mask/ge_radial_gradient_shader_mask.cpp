@@ -17,7 +17,7 @@
 
 #include "ge_log.h"
 #include "ge_radial_gradient_shader_mask.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_trace.h"
 
 namespace OHOS {
@@ -113,7 +113,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GERadialGradientShaderMask::GetRa
         }
     )";
 
-    auto radialGradientShaderMaskEffect = GECreateRuntimeEffectForShader(prog);
+    auto radialGradientShaderMaskEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!radialGradientShaderMaskEffect) {
         LOGE("GERadialGradientShaderMask::GetRadialGradientShaderMaskBuilder effect error");
         return nullptr;
@@ -212,7 +212,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GERadialGradientShaderMask::GetRa
         }
     )";
 
-    auto radialGradientShaderMaskNormalEffect = GECreateRuntimeEffectForShader(prog);
+    auto radialGradientShaderMaskNormalEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!radialGradientShaderMaskNormalEffect) {
         LOGE("GERadialGradientShaderMask::GetRadialGradientNormalMaskBuilder effect error");
         return nullptr;
@@ -17,7 +17,7 @@
  
 #include "ge_log.h"
 #include "ge_ripple_shader_mask.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_trace.h"
  
 namespace OHOS {
@@ -77,7 +77,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GERippleShaderMask::GetRippleShad
         }
     )";
 
-    auto rippleShaderMaskEffect = GECreateRuntimeEffectForShader(prog);
+    auto rippleShaderMaskEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!rippleShaderMaskEffect) {
         LOGE("GERippleShaderMask::GetRippleShaderMaskBuilder effect error");
         return nullptr;
@@ -143,7 +143,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GERippleShaderMask::GetRippleShad
         }
     )";
 
-    auto rippleShaderMaskNormalEffect = GECreateRuntimeEffectForShader(prog);
+    auto rippleShaderMaskNormalEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!rippleShaderMaskNormalEffect) {
         LOGE("GERippleShaderMask::GetRippleShaderNormalMaskBuilder effect error");
         return nullptr;
@@ -17,7 +17,7 @@
 #include "common/rs_vector4.h"
 #include "effect/shader_effect.h"
 #include "ge_use_effect_shader_mask.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_shader_filter_params.h"
 #include "platform/common/rs_log.h"
 #include "utils/matrix.h"
@@ -83,7 +83,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEUseEffectShaderMask::GetUseEffe
         }
     )";
 
-    auto useEffectShaderMaskEffect = GECreateRuntimeEffectForShader(prog);
+    auto useEffectShaderMaskEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (useEffectShaderMaskEffect == nullptr) {
         LOGE("GEUseEffectShaderMask::GetUseEffectShaderMaskBuilder effect error");
         return nullptr;
@@ -15,7 +15,7 @@
 #include <chrono>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_wave_gradient_shader_mask.h"
 
 namespace OHOS {
@@ -123,7 +123,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEWaveGradientShaderMask::GetWave
         }
     )";
 
-    auto waveShaderMaskEffect = GECreateRuntimeEffectForShader(prog);
+    auto waveShaderMaskEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!waveShaderMaskEffect) {
         LOGE("GEWaveGradientShaderMask::GetWaveShaderMaskBuilder effect error");
         return nullptr;
@@ -242,7 +242,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEWaveGradientShaderMask::GetWave
         }
     )";
 
-    auto waveShaderMaskNormalEffect = GECreateRuntimeEffectForShader(prog);
+    auto waveShaderMaskNormalEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!waveShaderMaskNormalEffect) {
         LOGE("GEWaveGradientShaderMask::GetWaveShaderNormalMaskBuilder effect error");
         return nullptr;
@@ -14,7 +14,7 @@
  */
 #include "ge_log.h"
 #include "ge_border_light_shader.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_visual_effect_impl.h"
 
 namespace OHOS {
@@ -167,7 +167,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEBorderLightShader::GetBorderLig
                 return half4(shinningColor.xyz * lightColor.w, shinningColor.w) * clamp(lightIntensity, 0.0, 1.0);
             }
         )";
-        borderLightShaderEffect_ = GECreateRuntimeEffectForShader(prog);
+        borderLightShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     }
 
     if (borderLightShaderEffect_ == nullptr) {
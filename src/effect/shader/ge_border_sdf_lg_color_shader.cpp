@@ -17,7 +17,7 @@
 #include "effect/runtime_effect.h"
 #include "effect/runtime_shader_builder.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 namespace OHOS {
 namespace Rosen {
 GEBorderSDFLGColorShader::GEBorderSDFLGColorShader() {}
@@ -30,7 +30,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GEBorderSDFLGColorShader::GetEffect()
 {
     thread_local std::shared_ptr<Drawing::RuntimeEffect> lgColorEffect = nullptr;
     if (!lgColorEffect) {
-        lgColorEffect = GECreateRuntimeEffectForShader(lgColorShaderCode_);
+        lgColorEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(lgColorShaderCode_);
     }
     return lgColorEffect;
 }
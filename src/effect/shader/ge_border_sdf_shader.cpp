@@ -17,7 +17,7 @@
 #include "effect/runtime_effect.h"
 #include "effect/runtime_shader_builder.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -30,7 +30,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GEBorderSDFShader::GetEffect()
     if (params_.style == 0) {
         thread_local std::shared_ptr<Drawing::RuntimeEffect> borderSdfSolidEffect = nullptr;
         if (!borderSdfSolidEffect) {
-            borderSdfSolidEffect = GECreateRuntimeEffectForShader(borderShaderCode_);
+            borderSdfSolidEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(borderShaderCode_);
         }
         return borderSdfSolidEffect;
     }
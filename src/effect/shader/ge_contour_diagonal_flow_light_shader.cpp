@@ -30,7 +30,7 @@
 #include "ge_kawase_blur_shader_filter.h"
 #include "ge_mesa_blur_shader_filter.h"
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #ifdef GE_OHOS
 #include "ge_system_properties.h"
 #endif
@@ -713,11 +713,6 @@ bool FEqual(float a, float b)
 {
     return std::abs(a - b) <= std::numeric_limits<float>::epsilon();
 }
-
-bool IntersectBBox(const Box4f& a, const Box4f& b)
-{
-    return !(a[XMAX_I] < b[XMIN_I] || a[XMIN_I] > b[XMAX_I] || a[YMAX_I] < b[YMIN_I] || a[YMIN_I] > b[YMAX_I]);
-}
 } // anonymous namespace
 
 GEContourDiagonalFlowLightShader::GEContourDiagonalFlowLightShader() {}
@@ -733,7 +728,8 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEContourDiagonalFlowLightShader:
     thread_local std::shared_ptr<Drawing::RuntimeEffect> precalculationShaderForMoreCurves = nullptr;
 
     if (precalculationShaderForMoreCurves == nullptr) {
-        precalculationShaderForMoreCurves = GECreateRuntimeEffectForShader(PRECALCULATIONFORMORECURVES_PROG);
+        precalculationShaderForMoreCurves =
+            GERuntimeEffectRegistry::GetInstance().GetOrCreate(PRECALCULATIONFORMORECURVES_PROG);
     }
 
     if (precalculationShaderForMoreCurves == nullptr) {
@@ -748,7 +744,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEContourDiagonalFlowLightShader:
     thread_local std::shared_ptr<Drawing::RuntimeEffect> convertShader = nullptr;
 
     if (convertShader == nullptr) {
-        convertShader = GECreateRuntimeEffectForShader(CONVERT_IMG_PROG);
+        convertShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(CONVERT_IMG_PROG);
     }
 
     if (convertShader == nullptr) {
@@ -763,7 +759,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEContourDiagonalFlowLightShader:
     thread_local std::shared_ptr<Drawing::RuntimeEffect> sdfMaskShader = nullptr;
 
     if (sdfMaskShader == nullptr) {
-        sdfMaskShader = GECreateRuntimeEffectForShader(SDF_MASK_PROG);
+        sdfMaskShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SDF_MASK_PROG);
     }
 
     if (sdfMaskShader == nullptr) {
@@ -854,13 +850,22 @@ void GEContourDiagonalFlowLightShader::AutoPartitionCal(Drawing::Canvas& canvas,
     // gpu cal
     for (int i = 0; i < static_cast<int>(curvesInGrid_.size()); i++) {
         if (curvesInGrid_[i].first.size() > 0) {
-            Box4f area = curvesInGrid_[i].second.bbox;
+            Box4f area = curvesInGrid_[i].second;
             const Drawing::Rect rectN = Drawing::Rect(area[0], area[2], area[1], area[3]);
             PreCalculateRegion(canvas, *offscreenCanvas_, i, rect, rectN);
         }
     }
 }
 
+GECurveSpatialIndex::Config GEContourDiagonalFlowLightShader::MakeSpatialIndexConfig()
+{
+    GECurveSpatialIndex::Config config;
+    config.maxCurvesPerLeaf = MAX_CURVES_PER_GRID;
+    config.minNodeSize = MIN_GRID_SIZE;
+    config.clipToRoot = true;
+    return config;
+}
+
 void GEContourDiagonalFlowLightShader::AutoGridPartition(int width, int height, float maxThickness)
 {
     if (width <= 1 || height <= 1) {
@@ -868,55 +873,15 @@ void GEContourDiagonalFlowLightShader::AutoGridPartition(int width, int height,
         return;
     }
     curvesInGrid_.clear();
+    segmentIndex_.clear();
     // calculate the bounding box of all curves
-    std::vector<Box4f> curveBBoxes;
     Box4f canvasBBox;
-    ComputeAllCurveBoundingBoxes(width, height, maxThickness, canvasBBox, curveBBoxes);
-    // init workQueue
-    std::queue<Grid> workQueue;
-    InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    // grid Partition
-    while (!workQueue.empty()) {
-        Grid current = workQueue.front();
-        workQueue.pop();
-        // cal grid size
-        float w = current.bbox[1] - current.bbox[0];
-        float h = current.bbox[3] - current.bbox[2];
-        // check is need to split
-        bool needsSplit = (static_cast<int>(current.curveIndices.size()) > MAX_CURVES_PER_GRID) &&
-            (w > MIN_GRID_SIZE && h > MIN_GRID_SIZE);
-        if (needsSplit) {
-            SplitGrid(current, curveBBoxes, workQueue, MIN_GRID_SIZE);
-        } else {
-            ProcessFinalGrid(current, curveBBoxes, height);
-        }
-    }
-}
-
-void GEContourDiagonalFlowLightShader::SplitGrid(const Grid& current, const std::vector<Box4f>& curveBBoxes,
-    std::queue<Grid>& workQueue, float minGridSize)
-{
-    // partition grid - quadtree
-    float midX = (current.bbox[XMIN_I] + current.bbox[XMAX_I]) * 0.5f;
-    float midY = (current.bbox[YMIN_I] + current.bbox[YMAX_I]) * 0.5f;
-    Box4f quadrants[4] = {
-        {current.bbox[XMIN_I], midX, current.bbox[YMIN_I], midY}, // Top-Left
-        {midX, current.bbox[XMAX_I], current.bbox[YMIN_I], midY}, // Top-Right
-        {current.bbox[XMIN_I], midX, midY, current.bbox[YMAX_I]}, // Bottom-Left
-        {midX, current.bbox[XMAX_I], midY, current.bbox[YMAX_I]}  // Bottom-Right
-    };
-    for (const auto& quad : quadrants) {
-        Grid child{quad, {}};
-        // find intersecting curves
-        for (int idx : current.curveIndices) {
-            if (IntersectBBox(child.bbox, curveBBoxes[idx])) {
-                child.curveIndices.push_back(idx);
-            }
-        }
-        // add node to workqueue
-        if (!child.curveIndices.empty()) {
-            workQueue.push(child);
-        }
+    ComputeAllCurveBoundingBoxes(width, height, maxThickness, canvasBBox, curveBBoxes_);
+    // grid Partition, only the grids crossed by moved curves are rewritten when few curves moved since last frame
+    spatialIndex_.Refresh(curveBBoxes_, canvasBBox);
+    const auto& nodes = spatialIndex_.GetNodes();
+    for (uint32_t leaf : spatialIndex_.GetLeaves()) {
+        ProcessFinalGrid(nodes[leaf], height);
     }
 }
 
@@ -1020,30 +985,18 @@ Box4f GEContourDiagonalFlowLightShader::ComputeCurveBoundingBox(
     return {minX, maxX, minY, maxY};
 }
 
-void GEContourDiagonalFlowLightShader::InitializeWorkQueue(
-    const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue)
+void GEContourDiagonalFlowLightShader::ProcessFinalGrid(const GECurveSpatialIndex::Node& leaf, int height)
 {
-    // init root grid
-    std::vector<int> initialCurves;
-    for (size_t i = 0; i < numCurves_; ++i) {
-        if (IntersectBBox(canvasBBox, curveBBoxes[i])) {
-            initialCurves.push_back(i);
-        }
-    }
-    workQueue.push({canvasBBox, initialCurves});
-}
-
-void GEContourDiagonalFlowLightShader::ProcessFinalGrid(
-    Grid& current, const std::vector<Box4f>& curveBBoxes, int height)
-{
-    Grid processedGrid = current;
     std::vector<float> gridCurves;
     std::vector<float> inOrderSeg;
     constexpr int slidingWindowLen = 4; // curve 3 point(6 value), slidingWindowLen is 4
+    gridCurves.reserve(leaf.indexCount * 6); // 6: values per curve
+    inOrderSeg.reserve(leaf.indexCount);
     // since only a partial image is captured, the following shifts need to be applied.
-    float xShift = 2*processedGrid.bbox[0] / static_cast<float>(height);
-    float yShift = 2*processedGrid.bbox[2] / static_cast<float>(height);
-    for (int idx : processedGrid.curveIndices) {
+    float xShift = 2*leaf.bbox[0] / static_cast<float>(height);
+    float yShift = 2*leaf.bbox[2] / static_cast<float>(height);
+    for (auto it = spatialIndex_.CurvesBegin(leaf); it != spatialIndex_.CurvesEnd(leaf); ++it) {
+        size_t idx = *it;
         gridCurves.push_back(controlPoints_[slidingWindowLen * idx] - xShift);      // start point x
         gridCurves.push_back(controlPoints_[slidingWindowLen * idx + 1] - yShift);  // start point y
         gridCurves.push_back(controlPoints_[slidingWindowLen * idx + 2] - xShift);  // 2:control point x
@@ -1052,18 +1005,18 @@ void GEContourDiagonalFlowLightShader::ProcessFinalGrid(
             controlPoints_.size()] - xShift);
         gridCurves.push_back(controlPoints_[(slidingWindowLen * idx + 5) % // 5:end point y
             controlPoints_.size()] - yShift);
-        
+
         inOrderSeg.push_back(static_cast<float>(idx));
     }
-    curvesInGrid_.push_back(std::make_pair(gridCurves, processedGrid));
-    segmentIndex_.push_back(inOrderSeg);
+    curvesInGrid_.emplace_back(std::move(gridCurves), leaf.bbox);
+    segmentIndex_.push_back(std::move(inOrderSeg));
 }
 
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GEContourDiagonalFlowLightShader::GetContourDiagonalFlowLightBuilder()
 {
     thread_local std::shared_ptr<Drawing::RuntimeEffect> contourDiagonalFlowLightShaderEffect_ = nullptr;
     if (contourDiagonalFlowLightShaderEffect_ == nullptr) {
-        contourDiagonalFlowLightShaderEffect_ = GECreateRuntimeEffectForShader(FLOW_LIGHT_PROG);
+        contourDiagonalFlowLightShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(FLOW_LIGHT_PROG);
     }
 
     if (contourDiagonalFlowLightShaderEffect_ == nullptr) {
@@ -1351,7 +1304,7 @@ std::shared_ptr<Drawing::Image> GEContourDiagonalFlowLightShader::BlendImg(Drawi
     }
     thread_local std::shared_ptr<Drawing::RuntimeEffect> blendShaderEffect_ = nullptr;
     if (blendShaderEffect_ == nullptr) {
-        blendShaderEffect_ = GECreateRuntimeEffectForShader(BLEND_IMG_PROG);
+        blendShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(BLEND_IMG_PROG);
     }
     if (blendShaderEffect_ == nullptr) {
         GE_LOGE("GEContourDiagonalFlowLightShader contourDiagonalFlowLightShaderEffect_ is nullptr.");
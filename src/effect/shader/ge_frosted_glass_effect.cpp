@@ -18,8 +18,9 @@
 #include <cmath>
 #include "ge_log.h"
 #include "ge_visual_effect_impl.h"
+#include "ge_sdf_evaluation_cache.h"
 #include "ge_sdf_rrect_shader_shape.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -406,7 +407,7 @@ void GEFrostedGlassEffect::MakeDrawingShader(Drawing::Canvas& canvas, const Draw
 bool GEFrostedGlassEffect::InitFrostedGlassEffect()
 {
     if (g_frostedGlassShaderEffect == nullptr) {
-        g_frostedGlassShaderEffect = GECreateRuntimeEffectForShader(MAIN_SHADER_PROG);
+        g_frostedGlassShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(MAIN_SHADER_PROG);
         if (g_frostedGlassShaderEffect == nullptr) {
             GE_LOGE("InitFrostedGlassEffect::RuntimeShader effect error\n");
             return false;
@@ -419,7 +420,8 @@ std::shared_ptr<Drawing::ShaderEffect> GEFrostedGlassEffect::MakeSDFNormalShader
     float width, float height)
 {
     if (auto shape = frostedGlassEffectParams_.sdfShape) {
-        return shape->GenerateDrawingShaderHasNormal(canvas, width, height);
+        return Drawing::GESDFEvaluationCache::GetShader(shape, canvas, width, height,
+            Drawing::Rect(0.0f, 0.0f, width, height), true);
     }
     return nullptr;
 }
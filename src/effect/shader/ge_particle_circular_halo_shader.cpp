@@ -15,7 +15,7 @@
 
 #include "ge_log.h"
 #include "ge_particle_circular_halo_shader.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_visual_effect_impl.h"
 
 namespace OHOS {
@@ -526,7 +526,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEParticleCircularHaloShader::Get
     thread_local std::shared_ptr<Drawing::RuntimeEffect> glowHaloEffect = nullptr;
 
     if (glowHaloEffect == nullptr) {
-        glowHaloEffect = GECreateRuntimeEffectForShader(GLOW_HALO_PROG);
+        glowHaloEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(GLOW_HALO_PROG);
     }
     if (glowHaloEffect == nullptr) {
         GE_LOGE("GEParticleCircularHaloShader::GetGlowHaloBuilder glowHaloEffect is nullptr.");
@@ -540,7 +540,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEParticleCircularHaloShader::Get
     thread_local std::shared_ptr<Drawing::RuntimeEffect> singleParticleHaloEffect = nullptr;
 
     if (singleParticleHaloEffect == nullptr) {
-        singleParticleHaloEffect = GECreateRuntimeEffectForShader(SINGLE_PARTICLE_HALO_PROG);
+        singleParticleHaloEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SINGLE_PARTICLE_HALO_PROG);
     }
     if (singleParticleHaloEffect == nullptr) {
         GE_LOGE("GEParticleCircularHaloShader::GetParticleHaloBuilder singleParticleHaloEffect is "
@@ -555,7 +555,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEParticleCircularHaloShader::Get
     thread_local std::shared_ptr<Drawing::RuntimeEffect> particleHaloEffect = nullptr;
 
     if (particleHaloEffect == nullptr) {
-        particleHaloEffect = GECreateRuntimeEffectForShader(PARTICLE_HALO_PROG);
+        particleHaloEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(PARTICLE_HALO_PROG);
     }
     if (particleHaloEffect == nullptr) {
         GE_LOGE("GEParticleCircularHaloShader::GetParticleHaloBuilder particleHaloEffect is "
@@ -570,7 +570,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEParticleCircularHaloShader::Get
     thread_local std::shared_ptr<Drawing::RuntimeEffect> glowHaloEffect = nullptr;
 
     if (glowHaloEffect == nullptr) {
-        glowHaloEffect = GECreateRuntimeEffectForShader(MAIN_SHADER_PROG);
+        glowHaloEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(MAIN_SHADER_PROG);
     }
     if (glowHaloEffect == nullptr) {
         GE_LOGE("GEParticleCircularHaloShader:: GetParticleCircularHaloBuilder glowHaloEffect is nullptr.");
@@ -15,10 +15,12 @@
 
 #include "ge_sdf_edge_light_shader.h"
 
+#include <algorithm>
 #include <unordered_map>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_evaluation_cache.h"
 
 namespace OHOS::Rosen {
 namespace {
@@ -152,7 +154,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFEdgeLightShader::GetEffectSh
     thread_local std::shared_ptr<Drawing::RuntimeEffect> effectShader_ = nullptr;
 
     if (effectShader_ == nullptr) {
-        effectShader_ = GECreateRuntimeEffectForShader(SHADER);
+        effectShader_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SHADER);
     }
 
     if (effectShader_ == nullptr) {
@@ -163,7 +165,12 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFEdgeLightShader::GetEffectSh
     auto width = canvasInfo_.geoWidth;
     auto height = canvasInfo_.geoHeight;
 
-    auto sdfShader = params_.sdfShape->GenerateDrawingShader(canvas, width, height);
+    // The thin border and the bloom fade out within their widths of the edge
+    Drawing::GESDFPrecisionHint hint;
+    hint.maxDistance = std::max({ params_.maxBorderWidth, params_.innerBorderBloomWidth,
+        params_.outerBorderBloomWidth, 1.0f });
+    auto sdfShader = Drawing::GESDFEvaluationCache::GetShader(params_.sdfShape, canvas, width, height, rect, false,
+        hint);
     if (sdfShader == nullptr) {
         LOGE("GESDFEdgeLightShader::GetEffectShaderBuilder sdfShader is nullptr");
         return nullptr;
@@ -98,6 +98,25 @@ bool GEShader::TryDrawShaderWithPen(Drawing::Canvas& canvas, const Drawing::Rect
     return true;
 }
 
+void GEShader::DrawRectWithoutInner(Drawing::Canvas& canvas, const Drawing::Rect& outerRect,
+    const Drawing::Rect& innerRect)
+{
+    Drawing::RectI outer(floor(outerRect.GetLeft()), floor(outerRect.GetTop()),
+        ceil(outerRect.GetRight()), ceil(outerRect.GetBottom()));
+    Drawing::RectI inner(ceil(innerRect.GetLeft()), ceil(innerRect.GetTop()),
+        floor(innerRect.GetRight()), floor(innerRect.GetBottom()));
+    if (!innerRect.IsValid() || inner.GetWidth() <= 0 || inner.GetHeight() <= 0) {
+        canvas.DrawRect(outerRect);
+        return;
+    }
+    Drawing::Region ringRegion;
+    ringRegion.SetRect(outer);
+    Drawing::Region innerRegion;
+    innerRegion.SetRect(inner);
+    ringRegion.Op(innerRegion, Drawing::RegionOp::DIFFERENCE);
+    canvas.DrawRegion(ringRegion);
+}
+
 void GEShader::MakeDrawingShader(Drawing::Canvas& canvas, const Drawing::Rect& rect, float progress)
 {
     MakeDrawingShader(rect, progress);
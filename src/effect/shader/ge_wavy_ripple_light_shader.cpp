@@ -14,7 +14,7 @@
  */
 #include <algorithm>
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_wavy_ripple_light_shader.h"
 
 namespace OHOS {
@@ -95,7 +95,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GEWavyRippleLightShader::GetWavyR
                 return vec4(color, mask);
             }
         )";
-        wavyRippleLightShaderEffect_ = GECreateRuntimeEffectForShader(prog);
+        wavyRippleLightShaderEffect_ = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     }
 
     if (wavyRippleLightShaderEffect_ == nullptr) {
@@ -17,12 +17,15 @@
 
 #include "ge_log.h"
 #include "ge_sdf_border_shader.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_sdf_evaluation_cache.h"
+#include "ge_runtime_effect_registry.h"
 
 
 namespace OHOS {
 namespace Rosen {
 static constexpr float SDF_BORDER_MIN_THRESHOLD = 0.0001f;
+static constexpr float SDF_BORDER_AA_WIDTH = 1.0f; // Antialiasing ramp of the border edges
+static constexpr float SDF_BORDER_INNER_SHRINK = 1.0f;
 
 GESDFBorderShader::GESDFBorderShader(const Drawing::GESDFBorderShaderParams& params) : params_(params)
 {}
@@ -40,13 +43,41 @@ void GESDFBorderShader::OnDrawShader(Drawing::Canvas& canvas, const Drawing::Rec
     if (shader == nullptr) {
         return;
     }
+    Drawing::Rect bandRect = rect;
+    Drawing::Rect innerRect;
+    if (!GetBorderBand(bandRect, innerRect)) {
+        return;
+    }
     Drawing::Brush brush;
     brush.SetShaderEffect(shader);
     canvas.AttachBrush(brush);
-    canvas.DrawRect(rect);
+    DrawRectWithoutInner(canvas, bandRect, innerRect);
     canvas.DetachBrush();
 }
 
+bool GESDFBorderShader::GetBorderBand(Drawing::Rect& rect, Drawing::Rect& innerRect) const
+{
+    if (!params_.shape) {
+        return true;
+    }
+    // Inner borders cover -(width + aa) < d < 0 and outlines 0 <= d <= width + aa, nothing else is drawn
+    float bandWidth = std::max(params_.border.width, SDF_BORDER_MIN_THRESHOLD) + SDF_BORDER_AA_WIDTH;
+    Drawing::Rect boundingRect;
+    if (params_.shape->GetBoundingRect(boundingRect)) {
+        float outset = params_.border.isOutline ? bandWidth + SDF_BORDER_AA_WIDTH : SDF_BORDER_AA_WIDTH;
+        boundingRect.MakeOutset(outset, outset);
+        if (!rect.Intersect(boundingRect)) {
+            return false;
+        }
+    }
+    // Points inside the inscribed rect are at least as deep as their distance to its edges
+    if (params_.shape->GetInscribedRect(innerRect)) {
+        float inset = (params_.border.isOutline ? 0.0f : bandWidth) + SDF_BORDER_INNER_SHRINK;
+        innerRect.MakeOutset(-inset, -inset);
+    }
+    return true;
+}
+
 std::shared_ptr<Drawing::ShaderEffect> GESDFBorderShader::MakeSDFBorderShader(Drawing::Canvas& canvas,
     const Drawing::Rect &rect)
 {
@@ -61,7 +92,10 @@ std::shared_ptr<Drawing::ShaderEffect> GESDFBorderShader::MakeSDFBorderShader(Dr
         return nullptr;
     }
 
-    auto sdfShader = params_.shape->GenerateDrawingShader(canvas, width, height);
+    // Both border kinds only read distances up to the border width and its outer ramp
+    Drawing::GESDFPrecisionHint hint;
+    hint.maxDistance = std::max(params_.border.width, SDF_BORDER_MIN_THRESHOLD) + SDF_BORDER_AA_WIDTH;
+    auto sdfShader = Drawing::GESDFEvaluationCache::GetShader(params_.shape, canvas, width, height, rect, false, hint);
     if (sdfShader == nullptr) {
         GE_LOGE("GESDFBorderShader: failed generate GESDFBorderShader.");
         return nullptr;
@@ -90,13 +124,13 @@ std::shared_ptr<Drawing::RuntimeEffect> GESDFBorderShader::GetSDFBorderEffect()
     if (params_.border.isOutline) {
         thread_local std::shared_ptr<Drawing::RuntimeEffect> sdfOutlineBorderEffect = nullptr;
         if (sdfOutlineBorderEffect == nullptr) {
-            sdfOutlineBorderEffect = GECreateRuntimeEffectForShader(outlineShaderCode_);
+            sdfOutlineBorderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(outlineShaderCode_);
         }
         return sdfOutlineBorderEffect;
     } else {
         thread_local std::shared_ptr<Drawing::RuntimeEffect> sdfBorderEffect = nullptr;
         if (sdfBorderEffect == nullptr) {
-            sdfBorderEffect = GECreateRuntimeEffectForShader(shaderCode_);
+            sdfBorderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderCode_);
         }
         return sdfBorderEffect;
     }
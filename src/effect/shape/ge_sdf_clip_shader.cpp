@@ -17,12 +17,18 @@
 
 #include "ge_log.h"
 #include "ge_sdf_clip_shader.h"
+#include "ge_sdf_evaluation_cache.h"
 #include "ge_sdf_shader_shape.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_trace.h"
 
 namespace OHOS {
 namespace Rosen {
+namespace {
+constexpr float INNER_REGION_SHRINK = 1.0f;
+constexpr float BOUNDS_MARGIN = 1.0f; // Pixels straddling the bounds are shaded, not cleared
+constexpr float SDF_CLIP_AA_WIDTH = 1.0f; // Edge ramp of the clip, the only distances it reads
+} // namespace
 
 GESDFClipShader::GESDFClipShader(const Drawing::GESDFClipShaderParams& params) : params_(params)
 {}
@@ -44,31 +50,37 @@ void GESDFClipShader::OnDrawShader(Drawing::Canvas& canvas, const Drawing::Rect&
         GE_TRACE_NAME_FMT("GESDFClipShader::OnDrawShader, normal type");
     }
     brush.SetBlendMode(Drawing::BlendMode::DST_IN);
+    Drawing::Rect bandRect = rect;
+    if (shader && !ClearOutsideBounds(canvas, brush, bandRect)) {
+        return;
+    }
     brush.SetShaderEffect(shader);
     canvas.AttachBrush(brush);
     Drawing::Rect inscribedRect;
     bool ringDrawValid = shader && params_.shape && params_.shape->GetInscribedRect(inscribedRect);
     if (ringDrawValid) {
-        Drawing::Region outerRegion;
-        outerRegion.SetRect(Drawing::RectI(
-            floor(rect.GetLeft()),
-            floor(rect.GetTop()),
-            ceil(rect.GetRight()),
-            ceil(rect.GetBottom())));
-        const int innerRegionShrink = 1;
-        Drawing::Region innerRegion;
-        innerRegion.SetRect(Drawing::RectI(
-            ceil(inscribedRect.GetLeft()) + innerRegionShrink,
-            ceil(inscribedRect.GetTop()) + innerRegionShrink,
-            floor(inscribedRect.GetRight()) - innerRegionShrink,
-            floor(inscribedRect.GetBottom())- innerRegionShrink));
-        Drawing::Region ringRegion(outerRegion);
-        ringRegion.Op(innerRegion, Drawing::RegionOp::DIFFERENCE);
-        canvas.DrawRegion(ringRegion);
+        inscribedRect.MakeOutset(-INNER_REGION_SHRINK, -INNER_REGION_SHRINK);
+        DrawRectWithoutInner(canvas, bandRect, inscribedRect);
     } else {
-        canvas.DrawRect(rect);
+        canvas.DrawRect(bandRect);
+    }
+    canvas.DetachBrush();
+}
+
+bool GESDFClipShader::ClearOutsideBounds(Drawing::Canvas& canvas, const Drawing::Brush& brush, Drawing::Rect& rect)
+{
+    Drawing::Rect boundingRect;
+    if (!params_.shape || !params_.shape->GetBoundingRect(boundingRect)) {
+        return true;
     }
+    // Clipping keeps nothing outside the shape, a transparent color clears there without evaluating the distance
+    boundingRect.MakeOutset(BOUNDS_MARGIN, BOUNDS_MARGIN);
+    Drawing::Brush clearBrush(brush);
+    clearBrush.SetColor(Drawing::Color::COLOR_TRANSPARENT);
+    canvas.AttachBrush(clearBrush);
+    DrawRectWithoutInner(canvas, rect, boundingRect);
     canvas.DetachBrush();
+    return rect.Intersect(boundingRect);
 }
 
 void GESDFClipShader::MakeDrawingShader(Drawing::Canvas& canvas, const Drawing::Rect& rect, float progress)
@@ -88,9 +100,11 @@ std::shared_ptr<Drawing::ShaderEffect> GESDFClipShader::MakeSDFClipShader(Drawin
         return nullptr;
     }
     GE_TRACE_NAME_FMT("GESDFClipShader::GetSDFClipEffect, normal type");
-    auto sdfShader = params_.shape->GenerateDrawingShader(canvas,
+    Drawing::GESDFPrecisionHint hint;
+    hint.maxDistance = SDF_CLIP_AA_WIDTH;
+    auto sdfShader = Drawing::GESDFEvaluationCache::GetShader(params_.shape, canvas,
         canvasInfo_.geoWidth != 0 ? canvasInfo_.geoWidth : rect.GetWidth(),
-        canvasInfo_.geoHeight != 0 ? canvasInfo_.geoHeight : rect.GetHeight());
+        canvasInfo_.geoHeight != 0 ? canvasInfo_.geoHeight : rect.GetHeight(), rect, false, hint);
     if (sdfShader == nullptr) {
         GE_LOGE("GESDFClipShader: failed generate GESDFClipShader.");
         return nullptr;
@@ -117,7 +131,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GESDFClipShader::GetSDFClipEffect()
     Drawing::RuntimeEffectOptions reo;
     reo.useHighpLocalCoords = true;
     if (sdfClipShader == nullptr) {
-        sdfClipShader = GECreateRuntimeEffectForShader(shaderCode_, reo);
+        sdfClipShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderCode_, reo);
     }
     return sdfClipShader;
 }
@@ -17,9 +17,13 @@
  
 #include "ge_log.h"
 #include "ge_sdf_color_shader.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_sdf_evaluation_cache.h"
+#include "ge_runtime_effect_registry.h"
 namespace OHOS {
 namespace Rosen {
+namespace {
+constexpr float SDF_COLOR_AA_WIDTH = 1.0f;
+} // namespace
 
 GESDFColorShader::GESDFColorShader(const Drawing::GESDFColorShaderParams& params) : params_(params)
 {}
@@ -32,10 +36,19 @@ void GESDFColorShader::OnDrawShader(Drawing::Canvas& canvas, const Drawing::Rect
     if (shader == nullptr) {
         return;
     }
+    // Only negative distances are colored, plus the antialiasing pixel around them
+    Drawing::Rect drawRect = rect;
+    Drawing::Rect boundingRect;
+    if (params_.shape && params_.shape->GetBoundingRect(boundingRect)) {
+        boundingRect.MakeOutset(SDF_COLOR_AA_WIDTH, SDF_COLOR_AA_WIDTH);
+        if (!drawRect.Intersect(boundingRect)) {
+            return;
+        }
+    }
     Drawing::Brush brush;
     brush.SetShaderEffect(shader);
     canvas.AttachBrush(brush);
-    canvas.DrawRect(rect);
+    canvas.DrawRect(drawRect);
     canvas.DetachBrush();
 }
 
@@ -56,7 +69,10 @@ std::shared_ptr<Drawing::ShaderEffect> GESDFColorShader::MakeSDFColorShader(Draw
         return nullptr;
     }
 
-    auto sdfShader = params_.shape->GenerateDrawingShader(canvas, rect.GetWidth(), rect.GetHeight());
+    Drawing::GESDFPrecisionHint hint;
+    hint.maxDistance = SDF_COLOR_AA_WIDTH;
+    auto sdfShader = Drawing::GESDFEvaluationCache::GetShader(params_.shape, canvas, rect.GetWidth(), rect.GetHeight(),
+        rect, false, hint);
     if (sdfShader == nullptr) {
         GE_LOGE("GESDFColorShader: failed generate GESDFColorShader.");
         return nullptr;
@@ -83,7 +99,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GESDFColorShader::GetSDFColorEffect()
 {
     thread_local std::shared_ptr<Drawing::RuntimeEffect> sdfColorShader = nullptr;
     if (sdfColorShader == nullptr) {
-        sdfColorShader = GECreateRuntimeEffectForShader(shaderCode_);
+        sdfColorShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderCode_);
     }
     return sdfColorShader;
 }
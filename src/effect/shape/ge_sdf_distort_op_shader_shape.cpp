@@ -16,7 +16,8 @@
 #include "ge_sdf_distort_op_shader_shape.h"
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_shape_compiler.h"
 #include "ge_trace.h"
 
 namespace OHOS {
@@ -34,6 +35,9 @@ static constexpr int INDEX_BOTTOM = 3;
 std::shared_ptr<ShaderEffect> GESDFDistortOpShaderShape::GenerateDrawingShader(float width, float height) const
 {
     GE_TRACE_NAME_FMT("GESDFDistortOpShaderShape::GenerateDrawingShader, Width: %g, Height: %g", width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, false)) {
+        return flatShader;
+    }
     auto shapeShader = params_.shape ? params_.shape->GenerateDrawingShader(width, height) : nullptr;
     if (!shapeShader) {
         return nullptr;
@@ -45,6 +49,9 @@ std::shared_ptr<ShaderEffect> GESDFDistortOpShaderShape::GenerateDrawingShaderHa
 {
     GE_TRACE_NAME_FMT("GESDFDistortOpShaderShape::GenerateDrawingShaderHasNormal, Width: %g, Height: %g",
         width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, true)) {
+        return flatShader;
+    }
     auto shapeShader = params_.shape ? params_.shape->GenerateDrawingShaderHasNormal(width, height) : nullptr;
     if (!shapeShader) {
         return nullptr;
@@ -59,6 +66,13 @@ void GESDFDistortOpShaderShape::Preprocess(Canvas& canvas, const Rect& rect, boo
     }
 }
 
+void GESDFDistortOpShaderShape::SetPrecisionHint(const GESDFPrecisionHint& hint)
+{
+    if (params_.shape) {
+        params_.shape->SetPrecisionHint(hint);
+    }
+}
+
 std::shared_ptr<ShaderEffect> GESDFDistortOpShaderShape::GenerateDistortOpDrawingShader(
     std::shared_ptr<ShaderEffect> shapeShader, bool hasNormal, float width, float height) const
 {
@@ -156,7 +170,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFDistortOpShaderShape::GetSDF
 
     Drawing::RuntimeEffectOptions reo;
     reo.useHighpLocalCoords = true;
-    auto sdfDistortShaderBuilderEffect = GECreateRuntimeEffectForShader(SHADER, reo);
+    auto sdfDistortShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SHADER, reo);
     if (!sdfDistortShaderBuilderEffect) {
         LOGE("GESDFDistortOpShaderShape::GetSDFDistortBuilder effect error");
         return nullptr;
@@ -188,8 +202,7 @@ std::shared_ptr<ShaderEffect> GESDFDistortOpShaderShape::GenerateDistortShaderEf
     return sdfDistortShapeShader;
 }
 
-void GESDFDistortOpShaderShape::ComputeAndSetUniforms(
-    const std::shared_ptr<Drawing::RuntimeShaderBuilder>& builder) const
+GESDFDistortOpShaderShape::DistortUniforms GESDFDistortOpShaderShape::ComputeUniforms() const
 {
     const float luX = params_.LUCorner.GetX();
     const float luY = params_.LUCorner.GetY();
@@ -205,38 +218,51 @@ void GESDFDistortOpShaderShape::ComputeAndSetUniforms(
     };
 
     // Precompute constants used by inverse bilinear mapping.
-    const float ex = ruX - luX;
-    const float ey = ruY - luY;
-    const float fx = lbX - luX;
-    const float fy = lbY - luY;
-    const float gx = luX - ruX + rbX - lbX;
-    const float gy = luY - ruY + rbY - lbY;
-
-    const float k2 = Cross2d(gx, gy, fx, fy);
+    DistortUniforms uniforms;
+    uniforms.lu[0] = luX;
+    uniforms.lu[1] = luY;
+    uniforms.e[0] = ruX - luX;
+    uniforms.e[1] = ruY - luY;
+    uniforms.f[0] = lbX - luX;
+    uniforms.f[1] = lbY - luY;
+    uniforms.g[0] = luX - ruX + rbX - lbX;
+    uniforms.g[1] = luY - ruY + rbY - lbY;
+
+    const float k2 = Cross2d(uniforms.g[0], uniforms.g[1], uniforms.f[0], uniforms.f[1]);
     const float safeK2 = (std::abs(k2) > EPSILON) ? k2 : ((k2 >= 0.0f) ? EPSILON : -EPSILON);
-    const float ik2 = 0.5f / safeK2; // Keep the original formula v = (-k1 ± w) * 0.5 / k2
-    const float k1Base = Cross2d(ex, ey, fx, fy) - Cross2d(luX, luY, gx, gy);
-    const float k0Base = -Cross2d(luX, luY, ex, ey);
-
-    builder->SetUniform("lu", luX, luY);
-    builder->SetUniform("e", ex, ey);
-    builder->SetUniform("f", fx, fy);
-    builder->SetUniform("g", gx, gy);
-    builder->SetUniform("k2", k2);
-    builder->SetUniform("ik2", ik2);
-    builder->SetUniform("k1Base", k1Base);
-    builder->SetUniform("k0Base", k0Base);
-
-    const int barrelDistortionSize = 4;
-    float barrelDistortion[] = {params_.barrelDistortion[INDEX_LEFT], params_.barrelDistortion[INDEX_RIGHT],
-        params_.barrelDistortion[INDEX_TOP], params_.barrelDistortion[INDEX_BOTTOM]};
-    builder->SetUniform("barrelDistortion", barrelDistortion, barrelDistortionSize);
-
-    const float distortionEnable = (std::abs(params_.barrelDistortion[INDEX_LEFT]) > EPSILON ||
+    uniforms.k2 = k2;
+    uniforms.ik2 = 0.5f / safeK2; // Keep the original formula v = (-k1 ± w) * 0.5 / k2
+    uniforms.k1Base = Cross2d(uniforms.e[0], uniforms.e[1], uniforms.f[0], uniforms.f[1]) -
+        Cross2d(luX, luY, uniforms.g[0], uniforms.g[1]);
+    uniforms.k0Base = -Cross2d(luX, luY, uniforms.e[0], uniforms.e[1]);
+
+    uniforms.barrelDistortion[INDEX_LEFT] = params_.barrelDistortion[INDEX_LEFT];
+    uniforms.barrelDistortion[INDEX_RIGHT] = params_.barrelDistortion[INDEX_RIGHT];
+    uniforms.barrelDistortion[INDEX_TOP] = params_.barrelDistortion[INDEX_TOP];
+    uniforms.barrelDistortion[INDEX_BOTTOM] = params_.barrelDistortion[INDEX_BOTTOM];
+    uniforms.distortionEnable = (std::abs(params_.barrelDistortion[INDEX_LEFT]) > EPSILON ||
         std::abs(params_.barrelDistortion[INDEX_RIGHT]) > EPSILON ||
         std::abs(params_.barrelDistortion[INDEX_TOP]) > EPSILON ||
         std::abs(params_.barrelDistortion[INDEX_BOTTOM]) > EPSILON) ? 1.0f : 0.0f;
-    builder->SetUniform("distortionEnable", distortionEnable);
+    return uniforms;
+}
+
+void GESDFDistortOpShaderShape::ComputeAndSetUniforms(
+    const std::shared_ptr<Drawing::RuntimeShaderBuilder>& builder) const
+{
+    DistortUniforms uniforms = ComputeUniforms();
+    builder->SetUniform("lu", uniforms.lu[0], uniforms.lu[1]);
+    builder->SetUniform("e", uniforms.e[0], uniforms.e[1]);
+    builder->SetUniform("f", uniforms.f[0], uniforms.f[1]);
+    builder->SetUniform("g", uniforms.g[0], uniforms.g[1]);
+    builder->SetUniform("k2", uniforms.k2);
+    builder->SetUniform("ik2", uniforms.ik2);
+    builder->SetUniform("k1Base", uniforms.k1Base);
+    builder->SetUniform("k0Base", uniforms.k0Base);
+
+    const int barrelDistortionSize = 4;
+    builder->SetUniform("barrelDistortion", uniforms.barrelDistortion, barrelDistortionSize);
+    builder->SetUniform("distortionEnable", uniforms.distortionEnable);
 }
 
 bool GESDFDistortOpShaderShape::HasType(const GESDFShapeType type) const
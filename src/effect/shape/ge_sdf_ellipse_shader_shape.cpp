@@ -16,7 +16,7 @@
 #include "ge_sdf_ellipse_shader_shape.h"
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_trace.h"
 
 namespace OHOS {
@@ -138,7 +138,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFEllipseShaderShape::GetSDFEl
         }
     )";
 
-    auto sdfEllipseShaderBuilderEffect = GECreateRuntimeEffectForShader(prog);
+    auto sdfEllipseShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!sdfEllipseShaderBuilderEffect) {
         LOGE("GESDFEllipseShaderShape::GetSDFEllipseShaderShapeBuilder effect error");
         return nullptr;
@@ -155,7 +155,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFEllipseShaderShape::GetSDFEl
         return sdfEllipseNormalShaderShapeBuilder;
     }
 
-    auto sdfEllipseNormalShaderBuilderEffect = GECreateRuntimeEffectForShader(SDF_GRAD_PROG);
+    auto sdfEllipseNormalShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SDF_GRAD_PROG);
     if (!sdfEllipseNormalShaderBuilderEffect) {
         LOGE("GESDFEllipseShaderShape::GetSDFEllipseNormalShapeBuilder effect error");
         return nullptr;
@@ -196,6 +196,15 @@ bool GESDFEllipseShaderShape::TryGetCenterAndHalfSize(float& outX, float& outY,
     shapeHalfSize = Vector2f(params_.width * 0.5f, params_.height * 0.5f);
     return true;
 }
+
+bool GESDFEllipseShaderShape::GetBoundingRect(Rect& rect)
+{
+    float halfWidth = params_.width * 0.5f;
+    float halfHeight = params_.height * 0.5f;
+    rect = Rect(params_.center.x_ - halfWidth, params_.center.y_ - halfHeight,
+        params_.center.x_ + halfWidth, params_.center.y_ + halfHeight);
+    return true;
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
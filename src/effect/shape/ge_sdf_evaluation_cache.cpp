@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_sdf_evaluation_cache.h"
+
+#include <cmath>
+
+#include "ge_log.h"
+#include "ge_system_properties.h"
+#include "ge_trace.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+std::shared_ptr<ShaderEffect> GenerateShapeShader(GESDFShaderShape& shape, Canvas& canvas, float width,
+    float height, bool hasNormal, const GESDFPrecisionHint& hint)
+{
+    bool hinted = hint != GESDFPrecisionHint {};
+    if (hinted) {
+        shape.SetPrecisionHint(hint);
+    }
+    auto shader = hasNormal ? shape.GenerateDrawingShaderHasNormal(canvas, width, height) :
+        shape.GenerateDrawingShader(canvas, width, height);
+    if (hinted) {
+        shape.SetPrecisionHint({});
+    }
+    return shader;
+}
+
+bool ContainsRect(const RectI& outer, const Rect& inner)
+{
+    return outer.GetLeft() <= inner.GetLeft() && outer.GetTop() <= inner.GetTop() &&
+        outer.GetRight() >= inner.GetRight() && outer.GetBottom() >= inner.GetBottom();
+}
+} // namespace
+
+GESDFEvaluationCache::FrameState& GESDFEvaluationCache::GetFrameState()
+{
+    thread_local FrameState state;
+    return state;
+}
+
+void GESDFEvaluationCache::BeginFrame()
+{
+    GetFrameState().depth++;
+}
+
+void GESDFEvaluationCache::EndFrame()
+{
+    auto& state = GetFrameState();
+    if (state.depth == 0) {
+        LOGE("GESDFEvaluationCache::EndFrame without BeginFrame");
+        return;
+    }
+    if (--state.depth == 0) {
+        state.entries.clear();
+    }
+}
+
+bool GESDFEvaluationCache::IsInFrame()
+{
+    return GetFrameState().depth > 0;
+}
+
+size_t GESDFEvaluationCache::GetEntryCount()
+{
+    return GetFrameState().entries.size();
+}
+
+std::shared_ptr<ShaderEffect> GESDFEvaluationCache::GetShader(const std::shared_ptr<GESDFShaderShape>& shape,
+    Canvas& canvas, float width, float height, const Rect& sampleRect, bool hasNormal, const GESDFPrecisionHint& hint)
+{
+    if (shape == nullptr) {
+        return nullptr;
+    }
+    auto& state = GetFrameState();
+    const void* context = canvas.GetGPUContext().get();
+    if (state.depth == 0 || context == nullptr || !sampleRect.IsValid() || !IsEnabled()) {
+        return GenerateShapeShader(*shape, canvas, width, height, hasNormal, hint);
+    }
+
+    for (auto& entry : state.entries) {
+        if (entry.shape != shape || entry.hash != shape->GetHash() || entry.context != context ||
+            entry.width != width || entry.height != height) {
+            continue;
+        }
+        if (entry.image != nullptr && ContainsRect(entry.imageArea, sampleRect)) {
+            return MakeSampler(entry);
+        }
+        entry.sampleRect.Join(sampleRect);
+        if (RasterizeEntry(entry, canvas)) {
+            return MakeSampler(entry);
+        }
+        return GenerateShapeShader(*shape, canvas, width, height, hasNormal, hint);
+    }
+
+    if (state.entries.size() < MAX_ENTRIES) {
+        Entry entry;
+        entry.shape = shape;
+        entry.hash = shape->GetHash();
+        entry.width = width;
+        entry.height = height;
+        entry.context = context;
+        entry.sampleRect = sampleRect;
+        state.entries.push_back(std::move(entry));
+    }
+    return GenerateShapeShader(*shape, canvas, width, height, hasNormal, hint);
+}
+
+bool GESDFEvaluationCache::RasterizeEntry(Entry& entry, Canvas& canvas)
+{
+    const auto& rect = entry.sampleRect;
+    // Rounded out so the linear sampler always has both neighbours of a sampled point
+    RectI area(static_cast<int>(std::floor(rect.GetLeft())) - 1, static_cast<int>(std::floor(rect.GetTop())) - 1,
+        static_cast<int>(std::ceil(rect.GetRight())) + 1, static_cast<int>(std::ceil(rect.GetBottom())) + 1);
+    entry.image = nullptr;
+    if (area.GetWidth() > MAX_TEXTURE_SIZE || area.GetHeight() > MAX_TEXTURE_SIZE) {
+        return false;
+    }
+    GE_TRACE_NAME_FMT("GESDFEvaluationCache::RasterizeEntry, Width: %d, Height: %d",
+        area.GetWidth(), area.GetHeight());
+    // The normal variant serves both kinds of consumer, the distance is in alpha either way
+    entry.image = entry.shape->MakeSDFImage(canvas, entry.width, entry.height, area, true);
+    if (entry.image == nullptr) {
+        GE_LOGE("GESDFEvaluationCache::RasterizeEntry make SDFImage is null");
+        return false;
+    }
+    entry.imageArea = area;
+    return true;
+}
+
+std::shared_ptr<ShaderEffect> GESDFEvaluationCache::MakeSampler(const Entry& entry)
+{
+    Matrix sampleMatrix;
+    sampleMatrix.Translate(entry.imageArea.GetLeft(), entry.imageArea.GetTop());
+    return ShaderEffect::CreateImageShader(*entry.image, TileMode::CLAMP, TileMode::CLAMP,
+        SamplingOptions(FilterMode::LINEAR), sampleMatrix);
+}
+
+bool GESDFEvaluationCache::IsEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.sdfevalcache", "1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 1) != 0;
+#else
+    return true;
+#endif
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
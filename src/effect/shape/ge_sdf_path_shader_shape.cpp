@@ -17,16 +17,26 @@
 
 #include <algorithm>
 #include <cmath>
-#include <cstdlib>
+#include <cstring>
+#include <iterator>
 #include <limits>
+#include <mutex>
 #include <stack>
 #include <string>
 #include <vector>
 
 #include "common/rs_common_def.h"
+#include "draw/path_iterator.h"
 #include "draw/surface.h"
+#include "ge_cache_helper.h"
+#include "ge_image_cache_provider.h"
 #include "ge_log.h"
+#include "ge_multi_cache_provider.h"
+#include "ge_params_hasher.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_cpu_generator.h"
 #include "ge_trace.h"
+#include "image/bitmap.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -50,103 +60,134 @@ constexpr float MIDPOINT_FACTOR = 0.5f;     // factor for calculating midpoint
 constexpr float MAX_ASPECT = 3.0f;          // Large aspect ratio difference
 constexpr float ALIGN_STEP = 8.0f;          // ceil the width and height of the downsampled components
 
-bool IntersectBBox(const Box4f& a, const Box4f& b)
+Drawing::ImageInfo MakeOffscreenImageInfo(Drawing::Canvas& canvas, const Drawing::Rect& rect)
 {
-    return !(a[XMAX_I] < b[XMIN_I] || a[XMIN_I] > b[XMAX_I] || a[YMAX_I] < b[YMIN_I] || a[YMIN_I] > b[YMAX_I]);
+    auto* canvasSurface = canvas.GetSurface();
+    auto colorSpace = canvasSurface ? canvasSurface->GetImageInfo().GetColorSpace() : nullptr;
+    return {rect.GetWidth(), rect.GetHeight(), RGBA_F16, Drawing::AlphaType::ALPHATYPE_OPAQUE, colorSpace};
 }
 
-// 150.0f: default base width, 250.0f: default base height
-std::vector<Vector2f> ConvertPixelToNDC(const std::vector<Vector2f>& pixelPoints, float baseWidth = 150.0f,
-    float baseHeight = 250.0f)
+// Normal sampling step of NORMAL_CALCULATION_SHADER, 1 + clamp(|sdf| * NORMAL_STEP_SCALE, 0, NORMAL_MAX_EXTRA_STEP)
+constexpr float NORMAL_STEP_SCALE = 0.2f;
+constexpr float NORMAL_MAX_EXTRA_STEP = 8.0f;
+constexpr float NORMAL_MIN_LENGTH = 0.00001f;
+constexpr size_t RGBA_CHANNELS = 4;
+
+// Nearest IEEE half float, ties away from zero, overflowing to infinity and underflowing to zero
+uint16_t FloatToHalf(float value)
 {
-    if (baseWidth < 1.0f || baseHeight < 1.0f) { // 1.0f is minimum pixel size
-        return {};
-    }
-    std::vector<Vector2f> ndcPoints;
-    ndcPoints.reserve(pixelPoints.size());
-    for (const auto& p : pixelPoints) {
-        float normalizedX = p[0] / baseWidth;
-        float normalizedY = p[1] / baseHeight; // 1 is index of y in point
-        float ndcX = (normalizedX * NDC_MULTIPLIER - NDC_OFFSET) * (baseWidth / baseHeight);
-        float ndcY = normalizedY * NDC_MULTIPLIER - NDC_OFFSET;
-        ndcPoints.emplace_back(ndcX, ndcY);
-    }
-    return ndcPoints;
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000u); // 16: sign bit of a half
+    int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xffu) - 127 + 15; // 23, 127, 15: float and half layouts
+    uint32_t mantissa = bits & 0x7fffffu;
+    if (exponent >= 31) { // 31: infinity exponent of a half
+        return static_cast<uint16_t>(sign | 0x7c00u);
+    }
+    if (exponent <= 0) {
+        if (exponent < -10) { // -10: below the smallest subnormal half
+            return sign;
+        }
+        mantissa |= 0x800000u; // Implicit leading bit
+        uint32_t shift = static_cast<uint32_t>(14 - exponent); // 14: 23 - 10 mantissa bits + 1
+        return static_cast<uint16_t>(sign | ((mantissa + (1u << (shift - 1))) >> shift));
+    }
+    // A rounding carry out of the mantissa correctly bumps the exponent
+    uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13); // 10, 13: half mantissa bits
+    return static_cast<uint16_t>(sign | (half + ((mantissa >> 12) & 1u)));      // 12: first dropped bit
 }
 
-void ConvertPointsToFloats(const std::vector<Vector2f>& in, std::vector<float>& out)
+// Cross-frame distance field cache, 8MB holds a few full-screen F16 fields of a typical path area
+constexpr size_t SDF_CACHE_BYTE_BUDGET = 8 * 1024 * 1024;
+constexpr size_t SDF_CACHE_MAX_ENTRIES = 32;
+
+struct DistanceFieldCacheStore {
+    std::mutex mutex;
+    GEMultiCacheProvider provider { SDF_CACHE_BYTE_BUDGET, SDF_CACHE_MAX_ENTRIES };
+};
+
+DistanceFieldCacheStore& GetDistanceFieldCacheStore()
 {
-    out.clear();
-    for (auto& p : in) {
-        out.push_back(p[0]);
-        out.push_back(p[1]);
-    }
+    static DistanceFieldCacheStore store;
+    return store;
 }
 
-Drawing::ImageInfo MakeOffscreenImageInfo(Drawing::Canvas& canvas, const Drawing::Rect& rect)
+// Conics are split into 2^CONIC_QUAD_POW2 quadratics, close enough for the SDF of rounded corners and arcs
+constexpr uint32_t CONIC_QUAD_POW2 = 2;
+constexpr size_t PATH_ITER_POINTS = 4;
+
+template <typename SegmentFunc>
+void AddConicAsQuads(const Vector2f& p0, const Vector2f& p1, const Vector2f& p2, float weight, uint32_t pow2,
+    SegmentFunc& onSegment)
 {
-    auto* canvasSurface = canvas.GetSurface();
-    auto colorSpace = canvasSurface ? canvasSurface->GetImageInfo().GetColorSpace() : nullptr;
-    return {rect.GetWidth(), rect.GetHeight(), RGBA_F16, Drawing::AlphaType::ALPHATYPE_OPAQUE, colorSpace};
+    if (pow2 == 0 || ROSEN_EQ(weight, 1.0f)) {
+        Vector2f quad[] = { p0, p1, p2 };
+        onSegment(quad, std::size(quad));
+        return;
+    }
+    // Split at t = 0.5 in homogeneous coordinates, both halves get the same weight
+    float scale = 1.0f / (1.0f + weight);
+    float halfWeight = std::sqrt(MIDPOINT_FACTOR + weight * MIDPOINT_FACTOR);
+    Vector2f wp1 = { p1.x_ * weight, p1.y_ * weight };
+    Vector2f mid = { (p0.x_ + NDC_MULTIPLIER * wp1.x_ + p2.x_) * scale * MIDPOINT_FACTOR,
+        (p0.y_ + NDC_MULTIPLIER * wp1.y_ + p2.y_) * scale * MIDPOINT_FACTOR };
+    Vector2f control0 = { (p0.x_ + wp1.x_) * scale, (p0.y_ + wp1.y_) * scale };
+    Vector2f control1 = { (wp1.x_ + p2.x_) * scale, (wp1.y_ + p2.y_) * scale };
+    AddConicAsQuads(p0, control0, mid, halfWeight, pow2 - 1, onSegment);
+    AddConicAsQuads(mid, control1, p2, halfWeight, pow2 - 1, onSegment);
 }
 
-using AddCurveSegment =
-    std::function<void(std::vector<std::vector<Vector2f>>& result, std::vector<float>& numbers, Vector2f& currentPos)>;
-static std::unordered_map<char, AddCurveSegment> addCurveSegmentMap_ = {
-    { 'M', // M is the start of a path
-        [](std::vector<std::vector<Vector2f>>& result, std::vector<float>& numbers, Vector2f& currentPos) {
-            if (numbers.size() < 2) { // 2: the number size of one point
-                LOGE("AddCurveSegment: M command requires 2 numbers");
-                return;
-            }
-            currentPos = Vector2f(numbers[0], numbers[1]);
-        } },
-    { 'L', // L is liner segment
-        [](std::vector<std::vector<Vector2f>>& result, std::vector<float>& numbers, Vector2f& currentPos) {
-            if (numbers.size() < 2) { // 2: the number size of liner
-                LOGE("AddCurveSegment: L command requires 2 numbers");
-                return;
+// Walk the verbs of path and report each segment as its points: 2 for lines, 3 for quadratics and 4 for cubics.
+// Conics are reported as quadratics, contours are closed with a line back to their start point.
+template <typename SegmentFunc>
+void ForEachPathSegment(const Drawing::Path& path, SegmentFunc&& onSegment)
+{
+    Drawing::PathIterator iter(path);
+    Drawing::Point pts[PATH_ITER_POINTS];
+    Vector2f contourStart;
+    Vector2f currentPos;
+    auto toVector = [&pts](size_t index) { return Vector2f(pts[index].GetX(), pts[index].GetY()); };
+    for (auto verb = iter.Next(pts); verb != Drawing::PathVerb::DONE; verb = iter.Next(pts)) {
+        switch (verb) {
+            case Drawing::PathVerb::MOVE:
+                contourStart = toVector(0);
+                currentPos = contourStart;
+                break;
+            case Drawing::PathVerb::LINE: {
+                Vector2f line[] = { currentPos, toVector(1) };
+                onSegment(line, std::size(line));
+                currentPos = line[1];
+                break;
             }
-            std::vector<Vector2f> segment;
-            segment.push_back(currentPos);             // start point of curve (end point of the previous curve)
-            Vector2f end = { numbers[0], numbers[1] }; // end point
-            segment.push_back(end);
-            currentPos = end;
-            result.push_back(segment);
-        } },
-    { 'Q', // Q is quadratic bezier curve
-        [](std::vector<std::vector<Vector2f>>& result, std::vector<float>& numbers, Vector2f& currentPos) {
-            if (numbers.size() < 4) { // 4: the number size of quadratic bezier curve
-                LOGE("AddCurveSegment: Q command requires 4 numbers");
-                return;
+            case Drawing::PathVerb::QUAD: {
+                Vector2f quad[] = { currentPos, toVector(1), toVector(2) }; // 2: end point
+                onSegment(quad, std::size(quad));
+                currentPos = quad[2]; // 2: end point
+                break;
             }
-            std::vector<Vector2f> segment;
-            segment.push_back(currentPos);                 // start point of curve (end point of the previous curve)
-            segment.push_back({ numbers[0], numbers[1] }); // control point
-            Vector2f end = { numbers[2], numbers[3] };     // end point
-            segment.push_back(end);
-            currentPos = end;
-            result.push_back(segment);
-        } },
-    { 'C', // C is cubic bezier cuerve
-        [](std::vector<std::vector<Vector2f>>& result, std::vector<float>& numbers, Vector2f& currentPos) {
-            if (numbers.size() < 6) { // 6: the number size of cubic bezier cuerve
-                LOGE("AddCurveSegment: C command requires 6 numbers");
-                return;
+            case Drawing::PathVerb::CONIC:
+                AddConicAsQuads(currentPos, toVector(1), toVector(2), iter.ConicWeight(), CONIC_QUAD_POW2,
+                    onSegment); // 2: end point
+                currentPos = toVector(2); // 2: end point
+                break;
+            case Drawing::PathVerb::CUBIC: {
+                Vector2f cubic[] = { currentPos, toVector(1), toVector(2), toVector(3) }; // 2, 3: control, end point
+                onSegment(cubic, std::size(cubic));
+                currentPos = cubic[3]; // 3: end point
+                break;
             }
-            std::vector<Vector2f> segment;
-            segment.push_back(currentPos);                 // start point of curve (end point of the previous curve)
-            segment.push_back({ numbers[0], numbers[1] }); // first control point
-            segment.push_back({ numbers[2], numbers[3] }); // second control point
-            Vector2f end = { numbers[4], numbers[5] };     // end point
-            segment.push_back(end);
-            currentPos = end;
-            result.push_back(segment);
-        } },
-    { 'Z', // Z M is the end of a path
-        [](std::vector<std::vector<Vector2f>>& result, std::vector<float>& numbers,
-               Vector2f& currentPos) { LOGD("AddCurveSegment: Z a path ends"); } }
-};
+            case Drawing::PathVerb::CLOSE:
+                if (!ROSEN_EQ(currentPos.x_, contourStart.x_) || !ROSEN_EQ(currentPos.y_, contourStart.y_)) {
+                    Vector2f line[] = { currentPos, contourStart };
+                    onSegment(line, std::size(line));
+                }
+                currentPos = contourStart;
+                break;
+            default:
+                break;
+        }
+    }
+}
 } // namespace
 
 static const std::string SDF_PROPAGATION_SHADER = R"(
@@ -488,71 +529,6 @@ static const std::string CLEAR_INF_SHADER = R"(
     }
 )";
 
-thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_precalcShaderEffect_ = nullptr;
-thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_normalShaderEffect_ = nullptr;
-thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_sdfPropEffect_ = nullptr;
-thread_local static std::shared_ptr<Drawing::RuntimeEffect> g_clearInfEffect = nullptr;
-
-static std::optional<double> convertStringToDouble(const std::string& str)
-{
-    char* end = nullptr;
-    errno = 0;
-    double val = strtod(str.c_str(), &end);
-    if (end == str) {
-        LOGE("Conversion failed: No valid number.");
-        return std::nullopt;
-    }
-    if (errno == ERANGE) {
-        LOGE("Conversion overflow or underflow.");
-        return std::nullopt;
-    }
-    return val;
-}
-
-static std::vector<float> parseNumbers(const std::string& s, size_t& i)
-{
-    std::vector<float> result;
-    while (i < s.length()) {
-        // Skip spaces
-        while (i < s.length() && std::isspace(s[i])) {
-            i++;
-        }
-        if (i >= s.length()) {
-            break;
-        }
-
-        // check whether it is the next command (letter).
-        char c = static_cast<char>(std::toupper(s[i]));
-        if (std::isalpha(c) && !(i + 1 < s.length() && (s[i + 1] == '-' || std::isdigit(s[i + 1])))) {
-            LOGD("next command: %{public}c", c);
-            break;
-        }
-
-        // Parse a number
-        size_t start = i;
-        bool hasDigits = false;
-        while (i < s.length() && (std::isdigit(s[i]) || s[i] == '-' || s[i] == '.')) {
-            if (std::isdigit(s[i])) {
-                hasDigits = true;
-            }
-            i++;
-        }
-
-        if (!hasDigits || i == start) {
-            break;
-        }
-
-        // converting numbers
-        auto optVal = convertStringToDouble(s.substr(start, i - start));
-        if (!optVal.has_value()) {
-            break;
-        }
-        double val = optVal.value();
-        result.push_back(static_cast<float>(val));
-    }
-    return result;
-}
-
 std::vector<std::vector<Vector2f>> GESDFPathShaderShape::GetCurveByPath(const Drawing::Path& path)
 {
     GE_TRACE_NAME_FMT("GESDFPathShaderShape::GetCurveByPath");
@@ -561,68 +537,63 @@ std::vector<std::vector<Vector2f>> GESDFPathShaderShape::GetCurveByPath(const Dr
         LOGE("GESDFPathShaderShape::GetCurveByPath: path is invalid.");
         return result;
     }
-    std::string svgPath = path.ConvertToSVGString();
-    Vector2f currentPos; // Curren position is
-
-    size_t i = 0;
-    while (i < svgPath.length()) {
-        // Skip spaces
-        while (i < svgPath.length() && std::isspace(svgPath[i])) {
-            i++;
-        }
-        if (i >= svgPath.length()) {
-            break;
-        }
+    ForEachPathSegment(path, [&result](const Vector2f* points, size_t count) {
+        result.emplace_back(points, points + count);
+    });
+    return result;
+}
 
-        char cmd = static_cast<char>(std::toupper(svgPath[i]));
-        i++;
-        // Read the corresponding number of digits according to the letters
-        std::vector<float> numbers = parseNumbers(svgPath, i);
-        auto it = addCurveSegmentMap_.find(cmd);
-        if (it != addCurveSegmentMap_.end()) {
-            it->second(result, numbers, currentPos);
-        } else {
-            LOGE("The %{public}c is not supported", cmd);
-            continue;
+size_t GESDFPathShaderShape::GetQuadCurvesByPath(const Drawing::Path& path, GESDFPathCurves& curves)
+{
+    GE_TRACE_NAME_FMT("GESDFPathShaderShape::GetQuadCurvesByPath");
+    if (!path.IsValid()) {
+        LOGE("GESDFPathShaderShape::GetQuadCurvesByPath: path is invalid.");
+        return 0;
+    }
+    size_t oldSize = curves.Size();
+    ForEachPathSegment(path, [&curves](const Vector2f* points, size_t count) {
+        if (count == LINE) {
+            curves.Add(points[0], points[0], points[1]);
+        } else if (count == 3) { // 3 is size of QUADRATIC BEZIER
+            curves.Add(points[0], points[1], points[2]); // 1, 2: control point and end point
+        } else if (count == 4) { // 4 is size of CUBIC BEZIER
+            Vector2f controlPoint = points[1]; // 1 is index
+            // 0, 2, 3 is index of CUBIC BEZIER
+            cubicToQuadraticSingle(points[0], controlPoint, points[2], points[3]);
+            curves.Add(points[0], controlPoint, points[3]); // 3 is index of CUBIC BEZIER
         }
-    }
-    return result;
+    });
+    return curves.Size() - oldSize;
 }
 
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFPathShaderShape::MakePrecalcShaderBuilder()
 {
-    if (g_precalcShaderEffect_ == nullptr) {
-        g_precalcShaderEffect_ = RuntimeEffect::CreateForShader(PRECALCULATION_FOR_SDF_SHADER);
-        if (g_precalcShaderEffect_ == nullptr) {
-            LOGE("GESDFPathShaderShape::MakePrecalcShaderBuilder failed to create effect");
-            return nullptr;
-        }
+    auto effect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(PRECALCULATION_FOR_SDF_SHADER);
+    if (effect == nullptr) {
+        LOGE("GESDFPathShaderShape::MakePrecalcShaderBuilder failed to create effect");
+        return nullptr;
     }
-    return std::make_shared<Drawing::RuntimeShaderBuilder>(g_precalcShaderEffect_);
+    return std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
 }
 
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFPathShaderShape::MakeNormalShaderBuilder()
 {
-    if (g_normalShaderEffect_ == nullptr) {
-        g_normalShaderEffect_ = RuntimeEffect::CreateForShader(NORMAL_CALCULATION_SHADER);
-        if (g_normalShaderEffect_ == nullptr) {
-            LOGE("GESDFPathShaderShape::MakeNormalShaderBuilder failed to create effect");
-            return nullptr;
-        }
+    auto effect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(NORMAL_CALCULATION_SHADER);
+    if (effect == nullptr) {
+        LOGE("GESDFPathShaderShape::MakeNormalShaderBuilder failed to create effect");
+        return nullptr;
     }
-    return std::make_shared<Drawing::RuntimeShaderBuilder>(g_normalShaderEffect_);
+    return std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
 }
 
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFPathShaderShape::MakeSdfPropShaderBuilder()
 {
-    if (g_sdfPropEffect_ == nullptr) {
-        g_sdfPropEffect_ = RuntimeEffect::CreateForShader(SDF_PROPAGATION_SHADER);
-        if (g_sdfPropEffect_ == nullptr) {
-            LOGE("GESDFPathShaderShape::MakeSdfPropShaderBuilder failed to create effect");
-            return nullptr;
-        }
+    auto effect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SDF_PROPAGATION_SHADER);
+    if (effect == nullptr) {
+        LOGE("GESDFPathShaderShape::MakeSdfPropShaderBuilder failed to create effect");
+        return nullptr;
     }
-    return std::make_shared<Drawing::RuntimeShaderBuilder>(g_sdfPropEffect_);
+    return std::make_shared<Drawing::RuntimeShaderBuilder>(effect);
 }
 
 std::shared_ptr<Image> GESDFPathShaderShape::RunSDFPropagation(
@@ -732,15 +703,13 @@ void GESDFPathShaderShape::CreateSurfaceAndCanvas(Drawing::Canvas& canvas, const
         offscreenCanvas_->DrawRect(rect);
         offscreenCanvas_->DetachBrush();
     };
-    if (!g_clearInfEffect) {
-        g_clearInfEffect = RuntimeEffect::CreateForShader(CLEAR_INF_SHADER);
-        if (!g_clearInfEffect) {
-            LOGE("GESDFPathShaderShape::CreateSurfaceAndCanvas CreateForShader failed");
-            FallbackClear();
-            return;
-        }
+    auto clearInfEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(CLEAR_INF_SHADER);
+    if (!clearInfEffect) {
+        LOGE("GESDFPathShaderShape::CreateSurfaceAndCanvas CreateForShader failed");
+        FallbackClear();
+        return;
     }
-    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(g_clearInfEffect);
+    auto builder = std::make_shared<Drawing::RuntimeShaderBuilder>(clearInfEffect);
     if (!builder) {
         LOGE("GESDFPathShaderShape::CreateSurfaceAndCanvas create builder failed");
         FallbackClear();
@@ -759,7 +728,17 @@ void GESDFPathShaderShape::CreateSurfaceAndCanvas(Drawing::Canvas& canvas, const
     offscreenCanvas_->DetachBrush();
 }
 
-void GESDFPathShaderShape::AutoGridPartition(float width, float height, const std::vector<Vector2f>& pixelControlPoints)
+GECurveSpatialIndex::Config GESDFPathShaderShape::MakeSpatialIndexConfig()
+{
+    GECurveSpatialIndex::Config config;
+    config.maxCurvesPerLeaf = 4; // 4: max curves per grid
+    config.minNodeSize = MIN_GRID_SIZE;
+    config.splitEitherSide = true;
+    config.halveThinNodes = true;
+    return config;
+}
+
+void GESDFPathShaderShape::AutoGridPartition(float width, float height)
 {
     GE_TRACE_NAME_FMT("GESDFPathShaderShape::AutoGridPartition");
     if (width < MIN_SCALE_CLAMP || height < MIN_SCALE_CLAMP) {
@@ -767,80 +746,35 @@ void GESDFPathShaderShape::AutoGridPartition(float width, float height, const st
         return;
     }
     curvesInGrid_.clear();
-    allGridsCovered_ = true;
-    maxEmptyGridShortSide_ = 0.0f;
+    segmentIndex_.clear();
 
-    std::vector<Box4f> curveBBoxes;
     Box4f canvasBBox;
-    ComputeAllCurveBoundingBoxes(width, height, pixelControlPoints, canvasBBox, curveBBoxes);
-
-    std::queue<Grid> workQueue;
-    InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-
-    while (!workQueue.empty()) {
-        Grid current = workQueue.front();
-        workQueue.pop();
-        float w = current.bbox[XMAX_I] - current.bbox[XMIN_I];
-        float h = current.bbox[YMAX_I] - current.bbox[YMIN_I];
-        bool needsSplit = (current.curveIndices.size() > 4) && // 4: max curves per grid
-                          (w > MIN_GRID_SIZE || h > MIN_GRID_SIZE);
-        if (needsSplit) {
-            SplitGrid(current, curveBBoxes, workQueue, MIN_GRID_SIZE);
-        } else {
-            ProcessFinalGrid(current, curveBBoxes);
-        }
+    ComputeAllCurveBoundingBoxes(width, height, canvasBBox, curveBBoxes_);
+    // Animated paths often move a few segments per frame, the index then only rewrites the cells they cross
+    spatialIndex_.Refresh(curveBBoxes_, canvasBBox);
+    UpdateEmptyGridStats();
+
+    const auto& nodes = spatialIndex_.GetNodes();
+    for (uint32_t leaf : spatialIndex_.GetLeaves()) {
+        ProcessFinalGrid(nodes[leaf]);
     }
 }
 
-void GESDFPathShaderShape::SplitGrid(
-    const Grid& current, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue, float minGridSize)
+void GESDFPathShaderShape::UpdateEmptyGridStats()
 {
-    GE_TRACE_NAME_FMT("GESDFPathShaderShape::SplitGrid");
-    float midX = (current.bbox[XMIN_I] + current.bbox[XMAX_I]) * MIDPOINT_FACTOR;
-    float midY = (current.bbox[YMIN_I] + current.bbox[YMAX_I]) * MIDPOINT_FACTOR;
-
-    // Divide into four quadrants
-    std::vector<Box4f> quadrants = {
-        { current.bbox[XMIN_I], midX, current.bbox[YMIN_I], midY }, // Top-Left
-        { midX, current.bbox[XMAX_I], current.bbox[YMIN_I], midY }, // Top-Right
-        { current.bbox[XMIN_I], midX, midY, current.bbox[YMAX_I] }, // Bottom-Left
-        { midX, current.bbox[XMAX_I], midY, current.bbox[YMAX_I] }  // Bottom-Right
-    };
-
-    if (current.bbox[XMAX_I] - current.bbox[XMIN_I] <= MIN_GRID_SIZE) {
-        quadrants = {
-            { current.bbox[XMIN_I], current.bbox[XMAX_I], current.bbox[YMIN_I], midY }, // Top
-            { current.bbox[XMIN_I], current.bbox[XMAX_I], midY, current.bbox[YMAX_I] }  // Bottom
-        };
-    } else if (current.bbox[YMAX_I] - current.bbox[YMIN_I] <= MIN_GRID_SIZE) {
-        quadrants = {
-            { current.bbox[XMIN_I], midX, current.bbox[YMIN_I], current.bbox[YMAX_I] }, // Left
-            { midX, current.bbox[XMAX_I], current.bbox[YMIN_I], current.bbox[YMAX_I] }  // Right
-        };
-    }
-
-    for (const auto& quad : quadrants) {
-        Grid child { quad, {} };
-        for (int idx : current.curveIndices) {
-            if (IntersectBBox(child.bbox, curveBBoxes[idx])) {
-                child.curveIndices.push_back(idx);
-            }
-        }
-        if (!child.curveIndices.empty()) {
-            workQueue.push(child);
-        } else {
-            allGridsCovered_ = false;
-            float side = std::min(quad[XMAX_I] - quad[XMIN_I],
-                                  quad[YMAX_I] - quad[YMIN_I]);
-            if (side > maxEmptyGridShortSide_ && side < canvasMinSide_ * 0.25f) { // 0.25: Corresponds to 2 partitions
-                maxEmptyGridShortSide_ = side;
-            }
+    const auto& emptyCells = spatialIndex_.GetEmptyCells();
+    allGridsCovered_ = emptyCells.empty();
+    maxEmptyGridShortSide_ = 0.0f;
+    for (const auto& cell : emptyCells) {
+        float side = std::min(cell[XMAX_I] - cell[XMIN_I], cell[YMAX_I] - cell[YMIN_I]);
+        if (side > maxEmptyGridShortSide_ && side < canvasMinSide_ * 0.25f) { // 0.25: Corresponds to 2 partitions
+            maxEmptyGridShortSide_ = side;
         }
     }
 }
 
 void GESDFPathShaderShape::ComputeAllCurveBoundingBoxes(float width, float height,
-    const std::vector<Vector2f>& pixelControlPoints, Box4f& canvasBBox, std::vector<Box4f>& curveBBoxes)
+    Box4f& canvasBBox, std::vector<Box4f>& curveBBoxes)
 {
     GE_TRACE_NAME_FMT("GESDFPathShaderShape::ComputeAllCurveBoundingBoxes");
     curveBBoxes.clear();
@@ -848,7 +782,7 @@ void GESDFPathShaderShape::ComputeAllCurveBoundingBoxes(float width, float heigh
     canvasBBox = { width, 0.0f, height, 0.0f };
     float maxThickness = 0.05f / NDC_MULTIPLIER * height; // 0.05f: Expanding the bounding box in NDC space
     for (size_t i = 0; i < numCurves_; ++i) {
-        Box4f bbox = ComputeCurveBoundingBox(i, maxThickness, pixelControlPoints, width, height);
+        Box4f bbox = ComputeCurveBoundingBox(i, maxThickness, width, height);
         curveBBoxes.push_back(bbox);
         canvasBBox[XMIN_I] = std::min(bbox[XMIN_I], canvasBBox[XMIN_I]);
         canvasBBox[XMAX_I] = std::max(bbox[XMAX_I], canvasBBox[XMAX_I]);
@@ -867,49 +801,38 @@ void GESDFPathShaderShape::ComputeAllCurveBoundingBoxes(float width, float heigh
 }
 
 Box4f GESDFPathShaderShape::ComputeCurveBoundingBox(size_t curveIndex, float maxThickness,
-    const std::vector<Vector2f>& pixelControlPoints, float width, float height)
+    float width, float height)
 {
-    size_t baseIdx = curveIndex * 3; // 3:Three control points of a quadratic curve
-    Vector2f A = pixelControlPoints[baseIdx]; // startPoint
-    Vector2f B = pixelControlPoints[baseIdx + 1]; // controlPoint
-    Vector2f C = pixelControlPoints[baseIdx + 2]; // endPoint
-
-    float minX = std::max(std::floor(std::min({A[0], B[0], C[0]}) - maxThickness), 0.0f);
-    float maxX = std::min(std::ceil(std::max({A[0], B[0], C[0]}) + maxThickness), width);
-    float minY = std::max(std::floor(std::min({A[1], B[1], C[1]}) - maxThickness), 0.0f);
-    float maxY = std::min(std::ceil(std::max({A[1], B[1], C[1]}) + maxThickness), height);
+    // start point, control point and end point of the quadratic curve
+    float ax = curves_.startX[curveIndex];
+    float bx = curves_.controlX[curveIndex];
+    float cx = curves_.endX[curveIndex];
+    float ay = curves_.startY[curveIndex];
+    float by = curves_.controlY[curveIndex];
+    float cy = curves_.endY[curveIndex];
+
+    float minX = std::max(std::floor(std::min({ax, bx, cx}) - maxThickness), 0.0f);
+    float maxX = std::min(std::ceil(std::max({ax, bx, cx}) + maxThickness), width);
+    float minY = std::max(std::floor(std::min({ay, by, cy}) - maxThickness), 0.0f);
+    float maxY = std::min(std::ceil(std::max({ay, by, cy}) + maxThickness), height);
     return { minX, maxX, minY, maxY };
 }
 
-void GESDFPathShaderShape::InitializeWorkQueue(
-    const Box4f& canvasBBox, const std::vector<Box4f>& curveBBoxes, std::queue<Grid>& workQueue)
-{
-    std::vector<uint32_t> initialCurves(numCurves_);
-    for (size_t i = 0; i < numCurves_; ++i) {
-        initialCurves[i] = i;
-    }
-    workQueue.push({ canvasBBox, initialCurves });
-}
-
-void GESDFPathShaderShape::ProcessFinalGrid(Grid& current, const std::vector<Box4f>& curveBBoxes)
+void GESDFPathShaderShape::ProcessFinalGrid(const GECurveSpatialIndex::Node& leaf)
 {
     GE_TRACE_NAME_FMT("GESDFPathShaderShape::ProcessFinalGrid");
-    Grid processedGrid = current;
     std::vector<float> gridCurves;
     std::vector<float> inOrderSeg;
-    for (size_t idx : processedGrid.curveIndices) {
-        size_t baseIdx = idx * CURVE_FLOAT_COUNT;
- 
-        gridCurves.push_back(controlPoints_[baseIdx]);     // startPoint.x
-        gridCurves.push_back(controlPoints_[baseIdx + 1]); // 1: startPoint.y
-        gridCurves.push_back(controlPoints_[baseIdx + 2]); // 2: controlPoint.x
-        gridCurves.push_back(controlPoints_[baseIdx + 3]); // 3: controlPoint.y
-        gridCurves.push_back(controlPoints_[baseIdx + 4]); // 4: endPoint.x
-        gridCurves.push_back(controlPoints_[baseIdx + 5]); // 5: endPoint.y
-        inOrderSeg.push_back(static_cast<float>(idx));
-    }
-    curvesInGrid_.push_back(std::make_pair(gridCurves, processedGrid));
-    segmentIndex_.push_back(inOrderSeg);
+    gridCurves.reserve(leaf.indexCount * CURVE_FLOAT_COUNT);
+    inOrderSeg.reserve(leaf.indexCount);
+    for (auto it = spatialIndex_.CurvesBegin(leaf); it != spatialIndex_.CurvesEnd(leaf); ++it) {
+        size_t baseIdx = *it * CURVE_FLOAT_COUNT;
+        gridCurves.insert(gridCurves.end(), controlPoints_.begin() + baseIdx,
+            controlPoints_.begin() + baseIdx + CURVE_FLOAT_COUNT); // start, control and end point
+        inOrderSeg.push_back(static_cast<float>(*it));
+    }
+    curvesInGrid_.emplace_back(std::move(gridCurves), leaf.bbox);
+    segmentIndex_.push_back(std::move(inOrderSeg));
 }
 
 Drawing::Path GESDFPathShaderShape::PreparePathForRendering(const Drawing::Rect& rect, float& width, float& height)
@@ -934,34 +857,25 @@ Drawing::Path GESDFPathShaderShape::PreparePathForRendering(const Drawing::Rect&
     return path;
 }
 
-std::vector<Vector2f> GESDFPathShaderShape::ProcessCurveSegments(const std::vector<std::vector<Vector2f>>& paramsCoef)
+void GESDFPathShaderShape::ConvertCurvesToNDC(float width, float height)
 {
-    GE_TRACE_NAME_FMT("GESDFPathShaderShape::ProcessCurveSegments");
-    std::vector<Vector2f> pixelControlPoints;
-    numCurves_ = 0;
-
-    for (auto& segment : paramsCoef) {
-        if (segment.size() == LINE) {
-            pixelControlPoints.push_back(segment[0]);
-            pixelControlPoints.push_back(segment[0]);
-            pixelControlPoints.push_back(segment[1]); // 1 is index
-            numCurves_++;
-        } else if (segment.size() == 3) { // 3 is size of QUADRATIC BEZIER
-            pixelControlPoints.push_back(segment[0]);
-            pixelControlPoints.push_back(segment[1]); // 1 is index
-            pixelControlPoints.push_back(segment[2]); // 2 is index of QUADRATIC BEZIER
-            numCurves_++;
-        } else if (segment.size() == 4) { // 4 is size of CUBIC BEZIER
-            Vector2f controlPoint = segment[1]; // 1 is index
-            // 0, 2, 3 is index of CUBIC BEZIER
-            cubicToQuadraticSingle(segment[0], controlPoint, segment[2], segment[3]);
-            pixelControlPoints.push_back(segment[0]);
-            pixelControlPoints.push_back(controlPoint);
-            pixelControlPoints.push_back(segment[3]); // 3 is index of CUBIC BEZIER
-            numCurves_++;
-        }
+    GE_TRACE_NAME_FMT("GESDFPathShaderShape::ConvertCurvesToNDC");
+    controlPoints_.clear();
+    if (width < 1.0f || height < 1.0f) { // 1.0f is minimum pixel size
+        return;
+    }
+    float aspect = width / height;
+    auto toNDCX = [width, aspect](float x) { return (x / width * NDC_MULTIPLIER - NDC_OFFSET) * aspect; };
+    auto toNDCY = [height](float y) { return y / height * NDC_MULTIPLIER - NDC_OFFSET; };
+    controlPoints_.reserve(numCurves_ * CURVE_FLOAT_COUNT);
+    for (size_t i = 0; i < numCurves_; ++i) {
+        controlPoints_.push_back(toNDCX(curves_.startX[i]));
+        controlPoints_.push_back(toNDCY(curves_.startY[i]));
+        controlPoints_.push_back(toNDCX(curves_.controlX[i]));
+        controlPoints_.push_back(toNDCY(curves_.controlY[i]));
+        controlPoints_.push_back(toNDCX(curves_.endX[i]));
+        controlPoints_.push_back(toNDCY(curves_.endY[i]));
     }
-    return pixelControlPoints;
 }
 
 void GESDFPathShaderShape::ProcessSingleBatch(Drawing::RuntimeShaderBuilder& builder, size_t gridIndex, size_t batch,
@@ -971,7 +885,7 @@ void GESDFPathShaderShape::ProcessSingleBatch(Drawing::RuntimeShaderBuilder& bui
     const auto& grid = curvesInGrid_[gridIndex];
     const auto& allCurves = grid.first;
     const auto& allSegments = segmentIndex_[gridIndex];
-    const Box4f area = grid.second.bbox;
+    const Box4f& area = grid.second;
     const Drawing::Rect rectN(area[XMIN_I], area[YMIN_I], area[XMAX_I], area[YMAX_I]);
 
     std::vector<float> batchCurves;
@@ -1150,6 +1064,10 @@ void GESDFPathShaderShape::UpdateNumPasses(float height)
         return;
     }
     float requiredStep = maxEmptyGridShortSide_ * 0.5f;
+    if (precisionHint_.maxDistance > 0.0f) {
+        // Propagating further only refines distances the consumer treats as far anyway
+        requiredStep = std::min(requiredStep, precisionHint_.maxDistance * params_.scale.y_ * 0.5f);
+    }
     if (requiredStep < 1.0f) {
         requiredStep = 1.0f;
     }
@@ -1158,6 +1076,111 @@ void GESDFPathShaderShape::UpdateNumPasses(float height)
     numPasses_ = static_cast<size_t>(std::clamp(passCount, 1, 6)); // at least 1 times, at most 6 times
 }
 
+void GESDFPathShaderShape::SetDistanceFieldCacheBudget(size_t byteBudget)
+{
+    auto& store = GetDistanceFieldCacheStore();
+    std::lock_guard<std::mutex> lock(store.mutex);
+    store.provider.SetByteBudget(byteBudget);
+}
+
+void GESDFPathShaderShape::ClearDistanceFieldCache()
+{
+    auto& store = GetDistanceFieldCacheStore();
+    std::lock_guard<std::mutex> lock(store.mutex);
+    store.provider.Clear();
+}
+
+uint64_t GESDFPathShaderShape::MakeDistanceFieldCacheKey(
+    Canvas& canvas, const Drawing::Path& path, float width, float height) const
+{
+    GEParamsHasher hasher;
+    // Images are only valid on the context they were made on
+    hasher.Combine(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(canvas.GetGPUContext().get())));
+    hasher.Combine(width);
+    hasher.Combine(height);
+    hasher.Combine(params_.scale);
+    // Fewer propagation passes leave far distances coarser
+    hasher.Combine(precisionHint_.maxDistance);
+    hasher.Combine(static_cast<uint32_t>(path.GetFillStyle()));
+    hasher.Combine(static_cast<uint64_t>(numCurves_));
+    for (const auto* array : { &curves_.startX, &curves_.startY, &curves_.controlX, &curves_.controlY,
+        &curves_.endX, &curves_.endY }) {
+        hasher.Combine(*array);
+    }
+    return hasher.GetResult();
+}
+
+std::shared_ptr<Image> GESDFPathShaderShape::LoadCachedDistanceField(uint64_t key)
+{
+    auto& store = GetDistanceFieldCacheStore();
+    std::lock_guard<std::mutex> lock(store.mutex);
+    const auto* entry = store.provider.GetByKeyAs<GEImageCache>(key);
+    return entry != nullptr ? entry->data : nullptr;
+}
+
+void GESDFPathShaderShape::StoreCachedDistanceField(uint64_t key, const std::shared_ptr<Image>& distanceField)
+{
+    if (distanceField == nullptr) {
+        return;
+    }
+    GEImageCache entry;
+    entry.data = distanceField;
+    auto& store = GetDistanceFieldCacheStore();
+    std::lock_guard<std::mutex> lock(store.mutex);
+    store.provider.StoreByKey(entry, key);
+}
+
+std::shared_ptr<Image> GESDFPathShaderShape::ComputeDistanceFieldOnCpu(
+    const Drawing::Path& path, int width, int height) const
+{
+    GE_TRACE_NAME_FMT("GESDFPathShaderShape::ComputeDistanceFieldOnCpu");
+    GESDFCpuGenerator::Curves curves { curves_.startX.data(), curves_.startY.data(), curves_.controlX.data(),
+        curves_.controlY.data(), curves_.endX.data(), curves_.endY.data(), numCurves_ };
+    auto fillType = path.GetFillStyle();
+    bool evenOdd = fillType == PathFillType::EVENTODD || fillType == PathFillType::INVERSE_EVENTODD;
+    bool inverse = fillType == PathFillType::INVERSE_WINDING || fillType == PathFillType::INVERSE_EVENTODD;
+    std::vector<float> distances;
+    if (!GESDFCpuGenerator::ComputeFromCurves(curves,
+        evenOdd ? GESDFCpuGenerator::FillRule::EVEN_ODD : GESDFCpuGenerator::FillRule::NON_ZERO, width, height,
+        distances)) {
+        LOGE("GESDFPathShaderShape::ComputeDistanceFieldOnCpu failed");
+        return nullptr;
+    }
+
+    Bitmap bitmap;
+    if (!bitmap.Build(ImageInfo(width, height, RGBA_F16, AlphaType::ALPHATYPE_PREMUL)) ||
+        bitmap.GetPixels() == nullptr) {
+        LOGE("GESDFPathShaderShape::ComputeDistanceFieldOnCpu bitmap build failed");
+        return nullptr;
+    }
+    // Same units as ComputeDistanceField, NDC distance times pixelScale
+    float sign = inverse ? -1.0f : 1.0f;
+    float distanceScale = sign * NDC_MULTIPLIER / std::max(params_.scale.y_, MIN_SCALE_CLAMP);
+    auto* pixels = static_cast<uint8_t*>(bitmap.GetPixels());
+    auto rowBytes = static_cast<size_t>(bitmap.GetRowBytes());
+    for (int y = 0; y < height; ++y) {
+        auto* row = reinterpret_cast<uint16_t*>(pixels + static_cast<size_t>(y) * rowBytes);
+        float py = y + MIDPOINT_FACTOR;
+        for (int x = 0; x < width; ++x) {
+            float px = x + MIDPOINT_FACTOR;
+            float centerSdf = distances[static_cast<size_t>(y) * width + x] * distanceScale;
+            float h = 1.0f + std::clamp(std::abs(centerSdf) * NORMAL_STEP_SCALE, 0.0f, NORMAL_MAX_EXTRA_STEP);
+            float nx = GESDFCpuGenerator::Sample(distances, width, height, px + h, py) -
+                GESDFCpuGenerator::Sample(distances, width, height, px - h, py);
+            float ny = GESDFCpuGenerator::Sample(distances, width, height, px, py + h) -
+                GESDFCpuGenerator::Sample(distances, width, height, px, py - h);
+            float len = std::sqrt(nx * nx + ny * ny);
+            float invLen = len > NORMAL_MIN_LENGTH ? sign / len : 0.0f;
+            uint16_t* out = row + static_cast<size_t>(x) * RGBA_CHANNELS;
+            out[0] = FloatToHalf(nx * invLen);
+            out[1] = FloatToHalf(ny * invLen);
+            out[2] = FloatToHalf(0.0f); // 2: blue
+            out[3] = FloatToHalf(centerSdf); // 3: alpha
+        }
+    }
+    return bitmap.MakeImage();
+}
+
 void GESDFPathShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal)
 {
     GE_TRACE_FUNC();
@@ -1166,22 +1189,70 @@ void GESDFPathShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool has
         LOGE("GESDFPathShaderShape::Preprocess: the paths is invalid.");
         return;
     }
+    // A coarse hint only lowers the resolution of this field, the next consumer starts from the requested scale
+    Vector2f requestedScale = params_.scale;
+    bool lowered = ApplyPrecisionHint(params_.scale);
+    PreprocessDistanceField(canvas, rect);
+    if (lowered) {
+        params_.scale = requestedScale;
+    }
+}
+
+bool GESDFPathShaderShape::ApplyPrecisionHint(Vector2f& scale) const
+{
+    // Bilinear sampling of the field is off by up to one texel, so texels up to maxError pixels wide are enough
+    if (precisionHint_.maxError <= 1.0f) {
+        return false;
+    }
+    float hintScale = std::max(1.0f / precisionHint_.maxError, MIN_SCALE_CLAMP);
+    if (hintScale >= scale.x_ && hintScale >= scale.y_) {
+        return false;
+    }
+    GE_TRACE_NAME_FMT("GESDFPathShaderShape::ApplyPrecisionHint, MaxError: %g", precisionHint_.maxError);
+    scale.x_ = std::min(scale.x_, hintScale);
+    scale.y_ = std::min(scale.y_, hintScale);
+    return true;
+}
+
+void GESDFPathShaderShape::PreprocessDistanceField(Canvas& canvas, const Rect& rect)
+{
     float width = 0.0f;
     float height = 0.0f;
     Drawing::Path path = PreparePathForRendering(rect, width, height);
 
-    std::vector<std::vector<Vector2f>> paramsCoef = GetCurveByPath(path);
-    std::vector<Vector2f> pixelControlPoints = ProcessCurveSegments(paramsCoef);
-    if (pixelControlPoints.empty()) {
+    curves_.Clear();
+    numCurves_ = GetQuadCurvesByPath(path, curves_);
+    if (numCurves_ == 0) {
         LOGE("GESDFPathShaderShape::Preprocess: no valid curves.");
         return;
     }
-    // Convert Pixel To NDC
-    std::vector<Vector2f> ndcControlPoints = ConvertPixelToNDC(pixelControlPoints, width, height);
-    ConvertPointsToFloats(ndcControlPoints, controlPoints_);
+    // Same curves at the same size give the same field, skip the partition and all the passes
+    bool useCache = GECacheHelper::IsSDFCacheEnabled(true);
+    uint64_t cacheKey = useCache ? MakeDistanceFieldCacheKey(canvas, path, width, height) : 0;
+    if (useCache) {
+        disResult_ = LoadCachedDistanceField(cacheKey);
+        if (disResult_) {
+            return;
+        }
+    }
+    if (GESDFCpuGenerator::IsEnabled(false)) {
+        disResult_ = ComputeDistanceFieldOnCpu(path, static_cast<int>(width), static_cast<int>(height));
+        if (disResult_) {
+            if (useCache) {
+                StoreCachedDistanceField(cacheKey, disResult_);
+            }
+            return;
+        }
+        LOGE("GESDFPathShaderShape::Preprocess CPU distance field failed, falling back to GPU");
+    }
+    ConvertCurvesToNDC(width, height);
     pointCnt_ = controlPoints_.size();
+    if (controlPoints_.empty()) {
+        LOGE("GESDFPathShaderShape::Preprocess: surface size is invalid.");
+        return;
+    }
 
-    AutoGridPartition(width, height, pixelControlPoints);
+    AutoGridPartition(width, height);
     if (curvesInGrid_.empty()) {
         LOGE("GESDFPathShaderShape::Preprocess: AutoGridPartition failed.");
         return;
@@ -1206,8 +1277,14 @@ void GESDFPathShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool has
         }
     }
     
-    std::shared_ptr<Image> propagatedSdf = RunSDFPropagation(canvas, offscreenSurface_->GetImageSnapshot(),
+    // The grid surface is done with once snapshotted, release it so it is not alive next to the propagation images
+    std::shared_ptr<Image> gridSdf = offscreenSurface_->GetImageSnapshot();
+    offscreenCanvas_ = nullptr;
+    offscreenSurface_ = nullptr;
+    std::shared_ptr<Image> propagatedSdf = RunSDFPropagation(canvas, gridSdf,
         pathImage, static_cast<int>(width), static_cast<int>(height));
+    gridSdf = nullptr;
+    pathImage = nullptr;
 
     disResult_ =
         ComputeDistanceField(canvas, propagatedSdf, static_cast<int>(width), static_cast<int>(height));
@@ -1215,6 +1292,9 @@ void GESDFPathShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool has
         LOGE("GESDFPathShaderShape::Preprocess ComputeDistanceField failed");
         return;
     }
+    if (useCache) {
+        StoreCachedDistanceField(cacheKey, disResult_);
+    }
 }
 
 std::shared_ptr<ShaderEffect> GESDFPathShaderShape::GenerateDrawingShader(float width, float height) const
@@ -1270,6 +1350,19 @@ std::shared_ptr<ShaderEffect> GESDFPathShaderShape::GenerateDrawingShaderHasNorm
     return out;
 }
 
+bool GESDFPathShaderShape::GetBoundingRect(Rect& rect)
+{
+    // Inverse fills are negative everywhere outside the path
+    auto fillType = params_.path.GetFillStyle();
+    if (fillType == PathFillType::INVERSE_WINDING || fillType == PathFillType::INVERSE_EVENTODD) {
+        return false;
+    }
+    // Scale only sets the distance field resolution, the field is sampled back in canvas coordinates
+    rect = params_.path.GetBounds();
+    rect.Offset(params_.offset.x_, params_.offset.y_);
+    return true;
+}
+
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
@@ -18,7 +18,7 @@
 #include <sstream>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_trace.h"
 
 namespace OHOS {
@@ -315,7 +315,8 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFRRectShaderShape::GetUniform
         return uniformSdfRRectShaderShapeBuilder;
     }
 
-    auto uniformSdfRRectShaderBuilderEffect = GECreateRuntimeEffectForShader(UNIFORM_RRECT_SHADER_PROG);
+    auto uniformSdfRRectShaderBuilderEffect =
+        GERuntimeEffectRegistry::GetInstance().GetOrCreate(UNIFORM_RRECT_SHADER_PROG);
     if (!uniformSdfRRectShaderBuilderEffect) {
         LOGE("GESDFRRectShaderShape::GetUniformSDFRRectShaderShapeBuilder effect error");
         return nullptr;
@@ -333,7 +334,8 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFRRectShaderShape::GetUniform
         return uniformSdfRRectNormalShaderShapeBuilder;
     }
 
-    auto uniformSdfRRectNormalShaderBuilderEffect = GECreateRuntimeEffectForShader(UNIFORM_SDF_GRAD_PROG);
+    auto uniformSdfRRectNormalShaderBuilderEffect =
+        GERuntimeEffectRegistry::GetInstance().GetOrCreate(UNIFORM_SDF_GRAD_PROG);
     if (!uniformSdfRRectNormalShaderBuilderEffect) {
         LOGE("GESDFRRectShaderShape::GetUniformSDFRRectNormalShapeBuilder effect error");
         return nullptr;
@@ -351,7 +353,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFRRectShaderShape::GetSDFRRec
         return sdfRRectShaderShapeBuilder;
     }
 
-    auto sdfRRectShaderBuilderEffect = GECreateRuntimeEffectForShader(RRECT_SHADER_PROG);
+    auto sdfRRectShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(RRECT_SHADER_PROG);
     if (!sdfRRectShaderBuilderEffect) {
         LOGE("GESDFRRectShaderShape::GetSDFRRectShaderShapeBuilder effect error");
         return nullptr;
@@ -368,7 +370,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFRRectShaderShape::GetSDFRRec
         return sdfRRectNormalShaderShapeBuilder;
     }
 
-    auto sdfRRectNormalShaderBuilderEffect = GECreateRuntimeEffectForShader(SDF_GRAD_PROG);
+    auto sdfRRectNormalShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SDF_GRAD_PROG);
     if (!sdfRRectNormalShaderBuilderEffect) {
         LOGE("GESDFRRectShaderShape::GettSDFRRectNormalShapeBuilder effect error");
         return nullptr;
@@ -425,6 +427,15 @@ bool GESDFRRectShaderShape::TryGetCenterAndHalfSize(float& outX, float& outY, Ve
     return true;
 }
 
+bool GESDFRRectShaderShape::GetBoundingRect(Rect& rect)
+{
+    const GERRect& rrect = GetRRect();
+    // The distance function extends the half size by EXTEND
+    rect = Rect(rrect.left_ - EXTEND, rrect.top_ - EXTEND,
+        rrect.left_ + rrect.width_ + EXTEND, rrect.top_ + rrect.height_ + EXTEND);
+    return true;
+}
+
 bool GESDFRRectShaderShape::GetInscribedRect(Rect& rect)
 {
     const GERRect& rrect = GetRRect();
@@ -21,7 +21,7 @@
 #include "ge_sdf_sub_op_shader_shape.h"
 #include "ge_sdf_transform_shader_shape.h"
 #include "ge_sdf_union_op_shader_shape.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_log.h"
 
 namespace OHOS {
@@ -104,12 +104,19 @@ bool GESDFShaderShape::TryGetCenterAndHalfSize(float& outX, float& outY, Vector2
 
 std::shared_ptr<Drawing::Image> GESDFShaderShape::MakeSDFImage(Canvas& canvas,
     float width, float height, bool hasNormal)
+{
+    return MakeSDFImage(canvas, width, height,
+        RectI(0, 0, static_cast<int>(width), static_cast<int>(height)), hasNormal);
+}
+
+std::shared_ptr<Drawing::Image> GESDFShaderShape::MakeSDFImage(Canvas& canvas,
+    float width, float height, const RectI& area, bool hasNormal)
 {
     if (g_shapeSDFShaderEffect == nullptr) {
         Drawing::RuntimeEffectOptions reo{};
         reo.needDrawingslToSksl = false;
         reo.useHighpLocalCoords = true;
-        g_shapeSDFShaderEffect = GECreateRuntimeEffectForShader(SHAPE_SDF_PROG, reo);
+        g_shapeSDFShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SHAPE_SDF_PROG, reo);
     }
     if (g_shapeSDFShaderEffect == nullptr) {
         GE_LOGE("GESDFShaderShape::MakeSDFImage create runtime error");
@@ -127,7 +134,8 @@ std::shared_ptr<Drawing::Image> GESDFShaderShape::MakeSDFImage(Canvas& canvas,
     std::shared_ptr<Drawing::ColorSpace> colorSpace = canvasSurface ?
         canvasSurface->GetImageInfo().GetColorSpace() : nullptr;
     Drawing::Matrix makeMatrix;
-    Drawing::ImageInfo imageInfo(width, height, Drawing::ColorType::COLORTYPE_RGBA_F16,
+    makeMatrix.Translate(-area.GetLeft(), -area.GetTop());
+    Drawing::ImageInfo imageInfo(area.GetWidth(), area.GetHeight(), Drawing::ColorType::COLORTYPE_RGBA_F16,
         Drawing::AlphaType::ALPHATYPE_OPAQUE, colorSpace);
     auto context = canvas.GetGPUContext().get();
     return context ? builder->MakeImage(context, &(makeMatrix), imageInfo, false) : nullptr;
@@ -16,14 +16,19 @@
 #include <chrono>
  
 #include "ge_log.h"
+#include "ge_sdf_evaluation_cache.h"
 #include "ge_sdf_shadow_shader.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "common/rs_common_def.h"
 
 namespace OHOS {
 namespace Rosen {
 constexpr float SDF_SHADOW_MIN_THRESHOLD = 0.0001f;
 constexpr float RADIUS_FACTOR = 1.5f;
+constexpr float INNER_REGION_SHRINK = 1.0f;
+constexpr float BOUNDS_MARGIN = 1.0f; // Keeps pixels straddling the shadow bounds
+// Distance error per pixel of falloff width, keeps the alpha error of the falloff around 1/32
+constexpr float SHADOW_MAX_ERROR_RATIO = 1.0f / 32.0f;
 
 // Elevation shadow constants (aligned with Skia SkDrawShadowInfo.h)
 constexpr float DEFAULT_LIGHT_HEIGHT = 600.0f;
@@ -88,34 +93,64 @@ void GESDFShadowShader::OnDrawShader(Drawing::Canvas& canvas, const Drawing::Rec
     if (shader == nullptr) {
         return;
     }
+    Drawing::Rect drawRect = newRect;
+    if (!ClipRectToShadowBounds(drawRect)) {
+        return;
+    }
     Drawing::Brush brush;
     brush.SetShaderEffect(shader);
     canvas.AttachBrush(brush);
     Drawing::Rect inscribedRect;
     bool ringDrawValid = !params_.shadow.isFilled && params_.shape && params_.shape->GetInscribedRect(inscribedRect);
     if (ringDrawValid) {
-        Drawing::Region outerRegion;
-        outerRegion.SetRect(Drawing::RectI(
-            floor(newRect.GetLeft()),
-            floor(newRect.GetTop()),
-            ceil(newRect.GetRight()),
-            ceil(newRect.GetBottom())));
-        const int innerRegionShrink = 1;
-        Drawing::Region innerRegion;
-        innerRegion.SetRect(Drawing::RectI(
-            ceil(inscribedRect.GetLeft()) + innerRegionShrink,
-            ceil(inscribedRect.GetTop()) + innerRegionShrink,
-            floor(inscribedRect.GetRight()) - innerRegionShrink,
-            floor(inscribedRect.GetBottom())- innerRegionShrink));
-        Drawing::Region ringRegion(outerRegion);
-        ringRegion.Op(innerRegion, Drawing::RegionOp::DIFFERENCE);
-        canvas.DrawRegion(ringRegion);
+        inscribedRect.MakeOutset(-INNER_REGION_SHRINK, -INNER_REGION_SHRINK);
+        DrawRectWithoutInner(canvas, drawRect, inscribedRect);
     } else {
-        canvas.DrawRect(newRect);
+        canvas.DrawRect(drawRect);
     }
     canvas.DetachBrush();
 }
 
+bool GESDFShadowShader::ClipRectToShadowBounds(Drawing::Rect& rect) const
+{
+    Drawing::Rect boundingRect;
+    if (!params_.shape || !params_.shape->GetBoundingRect(boundingRect)) {
+        return true;
+    }
+    // The shadow fades out within its extent around the offset shape
+    float extent = GetShadowExtent();
+    boundingRect.Offset(params_.shadow.offsetX, params_.shadow.offsetY);
+    boundingRect.MakeOutset(extent + BOUNDS_MARGIN, extent + BOUNDS_MARGIN);
+    return rect.Intersect(boundingRect);
+}
+
+float GESDFShadowShader::GetShadowExtent() const
+{
+    return IsElevationMode() ? std::max({ambientBlurRadius_, spotBlurRadius_, SDF_SHADOW_MIN_THRESHOLD}) :
+        std::max(params_.shadow.radius * RADIUS_FACTOR, SDF_SHADOW_MIN_THRESHOLD);
+}
+
+Drawing::GESDFPrecisionHint GESDFShadowShader::GetShapePrecisionHint() const
+{
+    Drawing::GESDFPrecisionHint hint;
+    hint.maxDistance = GetShadowExtent() + BOUNDS_MARGIN;
+    // Unfilled shadows cut the shape out with a one pixel ramp
+    if (params_.shadow.isFilled) {
+        float sharpestFalloff = IsElevationMode() ? std::min(ambientBlurRadius_, spotBlurRadius_) : GetShadowExtent();
+        hint.maxError = sharpestFalloff * SHADOW_MAX_ERROR_RATIO;
+    }
+    return hint;
+}
+
+Drawing::Rect GESDFShadowShader::GetShapeSampleRect(const Drawing::Rect& rect) const
+{
+    Drawing::Rect sampleRect = rect;
+    Drawing::Rect offsetRect = rect;
+    offsetRect.Offset(-params_.shadow.offsetX, -params_.shadow.offsetY);
+    sampleRect.Join(offsetRect);
+    return sampleRect;
+}
+
 std::shared_ptr<Drawing::ShaderEffect> GESDFShadowShader::MakeSDFShadowShader(Drawing::Canvas& canvas,
     const Drawing::Rect& rect)
 {
@@ -130,9 +165,10 @@ std::shared_ptr<Drawing::ShaderEffect> GESDFShadowShader::MakeSDFShadowShader(Dr
         return nullptr;
     }
 
-    auto sdfShader = params_.shape->GenerateDrawingShader(canvas,
+    auto sdfShader = Drawing::GESDFEvaluationCache::GetShader(params_.shape, canvas,
         canvasInfo_.geoWidth != 0 ? canvasInfo_.geoWidth : width,
-        canvasInfo_.geoHeight != 0 ? canvasInfo_.geoHeight : height);
+        canvasInfo_.geoHeight != 0 ? canvasInfo_.geoHeight : height, GetShapeSampleRect(rect), false,
+        GetShapePrecisionHint());
     if (sdfShader == nullptr) {
         GE_LOGE("GESDFShadowShader: failed generate GESDFShadowShader.");
         return nullptr;
@@ -165,7 +201,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GESDFShadowShader::GetSDFShadowEffect()
 {
     thread_local std::shared_ptr<Drawing::RuntimeEffect> sdfShadowShader = nullptr;
     if (sdfShadowShader == nullptr) {
-        sdfShadowShader = GECreateRuntimeEffectForShader(shaderCode_);
+        sdfShadowShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(shaderCode_);
     }
     return sdfShadowShader;
 }
@@ -200,7 +236,7 @@ std::shared_ptr<Drawing::RuntimeEffect> GESDFShadowShader::GetElevationShadowEff
 {
     thread_local std::shared_ptr<Drawing::RuntimeEffect> elevationShadowShader = nullptr;
     if (elevationShadowShader == nullptr) {
-        elevationShadowShader = GECreateRuntimeEffectForShader(elevationShaderCode_);
+        elevationShadowShader = GERuntimeEffectRegistry::GetInstance().GetOrCreate(elevationShaderCode_);
     }
     return elevationShadowShader;
 }
@@ -228,9 +264,10 @@ std::shared_ptr<Drawing::ShaderEffect> GESDFShadowShader::MakeElevationShadowSha
         return nullptr;
     }
 
-    auto sdfShader = params_.shape->GenerateDrawingShader(canvas,
+    auto sdfShader = Drawing::GESDFEvaluationCache::GetShader(params_.shape, canvas,
         canvasInfo_.geoWidth != 0 ? canvasInfo_.geoWidth : width,
-        canvasInfo_.geoHeight != 0 ? canvasInfo_.geoHeight : height);
+        canvasInfo_.geoHeight != 0 ? canvasInfo_.geoHeight : height, GetShapeSampleRect(rect), false,
+        GetShapePrecisionHint());
     if (sdfShader == nullptr) {
         GE_LOGE("GESDFShadowShader::MakeElevationShadowShader failed generate SDF shader.");
         return nullptr;
@@ -0,0 +1,625 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_sdf_shape_compiler.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "ge_log.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_distort_op_shader_shape.h"
+#include "ge_sdf_rrect_shader_shape.h"
+#include "ge_sdf_sub_op_shader_shape.h"
+#include "ge_sdf_transform_shader_shape.h"
+#include "ge_sdf_union_op_shader_shape.h"
+#include "ge_system_properties.h"
+#include "ge_trace.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr int32_t EMPTY_NODE = -1;
+constexpr int32_t CHILD_ONLY_NODE = -2;
+constexpr size_t SLOT_FLOATS = 4;
+constexpr size_t MAX_CACHED_PROGRAMS = 32;
+constexpr float HALF = 0.5f;
+constexpr float EXTEND = 0.5f; // Same edge extension as GESDFRRectShaderShape
+constexpr float MIN_SIZE = 0.0001f;
+constexpr float MIN_SPACING = 0.0001f;
+constexpr float EPSILON = 1e-6f;
+
+constexpr char COMMON_PROG[] = R"(
+    const float N_EPS = 1e-6;
+    const float N_SCALE = 2048.0;
+
+    vec2 safeNorm(vec2 v)
+    {
+        return v / max(length(v), N_EPS);
+    }
+
+    float EncodeDir(vec2 dir)
+    {
+        float xPos = floor(dir.x + N_SCALE);
+        float yPos = floor(dir.y + N_SCALE);
+        return xPos + (yPos / N_SCALE) * 0.5;
+    }
+
+    vec2 DecodeDir(float z)
+    {
+        float xPos = floor(z);
+        float yPos = (z - xPos) * N_SCALE * 2.0 - N_SCALE;
+        xPos -= N_SCALE;
+        return vec2(xPos, yPos);
+    }
+)";
+
+constexpr char RRECT_PROG[] = R"(
+    float sdfRRectUniform(vec2 q, vec2 b, float r)
+    {
+        vec2 d = abs(q) - (b - r);
+        return length(max(d, 0.0)) + min(max(d.x, d.y), 0.0) - r;
+    }
+)";
+
+constexpr char RRECT_NORMAL_PROG[] = R"(
+    vec3 sdgRRectUniform(vec2 p, vec2 b, float r)
+    {
+        vec2 s = sign(p);
+        vec2 w = abs(p) - b + r;
+        float g = max(w.x, w.y);
+        vec2 q = max(w, 0.0);
+        float l = length(q);
+        float outside = step(0.0, g);
+        float sd = mix(g, l, outside) - r;
+        float pickX = step(w.y, w.x);
+        vec2 gradIn = vec2(pickX, 1.0 - pickX);
+        vec2 gradOut = safeNorm(q);
+        vec2 grad = s * mix(gradIn, gradOut, outside);
+        return vec3(sd, grad);
+    }
+)";
+
+constexpr char CORNER_PROG[] = R"(
+    vec2 selectCornerRadius(vec2 p, vec2 radiusTL, vec2 radiusTR, vec2 radiusBR, vec2 radiusBL)
+    {
+        float isRight = step(0.0, p.x);
+        float isBottom = step(0.0, p.y);
+        vec2 topRadius = mix(radiusTL, radiusTR, isRight);
+        vec2 bottomRadius = mix(radiusBL, radiusBR, isRight);
+        return mix(topRadius, bottomRadius, isBottom);
+    }
+
+    float sdEllipse(vec2 p, vec2 r)
+    {
+        vec2 safeR = max(r, vec2(N_EPS));
+        vec2 invR = p / safeR;
+        vec2 invR2 = p / max(safeR * safeR, vec2(N_EPS));
+        float k0 = length(invR);
+        float k1 = max(length(invR2), N_EPS);
+        return k0 * (k0 - 1.0) / k1;
+    }
+)";
+
+constexpr char RRECT_CORNERS_PROG[] = R"(
+    float sdfRRectCorners(vec2 q, vec2 b, vec2 radiusTL, vec2 radiusTR, vec2 radiusBR, vec2 radiusBL)
+    {
+        vec2 local = abs(q);
+        vec2 radius = selectCornerRadius(q, radiusTL, radiusTR, radiusBR, radiusBL);
+        vec2 cornerPos = local - (b - radius);
+        if (cornerPos.x >= 0.0 && cornerPos.y >= 0.0) {
+            return sdEllipse(cornerPos, radius);
+        }
+        return max(local.x - b.x, local.y - b.y);
+    }
+)";
+
+constexpr char RRECT_CORNERS_NORMAL_PROG[] = R"(
+    vec2 ellipseGrad(vec2 p, vec2 r)
+    {
+        vec2 safeR = max(r, vec2(N_EPS));
+        vec2 scaled = p / safeR;
+        float scaledLen = max(length(scaled), N_EPS);
+        return safeNorm(p / max(safeR * safeR * scaledLen, vec2(N_EPS)));
+    }
+
+    vec3 sdgRRectCorners(vec2 p, vec2 b, vec2 radiusTL, vec2 radiusTR, vec2 radiusBR, vec2 radiusBL)
+    {
+        vec2 r = selectCornerRadius(p, radiusTL, radiusTR, radiusBR, radiusBL);
+        vec2 s = sign(p);
+        vec2 local = abs(p);
+        vec2 cornerCenter = b - r;
+        vec2 cornerPos = local - cornerCenter;
+        float useCorner = step(0.0, min(cornerPos.x, cornerPos.y));
+
+        float edgeSd = max(local.x - b.x, local.y - b.y);
+        float cornerSd = sdEllipse(cornerPos, r);
+        float sd = mix(edgeSd, cornerSd, useCorner);
+
+        vec2 edgeDelta = local - b;
+        float pickX = step(edgeDelta.y, edgeDelta.x);
+        vec2 gradEdge = vec2(pickX, 1.0 - pickX);
+        vec2 gradCorner = ellipseGrad(cornerPos, r);
+        vec2 grad = s * mix(gradEdge, gradCorner, useCorner);
+        return vec3(sd, grad);
+    }
+)";
+
+constexpr char SMOOTH_UNION_PROG[] = R"(
+    vec4 sdfSmoothUnion(vec4 d1, vec4 d2, float k)
+    {
+        k *= 4.0;
+        vec4 h = max(k - abs(d1 - d2), 0.0);
+        return min(d1, d2) - h * h * 0.25 / k;
+    }
+)";
+
+constexpr char SMOOTH_UNION_NORMAL_PROG[] = R"(
+    vec4 sdgSmoothUnion(vec4 d1, vec4 d2, float k)
+    {
+        k *= 4.0;
+        float h = max(k - abs(d1.a - d2.a), 0.0) / (2.0 * k);
+        vec2 centerDir1 = DecodeDir(d1.z);
+        vec2 centerDir2 = DecodeDir(d2.z);
+        vec2 centerDirUnion = mix(centerDir1, centerDir2, (d1.a < d2.a) ? h : 1.0 - h);
+        float encodingZ = EncodeDir(centerDirUnion);
+        return vec4(mix(d1.xy, d2.xy, (d1.a < d2.a) ? h : 1.0 - h), encodingZ, min(d1.a, d2.a) - h * h * k);
+    }
+)";
+
+constexpr char SMOOTH_SUB_PROG[] = R"(
+    vec4 sdfSmoothSub(vec4 d1, vec4 d2, float k)
+    {
+        k *= 4.0;
+        float h = max(k - abs(-d1.a - d2.a), 0.0);
+        return vec4(d2.xyz, max(-d1.a, d2.a) + h * h * 0.25 / k);
+    }
+)";
+
+constexpr char SMOOTH_SUB_NORMAL_PROG[] = R"(
+    vec4 sdgSmoothSub(vec4 d1, vec4 d2, float k)
+    {
+        k *= 4.0;
+        vec4 inverseD1 = vec4(-d1.xyz, -d1.a);
+        float h = max(k - abs(inverseD1.a - d2.a), 0.0) / (2.0 * k);
+        return vec4(mix(inverseD1.xyz, d2.xyz, (inverseD1.a > d2.a) ? h : 1.0 - h),
+            max(inverseD1.a, d2.a) + h * h * k);
+    }
+)";
+
+// k holds k2, ik2, k1Base and k0Base of GESDFDistortOpShaderShape
+constexpr char DISTORT_PROG[] = R"(
+    float Cross2d(vec2 a, vec2 b)
+    {
+        return a.x * b.y - a.y * b.x;
+    }
+
+    vec2 InvBilinear(vec2 p, vec2 lu, vec2 e, vec2 f, vec2 g, vec4 k)
+    {
+        vec2 h = p - lu;
+        float localK1 = k.z + Cross2d(p, g);
+        float localK0 = k.w + Cross2d(p, e);
+        if (abs(k.x) < 0.001) {
+            return vec2((h.x * localK1 + f.x * localK0) / (e.x * localK1 - g.x * localK0), -localK0 / localK1);
+        }
+        float w = localK1 * localK1 - 4.0 * localK0 * k.x;
+        if (w < 0.0) {
+            return vec2(-1.0);
+        }
+        w = sqrt(w);
+        float v = (-localK1 - w) * k.y;
+        float u = (h.x - f.x * v) / (e.x + g.x * v);
+        if (u < 0.0 || u > 1.0 || v < 0.0 || v > 1.0) {
+            v = (-localK1 + w) * k.y;
+            u = (h.x - f.x * v) / (e.x + g.x * v);
+        }
+        return vec2(u, v);
+    }
+
+    vec2 BarrelDistort(vec2 uv, vec4 barrelDistortion, float distortionEnable)
+    {
+        if (distortionEnable <= 0.0) {
+            return uv;
+        }
+        vec2 lerpDistortion = vec2(mix(barrelDistortion.x, barrelDistortion.y, uv.x),
+                                   mix(barrelDistortion.z, barrelDistortion.w, uv.y));
+        vec2 centerUV = uv - vec2(0.5);
+        vec2 normFactor = 1.0 / (1.0 + lerpDistortion * 0.5); // keeps the corners aligned with the input parameters
+        float l2 = dot(centerUV, centerUV);
+        centerUV *= 1.0 + lerpDistortion * l2;
+        centerUV *= normFactor;
+        return centerUV + vec2(0.5);
+    }
+)";
+
+// Node bodies, $0..$9 is the n-th vec4 of the node, $L and $R its children and $C its child shader
+struct NodeTemplate {
+    char keyChar;
+    const char* helper;
+    const char* normalHelper;
+    const char* body;
+    const char* normalBody;
+};
+
+constexpr char UNION_BODY[] = R"(
+        vec4 l = $L(p);
+        vec4 r = $R(p);
+        return l.a < r.a ? l : r;
+)";
+
+constexpr char SUB_BODY[] = R"(
+        vec4 l = $L(p);
+        vec4 r = $R(p);
+        vec4 inverseR = vec4(-r.xyz, -r.a);
+        return l.a > inverseR.a ? l : inverseR;
+)";
+
+constexpr char TRANSFORM_BODY[] = R"(
+        vec3 q = vec3(p, 1.0);
+        vec3 t = vec3(dot($0.xyz, q), dot($1.xyz, q), dot($2.xyz, q));
+        return $L(abs(t.z) > 0.00001 ? t.xy / t.z : t.xy);
+)";
+
+constexpr char DISTORT_BODY[] = R"(
+        vec2 uv = InvBilinear(p * $0.zw, $1.xy, $1.zw, $2.xy, $2.zw, $3);
+        uv = BarrelDistort(uv, $4, $5.x);
+        return $L(uv * $0.xy);
+)";
+
+// Indexed by NodeKind
+constexpr NodeTemplate NODE_TEMPLATES[] = {
+    { 'c', nullptr, nullptr, R"(
+        return child$C.eval(p);
+)", R"(
+        return child$C.eval(p);
+)" },
+    { 'r', RRECT_PROG, RRECT_NORMAL_PROG, R"(
+        return vec4(0.0, 0.0, 0.0, sdfRRectUniform(p - $0.xy, $0.zw, $1.x));
+)", R"(
+        vec2 q = p - $0.xy;
+        vec3 sdg = sdgRRectUniform(q, $0.zw, $1.x);
+        return vec4(sdg.yz, EncodeDir(q), sdg.x);
+)" },
+    { 'R', RRECT_CORNERS_PROG, RRECT_CORNERS_NORMAL_PROG, R"(
+        return vec4(0.0, 0.0, 0.0, sdfRRectCorners(p - $0.xy, $0.zw, $1.xy, $1.zw, $2.xy, $2.zw));
+)", R"(
+        vec2 q = p - $0.xy;
+        vec3 sdg = sdgRRectCorners(q, $0.zw, $1.xy, $1.zw, $2.xy, $2.zw);
+        return vec4(sdg.yz, EncodeDir(q), sdg.x);
+)" },
+    { 'u', nullptr, nullptr, UNION_BODY, UNION_BODY },
+    { 'U', SMOOTH_UNION_PROG, SMOOTH_UNION_NORMAL_PROG, R"(
+        return sdfSmoothUnion($L(p), $R(p), $0.x);
+)", R"(
+        return sdgSmoothUnion($L(p), $R(p), $0.x);
+)" },
+    { 's', nullptr, nullptr, SUB_BODY, SUB_BODY },
+    { 'S', SMOOTH_SUB_PROG, SMOOTH_SUB_NORMAL_PROG, R"(
+        return sdfSmoothSub($R(p), $L(p), $0.x);
+)", R"(
+        return sdgSmoothSub($R(p), $L(p), $0.x);
+)" },
+    { 't', nullptr, nullptr, TRANSFORM_BODY, TRANSFORM_BODY },
+    { 'd', DISTORT_PROG, DISTORT_PROG, DISTORT_BODY, DISTORT_BODY },
+};
+constexpr size_t NODE_KIND_COUNT = sizeof(NODE_TEMPLATES) / sizeof(NODE_TEMPLATES[0]);
+
+const NodeTemplate& GetTemplate(GESDFShapeCompiler::NodeKind kind)
+{
+    return NODE_TEMPLATES[static_cast<size_t>(kind)];
+}
+
+std::string NodeName(int32_t index)
+{
+    return "n" + std::to_string(index);
+}
+
+void AppendBody(const char* body, const GESDFShapeCompiler::Node& node, std::string& src)
+{
+    for (const char* c = body; *c != '\0'; ++c) {
+        if (*c != '$' || c[1] == '\0') {
+            src += *c;
+            continue;
+        }
+        ++c;
+        if (*c == 'L') {
+            src += NodeName(node.left);
+        } else if (*c == 'R') {
+            src += NodeName(node.right);
+        } else if (*c == 'C') {
+            src += std::to_string(node.childSlot);
+        } else {
+            src += "nodeParams[" + std::to_string(node.paramOffset + static_cast<uint32_t>(*c - '0')) + "]";
+        }
+    }
+}
+
+bool IsOpNode(GESDFShapeCompiler::NodeKind kind)
+{
+    return kind != GESDFShapeCompiler::NodeKind::CHILD_SHADER && kind != GESDFShapeCompiler::NodeKind::RRECT &&
+        kind != GESDFShapeCompiler::NodeKind::RRECT_CORNERS;
+}
+} // namespace
+
+int32_t GESDFShapeCompiler::AddNode(NodeKind kind, int32_t left, int32_t right, std::initializer_list<float> params,
+    Program& program)
+{
+    Node node;
+    node.kind = kind;
+    node.left = left;
+    node.right = right;
+    node.paramOffset = static_cast<uint32_t>(program.params.size() / SLOT_FLOATS);
+    program.params.insert(program.params.end(), params.begin(), params.end());
+    size_t padding = (SLOT_FLOATS - program.params.size() % SLOT_FLOATS) % SLOT_FLOATS;
+    program.params.insert(program.params.end(), padding, 0.0f);
+    program.nodes.push_back(node);
+    program.key += GetTemplate(kind).keyChar;
+    return static_cast<int32_t>(program.nodes.size() - 1);
+}
+
+int32_t GESDFShapeCompiler::AddChildShader(const GESDFShaderShape& shape, float width, float height,
+    Program& program)
+{
+    auto shader = program.hasNormal ? shape.GenerateDrawingShaderHasNormal(width, height) :
+        shape.GenerateDrawingShader(width, height);
+    if (!shader) {
+        return EMPTY_NODE;
+    }
+    int32_t index = AddNode(NodeKind::CHILD_SHADER, EMPTY_NODE, EMPTY_NODE, {}, program);
+    program.nodes[index].childSlot = static_cast<uint32_t>(program.children.size());
+    program.children.push_back(std::move(shader));
+    return index;
+}
+
+int32_t GESDFShapeCompiler::AddShape(const std::shared_ptr<GESDFShaderShape>& shape, float width, float height,
+    Program& program)
+{
+    if (!shape) {
+        return EMPTY_NODE;
+    }
+    int32_t index = AddInlineShape(*shape, width, height, program);
+    return index == CHILD_ONLY_NODE ? AddChildShader(*shape, width, height, program) : index;
+}
+
+int32_t GESDFShapeCompiler::AddInlineShape(const GESDFShaderShape& shape, float width, float height,
+    Program& program)
+{
+    if (program.nodes.size() >= MAX_NODES) {
+        return CHILD_ONLY_NODE;
+    }
+    // Dispatch on Type(), which names the class, since any shape may report a GESDFShapeType
+    switch (shape.Type()) {
+        case GEFilterType::SDF_RRECT_SHAPE: {
+            const auto& rrectShape = static_cast<const GESDFRRectShaderShape&>(shape);
+            const GERRect& rrect = rrectShape.GetRRect();
+            if (rrect.width_ < MIN_SIZE || rrect.height_ < MIN_SIZE) {
+                return EMPTY_NODE;
+            }
+            float centerX = rrect.left_ + rrect.width_ * HALF;
+            float centerY = rrect.top_ + rrect.height_ * HALF;
+            float halfWidth = rrect.width_ * HALF + EXTEND;
+            float halfHeight = rrect.height_ * HALF + EXTEND;
+            if (rrectShape.UseUniformRadiusFastPath()) {
+                return AddNode(NodeKind::RRECT, EMPTY_NODE, EMPTY_NODE, { centerX, centerY, halfWidth, halfHeight,
+                    rrectShape.ResolveUniformRadius(halfWidth, halfHeight) }, program);
+            }
+            auto radii = rrectShape.ResolveCornerRadii(halfWidth, halfHeight);
+            return AddNode(NodeKind::RRECT_CORNERS, EMPTY_NODE, EMPTY_NODE, { centerX, centerY, halfWidth, halfHeight,
+                radii[GERRect::TOP_LEFT].x_, radii[GERRect::TOP_LEFT].y_,
+                radii[GERRect::TOP_RIGHT].x_, radii[GERRect::TOP_RIGHT].y_,
+                radii[GERRect::BOTTOM_RIGHT].x_, radii[GERRect::BOTTOM_RIGHT].y_,
+                radii[GERRect::BOTTOM_LEFT].x_, radii[GERRect::BOTTOM_LEFT].y_ }, program);
+        }
+        case GEFilterType::SDF_UNION_OP: {
+            const auto& unionShape = static_cast<const GESDFUnionOpShaderShape&>(shape);
+            bool smooth = unionShape.GetSDFUnionOp() != GESDFUnionOp::UNION;
+            // Normals of smooth unions over triangles search for the exit point, left to the nested shader
+            if (smooth && program.hasNormal && unionShape.HasType(GESDFShapeType::TRIANGLE)) {
+                return CHILD_ONLY_NODE;
+            }
+            int32_t left = AddShape(unionShape.GetLeftSDFShape(), width, height, program);
+            int32_t right = AddShape(unionShape.GetRightSDFShape(), width, height, program);
+            if (left == EMPTY_NODE || right == EMPTY_NODE) {
+                return left == EMPTY_NODE ? right : left;
+            }
+            if (!smooth) {
+                return AddNode(NodeKind::UNION, left, right, {}, program);
+            }
+            return AddNode(NodeKind::SMOOTH_UNION, left, right,
+                { std::max(unionShape.GetSpacing(), MIN_SPACING) }, program);
+        }
+        case GEFilterType::SDF_SUB_OP_SHAPE: {
+            const auto& subShape = static_cast<const GESDFSubOpShaderShape&>(shape);
+            return AddSubOp(NodeKind::SUB, subShape.GetLeftSDFShape(), subShape.GetRightSDFShape(), 0.0f,
+                width, height, program);
+        }
+        case GEFilterType::SDF_SMOOTH_SUB_OP_SHAPE: {
+            const auto& subShape = static_cast<const GESDFSmoothSubOpShaderShape&>(shape);
+            return AddSubOp(NodeKind::SMOOTH_SUB, subShape.GetLeftSDFShape(), subShape.GetRightSDFShape(),
+                std::max(subShape.GetSpacing(), MIN_SPACING), width, height, program);
+        }
+        case GEFilterType::SDF_TRANSFORM_SHAPE: {
+            const auto& transformShape = static_cast<const GESDFTransformShaderShape&>(shape);
+            Drawing::Matrix invertMatrix;
+            // Gravity pull warps are left to the nested shader, so is a singular matrix drawing nothing
+            if (transformShape.GetUnionMode() == 1 || (!transformShape.GetMatrix().IsIdentity() &&
+                !transformShape.GetMatrix().Invert(invertMatrix))) {
+                return CHILD_ONLY_NODE;
+            }
+            int32_t child = AddShape(transformShape.GetSDFShape(), width, height, program);
+            if (child == EMPTY_NODE || transformShape.GetMatrix().IsIdentity()) {
+                return child;
+            }
+            // Rows of the inverse matrix, fragCoord to shape space
+            return AddNode(NodeKind::TRANSFORM, child, EMPTY_NODE, {
+                invertMatrix.Get(Matrix::SCALE_X), invertMatrix.Get(Matrix::SKEW_X), invertMatrix.Get(Matrix::TRANS_X),
+                0.0f,
+                invertMatrix.Get(Matrix::SKEW_Y), invertMatrix.Get(Matrix::SCALE_Y), invertMatrix.Get(Matrix::TRANS_Y),
+                0.0f,
+                invertMatrix.Get(Matrix::PERSP_0), invertMatrix.Get(Matrix::PERSP_1), invertMatrix.Get(Matrix::PERSP_2),
+            }, program);
+        }
+        case GEFilterType::SDF_DISTORT_OP_SHAPE: {
+            const auto& distortShape = static_cast<const GESDFDistortOpShaderShape&>(shape);
+            int32_t child = AddShape(distortShape.GetSDFShape(), width, height, program);
+            if (child == EMPTY_NODE) {
+                return EMPTY_NODE;
+            }
+            auto terms = distortShape.ComputeUniforms();
+            return AddNode(NodeKind::DISTORT, child, EMPTY_NODE, {
+                width, height, 1.0f / std::max(width, EPSILON), 1.0f / std::max(height, EPSILON),
+                terms.lu[0], terms.lu[1], terms.e[0], terms.e[1],
+                terms.f[0], terms.f[1], terms.g[0], terms.g[1],
+                terms.k2, terms.ik2, terms.k1Base, terms.k0Base,
+                terms.barrelDistortion[0], terms.barrelDistortion[1], terms.barrelDistortion[2],
+                terms.barrelDistortion[3], terms.distortionEnable,
+            }, program);
+        }
+        default:
+            return CHILD_ONLY_NODE;
+    }
+}
+
+int32_t GESDFShapeCompiler::AddSubOp(NodeKind kind, const std::shared_ptr<GESDFShaderShape>& leftShape,
+    const std::shared_ptr<GESDFShaderShape>& rightShape, float spacing, float width, float height, Program& program)
+{
+    int32_t left = AddShape(leftShape, width, height, program);
+    if (left == EMPTY_NODE) {
+        return EMPTY_NODE;
+    }
+    int32_t right = AddShape(rightShape, width, height, program);
+    if (right == EMPTY_NODE) {
+        return left;
+    }
+    if (kind == NodeKind::SUB) {
+        return AddNode(kind, left, right, {}, program);
+    }
+    return AddNode(kind, left, right, { spacing }, program);
+}
+
+bool GESDFShapeCompiler::Flatten(const GESDFShaderShape& root, float width, float height, bool hasNormal,
+    Program& program)
+{
+    program.hasNormal = hasNormal;
+    program.nodes.clear();
+    program.params.clear();
+    program.children.clear();
+    program.key.assign(1, hasNormal ? 'N' : 'D');
+    int32_t index = AddInlineShape(root, width, height, program);
+    // A root collapsing to a single leaf or child shader gains nothing over the nested shaders
+    if (index < 0 || !IsOpNode(program.nodes[index].kind)) {
+        return false;
+    }
+    return program.params.size() / SLOT_FLOATS <= MAX_PARAM_SLOTS;
+}
+
+std::string GESDFShapeCompiler::GenerateSource(const Program& program)
+{
+    std::string src;
+    for (size_t i = 0; i < program.children.size(); ++i) {
+        src += "    uniform shader child" + std::to_string(i) + ";\n";
+    }
+    size_t slotCount = std::max(program.params.size() / SLOT_FLOATS, static_cast<size_t>(1));
+    src += "    uniform vec4 nodeParams[" + std::to_string(slotCount) + "];\n";
+    src += COMMON_PROG;
+
+    bool kindUsed[NODE_KIND_COUNT] = {};
+    for (const auto& node : program.nodes) {
+        kindUsed[static_cast<size_t>(node.kind)] = true;
+    }
+    // Corner helpers are shared by both rounded rect variants
+    if (kindUsed[static_cast<size_t>(NodeKind::RRECT_CORNERS)]) {
+        src += CORNER_PROG;
+    }
+    for (size_t kind = 0; kind < NODE_KIND_COUNT; ++kind) {
+        const char* helper = program.hasNormal ? NODE_TEMPLATES[kind].normalHelper : NODE_TEMPLATES[kind].helper;
+        if (kindUsed[kind] && helper != nullptr) {
+            src += helper;
+        }
+    }
+
+    for (size_t i = 0; i < program.nodes.size(); ++i) {
+        const Node& node = program.nodes[i];
+        const NodeTemplate& nodeTemplate = GetTemplate(node.kind);
+        src += "\n    vec4 " + NodeName(static_cast<int32_t>(i)) + "(vec2 p)\n    {";
+        AppendBody(program.hasNormal ? nodeTemplate.normalBody : nodeTemplate.body, node, src);
+        src += "    }\n";
+    }
+    src += "\n    half4 main(vec2 fragCoord)\n    {\n        return half4(" +
+        NodeName(static_cast<int32_t>(program.nodes.size() - 1)) + "(fragCoord));\n    }\n";
+    return src;
+}
+
+std::shared_ptr<ShaderEffect> GESDFShapeCompiler::GenerateDrawingShader(const GESDFShaderShape& root,
+    float width, float height, bool hasNormal)
+{
+    if (!IsEnabled()) {
+        return nullptr;
+    }
+    // Child shaders may flatten their own subtrees while this one is being flattened, so nothing is shared here
+    Program program;
+    if (!Flatten(root, width, height, hasNormal, program)) {
+        return nullptr;
+    }
+    GE_TRACE_NAME_FMT("GESDFShapeCompiler::GenerateDrawingShader, Nodes: %zu, Children: %zu",
+        program.nodes.size(), program.children.size());
+
+    thread_local std::unordered_map<std::string, std::shared_ptr<Drawing::RuntimeShaderBuilder>> builders;
+    auto iter = builders.find(program.key);
+    if (iter == builders.end()) {
+        if (builders.size() >= MAX_CACHED_PROGRAMS) {
+            builders.clear();
+        }
+        Drawing::RuntimeEffectOptions reo;
+        reo.useHighpLocalCoords = true;
+        auto effect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(GenerateSource(program), reo);
+        if (!effect) {
+            LOGE("GESDFShapeCompiler::GenerateDrawingShader effect error, key: %{public}s", program.key.c_str());
+        }
+        // Failed programs are kept as nullptr, so the tree is not generated again every frame
+        iter = builders.emplace(program.key,
+            effect ? std::make_shared<Drawing::RuntimeShaderBuilder>(effect) : nullptr).first;
+    }
+    auto builder = iter->second;
+    if (!builder) {
+        return nullptr;
+    }
+
+    for (size_t i = 0; i < program.children.size(); ++i) {
+        builder->SetChild("child" + std::to_string(i), program.children[i]);
+    }
+    builder->SetUniform("nodeParams", program.params.data(), program.params.size());
+    auto shader = builder->MakeShader(nullptr, false);
+    if (!shader) {
+        LOGE("GESDFShapeCompiler::GenerateDrawingShader shaderEffect error");
+    }
+    return shader;
+}
+
+bool GESDFShapeCompiler::IsEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.sdfcompile", "1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 1) != 0;
+#else
+    return true;
+#endif
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
@@ -18,7 +18,8 @@
 #include <algorithm>
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_shape_compiler.h"
 #include "ge_trace.h"
 
 namespace OHOS {
@@ -73,6 +74,9 @@ static constexpr char SDF_SMOOTH_SUB_OP_PROG[] = R"(
 std::shared_ptr<ShaderEffect> GESDFSubOpShaderShape::GenerateDrawingShader(float width, float height) const
 {
     GE_TRACE_NAME_FMT("GESDFSubOpShaderShape::GenerateDrawingShader, Width: %g, Height: %g", width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, false)) {
+        return flatShader;
+    }
     auto leftShader = params_.left ? params_.left->GenerateDrawingShader(width, height) : nullptr;
     auto rightShader = params_.right ? params_.right->GenerateDrawingShader(width, height) : nullptr;
     if (!leftShader) {
@@ -87,6 +91,9 @@ std::shared_ptr<ShaderEffect> GESDFSubOpShaderShape::GenerateDrawingShader(float
 std::shared_ptr<ShaderEffect> GESDFSubOpShaderShape::GenerateDrawingShaderHasNormal(float width, float height) const
 {
     GE_TRACE_NAME_FMT("GESDFSubOpShaderShape::GenerateDrawingShaderHasNormal, Width: %g, Height: %g", width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, true)) {
+        return flatShader;
+    }
     auto leftShader = params_.left ? params_.left->GenerateDrawingShaderHasNormal(width, height) : nullptr;
     auto rightShader = params_.right ? params_.right->GenerateDrawingShaderHasNormal(width, height) : nullptr;
     if (!leftShader) {
@@ -108,6 +115,16 @@ void GESDFSubOpShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool ha
     }
 }
 
+void GESDFSubOpShaderShape::SetPrecisionHint(const GESDFPrecisionHint& hint)
+{
+    if (params_.left) {
+        params_.left->SetPrecisionHint(hint);
+    }
+    if (params_.right) {
+        params_.right->SetPrecisionHint(hint);
+    }
+}
+
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFSubOpShaderShape::GetSDFSubOpBuilder(bool) const
 {
     thread_local std::shared_ptr<Drawing::RuntimeShaderBuilder> sdfSubOpShaderShapeBuilder = nullptr;
@@ -130,7 +147,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFSubOpShaderShape::GetSDFSubO
         }
     )";
 
-    auto sdfSubOpShaderBuilderEffect = GECreateRuntimeEffectForShader(prog);
+    auto sdfSubOpShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!sdfSubOpShaderBuilderEffect) {
         LOGE("GESDFSubOpShaderShape::GetSDFSubOpBuilder effect error");
         return nullptr;
@@ -172,9 +189,18 @@ bool GESDFSubOpShaderShape::HasType(const GESDFShapeType type) const
     return false;
 }
 
+bool GESDFSubOpShaderShape::GetBoundingRect(Rect& rect)
+{
+    // Subtracting only removes points from the left shape
+    return params_.left ? params_.left->GetBoundingRect(rect) : false;
+}
+
 std::shared_ptr<ShaderEffect> GESDFSmoothSubOpShaderShape::GenerateDrawingShader(float width, float height) const
 {
     GE_TRACE_NAME_FMT("GESDFSmoothSubOpShaderShape::GenerateDrawingShader, Width: %g, Height: %g", width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, false)) {
+        return flatShader;
+    }
     auto leftShader = params_.left ? params_.left->GenerateDrawingShader(width, height) : nullptr;
     auto rightShader = params_.right ? params_.right->GenerateDrawingShader(width, height) : nullptr;
     if (!leftShader) {
@@ -191,6 +217,9 @@ std::shared_ptr<ShaderEffect> GESDFSmoothSubOpShaderShape::GenerateDrawingShader
 {
     GE_TRACE_NAME_FMT(
         "GESDFSmoothSubOpShaderShape::GenerateDrawingShaderHasNormal, Width: %g, Height: %g", width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, true)) {
+        return flatShader;
+    }
     auto leftShader = params_.left ? params_.left->GenerateDrawingShaderHasNormal(width, height) : nullptr;
     auto rightShader = params_.right ? params_.right->GenerateDrawingShaderHasNormal(width, height) : nullptr;
     if (!leftShader) {
@@ -212,6 +241,17 @@ void GESDFSmoothSubOpShaderShape::Preprocess(Canvas& canvas, const Rect& rect, b
     }
 }
 
+void GESDFSmoothSubOpShaderShape::SetPrecisionHint(const GESDFPrecisionHint& hint)
+{
+    auto childHint = hint.Widen(params_.spacing);
+    if (params_.left) {
+        params_.left->SetPrecisionHint(childHint);
+    }
+    if (params_.right) {
+        params_.right->SetPrecisionHint(childHint);
+    }
+}
+
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFSmoothSubOpShaderShape::GetSDFSmoothSubOpBuilder(
     bool hasNormal) const
 {
@@ -222,7 +262,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFSmoothSubOpShaderShape::GetS
         }
 
         auto sdfNormalSmoothSubOpShaderBuilderEffect =
-            GECreateRuntimeEffectForShader(SDF_NORMAL_SMOOTH_SUB_OP_PROG);
+            GERuntimeEffectRegistry::GetInstance().GetOrCreate(SDF_NORMAL_SMOOTH_SUB_OP_PROG);
         if (!sdfNormalSmoothSubOpShaderBuilderEffect) {
             LOGE("GESDFSmoothSubOpShaderShape::GetSDFSmoothSubOpBuilder normal effect error");
             return nullptr;
@@ -238,7 +278,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFSmoothSubOpShaderShape::GetS
         return sdfSmoothSubOpShaderShapeBuilder;
     }
 
-    auto sdfSmoothSubOpShaderBuilderEffect = GECreateRuntimeEffectForShader(SDF_SMOOTH_SUB_OP_PROG);
+    auto sdfSmoothSubOpShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SDF_SMOOTH_SUB_OP_PROG);
     if (!sdfSmoothSubOpShaderBuilderEffect) {
         LOGE("GESDFSmoothSubOpShaderShape::GetSDFSmoothSubOpBuilder effect error");
         return nullptr;
@@ -281,6 +321,12 @@ bool GESDFSmoothSubOpShaderShape::HasType(const GESDFShapeType type) const
     }
     return false;
 }
+
+bool GESDFSmoothSubOpShaderShape::GetBoundingRect(Rect& rect)
+{
+    // The smooth maximum is never below the maximum, so the result stays inside the left shape
+    return params_.left ? params_.left->GetBoundingRect(rect) : false;
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
@@ -14,7 +14,8 @@
  */
 
 #include "ge_sdf_transform_shader_shape.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_shape_compiler.h"
 #include "ge_log.h"
 #include "ge_trace.h"
 
@@ -31,13 +32,16 @@ std::shared_ptr<ShaderEffect> GESDFTransformShaderShape::GenerateDrawingShader(f
     if (params_.unionMode == 1) {
         return GenerateGravityPullDrawingShader(width, height);
     }
-    
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, false)) {
+        return flatShader;
+    }
+
     std::shared_ptr<Drawing::RuntimeShaderBuilder> builder = GetSDFTransformShaderShapeBuilder();
     if (!builder) {
         LOGE("GESDFTransformShaderShape::GenerateDrawingShader has builder error");
         return nullptr;
     }
-    auto shapeShader = params_.shape->GenerateDrawingShader(width, height);
+    auto shapeShader = GetChildShader(width, height, false);
     if (!shapeShader) {
         LOGE("GESDFTransformShaderShape::GenerateDrawingShader has empty shader");
         return nullptr;
@@ -58,13 +62,16 @@ std::shared_ptr<ShaderEffect> GESDFTransformShaderShape::GenerateDrawingShaderHa
     if (params_.unionMode == 1) {
         return GenerateGravityPullDrawingShaderHasNormal(width, height);
     }
-    
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, true)) {
+        return flatShader;
+    }
+
     std::shared_ptr<Drawing::RuntimeShaderBuilder> builder = GetSDFTransformShaderHasNormalShapeBuilder();
     if (!builder) {
         LOGE("GESDFTransformShaderShape::GenerateDrawingShaderHasNormal has builder error");
         return nullptr;
     }
-    auto shapeShader = params_.shape->GenerateDrawingShaderHasNormal(width, height);
+    auto shapeShader = GetChildShader(width, height, true);
     if (!shapeShader) {
         LOGE("GESDFTransformShaderShape::GenerateDrawingShaderHasNormal has empty shader");
         return nullptr;
@@ -75,11 +82,62 @@ std::shared_ptr<ShaderEffect> GESDFTransformShaderShape::GenerateDrawingShaderHa
 
 void GESDFTransformShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool hasNormal)
 {
+    if (!params_.shape) {
+        return;
+    }
+    if (preprocessedShape_ == params_.shape && IsSameShape(preprocessedShape_, preprocessedHash_, params_.shape) &&
+        preprocessedRect_ == rect && preprocessedHint_ == precisionHint_ && (preprocessedNormal_ || !hasNormal)) {
+        GE_TRACE_NAME_FMT("GESDFTransformShaderShape::Preprocess, reuse child");
+        return;
+    }
+    params_.shape->Preprocess(canvas, rect, hasNormal);
+    preprocessedShape_ = params_.shape;
+    preprocessedHash_ = params_.shape->GetHash();
+    preprocessedRect_ = rect;
+    preprocessedNormal_ = hasNormal;
+    preprocessedHint_ = precisionHint_;
+}
+
+void GESDFTransformShaderShape::SetPrecisionHint(const GESDFPrecisionHint& hint)
+{
+    precisionHint_ = hint;
     if (params_.shape) {
-        params_.shape->Preprocess(canvas, rect, hasNormal);
+        params_.shape->SetPrecisionHint(hint);
+    }
+}
+
+void GESDFTransformShaderShape::CopyState(const GESDFTransformShaderShape& shape)
+{
+    auto child = params_.shape;
+    params_ = shape.params_;
+    if (child && IsSameShape(child, child->GetHash(), params_.shape)) {
+        params_.shape = child;
     }
 }
 
+bool GESDFTransformShaderShape::IsSameShape(const std::shared_ptr<GESDFShaderShape>& shape, uint32_t hash,
+    const std::shared_ptr<GESDFShaderShape>& other)
+{
+    if (!shape || !other || hash == 0 || other->GetHash() != hash) {
+        return false;
+    }
+    return shape == other || shape->GetSDFShapeType() == other->GetSDFShapeType();
+}
+
+std::shared_ptr<ShaderEffect> GESDFTransformShaderShape::GetChildShader(float width, float height,
+    bool hasNormal) const
+{
+    auto& cache = hasNormal ? childNormalShaderCache_ : childShaderCache_;
+    if (cache.shader && cache.shape == params_.shape && IsSameShape(cache.shape, cache.hash, params_.shape) &&
+        cache.width == width && cache.height == height && cache.hint == precisionHint_) {
+        return cache.shader;
+    }
+    auto shader = hasNormal ? params_.shape->GenerateDrawingShaderHasNormal(width, height) :
+        params_.shape->GenerateDrawingShader(width, height);
+    cache = { params_.shape, params_.shape->GetHash(), width, height, precisionHint_, shader };
+    return shader;
+}
+
 std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFTransformShaderShape::GetSDFTransformShaderShapeBuilder() const
 {
     thread_local std::shared_ptr<Drawing::RuntimeShaderBuilder> sdfTransformShaderShapeBuilder = nullptr;
@@ -101,7 +159,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFTransformShaderShape::GetSDF
         }
     )";
 
-    auto sdfTransformShaderBuilderEffect = GECreateRuntimeEffectForShader(prog);
+    auto sdfTransformShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!sdfTransformShaderBuilderEffect) {
         LOGE("GESDFTransformShaderShape::GetSDFTransformShaderShapeBuilder effect error");
         return nullptr;
@@ -133,7 +191,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFTransformShaderShape::GetSDF
         }
     )";
 
-    auto sdfTransformShaderHasNormalBuilderEffect = GECreateRuntimeEffectForShader(prog);
+    auto sdfTransformShaderHasNormalBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!sdfTransformShaderHasNormalBuilderEffect) {
         LOGE("GESDFTransformShaderShape::sdfTransformShaderHasNormalShapeBuilder effect error");
         return nullptr;
@@ -184,6 +242,24 @@ bool GESDFTransformShaderShape::HasType(const GESDFShapeType type) const
     return false;
 }
 
+bool GESDFTransformShaderShape::GetBoundingRect(Rect& rect)
+{
+    // Gravity pull warps the child, perspective maps a box to a box only in front of the eye and a singular matrix
+    // generates a flat distance
+    if (params_.unionMode == 1 || !params_.shape || params_.matrix.Get(Matrix::PERSP_0) != 0.0f ||
+        params_.matrix.Get(Matrix::PERSP_1) != 0.0f) {
+        return false;
+    }
+    Drawing::Matrix invertMatrix;
+    Rect shapeRect;
+    if (!params_.matrix.Invert(invertMatrix) || !params_.shape->GetBoundingRect(shapeRect)) {
+        return false;
+    }
+    // The child is evaluated at the inverse mapped coordinate, so its box maps forward
+    params_.matrix.MapRect(rect, shapeRect);
+    return true;
+}
+
 bool GESDFTransformShaderShape::TryGetCenterAndHalfSize(float& outX, float& outY, Vector2f& shapeHalfSize) const
 {
     if (!params_.shape) {
@@ -373,7 +449,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFTransformShaderShape::GetGra
         return gravityPullShaderBuilder;
     }
 
-    auto gravityPullShaderEffect = GECreateRuntimeEffectForShader(GRAVITY_PULL_PROG);
+    auto gravityPullShaderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(GRAVITY_PULL_PROG);
     if (!gravityPullShaderEffect) {
         LOGE("GESDFTransformShaderShape::GetGravityPullDrawingShaderBuilder effect error");
         return nullptr;
@@ -394,7 +470,7 @@ std::shared_ptr<ShaderEffect> GESDFTransformShaderShape::GenerateGravityPullDraw
         return nullptr;
     }
 
-    auto baseShapeShader = params_.shape->GenerateDrawingShader(width, height);
+    auto baseShapeShader = GetChildShader(width, height, false);
     if (!baseShapeShader) {
         LOGE("GESDFTransformShaderShape::GenerateGravityPullDrawingShader has empty base shader");
         return nullptr;
@@ -570,7 +646,8 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFTransformShaderShape::GetGra
         return gravPullShaderHasNormalBuilder;
     }
 
-    auto gravityPullShaderHasNormalEffect = GECreateRuntimeEffectForShader(GRAVITY_PULL_NORMAL_PROG);
+    auto gravityPullShaderHasNormalEffect =
+        GERuntimeEffectRegistry::GetInstance().GetOrCreate(GRAVITY_PULL_NORMAL_PROG);
     if (!gravityPullShaderHasNormalEffect) {
         LOGE("GESDFTransformShaderShape::GetGravPullDrawingShaderHasNormBuilder effect error");
         return nullptr;
@@ -591,7 +668,7 @@ std::shared_ptr<ShaderEffect> GESDFTransformShaderShape::GenerateGravityPullDraw
         return nullptr;
     }
     
-    auto baseShapeShader = params_.shape->GenerateDrawingShaderHasNormal(width, height);
+    auto baseShapeShader = GetChildShader(width, height, true);
     if (!baseShapeShader) {
         LOGE("GESDFTransformShaderShape::GenerateGravityPullDrawingShaderHasNormal has empty base shader");
         return nullptr;
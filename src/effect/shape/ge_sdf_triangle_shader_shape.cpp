@@ -13,8 +13,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "ge_sdf_triangle_shader_shape.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 #include "ge_log.h"
 #include "ge_trace.h"
 
@@ -234,7 +236,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFTriangleShaderShape::GetSDFT
         }
     )";
 
-    auto sdfTriangleShaderBuilderEffect = GECreateRuntimeEffectForShader(prog);
+    auto sdfTriangleShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!sdfTriangleShaderBuilderEffect) {
         LOGE("GESDFTriangleShaderShape::GetSDFTriangleShaderShapeBuilder effect error");
         return nullptr;
@@ -251,7 +253,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFTriangleShaderShape::GetSDFT
         return sdfTriangleNormalShaderShapeBuilder;
     }
 
-    auto sdfTriangleNormalShaderBuilderEffect = GECreateRuntimeEffectForShader(SDF_GRAD_PROG);
+    auto sdfTriangleNormalShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(SDF_GRAD_PROG);
     if (!sdfTriangleNormalShaderBuilderEffect) {
         LOGE("GESDFTriangleShaderShape::GetSDFTriangleNormalShapeBuilder effect error");
         return nullptr;
@@ -288,6 +290,16 @@ std::shared_ptr<ShaderEffect> GESDFTriangleShaderShape::GenerateShaderEffect(
     }
     return sdfTriangleShapeShader;
 }
+
+bool GESDFTriangleShaderShape::GetBoundingRect(Rect& rect)
+{
+    // Rounding shrinks the triangle towards its incenter, so it never leaves the vertices
+    rect = Rect(std::min({params_.vertex0.x_, params_.vertex1.x_, params_.vertex2.x_}),
+        std::min({params_.vertex0.y_, params_.vertex1.y_, params_.vertex2.y_}),
+        std::max({params_.vertex0.x_, params_.vertex1.x_, params_.vertex2.x_}),
+        std::max({params_.vertex0.y_, params_.vertex1.y_, params_.vertex2.y_}));
+    return true;
+}
 } // Drawing
 } // namespace Rosen
 } // namespace OHOS
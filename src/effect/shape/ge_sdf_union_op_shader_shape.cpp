@@ -16,7 +16,8 @@
 #include "ge_sdf_union_op_shader_shape.h"
 
 #include "ge_log.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
+#include "ge_sdf_shape_compiler.h"
 #include "ge_trace.h"
 
 namespace OHOS {
@@ -27,6 +28,9 @@ std::shared_ptr<ShaderEffect> GESDFUnionOpShaderShape::GenerateDrawingShader(flo
 {
     GE_TRACE_NAME_FMT("GESDFUnionOpShaderShape::GenerateDrawingShader, Type: %s , Width: %g, Height: %g",
         params_.op == GESDFUnionOp::UNION ? "UNION" : "SMOOTH_UNION", width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, false)) {
+        return flatShader;
+    }
 
     auto leftShader = params_.left ? params_.left->GenerateDrawingShader(width, height) : nullptr;
     auto rightShader = params_.right ? params_.right->GenerateDrawingShader(width, height) : nullptr;
@@ -48,6 +52,9 @@ std::shared_ptr<ShaderEffect> GESDFUnionOpShaderShape::GenerateDrawingShaderHasN
 {
     GE_TRACE_NAME_FMT("GESDFUnionOpShaderShape::GenerateDrawingShaderHasNormal, Type: %s , Width: %g, Height: %g",
         params_.op == GESDFUnionOp::UNION ? "UNION" : "SMOOTH_UNION", width, height);
+    if (auto flatShader = GESDFShapeCompiler::GenerateDrawingShader(*this, width, height, true)) {
+        return flatShader;
+    }
     auto leftShader = params_.left ? params_.left->GenerateDrawingShaderHasNormal(width, height) : nullptr;
     auto rightShader = params_.right ? params_.right->GenerateDrawingShaderHasNormal(width, height) : nullptr;
     if (!leftShader && !rightShader) {
@@ -76,6 +83,17 @@ void GESDFUnionOpShaderShape::Preprocess(Canvas& canvas, const Rect& rect, bool
     }
 }
 
+void GESDFUnionOpShaderShape::SetPrecisionHint(const GESDFPrecisionHint& hint)
+{
+    auto childHint = params_.op == GESDFUnionOp::SMOOTH_UNION ? hint.Widen(params_.spacing) : hint;
+    if (params_.left) {
+        params_.left->SetPrecisionHint(childHint);
+    }
+    if (params_.right) {
+        params_.right->SetPrecisionHint(childHint);
+    }
+}
+
 std::shared_ptr<ShaderEffect> GESDFUnionOpShaderShape::GenerateUnionOpDrawingShader(
     std::shared_ptr<ShaderEffect> leftShader, std::shared_ptr<ShaderEffect> rightShader, bool hasNormal) const
 {
@@ -109,7 +127,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFUnionOpShaderShape::GetSDFUn
         }
     )";
 
-    auto sdfUnionShaderBuilderEffect = GECreateRuntimeEffectForShader(prog);
+    auto sdfUnionShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!sdfUnionShaderBuilderEffect) {
         LOGE("GESDFUnionOpShaderShape::GetSDFUnionBuilder effect error");
         return nullptr;
@@ -146,7 +164,7 @@ std::shared_ptr<Drawing::RuntimeShaderBuilder> GESDFUnionOpShaderShape::GetSDFSm
         }
     )";
 
-    auto sdfSmoothUnionShaderBuilderEffect = GECreateRuntimeEffectForShader(prog);
+    auto sdfSmoothUnionShaderBuilderEffect = GERuntimeEffectRegistry::GetInstance().GetOrCreate(prog);
     if (!sdfSmoothUnionShaderBuilderEffect) {
         LOGE("GESDFUnionOpShaderShape::GetSDFSmoothUnionBuilder effect error");
         return nullptr;
@@ -424,6 +442,30 @@ bool GESDFUnionOpShaderShape::GetInscribedRect(Rect& rect)
     }
     return true;
 }
+
+bool GESDFUnionOpShaderShape::GetBoundingRect(Rect& rect)
+{
+    Rect leftRect;
+    Rect rightRect;
+    bool leftSupport = params_.left ? params_.left->GetBoundingRect(leftRect) : false;
+    bool rightSupport = params_.right ? params_.right->GetBoundingRect(rightRect) : false;
+    // A missing side generates the other side alone, any other unbounded side makes the union unbounded
+    if ((params_.left && !leftSupport) || (params_.right && !rightSupport) || (!leftSupport && !rightSupport)) {
+        return false;
+    }
+    if (leftSupport && rightSupport) {
+        rect = leftRect;
+        rect.Join(rightRect);
+    } else {
+        rect = leftSupport ? leftRect : rightRect;
+    }
+    if (params_.op == GESDFUnionOp::SMOOTH_UNION && leftSupport && rightSupport) {
+        // The smooth minimum blends the shapes up to spacing away from both of them
+        float spacing = std::max(params_.spacing, 0.0f);
+        rect.MakeOutset(spacing, spacing);
+    }
+    return true;
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -24,7 +24,7 @@
 #include "ge_mesa_blur_shader_filter.h"
 #include "ge_linear_gradient_blur_shader_filter.h"
 #include "ge_pixel_map_shader_mask.h"
-#include "ge_shader_diagnostics.h"
+#include "ge_runtime_effect_registry.h"
 
 namespace OHOS {
 namespace Rosen {
@@ -618,7 +618,7 @@ std::shared_ptr<Drawing::RuntimeEffect> HpsEffectFilter::GetUpscaleEffect() cons
                 return finalColor;
             }
             )");
-            return GECreateRuntimeEffectForShader(mixClampString);
+            return GERuntimeEffectRegistry::GetInstance().GetOrCreate(mixClampString);
         }();
         return s_clampUpEffect;
     }
@@ -639,7 +639,7 @@ std::shared_ptr<Drawing::RuntimeEffect> HpsEffectFilter::GetUpscaleEffect() cons
             return finalColor;
         }
         )");
-        return GECreateRuntimeEffectForShader(mixString);
+        return GERuntimeEffectRegistry::GetInstance().GetOrCreate(mixString);
     }();
     return s_upscaleEffect;
 }
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_compiled_effect_chain.h"
+
+#include <algorithm>
+
+#include "core/ge_effect_factory.h"
+#include "ge_log.h"
+#include "ge_render.h"
+#include "ge_visual_effect_impl.h"
+
+namespace OHOS {
+namespace Rosen {
+
+bool GECompiledEffectChain::IsNodeUpToDate(const Node& node,
+    const std::shared_ptr<Drawing::GEVisualEffectImpl>& impl)
+{
+    if (node.type != impl->GetFilterType()) {
+        return false;
+    }
+    // Reusability is a property of the filter class, a non-reusable node never needs to be compiled again
+    return !node.reusable || node.generation == impl->GetParamsGeneration();
+}
+
+std::vector<GECompiledEffectChain::Node>::iterator GECompiledEffectChain::FindNode(
+    const std::shared_ptr<Drawing::GEVisualEffectImpl>& impl)
+{
+    // Chains hold a handful of effects, a linear scan beats any map here.
+    // Comparing locked weak_ptrs (not raw addresses) keeps a new effect allocated at a freed address from matching.
+    return std::find_if(nodes_.begin(), nodes_.end(),
+        [&impl](const Node& node) { return node.impl.lock() == impl; });
+}
+
+size_t GECompiledEffectChain::Update(const Drawing::GEVisualEffectContainer& veContainer)
+{
+    bool mesaBlurAllEnabled = GraphicsEffectEngine::GERender::IsMesablurAllEnabled();
+    if (mesaBlurAllEnabled != mesaBlurAllEnabled_) {
+        nodes_.clear();
+        mesaBlurAllEnabled_ = mesaBlurAllEnabled;
+    }
+
+    size_t createdCount = 0;
+    std::vector<Node> updatedNodes;
+    updatedNodes.reserve(veContainer.GetFilters().size());
+    for (const auto& vef : veContainer.GetFilters()) {
+        auto impl = vef ? vef->GetImpl() : nullptr;
+        if (impl == nullptr) {
+            continue;
+        }
+        auto it = FindNode(impl);
+        if (it != nodes_.end() && IsNodeUpToDate(*it, impl)) {
+            if (!it->reusable) {
+                it->filter = nullptr; // An unclaimed one-shot filter may be built from outdated params
+            }
+            updatedNodes.push_back(std::move(*it));
+            nodes_.erase(it);
+            continue;
+        }
+        auto filter = GEEffectFactory::CreateFilter(impl);
+        if (filter == nullptr) {
+            continue;
+        }
+        LOGD("GECompiledEffectChain::Update compiled filter type %{public}d", (int)impl->GetFilterType());
+        bool reusable = filter->IsReusableAcrossFrames();
+        updatedNodes.push_back(
+            { impl, impl->GetFilterType(), impl->GetParamsGeneration(), reusable, std::move(filter) });
+        ++createdCount;
+    }
+    nodes_ = std::move(updatedNodes);
+    return createdCount;
+}
+
+std::shared_ptr<GEShaderFilter> GECompiledEffectChain::AcquireFilter(
+    const std::shared_ptr<Drawing::GEVisualEffectImpl>& impl)
+{
+    if (impl == nullptr) {
+        return nullptr;
+    }
+    auto it = FindNode(impl);
+    if (it == nodes_.end() || !IsNodeUpToDate(*it, impl)) {
+        return nullptr;
+    }
+    if (!it->reusable) {
+        return std::move(it->filter);
+    }
+    return it->filter;
+}
+
+void GECompiledEffectChain::Clear()
+{
+    nodes_.clear();
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,312 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_filter_fusion_pass.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ge_log.h"
+#include "ge_shader_filter_params.h"
+#include "ge_system_properties.h"
+#include "ge_visual_effect_impl.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+using Drawing::GEFilterType;
+
+constexpr float FLOAT_EPSILON = 1e-6f;
+// Gaussian sigma of a blur radius, sigma = BLUR_SIGMA_SCALE * radius + 0.5 (same convention as Skia blur filters)
+constexpr float BLUR_SIGMA_SCALE = 0.57735f;
+constexpr float BLUR_SIGMA_OFFSET = 0.5f;
+
+bool IsZero(float value)
+{
+    return std::abs(value) <= FLOAT_EPSILON;
+}
+
+bool IsBlur(GEFilterType type)
+{
+    return type == GEFilterType::KAWASE_BLUR || type == GEFilterType::MESA_BLUR;
+}
+
+// GERender configures the filter of the fused effect from it as it would have configured the first effect
+void InheritEffectState(const Drawing::GEVisualEffect& from, Drawing::GEVisualEffect& to)
+{
+    to.SetCanvasInfo(from.GetCanvasInfo());
+    to.SetSupportHeadroom(from.GetSupportHeadroom());
+    auto fromImpl = from.GetImpl();
+    auto toImpl = to.GetImpl();
+    // A cache is read as the type its filter stored, a filter of another type could not read it
+    if (fromImpl != nullptr && toImpl != nullptr && fromImpl->GetFilterType() == toImpl->GetFilterType()) {
+        toImpl->SetCache(fromImpl->GetCache());
+    }
+}
+
+bool HasGrey(const Drawing::GEMESABlurShaderFilterParams& params)
+{
+    // Same test as GEMESABlurShaderFilter
+    return params.greyCoef1 > FLOAT_EPSILON || params.greyCoef2 > FLOAT_EPSILON;
+}
+
+bool HasStretch(const Drawing::GEMESABlurShaderFilterParams& params)
+{
+    return !IsZero(params.offsetX) || !IsZero(params.offsetY) || !IsZero(params.offsetZ) ||
+           !IsZero(params.offsetW) || !IsZero(params.width) || !IsZero(params.height);
+}
+
+// A MESA blur that only blurs, so it may be folded into the blur before it
+bool IsPlainBlur(const Drawing::GEMESABlurShaderFilterParams& params)
+{
+    return !params.isDirection && !HasGrey(params) && !HasStretch(params);
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> MakeKawase(int radius)
+{
+    auto kawase =
+        std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR, Drawing::DrawingPaintType::BRUSH);
+    kawase->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, radius);
+    return kawase;
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> MakeMesa(const Drawing::GEMESABlurShaderFilterParams& params)
+{
+    auto mesa =
+        std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_MESA_BLUR, Drawing::DrawingPaintType::BRUSH);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_RADIUS, params.radius);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_GREY_COEF_1, params.greyCoef1);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_GREY_COEF_2, params.greyCoef2);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_X, params.offsetX);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_Y, params.offsetY);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_Z, params.offsetZ);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_W, params.offsetW);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_TILE_MODE, params.tileMode);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_WIDTH, params.width);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_HEIGHT, params.height);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_IS_DIRECTION, params.isDirection);
+    mesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_ANGLE, params.angle);
+    return mesa;
+}
+
+// MESA blur without stretch, see RSMESABlurShaderFilter::GenerateGEVisualEffect
+Drawing::GEMESABlurShaderFilterParams MakeMesaParams(int radius, float greyCoef1, float greyCoef2)
+{
+    Drawing::GEMESABlurShaderFilterParams params {};
+    params.radius = radius;
+    params.greyCoef1 = greyCoef1;
+    params.greyCoef2 = greyCoef2;
+    return params;
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> FuseGreyKawase(
+    const Drawing::GEVisualEffectImpl& first, const Drawing::GEVisualEffectImpl& second)
+{
+    auto&& greyParams = first.GetGreyParams();
+    auto&& blurParams = second.GetKawaseParams();
+    if (greyParams == nullptr || blurParams == nullptr) {
+        LOGW("GEFilterFusionPass greyParams or blurParams is null, skip fusion");
+        return nullptr;
+    }
+    return MakeMesa(MakeMesaParams(blurParams->radius, greyParams->greyCoef1, greyParams->greyCoef2));
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> FuseGreyMesa(
+    const Drawing::GEVisualEffectImpl& first, const Drawing::GEVisualEffectImpl& second)
+{
+    auto&& greyParams = first.GetGreyParams();
+    auto&& blurParams = second.GetMESAParams();
+    if (greyParams == nullptr || blurParams == nullptr || HasGrey(*blurParams)) {
+        return nullptr;
+    }
+    // Grey is per pixel, so it commutes with the stretch that MESA applies before blurring
+    auto params = *blurParams;
+    params.greyCoef1 = greyParams->greyCoef1;
+    params.greyCoef2 = greyParams->greyCoef2;
+    return MakeMesa(params);
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> FuseKawaseKawase(
+    const Drawing::GEVisualEffectImpl& first, const Drawing::GEVisualEffectImpl& second)
+{
+    auto&& firstParams = first.GetKawaseParams();
+    auto&& secondParams = second.GetKawaseParams();
+    if (firstParams == nullptr || secondParams == nullptr) {
+        return nullptr;
+    }
+    return MakeKawase(GEFilterFusionPass::CombineBlurRadius(firstParams->radius, secondParams->radius));
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> FuseMesaMesa(
+    const Drawing::GEVisualEffectImpl& first, const Drawing::GEVisualEffectImpl& second)
+{
+    auto&& firstParams = first.GetMESAParams();
+    auto&& secondParams = second.GetMESAParams();
+    if (firstParams == nullptr || secondParams == nullptr || firstParams->isDirection ||
+        !IsPlainBlur(*secondParams)) {
+        return nullptr;
+    }
+    // Grey and stretch of the first blur come before both blurs, they are kept
+    auto params = *firstParams;
+    params.radius = GEFilterFusionPass::CombineBlurRadius(firstParams->radius, secondParams->radius);
+    return MakeMesa(params);
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> FuseKawaseMesa(
+    const Drawing::GEVisualEffectImpl& first, const Drawing::GEVisualEffectImpl& second)
+{
+    auto&& firstParams = first.GetKawaseParams();
+    auto&& secondParams = second.GetMESAParams();
+    if (firstParams == nullptr || secondParams == nullptr || !IsPlainBlur(*secondParams)) {
+        return nullptr;
+    }
+    auto radius = GEFilterFusionPass::CombineBlurRadius(firstParams->radius, secondParams->radius);
+    return MakeMesa(MakeMesaParams(radius, 0.f, 0.f));
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> FuseMesaKawase(
+    const Drawing::GEVisualEffectImpl& first, const Drawing::GEVisualEffectImpl& second)
+{
+    auto&& firstParams = first.GetMESAParams();
+    auto&& secondParams = second.GetKawaseParams();
+    if (firstParams == nullptr || secondParams == nullptr || firstParams->isDirection) {
+        return nullptr;
+    }
+    auto params = *firstParams;
+    params.radius = GEFilterFusionPass::CombineBlurRadius(firstParams->radius, secondParams->radius);
+    return MakeMesa(params);
+}
+} // namespace
+
+GEFilterFusionPass::GEFilterFusionPass() : rules_(GetDefaultRules()) {}
+
+GEFilterFusionPass::GEFilterFusionPass(std::vector<GEFilterFusionRule> rules) : rules_(std::move(rules)) {}
+
+std::string_view GEFilterFusionPass::GetLogName() const
+{
+    return "GEFilterFusionPass";
+}
+
+const std::vector<GEFilterFusionRule>& GEFilterFusionPass::GetDefaultRules()
+{
+    static const std::vector<GEFilterFusionRule> rules = {
+        { "GreyKawaseToMesa", GEFilterType::GREY, GEFilterType::KAWASE_BLUR, FuseGreyKawase },
+        { "GreyMesaToMesa", GEFilterType::GREY, GEFilterType::MESA_BLUR, FuseGreyMesa },
+        { "KawaseKawase", GEFilterType::KAWASE_BLUR, GEFilterType::KAWASE_BLUR, FuseKawaseKawase },
+        { "MesaMesa", GEFilterType::MESA_BLUR, GEFilterType::MESA_BLUR, FuseMesaMesa },
+        { "KawaseMesa", GEFilterType::KAWASE_BLUR, GEFilterType::MESA_BLUR, FuseKawaseMesa },
+        { "MesaKawase", GEFilterType::MESA_BLUR, GEFilterType::KAWASE_BLUR, FuseMesaKawase },
+    };
+    return rules;
+}
+
+std::vector<GEFilterFusionRule> GEFilterFusionPass::SelectDefaultRules(std::initializer_list<std::string_view> names)
+{
+    std::vector<GEFilterFusionRule> rules;
+    for (const auto& rule : GetDefaultRules()) {
+        if (std::find(names.begin(), names.end(), rule.name) != names.end()) {
+            rules.push_back(rule);
+        }
+    }
+    return rules;
+}
+
+std::vector<GEFilterFusionRule> GEFilterFusionPass::GetRenderRules()
+{
+    bool isBlurFusionEnabled = IsBlurFusionEnabled();
+    std::vector<GEFilterFusionRule> rules;
+    for (const auto& rule : GetDefaultRules()) {
+        if (isBlurFusionEnabled || !IsBlur(rule.first) || !IsBlur(rule.second)) {
+            rules.push_back(rule);
+        }
+    }
+    return rules;
+}
+
+bool GEFilterFusionPass::IsBlurFusionEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.blurfusion", "0");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 0) == 1;
+#else
+    return false;
+#endif
+}
+
+int GEFilterFusionPass::CombineBlurRadius(int radius1, int radius2)
+{
+    // Radii below 1 do not blur, see GEKawaseBlurShaderFilter and GEMESABlurShaderFilter
+    if (radius1 < 1 || radius2 < 1) {
+        return std::max(radius1, radius2);
+    }
+    float sigma1 = BLUR_SIGMA_SCALE * radius1 + BLUR_SIGMA_OFFSET;
+    float sigma2 = BLUR_SIGMA_SCALE * radius2 + BLUR_SIGMA_OFFSET;
+    float sigma = std::sqrt(sigma1 * sigma1 + sigma2 * sigma2);
+    return static_cast<int>(std::lround((sigma - BLUR_SIGMA_OFFSET) / BLUR_SIGMA_SCALE));
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> GEFilterFusionPass::TryFuse(
+    GEFilterComposable& first, GEFilterComposable& second)
+{
+    auto firstEffect = first.GetEffect();
+    auto secondEffect = second.GetEffect();
+    if (firstEffect == nullptr || secondEffect == nullptr) {
+        return nullptr;
+    }
+    auto firstImpl = firstEffect->GetImpl();
+    auto secondImpl = secondEffect->GetImpl();
+    if (firstImpl == nullptr || secondImpl == nullptr) {
+        return nullptr;
+    }
+    auto firstType = firstImpl->GetFilterType();
+    auto secondType = secondImpl->GetFilterType();
+    for (const auto& rule : rules_) {
+        if (rule.first != firstType || rule.second != secondType) {
+            continue;
+        }
+        if (auto fused = rule.rewrite(*firstImpl, *secondImpl)) {
+            InheritEffectState(*firstEffect, *fused);
+            firedRules_.push_back(rule.name);
+            LOGD("GEFilterFusionPass::Run %{public}s fused", rule.name.data());
+            return fused;
+        }
+    }
+    return nullptr;
+}
+
+GEFilterComposerPassResult GEFilterFusionPass::Run(std::vector<GEFilterComposable>& composables)
+{
+    firedRules_.clear();
+    std::vector<GEFilterComposable> resultComposables;
+    resultComposables.reserve(composables.size());
+    for (auto& composable : composables) {
+        if (!resultComposables.empty()) {
+            if (auto fused = TryFuse(resultComposables.back(), composable)) {
+                resultComposables.back() = GEFilterComposable(fused);
+                continue;
+            }
+        }
+        resultComposables.push_back(composable);
+    }
+    bool composed = !firedRules_.empty();
+    if (composed) {
+        composables.swap(resultComposables);
+    }
+    return GEFilterComposerPassResult { composed };
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_filter_result_cache.h"
+
+#include "ge_image_cache_provider.h"
+#include "ge_log.h"
+#include "ge_params_hasher.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+bool IsSameRect(const Drawing::Rect& lhs, const Drawing::Rect& rhs)
+{
+    return lhs.GetLeft() == rhs.GetLeft() && lhs.GetTop() == rhs.GetTop() && lhs.GetRight() == rhs.GetRight() &&
+        lhs.GetBottom() == rhs.GetBottom();
+}
+} // namespace
+
+bool GEFilterResultCache::Key::operator==(const Key& other) const
+{
+    return type == other.type && paramsHash == other.paramsHash && imageId == other.imageId &&
+        stateHash == other.stateHash && IsSameRect(src, other.src) && IsSameRect(dst, other.dst);
+}
+
+size_t GEFilterResultCache::KeyHash::operator()(const Key& key) const
+{
+    Drawing::GEParamsHasher hasher(key.paramsHash);
+    hasher.Combine(key.type);
+    hasher.Combine(key.imageId);
+    hasher.Combine(key.stateHash);
+    for (const auto& rect : { key.src, key.dst }) {
+        hasher.Combine(rect.GetLeft());
+        hasher.Combine(rect.GetTop());
+        hasher.Combine(rect.GetRight());
+        hasher.Combine(rect.GetBottom());
+    }
+    return static_cast<size_t>(hasher.GetResult());
+}
+
+size_t GEFilterResultCache::GetImageBytes(const Drawing::Image& image)
+{
+    return GEImageCache::GetImageBytes(image);
+}
+
+std::shared_ptr<Drawing::Image> GEFilterResultCache::Find(const Key& key)
+{
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        ++missCount_;
+        return nullptr;
+    }
+    ++hitCount_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->image;
+}
+
+bool GEFilterResultCache::Store(const Key& key, const std::shared_ptr<Drawing::Image>& image,
+    std::vector<std::shared_ptr<const void>> retained)
+{
+    if (image == nullptr) {
+        return false;
+    }
+    size_t bytes = GetImageBytes(*image);
+    if (bytes > byteBudget_) {
+        LOGD("GEFilterResultCache::Store image of %{public}zu bytes exceeds budget %{public}zu", bytes, byteBudget_);
+        return false;
+    }
+    if (auto it = index_.find(key); it != index_.end()) {
+        EraseEntry(it->second);
+    }
+    entries_.push_front({ key, image, bytes, std::move(retained) });
+    index_.emplace(key, entries_.begin());
+    usedBytes_ += bytes;
+    EvictToBudget();
+    return true;
+}
+
+template<typename Predicate>
+void GEFilterResultCache::EraseIf(Predicate predicate)
+{
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        auto current = it++;
+        if (predicate(*current)) {
+            EraseEntry(current);
+        }
+    }
+}
+
+void GEFilterResultCache::InvalidateImage(uint32_t imageId)
+{
+    EraseIf([imageId](const Entry& entry) { return entry.key.imageId == imageId; });
+}
+
+void GEFilterResultCache::InvalidateType(Drawing::GEFilterType type)
+{
+    EraseIf([type](const Entry& entry) { return entry.key.type == type; });
+}
+
+void GEFilterResultCache::Clear()
+{
+    entries_.clear();
+    index_.clear();
+    usedBytes_ = 0;
+}
+
+void GEFilterResultCache::SetByteBudget(size_t byteBudget)
+{
+    byteBudget_ = byteBudget;
+    EvictToBudget();
+}
+
+void GEFilterResultCache::EraseEntry(EntryList::iterator it)
+{
+    usedBytes_ -= it->bytes;
+    index_.erase(it->key);
+    entries_.erase(it);
+}
+
+void GEFilterResultCache::EvictToBudget()
+{
+    while (usedBytes_ > byteBudget_ && !entries_.empty()) {
+        EraseEntry(std::prev(entries_.end()));
+    }
+}
+
+} // namespace Rosen
+} // namespace OHOS
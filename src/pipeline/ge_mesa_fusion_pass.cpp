@@ -14,83 +14,15 @@
  */
 #include "ge_mesa_fusion_pass.h"
 
-#include <memory>
-
-#include "ge_filter_type.h"
-#include "ge_shader_filter_params.h"
-
 namespace OHOS {
 namespace Rosen {
 
+GEMesaFusionPass::GEMesaFusionPass() : GEFilterFusionPass(SelectDefaultRules({ "GreyKawaseToMesa" })) {}
+
 std::string_view GEMesaFusionPass::GetLogName() const
 {
     return "GEMesaFusionPass";
 }
 
-GEFilterComposerPassResult GEMesaFusionPass::Run(std::vector<GEFilterComposable>& composables)
-{
-    using Drawing::GEFilterType;
-    std::vector<GEFilterComposable> resultComposables;
-    bool composed = false;
-    for (size_t i = 0; i < composables.size(); ++i) {
-        if (i == composables.size() - 1) { // The last one when composables.size() is odd
-            resultComposables.push_back(composables[i]);
-            continue;
-        }
-        size_t j = i + 1;
-        auto iEffect = composables[i].GetEffect();
-        auto jEffect = composables[j].GetEffect();
-        if (iEffect == nullptr || jEffect == nullptr) {
-            resultComposables.push_back(composables[i]);
-            continue;
-        }
-        auto iImpl = iEffect->GetImpl();
-        auto jImpl = jEffect->GetImpl();
-        if (iImpl == nullptr || jImpl == nullptr) {
-            resultComposables.push_back(composables[i]);
-            continue;
-        }
-        if (iImpl->GetFilterType() == GEFilterType::GREY && jImpl->GetFilterType() == GEFilterType::KAWASE_BLUR) {
-            auto&& greyParams = iImpl->GetGreyParams();
-            auto&& blurParams = jImpl->GetKawaseParams();
-            if (greyParams == nullptr || blurParams == nullptr) {
-                LOGW("GEMesaFusionPass::Run greyParams or blurParams is null, skip fusion");
-                resultComposables.push_back(composables[i]);
-                continue;
-            }
-            resultComposables.push_back(ComposeGreyKawase(greyParams, blurParams));
-            i = j; // consumed 2 effects, skip composed j, next loop will be j+1
-            composed = true;
-            LOGD("GEMesaFusionPass::Run Grey Kawase fused");
-        } else {
-            resultComposables.push_back(composables[i]);
-        }
-    }
-    if (composed) {
-        composables.swap(resultComposables);
-    }
-    return GEFilterComposerPassResult { composed };
-}
-
-std::shared_ptr<Drawing::GEVisualEffect> GEMesaFusionPass::ComposeGreyKawase(
-    const std::shared_ptr<Drawing::GEGreyShaderFilterParams>& greyParams,
-    const std::shared_ptr<Drawing::GEKawaseBlurShaderFilterParams>& blurParams)
-{
-    auto mesaFilter =
-        std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_MESA_BLUR, Drawing::DrawingPaintType::BRUSH);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_RADIUS, blurParams->radius);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_GREY_COEF_1, greyParams->greyCoef1);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_GREY_COEF_2, greyParams->greyCoef2);
-    // Setting to zero is intentional (See RSMESABlurShaderFilter::GenerateGEVisualEffect)
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_X, 0.f);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_Y, 0.f);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_Z, 0.f);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_OFFSET_W, 0.f);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_TILE_MODE, 0);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_WIDTH, 0.f);
-    mesaFilter->SetParam(Drawing::GE_FILTER_MESA_BLUR_STRETCH_HEIGHT, 0.f);
-    return mesaFilter;
-}
-
 } // namespace Rosen
 } // namespace OHOS
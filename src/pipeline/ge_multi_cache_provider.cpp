@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_multi_cache_provider.h"
+
+#include <algorithm>
+
+#include "ge_log.h"
+
+namespace OHOS {
+namespace Rosen {
+
+const IGECache* GEMultiCacheProvider::GetFirst() const
+{
+    return entries_.empty() ? nullptr : entries_.front().cache.get();
+}
+
+bool GEMultiCacheProvider::Store(const IGECache& cache)
+{
+    return StoreByKey(cache, DEFAULT_KEY);
+}
+
+const IGECache* GEMultiCacheProvider::GetByKey(ExactDowncastUtils::TypeID typeId, uint64_t key) const
+{
+    auto it = FindEntry(typeId.id, key);
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+    entries_.splice(entries_.begin(), entries_, it);
+    return it->cache.get();
+}
+
+bool GEMultiCacheProvider::StoreByKey(const IGECache& cache, uint64_t key)
+{
+    auto copy = cache.Clone();
+    if (copy == nullptr) {
+        LOGE("GEMultiCacheProvider::StoreByKey cache is not clonable");
+        return false;
+    }
+    size_t bytes = copy->GetByteSize();
+    if (bytes > byteBudget_ || maxEntries_ == 0) {
+        LOGD("GEMultiCacheProvider::StoreByKey cache of %{public}zu bytes does not fit", bytes);
+        return false;
+    }
+    auto typeId = cache.GetExactTypeID().id;
+    auto it = FindEntry(typeId, key);
+    if (it != entries_.end()) {
+        usedBytes_ -= it->bytes;
+        entries_.erase(it);
+    }
+    entries_.push_front({ typeId, key, std::move(copy), bytes });
+    usedBytes_ += bytes;
+    EvictToBudget();
+    return true;
+}
+
+bool GEMultiCacheProvider::Erase(ExactDowncastUtils::TypeID typeId, uint64_t key)
+{
+    auto it = FindEntry(typeId.id, key);
+    if (it == entries_.end()) {
+        return false;
+    }
+    usedBytes_ -= it->bytes;
+    entries_.erase(it);
+    return true;
+}
+
+void GEMultiCacheProvider::Clear()
+{
+    entries_.clear();
+    usedBytes_ = 0;
+}
+
+void GEMultiCacheProvider::SetByteBudget(size_t byteBudget)
+{
+    byteBudget_ = byteBudget;
+    EvictToBudget();
+}
+
+void GEMultiCacheProvider::SetMaxEntries(size_t maxEntries)
+{
+    maxEntries_ = maxEntries;
+    EvictToBudget();
+}
+
+void GEMultiCacheProvider::SetEvictionPolicy(EvictionPolicy policy)
+{
+    policy_ = policy;
+}
+
+GEMultiCacheProvider::EntryList::iterator GEMultiCacheProvider::FindEntry(
+    ExactDowncastUtils::TypeID::RawTypeID typeId, uint64_t key) const
+{
+    return std::find_if(entries_.begin(), entries_.end(),
+        [typeId, key](const Entry& entry) { return entry.typeId == typeId && entry.key == key; });
+}
+
+GEMultiCacheProvider::EntryList::iterator GEMultiCacheProvider::PickVictim()
+{
+    // Never evict the entry just stored, it is at the front
+    auto victim = std::prev(entries_.end());
+    if (policy_ == EvictionPolicy::COST) {
+        for (auto it = victim; it != entries_.begin(); --it) {
+            if (it->bytes > victim->bytes) {
+                victim = it;
+            }
+        }
+    }
+    return victim;
+}
+
+void GEMultiCacheProvider::EvictToBudget()
+{
+    while (entries_.size() > 1 && (usedBytes_ > byteBudget_ || entries_.size() > maxEntries_)) {
+        auto victim = PickVictim();
+        usedBytes_ -= victim->bytes;
+        entries_.erase(victim);
+    }
+    // A single entry over the budget only remains after the budget shrinks
+    if (!entries_.empty() && (usedBytes_ > byteBudget_ || entries_.size() > maxEntries_)) {
+        Clear();
+    }
+}
+
+} // namespace Rosen
+} // namespace OHOS
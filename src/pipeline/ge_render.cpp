@@ -17,12 +17,15 @@
 #include "core/ge_effect_factory.h"
 #include "ge_direct_draw_on_canvas_pass.h"
 #include "ge_filter_composer.h"
+#include "ge_filter_fusion_pass.h"
 #include "ge_hps_build_pass.h"
 #include "ge_hps_effect_filter.h"
 #include "ge_hps_upscale_pass.h"
 #include "ge_log.h"
-#include "ge_mesa_fusion_pass.h"
+#include "ge_params_hasher.h"
+#include "ge_sdf_evaluation_cache.h"
 #include "ge_system_properties.h"
+#include "ge_transient_surface_pool.h"
 #include "ge_visual_effect_impl.h"
 
 namespace OHOS {
@@ -68,15 +71,91 @@ std::shared_ptr<Drawing::Image> GERender::ApplyImageEffect(Drawing::Canvas& canv
         LOGE("GERender::ApplyImageEffect image is null");
         return nullptr;
     }
+    compiledChain_.Update(veContainer);
+    // Blur passes of the filters lease their intermediate surfaces within this frame
+    GETransientSurfacePool::FrameScope surfaceFrame;
     auto resImage = context.image;
+    // Cached results are per filter, chained filters leave no intermediate image to cache
+    if (filterResultCache_ != nullptr) {
+        for (auto& vef: veContainer.GetFilters()) {
+            ShaderFilterEffectContext innerContext {resImage, context.src, context.dst, context.geCacheProvider,
+                GetDirtyRect(context, resImage)};
+            ProcessShaderFilter(canvas, vef, resImage, innerContext);
+        }
+        return resImage;
+    }
+
+    std::vector<ChainedShaderFilter> chain;
     for (auto& vef: veContainer.GetFilters()) {
-        ShaderFilterEffectContext innerContext {resImage, context.src, context.dst, context.geCacheProvider};
-        ProcessShaderFilter(canvas, vef, resImage, innerContext);
+        // Filters waiting in chain read the output of the ones before them, not resImage
+        ShaderFilterEffectContext innerContext {resImage, context.src, context.dst, context.geCacheProvider,
+            chain.empty() ? GetDirtyRect(context, resImage) : std::nullopt};
+        std::shared_ptr<GEShaderFilter> geShaderFilter;
+        if (!BeforeApplyShaderFilter(canvas, vef, innerContext, geShaderFilter)) {
+            continue;
+        }
+        if (geShaderFilter->SupportsShaderChaining()) {
+            chain.push_back({vef, geShaderFilter});
+            continue;
+        }
+        ApplyShaderChain(canvas, chain, resImage, context);
+        resImage = geShaderFilter->ProcessImage(canvas, resImage, context.src, context.dst);
+        AfterApplyShaderFilter(canvas, *vef, innerContext, *geShaderFilter);
     }
+    ApplyShaderChain(canvas, chain, resImage, context);
 
     return resImage;
 }
 
+std::optional<Drawing::Rect> GERender::GetDirtyRect(const ShaderFilterEffectContext& context,
+    const std::shared_ptr<Drawing::Image>& image)
+{
+    // Filters before it may have changed any pixel of the image
+    return image == context.image ? context.dirtyRect : std::nullopt;
+}
+
+void GERender::ApplyShaderChain(Drawing::Canvas& canvas, std::vector<ChainedShaderFilter>& chain,
+    std::shared_ptr<Drawing::Image>& resImage, const ShaderFilterEffectContext& context)
+{
+    // A lone filter gains nothing from chaining and runs as before
+    bool chainShaders = chain.size() > 1;
+    std::shared_ptr<Drawing::ShaderEffect> chainShader;
+    size_t chainLength = 0;
+    auto rasterizeChain = [&canvas, &resImage, &chainShader, &chainLength]() {
+        if (chainShader == nullptr) {
+            return;
+        }
+        auto chainImage = GEShaderFilter::MakeChainedImage(canvas, chainShader, resImage->GetImageInfo());
+        if (chainImage != nullptr) {
+            LOGD("GERender::ApplyShaderChain %{public}zu filters drawn in one pass", chainLength);
+            resImage = chainImage;
+        } else {
+            LOGE("GERender::ApplyShaderChain failed to draw %{public}zu chained filters", chainLength);
+        }
+        chainShader = nullptr;
+        chainLength = 0;
+    };
+
+    for (auto& [visualEffect, geShaderFilter] : chain) {
+        ShaderFilterEffectContext innerContext {resImage, context.src, context.dst, context.geCacheProvider};
+        std::shared_ptr<Drawing::ShaderEffect> shader;
+        if (chainShaders && resImage != nullptr) {
+            auto input = chainShader ? chainShader : GEShaderFilter::MakeChainInputShader(*resImage);
+            shader = geShaderFilter->MakeChainedShader(input, resImage->GetImageInfo());
+        }
+        if (shader != nullptr) {
+            chainShader = shader;
+            ++chainLength;
+        } else {
+            rasterizeChain();
+            resImage = geShaderFilter->ProcessImage(canvas, resImage, context.src, context.dst);
+        }
+        AfterApplyShaderFilter(canvas, *visualEffect, innerContext, *geShaderFilter);
+    }
+    rasterizeChain();
+    chain.clear();
+}
+
 bool GERender::BeforeApplyShaderFilter(Drawing::Canvas& canvas,
     const std::shared_ptr<Drawing::GEVisualEffect>& visualEffect, const ShaderFilterEffectContext& context,
     std::shared_ptr<GEShaderFilter>& geShaderFilter)
@@ -86,7 +165,14 @@ bool GERender::BeforeApplyShaderFilter(Drawing::Canvas& canvas,
         return false;
     }
     auto ve = visualEffect->GetImpl();
-    geShaderFilter = GenerateShaderFilter(visualEffect);
+    geShaderFilter = compiledChain_.AcquireFilter(ve);
+    if (geShaderFilter != nullptr) {
+        // Compiled filters outlive the frame, canvas info may differ from the one seen at compile time
+        geShaderFilter->SetShaderFilterCanvasinfo(visualEffect->GetCanvasInfo());
+    } else {
+        // Effects created by composer passes (e.g. GEFilterFusionPass) are not compiled
+        geShaderFilter = GenerateShaderFilter(visualEffect);
+    }
     if (geShaderFilter == nullptr) {
         LOGD("GERender::BeforeApplyShaderFilter geShaderFilter is null");
         return false;
@@ -94,6 +180,7 @@ bool GERender::BeforeApplyShaderFilter(Drawing::Canvas& canvas,
     geShaderFilter->SetSupportHeadroom(visualEffect->GetSupportHeadroom());
     geShaderFilter->SetCache(ve->GetCache());
     geShaderFilter->SetCacheProvider(context.geCacheProvider);
+    geShaderFilter->SetDirtyRect(context.dirtyRect);
     geShaderFilter->Preprocess(canvas, context.src, context.dst);
     return true;
 }
@@ -104,14 +191,61 @@ bool GERender::AfterApplyShaderFilter(Drawing::Canvas& canvas, const Drawing::GE
     // Update information after executing the shader filter
     auto ve = visualEffect.GetImpl();
     ve->SetCache(geShaderFilter.GetCache());
-    if (ve->GetFilterType() == Drawing::GEVisualEffectImpl::FilterType::GASIFY ||
-        ve->GetFilterType() == Drawing::GEVisualEffectImpl::FilterType::PARTICLE_ABLATION) {
+    UpdateExpansionState(ve->GetFilterType(), context.src);
+    return true;
+}
+
+void GERender::UpdateExpansionState(Drawing::GEFilterType type, const Drawing::Rect& src)
+{
+    if (type == Drawing::GEVisualEffectImpl::FilterType::GASIFY ||
+        type == Drawing::GEVisualEffectImpl::FilterType::PARTICLE_ABLATION) {
         isNeedExpansionFilter_ = true;
-        expansionRect_.SetLeft(context.src.GetLeft());
-        expansionRect_.SetTop(context.src.GetTop());
-        expansionRect_.SetRight(context.src.GetRight());
-        expansionRect_.SetBottom(context.src.GetBottom());
+        expansionRect_.SetLeft(src.GetLeft());
+        expansionRect_.SetTop(src.GetTop());
+        expansionRect_.SetRight(src.GetRight());
+        expansionRect_.SetBottom(src.GetBottom());
+    }
+}
+
+void GERender::SetFilterResultCacheEnabled(bool enabled, size_t byteBudget)
+{
+    if (!enabled) {
+        filterResultCache_ = nullptr;
+        return;
+    }
+    if (filterResultCache_ == nullptr) {
+        filterResultCache_ = std::make_unique<GEFilterResultCache>(byteBudget);
+    } else {
+        filterResultCache_->SetByteBudget(byteBudget);
     }
+}
+
+bool GERender::MakeFilterResultCacheKey(Drawing::Canvas& canvas, const Drawing::GEVisualEffect& visualEffect,
+    const ShaderFilterEffectContext& context, GEFilterResultCache::Key& outKey,
+    const Drawing::GEParamsHash*& outParamsHash)
+{
+    const auto& canvasInfo = visualEffect.GetCanvasInfo();
+    // Filters using a cache provider may reuse their own results in ways the key does not capture
+    if (context.image == nullptr || context.geCacheProvider != nullptr || canvasInfo.disableFilterCache) {
+        return false;
+    }
+    auto ve = visualEffect.GetImpl();
+    outParamsHash = ve ? ve->GetParamsHash() : nullptr;
+    if (outParamsHash == nullptr) {
+        return false;
+    }
+    Drawing::GEParamsHasher stateHasher;
+    stateHasher.Combine(canvas.GetTotalMatrix());
+    stateHasher.Combine(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(canvas.GetGPUContext().get())));
+    stateHasher.Combine(canvasInfo.geoWidth);
+    stateHasher.Combine(canvasInfo.geoHeight);
+    stateHasher.Combine(canvasInfo.tranX);
+    stateHasher.Combine(canvasInfo.tranY);
+    stateHasher.Combine(canvasInfo.mat);
+    stateHasher.Combine(canvasInfo.materialDst);
+    stateHasher.Combine(visualEffect.GetSupportHeadroom());
+    outKey = { ve->GetFilterType(), outParamsHash->value, context.image->GetUniqueID(), context.src, context.dst,
+        stateHasher.GetResult() };
     return true;
 }
 
@@ -138,15 +272,33 @@ GERender::ApplyShaderFilterTarget GERender::ProcessShaderFilter(Drawing::Canvas&
     std::shared_ptr<Drawing::GEVisualEffect> visualEffect, std::shared_ptr<Drawing::Image>& resImage,
     const ShaderFilterEffectContext& context)
 {
+    GEFilterResultCache::Key cacheKey;
+    const Drawing::GEParamsHash* paramsHash = nullptr;
+    bool useResultCache = filterResultCache_ != nullptr && visualEffect != nullptr &&
+        MakeFilterResultCacheKey(canvas, *visualEffect, context, cacheKey, paramsHash);
+    if (useResultCache) {
+        if (auto cachedImage = filterResultCache_->Find(cacheKey)) {
+            LOGD("GERender::ProcessShaderFilter reuse cached result of type %{public}d", (int)cacheKey.type);
+            resImage = cachedImage;
+            UpdateExpansionState(cacheKey.type, context.src);
+            return ApplyShaderFilterTarget::DrawOnImage;
+        }
+    }
+
     std::shared_ptr<GEShaderFilter> geShaderFilter;
     if (!BeforeApplyShaderFilter(canvas, visualEffect, context, geShaderFilter)) {
         return ApplyShaderFilterTarget::Error;
     }
     // When BeforeApplyShaderFilter returning true, geShaderFilter and visualEffect is guranteed not nullptr
+    auto inImage = resImage;
     resImage = geShaderFilter->ProcessImage(canvas, resImage, context.src, context.dst);
     if (!AfterApplyShaderFilter(canvas, *visualEffect, context, *geShaderFilter)) {
         return ApplyShaderFilterTarget::Error;
     }
+    // A filter returning its input has nothing worth caching
+    if (useResultCache && resImage != inImage) {
+        filterResultCache_->Store(cacheKey, resImage, paramsHash->retained);
+    }
     return ApplyShaderFilterTarget::DrawOnImage;
 }
 
@@ -162,7 +314,7 @@ static bool ComposeEffects(Drawing::Canvas& canvas,
     }
     GEFilterComposer composer;
     composer.Add<GEHpsBuildPass>(canvas, context);
-    composer.Add<GEMesaFusionPass>();
+    composer.Add<GEFilterFusionPass>(GEFilterFusionPass::GetRenderRules());
     composer.Add<GEHpsUpscalePass>();
     composer.Add<GEDirectDrawOnCanvasPass>();
     composables = GEFilterComposer::BuildComposables(visualEffects);
@@ -186,6 +338,8 @@ GERender::ApplyHpsGEResult GERender::ApplyHpsGEImageEffect(Drawing::Canvas& canv
     if (!ComposeEffects(canvas, visualEffects, context, composables)) {
         return ApplyHpsGEResult::CanvasNotDrawnAndHpsNotApplied();
     }
+    compiledChain_.Update(veContainer);
+    GETransientSurfacePool::FrameScope surfaceFrame;
     auto currentImage = context.image;
     std::shared_ptr<Drawing::Image> resImage = nullptr;
     bool appliedHpsBlur = false;
@@ -296,6 +450,8 @@ void GERender::DrawShaderEffect(Drawing::Canvas& canvas, Drawing::GEVisualEffect
 {
     LOGD("GERender::shaderEffects %{public}zu", veContainer.GetFilters().size());
     std::vector<std::shared_ptr<GEShader>> shaderEffects;
+    // Effects of one container sharing a shape evaluate it once
+    Drawing::GESDFEvaluationCache::FrameScope sdfFrame;
     for (auto vef : veContainer.GetFilters()) {
         if (vef == nullptr) {
             LOGD("GERender::DrawShaderEffect vef is null");
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_shader_prewarm.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "draw/canvas.h"
+#include "ge_log.h"
+#include "ge_shader.h"
+#include "ge_shader_disk_cache.h"
+#include "ge_shader_filter.h"
+#include "ge_shader_mask.h"
+#include "ge_shader_shape.h"
+#include "ge_trace.h"
+#include "ge_visual_effect_impl.h"
+#include "image/bitmap.h"
+
+namespace OHOS {
+namespace GraphicsEffectEngine {
+namespace {
+using Rosen::Drawing::GEFilterType;
+
+uint64_t ElapsedNs(std::chrono::steady_clock::time_point start)
+{
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+uint32_t ClampThreadCount(uint32_t threadCount, size_t jobCount)
+{
+    if (threadCount == 0) {
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    return std::clamp(threadCount, 1u, static_cast<uint32_t>(std::max<size_t>(jobCount, 1)));
+}
+
+// Runs job(index) for every index in [0, jobCount) on threadCount threads, the calling thread included
+template<typename Job>
+void ParallelFor(size_t jobCount, uint32_t threadCount, const Job& job)
+{
+    // Workers pick the next index until none is left
+    std::atomic<size_t> next { 0 };
+    auto worker = [jobCount, &next, &job]() {
+        for (size_t index = next.fetch_add(1); index < jobCount; index = next.fetch_add(1)) {
+            job(index);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (uint32_t i = 1; i < threadCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+}
+
+void RunFilter(const std::shared_ptr<Rosen::Drawing::IGEFilterType>& effect, Rosen::Drawing::Canvas& canvas,
+    const std::shared_ptr<Rosen::Drawing::Image>& image, const Rosen::Drawing::Rect& rect)
+{
+    auto filter = std::static_pointer_cast<Rosen::GEShaderFilter>(effect);
+    filter->Preprocess(canvas, rect, rect);
+    filter->ProcessImage(canvas, image, rect, rect);
+}
+
+void RunShader(const std::shared_ptr<Rosen::Drawing::IGEFilterType>& effect, Rosen::Drawing::Canvas& canvas,
+    const Rosen::Drawing::Rect& rect)
+{
+    std::static_pointer_cast<Rosen::GEShader>(effect)->DrawShader(canvas, rect);
+}
+
+void RunMask(const std::shared_ptr<Rosen::Drawing::IGEFilterType>& effect, float size)
+{
+    auto mask = std::static_pointer_cast<Rosen::Drawing::GEShaderMask>(effect);
+    mask->GenerateDrawingShader(size, size);
+    mask->GenerateDrawingShaderHasNormal(size, size);
+}
+
+void RunShape(const std::shared_ptr<Rosen::Drawing::IGEFilterType>& effect, Rosen::Drawing::Canvas& canvas,
+    float size)
+{
+    auto shape = std::static_pointer_cast<Rosen::Drawing::GEShaderShape>(effect);
+    shape->GenerateDrawingShader(canvas, size, size);
+    shape->GenerateDrawingShaderHasNormal(canvas, size, size);
+}
+} // namespace
+
+GEShaderPrewarm::EffectReport GEShaderPrewarm::RunEffect(GEFilterType type)
+{
+    EffectReport report;
+    report.type = type;
+    report.category = GEEffectFactory::GetCategory(type);
+    if (!GEEffectFactory::IsRegistered(type) || report.category == GEEffectCategory::UNKNOWN) {
+        return report;
+    }
+    GE_TRACE_NAME_FMT("GEShaderPrewarm::RunEffect type=%d", static_cast<int>(type));
+
+    auto& registry = Rosen::GERuntimeEffectRegistry::GetInstance();
+    auto statsBefore = registry.GetThreadStats();
+    auto start = std::chrono::steady_clock::now();
+
+    auto impl = std::make_shared<Rosen::Drawing::GEVisualEffectImpl>(type);
+    auto effect = GEEffectFactory::Create(impl);
+    report.created = effect != nullptr;
+    if (effect != nullptr) {
+        Rosen::Drawing::Bitmap bitmap;
+        Rosen::Drawing::BitmapFormat format { Rosen::Drawing::COLORTYPE_RGBA_8888, Rosen::Drawing::ALPHATYPE_PREMUL };
+        bitmap.Build(CANVAS_SIZE, CANVAS_SIZE, format);
+        bitmap.ClearWithColor(Rosen::Drawing::Color::COLOR_WHITE);
+        Rosen::Drawing::Canvas canvas;
+        canvas.Bind(bitmap);
+        auto image = bitmap.MakeImage();
+        auto size = static_cast<float>(CANVAS_SIZE);
+        Rosen::Drawing::Rect rect(0.0f, 0.0f, size, size);
+        switch (report.category) {
+            case GEEffectCategory::FILTER:
+                RunFilter(effect, canvas, image, rect);
+                break;
+            case GEEffectCategory::SHADER:
+                RunShader(effect, canvas, rect);
+                break;
+            case GEEffectCategory::MASK:
+                RunMask(effect, size);
+                break;
+            case GEEffectCategory::SHAPE:
+                RunShape(effect, canvas, size);
+                break;
+            default:
+                break;
+        }
+    }
+
+    report.elapsedNs = ElapsedNs(start);
+    auto statsAfter = registry.GetThreadStats();
+    report.compileCount = statsAfter.compileCount - statsBefore.compileCount;
+    report.failureCount = statsAfter.failureCount - statsBefore.failureCount;
+    report.compileTimeNs = statsAfter.compileTimeNs - statsBefore.compileTimeNs;
+    GE_LOGD("GEShaderPrewarm::RunEffect type=%{public}d compiled=%{public}" PRIu64 " in %{public}" PRIu64 "ns",
+        static_cast<int>(type), report.compileCount, report.compileTimeNs);
+    return report;
+}
+
+GEShaderPrewarm::Report GEShaderPrewarm::Run(uint32_t threadCount)
+{
+    GE_TRACE_FUNC();
+    Report report;
+    for (int32_t i = static_cast<int32_t>(GEFilterType::NONE) + 1; i < static_cast<int32_t>(GEFilterType::MAX); ++i) {
+        auto type = static_cast<GEFilterType>(i);
+        if (GEEffectFactory::IsRegistered(type) && GEEffectFactory::GetCategory(type) != GEEffectCategory::UNKNOWN) {
+            report.effects.push_back({ type, GEEffectFactory::GetCategory(type) });
+        }
+    }
+    threadCount = ClampThreadCount(threadCount, report.effects.size());
+    report.threadCount = threadCount;
+
+    auto start = std::chrono::steady_clock::now();
+    // Each job writes only the report of the effect it runs
+    ParallelFor(report.effects.size(), threadCount,
+        [&report](size_t index) { report.effects[index] = RunEffect(report.effects[index].type); });
+    report.wallTimeNs = ElapsedNs(start);
+    report.registryStats = Rosen::GERuntimeEffectRegistry::GetInstance().GetStats();
+    GE_LOGI("GEShaderPrewarm::Run %{public}zu effects on %{public}u threads in %{public}" PRIu64 "ns",
+        report.effects.size(), threadCount, report.wallTimeNs);
+    return report;
+}
+
+size_t GEShaderPrewarm::RunDiskCache(uint32_t threadCount)
+{
+    GE_TRACE_FUNC();
+    auto records = Rosen::GEShaderDiskCache::GetInstance().Load();
+    if (records.empty()) {
+        return 0;
+    }
+    threadCount = ClampThreadCount(threadCount, records.size());
+    auto& registry = Rosen::GERuntimeEffectRegistry::GetInstance();
+    std::atomic<size_t> compiledCount { 0 };
+    auto start = std::chrono::steady_clock::now();
+    ParallelFor(records.size(), threadCount, [&records, &registry, &compiledCount](size_t index) {
+        const auto& record = records[index];
+        auto effect = Rosen::GEShaderDiskCache::HasOptions(record.optionsKey) ?
+            registry.GetOrCreate(record.source, Rosen::GEShaderDiskCache::DecodeOptions(record.optionsKey)) :
+            registry.GetOrCreate(record.source);
+        if (effect != nullptr) {
+            compiledCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    GE_LOGI("GEShaderPrewarm::RunDiskCache %{public}zu of %{public}zu programs on %{public}u threads in "
+        "%{public}" PRIu64 "ns", compiledCount.load(), records.size(), threadCount, ElapsedNs(start));
+    return compiledCount.load();
+}
+
+} // namespace GraphicsEffectEngine
+} // namespace OHOS
@@ -0,0 +1,398 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_cpu_blur.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+#include "ge_float4.h"
+#include "ge_log.h"
+#include "ge_system_properties.h"
+#include "ge_trace.h"
+#include "ge_worker_pool.h"
+#include "image/bitmap.h"
+
+namespace OHOS {
+namespace Rosen {
+
+namespace {
+constexpr size_t RGBA_CHANNELS = 4;
+constexpr float PIXEL_CENTER = 0.5f;
+constexpr float CHANNEL_MAX = 255.0f;
+constexpr float KAWASE_WEIGHT = 0.2f;
+constexpr float MESA_WEIGHT = 0.25f;
+constexpr float MATRIX_EPS = 1e-6f;
+// Constants of random() in the mix shaders
+constexpr float NOISE_DOT_X = 78.233f;
+constexpr float NOISE_DOT_Y = 12.9898f;
+constexpr float NOISE_SCALE = 43758.5453f;
+// IEEE half layout
+constexpr uint32_t HALF_SIGN_SHIFT = 16;
+constexpr uint32_t HALF_EXP_MASK = 0x1f;
+constexpr uint32_t HALF_MANT_MASK = 0x3ff;
+constexpr uint32_t HALF_MANT_BITS = 10;
+constexpr uint32_t HALF_INF = 0x7c00;
+constexpr int32_t HALF_EXP_BIAS = 15;
+constexpr int32_t HALF_EXP_MAX = 31;
+constexpr uint32_t FLOAT_MANT_BITS = 23;
+constexpr uint32_t FLOAT_EXP_MASK = 0xff;
+constexpr uint32_t FLOAT_INF = 0x7f800000;
+constexpr int32_t FLOAT_EXP_BIAS = 127;
+constexpr uint32_t MANT_SHIFT = FLOAT_MANT_BITS - HALF_MANT_BITS;
+constexpr uint32_t HALF_ROUND_BIT = 1u << (MANT_SHIFT - 1);
+
+// One premultiplied RGBA pixel per vector
+using Float4 = GEFloat4;
+
+inline Float4 Lerp(Float4 a, Float4 b, float t)
+{
+    return a + (b - a) * Float4::Splat(t);
+}
+
+bool IsValid(const GECpuBlur::Buffer& buffer)
+{
+    return buffer.width > 0 && buffer.height > 0 &&
+        buffer.pixels.size() == static_cast<size_t>(buffer.width) * buffer.height * RGBA_CHANNELS;
+}
+
+void PrepareBuffer(GECpuBlur::Buffer& buffer, int width, int height)
+{
+    buffer.width = std::max(width, 0);
+    buffer.height = std::max(height, 0);
+    buffer.pixels.resize(static_cast<size_t>(buffer.width) * buffer.height * RGBA_CHANNELS);
+}
+
+// Linear image shader sampling with clamped edges, pixel centers at +0.5
+inline Float4 Sample(const GECpuBlur::Buffer& src, const GECpuBlur::Mapping& mapping, float x, float y)
+{
+    int width = src.width;
+    int height = src.height;
+    float u = std::clamp(x * mapping.scaleX + mapping.transX - PIXEL_CENTER, -1.0f, static_cast<float>(width));
+    float v = std::clamp(y * mapping.scaleY + mapping.transY - PIXEL_CENTER, -1.0f, static_cast<float>(height));
+    float floorU = std::floor(u);
+    float floorV = std::floor(v);
+    int x0 = static_cast<int>(floorU);
+    int y0 = static_cast<int>(floorV);
+    int x1 = std::clamp(x0 + 1, 0, width - 1);
+    int y1 = std::clamp(y0 + 1, 0, height - 1);
+    x0 = std::clamp(x0, 0, width - 1);
+    y0 = std::clamp(y0, 0, height - 1);
+    const float* row0 = src.pixels.data() + static_cast<size_t>(y0) * width * RGBA_CHANNELS;
+    const float* row1 = src.pixels.data() + static_cast<size_t>(y1) * width * RGBA_CHANNELS;
+    float tx = u - floorU;
+    Float4 top = Lerp(Float4::Load(row0 + x0 * RGBA_CHANNELS), Float4::Load(row0 + x1 * RGBA_CHANNELS), tx);
+    Float4 bottom = Lerp(Float4::Load(row1 + x0 * RGBA_CHANNELS), Float4::Load(row1 + x1 * RGBA_CHANNELS), tx);
+    return Lerp(top, bottom, v - floorV);
+}
+
+// Runs rowFunc over [begin, end) row ranges of ROWS_PER_TASK on up to MAX_THREADS threads, the caller included, the
+// others taken from GEWorkerPool
+void ParallelRows(int height, const std::function<void(int, int)>& rowFunc)
+{
+    int taskCount = (height + GECpuBlur::ROWS_PER_TASK - 1) / GECpuBlur::ROWS_PER_TASK;
+    if (taskCount <= 0) {
+        return;
+    }
+    unsigned int threadCount = std::min({ std::max(std::thread::hardware_concurrency(), 1u), GECpuBlur::MAX_THREADS,
+        static_cast<unsigned int>(taskCount) });
+    if (threadCount <= 1) {
+        rowFunc(0, height);
+        return;
+    }
+    GEWorkerPool::GetInstance().Run(taskCount, threadCount - 1, [&rowFunc, height](int task) {
+        int begin = task * GECpuBlur::ROWS_PER_TASK;
+        rowFunc(begin, std::min(begin + GECpuBlur::ROWS_PER_TASK, height));
+    });
+}
+
+float HalfToFloat(uint16_t half)
+{
+    uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << HALF_SIGN_SHIFT;
+    uint32_t exponent = (half >> HALF_MANT_BITS) & HALF_EXP_MASK;
+    uint32_t mantissa = half & HALF_MANT_MASK;
+    uint32_t bits = sign;
+    if (exponent == HALF_EXP_MASK) {
+        bits |= FLOAT_INF | (mantissa << MANT_SHIFT);
+    } else if (exponent != 0) {
+        bits |= ((exponent + FLOAT_EXP_BIAS - HALF_EXP_BIAS) << FLOAT_MANT_BITS) | (mantissa << MANT_SHIFT);
+    } else if (mantissa != 0) {
+        // Subnormal, normalized into the float exponent range
+        int32_t shift = 0;
+        while ((mantissa & (1u << HALF_MANT_BITS)) == 0) {
+            mantissa <<= 1;
+            ++shift;
+        }
+        mantissa &= HALF_MANT_MASK;
+        bits |= (static_cast<uint32_t>(FLOAT_EXP_BIAS - HALF_EXP_BIAS + 1 - shift) << FLOAT_MANT_BITS) |
+            (mantissa << MANT_SHIFT);
+    }
+    float value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+uint16_t FloatToHalf(float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    auto sign = static_cast<uint16_t>((bits >> HALF_SIGN_SHIFT) & 0x8000u);
+    int32_t exponent = static_cast<int32_t>((bits >> FLOAT_MANT_BITS) & FLOAT_EXP_MASK) - FLOAT_EXP_BIAS +
+        HALF_EXP_BIAS;
+    uint32_t mantissa = bits & ((1u << FLOAT_MANT_BITS) - 1);
+    if (exponent <= 0) {
+        // Below the normal half range, flushed to zero like the render targets do
+        return sign;
+    }
+    if (exponent >= HALF_EXP_MAX) {
+        return static_cast<uint16_t>(sign | HALF_INF);
+    }
+    auto half = static_cast<uint16_t>(sign | (static_cast<uint32_t>(exponent) << HALF_MANT_BITS) |
+        (mantissa >> MANT_SHIFT));
+    // Round half up, a carry into the exponent is still the right value
+    if ((mantissa & HALF_ROUND_BIT) != 0) {
+        ++half;
+    }
+    return half;
+}
+
+float Random(float x, float y)
+{
+    float t = std::sin(x * NOISE_DOT_X + y * NOISE_DOT_Y) * NOISE_SCALE;
+    return t - std::floor(t);
+}
+} // namespace
+
+bool GECpuBlur::IsEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.cpublur", "1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 1) != 0;
+#else
+    return true;
+#endif
+}
+
+bool GECpuBlur::ShouldUse(Drawing::Canvas& canvas)
+{
+    return canvas.GetGPUContext() == nullptr && IsEnabled();
+}
+
+bool GECpuBlur::MakeMapping(const Drawing::Matrix& shaderMatrix, Mapping& mapping)
+{
+    Drawing::Matrix inverse;
+    if (!shaderMatrix.Invert(inverse)) {
+        return false;
+    }
+    if (std::abs(inverse.Get(Drawing::Matrix::SKEW_X)) > MATRIX_EPS ||
+        std::abs(inverse.Get(Drawing::Matrix::SKEW_Y)) > MATRIX_EPS ||
+        std::abs(inverse.Get(Drawing::Matrix::PERSP_0)) > MATRIX_EPS ||
+        std::abs(inverse.Get(Drawing::Matrix::PERSP_1)) > MATRIX_EPS ||
+        std::abs(inverse.Get(Drawing::Matrix::PERSP_2) - 1.0f) > MATRIX_EPS) {
+        return false;
+    }
+    mapping.scaleX = inverse.Get(Drawing::Matrix::SCALE_X);
+    mapping.scaleY = inverse.Get(Drawing::Matrix::SCALE_Y);
+    mapping.transX = inverse.Get(Drawing::Matrix::TRANS_X);
+    mapping.transY = inverse.Get(Drawing::Matrix::TRANS_Y);
+    return true;
+}
+
+bool GECpuBlur::ReadImage(const std::shared_ptr<Drawing::Image>& image, Buffer& buffer)
+{
+    if (image == nullptr || image->GetWidth() <= 0 || image->GetHeight() <= 0) {
+        return false;
+    }
+    GE_TRACE_NAME_FMT("GECpuBlur::ReadImage, Width: %d, Height: %d", image->GetWidth(), image->GetHeight());
+    int width = image->GetWidth();
+    int height = image->GetHeight();
+    bool isF16 = image->GetColorType() == Drawing::ColorType::COLORTYPE_RGBA_F16;
+    Drawing::ImageInfo readInfo(width, height,
+        isF16 ? Drawing::ColorType::COLORTYPE_RGBA_F16 : Drawing::ColorType::COLORTYPE_RGBA_8888,
+        Drawing::AlphaType::ALPHATYPE_PREMUL);
+    PrepareBuffer(buffer, width, height);
+    size_t rowChannels = static_cast<size_t>(width) * RGBA_CHANNELS;
+    if (isF16) {
+        std::vector<uint16_t> halves(buffer.pixels.size());
+        if (!image->ReadPixels(readInfo, halves.data(), rowChannels * sizeof(uint16_t), 0, 0)) {
+            LOGE("GECpuBlur::ReadImage read F16 pixels failed");
+            return false;
+        }
+        ParallelRows(height, [&halves, &buffer, rowChannels](int begin, int end) {
+            for (size_t i = begin * rowChannels; i < end * rowChannels; ++i) {
+                buffer.pixels[i] = HalfToFloat(halves[i]);
+            }
+        });
+        return true;
+    }
+    std::vector<uint8_t> bytes(buffer.pixels.size());
+    if (!image->ReadPixels(readInfo, bytes.data(), rowChannels, 0, 0)) {
+        LOGE("GECpuBlur::ReadImage read pixels failed");
+        return false;
+    }
+    ParallelRows(height, [&bytes, &buffer, rowChannels](int begin, int end) {
+        for (size_t i = begin * rowChannels; i < end * rowChannels; ++i) {
+            buffer.pixels[i] = bytes[i] * (1.0f / CHANNEL_MAX);
+        }
+    });
+    return true;
+}
+
+std::shared_ptr<Drawing::Image> GECpuBlur::MakeImage(const Buffer& buffer, const Drawing::ImageInfo& info)
+{
+    if (!IsValid(buffer) || buffer.width != info.GetWidth() || buffer.height != info.GetHeight()) {
+        LOGE("GECpuBlur::MakeImage buffer does not match the image size");
+        return nullptr;
+    }
+    bool isF16 = info.GetColorType() == Drawing::ColorType::COLORTYPE_RGBA_F16;
+    Drawing::ImageInfo outputInfo(buffer.width, buffer.height,
+        isF16 ? Drawing::ColorType::COLORTYPE_RGBA_F16 : Drawing::ColorType::COLORTYPE_RGBA_8888,
+        info.GetAlphaType(), info.GetColorSpace());
+    Drawing::Bitmap bitmap;
+    if (!bitmap.Build(outputInfo) || bitmap.GetPixels() == nullptr) {
+        LOGE("GECpuBlur::MakeImage bitmap build failed");
+        return nullptr;
+    }
+    auto* output = static_cast<uint8_t*>(bitmap.GetPixels());
+    auto rowBytes = static_cast<size_t>(bitmap.GetRowBytes());
+    size_t rowChannels = static_cast<size_t>(buffer.width) * RGBA_CHANNELS;
+    ParallelRows(buffer.height, [&buffer, output, rowBytes, rowChannels, isF16](int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+            const float* in = buffer.pixels.data() + static_cast<size_t>(y) * rowChannels;
+            uint8_t* row = output + static_cast<size_t>(y) * rowBytes;
+            if (isF16) {
+                auto* out = reinterpret_cast<uint16_t*>(row);
+                for (size_t i = 0; i < rowChannels; ++i) {
+                    out[i] = FloatToHalf(in[i]);
+                }
+                continue;
+            }
+            for (size_t i = 0; i < rowChannels; ++i) {
+                row[i] = static_cast<uint8_t>(std::lround(std::clamp(in[i], 0.0f, 1.0f) * CHANNEL_MAX));
+            }
+        }
+    });
+    return bitmap.MakeImage();
+}
+
+void GECpuBlur::Resample(const Buffer& src, const Mapping& mapping, int width, int height, Buffer& dst)
+{
+    PrepareBuffer(dst, width, height);
+    if (!IsValid(src)) {
+        std::fill(dst.pixels.begin(), dst.pixels.end(), 0.0f);
+        return;
+    }
+    ParallelRows(dst.height, [&src, &mapping, &dst](int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+            float py = y + PIXEL_CENTER;
+            float* out = dst.pixels.data() + static_cast<size_t>(y) * dst.width * RGBA_CHANNELS;
+            for (int x = 0; x < dst.width; ++x) {
+                Sample(src, mapping, x + PIXEL_CENTER, py).Store(out + x * RGBA_CHANNELS);
+            }
+        }
+    });
+}
+
+void GECpuBlur::KawasePass(const Buffer& src, const Mapping& mapping, float offset, float maxX, float maxY,
+    int width, int height, Buffer& dst)
+{
+    PrepareBuffer(dst, width, height);
+    if (!IsValid(src)) {
+        std::fill(dst.pixels.begin(), dst.pixels.end(), 0.0f);
+        return;
+    }
+    GE_TRACE_NAME_FMT("GECpuBlur::KawasePass, Width: %d, Height: %d", width, height);
+    const Float4 weight = Float4::Splat(KAWASE_WEIGHT);
+    ParallelRows(dst.height, [&src, &mapping, &dst, offset, maxX, maxY, weight](int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+            float py = y + PIXEL_CENTER;
+            float down = std::clamp(py + offset, 0.0f, maxY);
+            float up = std::clamp(py - offset, 0.0f, maxY);
+            float* out = dst.pixels.data() + static_cast<size_t>(y) * dst.width * RGBA_CHANNELS;
+            for (int x = 0; x < dst.width; ++x) {
+                float px = x + PIXEL_CENTER;
+                float right = std::clamp(px + offset, 0.0f, maxX);
+                float left = std::clamp(px - offset, 0.0f, maxX);
+                Float4 color = Sample(src, mapping, px, py) + Sample(src, mapping, right, down) +
+                    Sample(src, mapping, right, up) + Sample(src, mapping, left, down) +
+                    Sample(src, mapping, left, up);
+                (color * weight).Store(out + x * RGBA_CHANNELS);
+            }
+        }
+    });
+}
+
+void GECpuBlur::MesaPass(const Buffer& src, const Mapping& mapping, float offsetX, float offsetY, int width,
+    int height, Buffer& dst)
+{
+    PrepareBuffer(dst, width, height);
+    if (!IsValid(src)) {
+        std::fill(dst.pixels.begin(), dst.pixels.end(), 0.0f);
+        return;
+    }
+    GE_TRACE_NAME_FMT("GECpuBlur::MesaPass, Width: %d, Height: %d", width, height);
+    const Float4 weight = Float4::Splat(MESA_WEIGHT);
+    ParallelRows(dst.height, [&src, &mapping, &dst, offsetX, offsetY, weight](int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+            float py = y + PIXEL_CENTER;
+            float* out = dst.pixels.data() + static_cast<size_t>(y) * dst.width * RGBA_CHANNELS;
+            for (int x = 0; x < dst.width; ++x) {
+                float px = x + PIXEL_CENTER;
+                Float4 color = Sample(src, mapping, px + offsetX, py + offsetY) +
+                    Sample(src, mapping, px - offsetY, py + offsetX) +
+                    Sample(src, mapping, px - offsetX, py - offsetY) +
+                    Sample(src, mapping, px + offsetY, py - offsetX);
+                (color * weight).Store(out + x * RGBA_CHANNELS);
+            }
+        }
+    });
+}
+
+void GECpuBlur::MixAndDither(const Buffer& blurred, const Mapping& blurredMapping, const Buffer* original,
+    const Mapping& originalMapping, float mixFactor, float noiseFactor, int width, int height, Buffer& dst)
+{
+    PrepareBuffer(dst, width, height);
+    if (!IsValid(blurred)) {
+        std::fill(dst.pixels.begin(), dst.pixels.end(), 0.0f);
+        return;
+    }
+    GE_TRACE_NAME_FMT("GECpuBlur::MixAndDither, Width: %d, Height: %d", width, height);
+    bool useOriginal = mixFactor < 1.0f && original != nullptr && IsValid(*original);
+    float granularity = noiseFactor / CHANNEL_MAX;
+    ParallelRows(dst.height, [&](int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+            float py = y + PIXEL_CENTER;
+            float* out = dst.pixels.data() + static_cast<size_t>(y) * dst.width * RGBA_CHANNELS;
+            for (int x = 0; x < dst.width; ++x) {
+                float px = x + PIXEL_CENTER;
+                Float4 color = Sample(blurred, blurredMapping, px, py);
+                if (useOriginal) {
+                    color = Lerp(Sample(*original, originalMapping, px, py), color, mixFactor);
+                }
+                float noise = granularity * (Random(px, py) * 2.0f - 1.0f); // 2.0, 1.0: mix(-g, g, r)
+                const float noiseLanes[RGBA_CHANNELS] = { noise, noise, noise, 0.0f };
+                (color + Float4::Load(noiseLanes)).Store(out + x * RGBA_CHANNELS);
+            }
+        }
+    });
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_curve_spatial_index.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+namespace OHOS {
+namespace Rosen {
+
+namespace {
+constexpr float MIDPOINT_FACTOR = 0.5f;
+constexpr size_t MAX_CHILDREN = 4;
+
+// Sorts the (node, curve) pairs by node, then curve
+void SortPairs(std::vector<std::array<uint32_t, 2>>& pairs)
+{
+    std::sort(pairs.begin(), pairs.end());
+}
+
+// Curves paired with nodeId in pairs sorted by SortPairs, as the [begin, end) range
+std::pair<size_t, size_t> FindNodePairs(const std::vector<std::array<uint32_t, 2>>& pairs, uint32_t nodeId)
+{
+    auto begin = std::lower_bound(pairs.begin(), pairs.end(), std::array<uint32_t, 2> { nodeId, 0 });
+    auto end = std::lower_bound(begin, pairs.end(), std::array<uint32_t, 2> { nodeId + 1, 0 });
+    return { static_cast<size_t>(begin - pairs.begin()), static_cast<size_t>(end - pairs.begin()) };
+}
+} // namespace
+
+void GECurveSpatialIndex::Clear()
+{
+    nodes_.clear();
+    indices_.clear();
+    leaves_.clear();
+    emptyCells_.clear();
+    curveBoxes_.clear();
+    builtIndexCount_ = 0;
+}
+
+bool GECurveSpatialIndex::NeedsSplit(const Node& node, size_t curveCount) const
+{
+    if (curveCount <= config_.maxCurvesPerLeaf || node.depth >= config_.maxDepth) {
+        return false;
+    }
+    bool wide = node.bbox[XMAX_I] - node.bbox[XMIN_I] > config_.minNodeSize;
+    bool tall = node.bbox[YMAX_I] - node.bbox[YMIN_I] > config_.minNodeSize;
+    return config_.splitEitherSide ? (wide || tall) : (wide && tall);
+}
+
+bool GECurveSpatialIndex::Contains(uint32_t nodeId, const Box& curveBox) const
+{
+    // A child box lies in its parent box, so touching a node implies touching all of its ancestors
+    return (nodeId == 0 && !config_.clipToRoot) || Intersect(nodes_[nodeId].bbox, curveBox);
+}
+
+void GECurveSpatialIndex::SplitNode(uint32_t nodeId, const std::vector<Box>& curveBoxes)
+{
+    const Node parent = nodes_[nodeId];
+    const Box& box = parent.bbox;
+    float midX = (box[XMIN_I] + box[XMAX_I]) * MIDPOINT_FACTOR;
+    float midY = (box[YMIN_I] + box[YMAX_I]) * MIDPOINT_FACTOR;
+    std::array<Box, MAX_CHILDREN> children;
+    size_t childBoxCount = MAX_CHILDREN;
+    if (config_.halveThinNodes && box[XMAX_I] - box[XMIN_I] <= config_.minNodeSize) {
+        children[0] = { box[XMIN_I], box[XMAX_I], box[YMIN_I], midY }; // Top
+        children[1] = { box[XMIN_I], box[XMAX_I], midY, box[YMAX_I] }; // Bottom
+        childBoxCount = 2; // 2: halves
+    } else if (config_.halveThinNodes && box[YMAX_I] - box[YMIN_I] <= config_.minNodeSize) {
+        children[0] = { box[XMIN_I], midX, box[YMIN_I], box[YMAX_I] }; // Left
+        children[1] = { midX, box[XMAX_I], box[YMIN_I], box[YMAX_I] }; // Right
+        childBoxCount = 2; // 2: halves
+    } else {
+        children[0] = { box[XMIN_I], midX, box[YMIN_I], midY }; // Top-Left
+        children[1] = { midX, box[XMAX_I], box[YMIN_I], midY }; // Top-Right
+        children[2] = { box[XMIN_I], midX, midY, box[YMAX_I] }; // 2: Bottom-Left
+        children[3] = { midX, box[XMAX_I], midY, box[YMAX_I] }; // 3: Bottom-Right
+    }
+
+    auto firstChild = static_cast<uint32_t>(nodes_.size());
+    for (size_t c = 0; c < childBoxCount; ++c) {
+        auto firstIndex = static_cast<uint32_t>(indices_.size());
+        // Indexed access, push_back may reallocate indices_
+        for (uint32_t k = parent.firstIndex; k < parent.firstIndex + parent.indexCount; ++k) {
+            uint32_t curve = indices_[k];
+            if (Intersect(children[c], curveBoxes[curve])) {
+                indices_.push_back(curve);
+            }
+        }
+        auto indexCount = static_cast<uint32_t>(indices_.size()) - firstIndex;
+        if (indexCount == 0) {
+            emptyCells_.push_back(children[c]);
+            continue;
+        }
+        Node child;
+        child.bbox = children[c];
+        child.firstIndex = firstIndex;
+        child.indexCount = indexCount;
+        child.depth = parent.depth + 1;
+        nodes_.push_back(child);
+    }
+    nodes_[nodeId].firstChild = firstChild;
+    nodes_[nodeId].childCount = static_cast<uint32_t>(nodes_.size()) - firstChild;
+}
+
+void GECurveSpatialIndex::Build(const std::vector<Box>& curveBoxes, const Box& rootBox)
+{
+    Clear();
+    curveBoxes_.assign(curveBoxes.begin(), curveBoxes.end());
+    for (uint32_t i = 0; i < static_cast<uint32_t>(curveBoxes.size()); ++i) {
+        if (!config_.clipToRoot || Intersect(rootBox, curveBoxes[i])) {
+            indices_.push_back(i);
+        }
+    }
+    Node root;
+    root.bbox = rootBox;
+    root.indexCount = static_cast<uint32_t>(indices_.size());
+    nodes_.push_back(root);
+
+    // nodes_ grows while walked, appending children in the order a FIFO work queue would pop them
+    for (uint32_t id = 0; id < static_cast<uint32_t>(nodes_.size()); ++id) {
+        if (NeedsSplit(nodes_[id], nodes_[id].indexCount)) {
+            SplitNode(id, curveBoxes);
+        }
+        if (nodes_[id].IsLeaf()) {
+            leaves_.push_back(id);
+        }
+    }
+    builtIndexCount_ = indices_.size();
+}
+
+bool GECurveSpatialIndex::Update(
+    const std::vector<Box>& curveBoxes, const std::vector<uint32_t>& movedCurves, const Box& rootBox)
+{
+    if (nodes_.empty() || curveBoxes.size() != curveBoxes_.size() || rootBox != nodes_[0].bbox) {
+        return false;
+    }
+    movedScratch_.assign(movedCurves.begin(), movedCurves.end());
+    std::sort(movedScratch_.begin(), movedScratch_.end());
+    movedScratch_.erase(std::unique(movedScratch_.begin(), movedScratch_.end()), movedScratch_.end());
+    if (!movedScratch_.empty() && movedScratch_.back() >= curveBoxes.size()) {
+        return false;
+    }
+
+    enterScratch_.clear();
+    leaveScratch_.clear();
+    for (uint32_t curve : movedScratch_) {
+        const Box& oldBox = curveBoxes_[curve];
+        const Box& newBox = curveBoxes[curve];
+        for (const auto& cell : emptyCells_) {
+            if (Intersect(cell, newBox)) {
+                return false;
+            }
+        }
+        for (uint32_t id = 0; id < static_cast<uint32_t>(nodes_.size()); ++id) {
+            bool wasIn = Contains(id, oldBox);
+            bool isIn = Contains(id, newBox);
+            if (isIn && !wasIn) {
+                enterScratch_.push_back({ id, curve });
+            } else if (wasIn && !isIn) {
+                leaveScratch_.push_back({ id, curve });
+            }
+        }
+    }
+    SortPairs(enterScratch_);
+    SortPairs(leaveScratch_);
+
+    // Validate every touched node before rewriting any of them, a failed Update leaves the index as it was
+    size_t appendCount = 0;
+    for (uint32_t id = 0; id < static_cast<uint32_t>(nodes_.size()); ++id) {
+        auto [enterBegin, enterEnd] = FindNodePairs(enterScratch_, id);
+        auto [leaveBegin, leaveEnd] = FindNodePairs(leaveScratch_, id);
+        if (enterBegin == enterEnd && leaveBegin == leaveEnd) {
+            continue;
+        }
+        const Node& node = nodes_[id];
+        size_t newCount = node.indexCount + (enterEnd - enterBegin) - (leaveEnd - leaveBegin);
+        bool split = NeedsSplit(node, newCount);
+        if (newCount == 0 || split == node.IsLeaf()) {
+            return false;
+        }
+        appendCount += newCount;
+    }
+    if (indices_.size() + appendCount > 2 * builtIndexCount_) { // 2: rebuild rather than grow the buffer further
+        return false;
+    }
+
+    indices_.reserve(indices_.size() + appendCount);
+    for (uint32_t id = 0; id < static_cast<uint32_t>(nodes_.size()); ++id) {
+        auto [enterBegin, enterEnd] = FindNodePairs(enterScratch_, id);
+        auto [leaveBegin, leaveEnd] = FindNodePairs(leaveScratch_, id);
+        if (enterBegin == enterEnd && leaveBegin == leaveEnd) {
+            continue;
+        }
+        Node& node = nodes_[id];
+        auto firstIndex = static_cast<uint32_t>(indices_.size());
+        size_t leave = leaveBegin;
+        // Both the node's curves and its leaving curves are ascending, so a merge walk drops them
+        for (uint32_t k = node.firstIndex; k < node.firstIndex + node.indexCount; ++k) {
+            uint32_t curve = indices_[k];
+            while (leave < leaveEnd && leaveScratch_[leave][1] < curve) {
+                ++leave;
+            }
+            if (leave < leaveEnd && leaveScratch_[leave][1] == curve) {
+                continue;
+            }
+            indices_.push_back(curve);
+        }
+        for (size_t enter = enterBegin; enter < enterEnd; ++enter) {
+            indices_.push_back(enterScratch_[enter][1]);
+        }
+        std::inplace_merge(indices_.begin() + firstIndex,
+            indices_.end() - static_cast<std::ptrdiff_t>(enterEnd - enterBegin), indices_.end());
+        node.firstIndex = firstIndex;
+        node.indexCount = static_cast<uint32_t>(indices_.size()) - firstIndex;
+    }
+    for (uint32_t curve : movedScratch_) {
+        curveBoxes_[curve] = curveBoxes[curve];
+    }
+    return true;
+}
+
+bool GECurveSpatialIndex::Refresh(const std::vector<Box>& curveBoxes, const Box& rootBox)
+{
+    if (nodes_.empty() || curveBoxes.size() != curveBoxes_.size() || rootBox != nodes_[0].bbox) {
+        Build(curveBoxes, rootBox);
+        return false;
+    }
+    auto& movedCurves = refreshScratch_;
+    movedCurves.clear();
+    size_t maxMoved = curveBoxes.size() / REFRESH_UPDATE_DIVISOR;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(curveBoxes.size()); ++i) {
+        if (curveBoxes[i] == curveBoxes_[i]) {
+            continue;
+        }
+        if (movedCurves.size() >= maxMoved) {
+            Build(curveBoxes, rootBox);
+            return false;
+        }
+        movedCurves.push_back(i);
+    }
+    if (movedCurves.empty() || Update(curveBoxes, movedCurves, rootBox)) {
+        return true;
+    }
+    Build(curveBoxes, rootBox);
+    return false;
+}
+
+} // namespace Rosen
+} // namespace OHOS
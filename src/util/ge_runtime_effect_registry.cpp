@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_runtime_effect_registry.h"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string_view>
+
+#include "ge_log.h"
+#include "ge_shader_diagnostics.h"
+#include "ge_shader_disk_cache.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+// Compiles run by the current thread, see GetThreadStats
+thread_local uint64_t g_threadCompileCount = 0;
+thread_local uint64_t g_threadFailureCount = 0;
+thread_local uint64_t g_threadCompileTimeNs = 0;
+} // namespace
+
+GERuntimeEffectRegistry& GERuntimeEffectRegistry::GetInstance()
+{
+    // Never destroyed: cached effects must not be released during static destruction, after the graphics backend
+    static GERuntimeEffectRegistry* instance = new GERuntimeEffectRegistry();
+    return *instance;
+}
+
+std::shared_ptr<Drawing::RuntimeEffect> GERuntimeEffectRegistry::GetOrCreate(
+    const std::string& shaderSrc, const GESourceLocation& srcLoc)
+{
+    return GetOrCreateImpl(shaderSrc, nullptr, srcLoc);
+}
+
+std::shared_ptr<Drawing::RuntimeEffect> GERuntimeEffectRegistry::GetOrCreate(
+    const std::string& shaderSrc, const Drawing::RuntimeEffectOptions& options, const GESourceLocation& srcLoc)
+{
+    return GetOrCreateImpl(shaderSrc, &options, srcLoc);
+}
+
+std::shared_ptr<Drawing::RuntimeEffect> GERuntimeEffectRegistry::GetOrCreateImpl(const std::string& shaderSrc,
+    const Drawing::RuntimeEffectOptions* options, const GESourceLocation& srcLoc)
+{
+    uint64_t key = std::hash<std::string_view> {}(shaderSrc);
+    uint32_t optionsKey = GEShaderDiskCache::EncodeOptions(options);
+    if (const Entry* entry = Find(key, optionsKey, shaderSrc)) {
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        return entry->effect;
+    }
+    const Entry* entry = Compile(key, optionsKey, shaderSrc, options, srcLoc);
+    return entry != nullptr ? entry->effect : nullptr;
+}
+
+const GERuntimeEffectRegistry::Entry* GERuntimeEffectRegistry::Find(
+    uint64_t key, uint32_t optionsKey, const std::string& shaderSrc) const
+{
+    // Linear probing, slots are only ever filled so the first empty slot ends the search
+    for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+        const Entry* entry = table_[(key + probe) % TABLE_SIZE].load(std::memory_order_acquire);
+        if (entry == nullptr) {
+            return nullptr;
+        }
+        if (entry->key == key && entry->optionsKey == optionsKey && entry->source == shaderSrc) {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+const GERuntimeEffectRegistry::Entry* GERuntimeEffectRegistry::FindLocked(
+    uint64_t key, uint32_t optionsKey, const std::string& shaderSrc) const
+{
+    if (const Entry* entry = Find(key, optionsKey, shaderSrc)) {
+        return entry;
+    }
+    auto range = overflow_.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->optionsKey == optionsKey && it->second->source == shaderSrc) {
+            return it->second.get();
+        }
+    }
+    return nullptr;
+}
+
+bool GERuntimeEffectRegistry::IsPendingLocked(uint64_t key, uint32_t optionsKey, const std::string& shaderSrc) const
+{
+    return std::any_of(pending_.begin(), pending_.end(), [key, optionsKey, &shaderSrc](const PendingCompile& pending) {
+        return pending.key == key && pending.optionsKey == optionsKey && *pending.source == shaderSrc;
+    });
+}
+
+const GERuntimeEffectRegistry::Entry* GERuntimeEffectRegistry::Compile(uint64_t key, uint32_t optionsKey,
+    const std::string& shaderSrc, const Drawing::RuntimeEffectOptions* options, const GESourceLocation& srcLoc)
+{
+    std::unique_lock<std::mutex> lock(compileMutex_);
+    // Concurrent first uses of a source compile it once, the others wait for the result
+    compileDoneCv_.wait(lock, [this, key, optionsKey, &shaderSrc]() {
+        return !IsPendingLocked(key, optionsKey, shaderSrc);
+    });
+    if (const Entry* entry = FindLocked(key, optionsKey, shaderSrc)) {
+        hitCount_.fetch_add(1, std::memory_order_relaxed);
+        return entry;
+    }
+    pending_.push_back({ key, optionsKey, &shaderSrc });
+    lock.unlock();
+
+    // Compiled without the lock, so that different sources compile in parallel
+    auto start = std::chrono::steady_clock::now();
+    auto effect = options != nullptr ? GECreateRuntimeEffectForShader(shaderSrc, *options, srcLoc)
+                                     : GECreateRuntimeEffectForShader(shaderSrc, srcLoc);
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    auto elapsedNs = static_cast<uint64_t>(elapsed.count());
+    compileCount_.fetch_add(1, std::memory_order_relaxed);
+    compileTimeNs_.fetch_add(elapsedNs, std::memory_order_relaxed);
+    ++g_threadCompileCount;
+    g_threadCompileTimeNs += elapsedNs;
+    if (effect == nullptr) {
+        failureCount_.fetch_add(1, std::memory_order_relaxed);
+        ++g_threadFailureCount;
+        LOGE("GERuntimeEffectRegistry::Compile failed: %{public}s:%{public}u", srcLoc.FileName(), srcLoc.Line());
+    }
+
+    auto entry = std::make_unique<Entry>();
+    entry->key = key;
+    entry->optionsKey = optionsKey;
+    entry->source = shaderSrc;
+    entry->effect = std::move(effect);
+    const Entry* published = entry.get();
+
+    lock.lock();
+    if (Publish(published)) {
+        entry.release(); // Owned by the table from now on, the registry is never destroyed
+    } else {
+        LOGD("GERuntimeEffectRegistry::Compile table full, entry kept in overflow");
+        overflow_.emplace(key, std::move(entry));
+    }
+    entryCount_.fetch_add(1, std::memory_order_relaxed);
+    pending_.erase(std::find_if(pending_.begin(), pending_.end(),
+        [&shaderSrc](const PendingCompile& pending) { return pending.source == &shaderSrc; }));
+    lock.unlock();
+    compileDoneCv_.notify_all();
+    if (published->effect != nullptr) {
+        // Lets the next process start compile it ahead of its first use, see GEShaderPrewarm::RunDiskCache. Written
+        // on the cache's writer thread, the compiling thread is often the render thread
+        GEShaderDiskCache::GetInstance().StoreAsync(shaderSrc, optionsKey);
+    }
+    return published;
+}
+
+bool GERuntimeEffectRegistry::Publish(const Entry* entry)
+{
+    for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+        auto& slot = table_[(entry->key + probe) % TABLE_SIZE];
+        if (slot.load(std::memory_order_relaxed) == nullptr) {
+            // Release pairs with the acquire load in Find, readers see a fully built entry
+            slot.store(entry, std::memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+GERuntimeEffectRegistry::Stats GERuntimeEffectRegistry::GetStats() const
+{
+    Stats stats;
+    stats.hitCount = hitCount_.load(std::memory_order_relaxed);
+    stats.compileCount = compileCount_.load(std::memory_order_relaxed);
+    stats.failureCount = failureCount_.load(std::memory_order_relaxed);
+    stats.compileTimeNs = compileTimeNs_.load(std::memory_order_relaxed);
+    stats.entryCount = entryCount_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+GERuntimeEffectRegistry::Stats GERuntimeEffectRegistry::GetThreadStats() const
+{
+    Stats stats;
+    stats.compileCount = g_threadCompileCount;
+    stats.failureCount = g_threadFailureCount;
+    stats.compileTimeNs = g_threadCompileTimeNs;
+    return stats;
+}
+
+void GERuntimeEffectRegistry::ResetStats()
+{
+    hitCount_.store(0, std::memory_order_relaxed);
+    compileCount_.store(0, std::memory_order_relaxed);
+    failureCount_.store(0, std::memory_order_relaxed);
+    compileTimeNs_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Rosen
+} // namespace OHOS
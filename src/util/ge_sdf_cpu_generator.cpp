@@ -0,0 +1,489 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_sdf_cpu_generator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include "ge_float4.h"
+#include "ge_log.h"
+#include "ge_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+
+namespace {
+constexpr int TILE_SIZE = 16;
+constexpr float PIXEL_CENTER = 0.5f;
+constexpr float ALPHA_MAX = 255.0f;
+constexpr float ALPHA_SCALE = 1.0f / ALPHA_MAX;
+// Squared distance of pixels with no seed, finite so that differences of two of them stay finite
+constexpr float EDT_INF = 1e20f;
+constexpr double COLLINEAR_EPS = 1e-9;
+constexpr double ONE_THIRD = 1.0 / 3.0;
+constexpr double SQRT3 = 1.7320508075688772;
+constexpr float ENDPOINT_MATCH_EPS = 1e-4f;
+constexpr size_t TRANSPOSE_BLOCK = 32;
+
+struct Quad {
+    double x0;
+    double y0;
+    double x1;
+    double y1;
+    double x2;
+    double y2;
+    // Bounding box of the control points, which contains the curve
+    float xmin;
+    float xmax;
+    float ymin;
+    float ymax;
+};
+
+// Seeds GEFloat4::LANES pixels per step without branching on alpha and returns the first pixel left to the caller.
+// 8-bit alpha is zero or full exactly when alpha * 255 is 0 or 255, so the two extremes become 0/1 factors of EDT_INF;
+// the clamped edge distances are 0 at the extremes, which keeps the result equal to the scalar seeding.
+int SeedRowVectorized(const uint8_t* src, size_t pixelStride, int width, float* outerRow, float* innerRow)
+{
+    const GEFloat4 zero = GEFloat4::Splat(0.0f);
+    const GEFloat4 one = GEFloat4::Splat(1.0f);
+    const GEFloat4 inf = GEFloat4::Splat(EDT_INF);
+    const GEFloat4 center = GEFloat4::Splat(PIXEL_CENTER);
+    const GEFloat4 alphaScale = GEFloat4::Splat(ALPHA_SCALE);
+    const GEFloat4 fullBelow = GEFloat4::Splat(ALPHA_MAX - 1.0f);
+    float lanes[GEFloat4::LANES];
+    int x = 0;
+    for (; x + static_cast<int>(GEFloat4::LANES) <= width; x += static_cast<int>(GEFloat4::LANES)) {
+        for (size_t lane = 0; lane < GEFloat4::LANES; ++lane) {
+            lanes[lane] = src[(static_cast<size_t>(x) + lane) * pixelStride];
+        }
+        GEFloat4 raw = GEFloat4::Load(lanes);
+        GEFloat4 d = center - raw * alphaScale;
+        GEFloat4 isEmpty = Max(one - raw, zero);
+        GEFloat4 isFull = Max(raw - fullBelow, zero);
+        GEFloat4 outside = Max(d, zero);
+        GEFloat4 inside = Min(d, zero);
+        (outside * outside + isEmpty * inf).Store(outerRow + x);
+        (inside * inside + isFull * inf).Store(innerRow + x);
+    }
+    return x;
+}
+
+Quad MakeQuad(float x0, float y0, float x1, float y1, float x2, float y2)
+{
+    return { x0, y0, x1, y1, x2, y2, std::min({ x0, x1, x2 }), std::max({ x0, x1, x2 }), std::min({ y0, y1, y2 }),
+        std::max({ y0, y1, y2 }) };
+}
+
+bool IsValidSize(int width, int height)
+{
+    return width > 0 && height > 0 &&
+        static_cast<size_t>(width) * static_cast<size_t>(height) <= GESDFCpuGenerator::MAX_PIXELS;
+}
+
+double SegmentDistanceSq(double px, double py, double ax, double ay, double bx, double by)
+{
+    double abx = bx - ax;
+    double aby = by - ay;
+    double apx = px - ax;
+    double apy = py - ay;
+    double ab2 = abx * abx + aby * aby;
+    double t = ab2 > 0.0 ? std::clamp((apx * abx + apy * aby) / ab2, 0.0, 1.0) : 0.0;
+    double dx = apx - abx * t;
+    double dy = apy - aby * t;
+    return dx * dx + dy * dy;
+}
+
+// A quadratic with collinear control points covers a segment of its line, possibly overshooting the end points
+double CollinearDistanceSq(double px, double py, const Quad& q)
+{
+    double ex = q.x2 - q.x0;
+    double ey = q.y2 - q.y0;
+    double ee = ex * ex + ey * ey;
+    if (ee <= 0.0) {
+        return SegmentDistanceSq(px, py, q.x0, q.y0, q.x1, q.y1);
+    }
+    // Position along the line is u(t) = 2t(1 - t)u1 + t^2, extreme at t = u1 / (2u1 - 1)
+    double u1 = ((q.x1 - q.x0) * ex + (q.y1 - q.y0) * ey) / ee;
+    double umin = 0.0;
+    double umax = 1.0;
+    double denom = 2.0 * u1 - 1.0; // 2.0: derivative of u(t)
+    if (std::abs(denom) > COLLINEAR_EPS) {
+        double t = u1 / denom;
+        if (t > 0.0 && t < 1.0) {
+            double u = 2.0 * t * (1.0 - t) * u1 + t * t; // 2.0: quadratic Bernstein weight
+            umin = std::min(umin, u);
+            umax = std::max(umax, u);
+        }
+    }
+    return SegmentDistanceSq(px, py, q.x0 + ex * umin, q.y0 + ey * umin, q.x0 + ex * umax, q.y0 + ey * umax);
+}
+
+// Exact squared distance to a quadratic Bezier, from the roots of the cubic derivative of the squared distance
+double QuadDistanceSq(double px, double py, const Quad& q)
+{
+    double ax = q.x1 - q.x0;
+    double ay = q.y1 - q.y0;
+    double bx = q.x0 - 2.0 * q.x1 + q.x2; // 2.0: second difference
+    double by = q.y0 - 2.0 * q.y1 + q.y2; // 2.0: second difference
+    double ex = q.x2 - q.x0;
+    double ey = q.y2 - q.y0;
+    double cross = ax * ey - ay * ex;
+    double bb = bx * bx + by * by;
+    if (std::abs(cross) <= COLLINEAR_EPS * (ax * ax + ay * ay + ex * ex + ey * ey) || bb <= 0.0) {
+        return CollinearDistanceSq(px, py, q);
+    }
+    double cx = ax * 2.0; // 2.0: first derivative weight
+    double cy = ay * 2.0; // 2.0: first derivative weight
+    double dx = q.x0 - px;
+    double dy = q.y0 - py;
+    double kk = 1.0 / bb;
+    double kx = kk * (ax * bx + ay * by);
+    double ky = kk * (2.0 * (ax * ax + ay * ay) + (dx * bx + dy * by)) * ONE_THIRD; // 2.0: from the derivative
+    double kz = kk * (dx * ax + dy * ay);
+    double p = ky - kx * kx;
+    double qq = kx * (2.0 * kx * kx - 3.0 * ky) + kz; // 2.0, 3.0: depressed cubic coefficients
+    double h = qq * qq + 4.0 * p * p * p;             // 4.0: discriminant
+    auto distanceAt = [&](double t) {
+        t = std::clamp(t, 0.0, 1.0);
+        double vx = dx + (cx + bx * t) * t;
+        double vy = dy + (cy + by * t) * t;
+        return vx * vx + vy * vy;
+    };
+    if (h >= 0.0) {
+        h = std::sqrt(h);
+        double u = std::cbrt((h - qq) * 0.5);  // 0.5: Cardano
+        double v = std::cbrt((-h - qq) * 0.5); // 0.5: Cardano
+        return distanceAt(u + v - kx);
+    }
+    double z = std::sqrt(-p);
+    double angle = std::acos(std::clamp(qq / (p * z * 2.0), -1.0, 1.0)) * ONE_THIRD; // 2.0: trigonometric solution
+    double m = std::cos(angle);
+    double n = std::sin(angle) * SQRT3;
+    // The third root is a maximum of the distance
+    return std::min(distanceAt((m + m) * z - kx), distanceAt((-n - m) * z - kx));
+}
+
+float BoxDistanceSq(float xmin, float xmax, float ymin, float ymax, const Quad& q)
+{
+    float dx = std::max({ q.xmin - xmax, xmin - q.xmax, 0.0f });
+    float dy = std::max({ q.ymin - ymax, ymin - q.ymax, 0.0f });
+    return dx * dx + dy * dy;
+}
+
+// Adds the x and direction of the crossing of q with the row at y, for the y-monotonic span [t0, t1] of q
+void AddRowCrossing(const Quad& q, double t0, double t1, double y, std::vector<std::pair<float, int>>& crossings)
+{
+    double a = q.y0 - 2.0 * q.y1 + q.y2; // 2.0: second difference
+    double b = 2.0 * (q.y1 - q.y0);      // 2.0: first derivative weight
+    auto yAt = [&](double t) { return (a * t + b) * t + q.y0; };
+    double ya = yAt(t0);
+    double yb = yAt(t1);
+    // Half open on the span so that a row through a joint counts it once
+    bool down = ya <= y && y < yb;
+    bool up = yb <= y && y < ya;
+    if (!down && !up) {
+        return;
+    }
+    double c = q.y0 - y;
+    double t = 0.0;
+    if (std::abs(a) <= COLLINEAR_EPS * std::abs(b)) {
+        t = -c / b;
+    } else {
+        double disc = std::sqrt(std::max(b * b - 4.0 * a * c, 0.0)); // 4.0: quadratic formula
+        double r0 = (-b - disc) / (2.0 * a);                           // 2.0: quadratic formula
+        double r1 = (-b + disc) / (2.0 * a);                           // 2.0: quadratic formula
+        double mid = (t0 + t1) * 0.5;                                  // 0.5: span midpoint
+        t = std::abs(r0 - mid) < std::abs(r1 - mid) ? r0 : r1;
+    }
+    t = std::clamp(t, t0, t1);
+    double x = ((q.x0 - 2.0 * q.x1 + q.x2) * t + 2.0 * (q.x1 - q.x0)) * t + q.x0; // 2.0: Bernstein form
+    crossings.emplace_back(static_cast<float>(x), down ? 1 : -1);
+}
+
+void BlockTranspose(const std::vector<float>& src, std::vector<float>& dst, size_t rows, size_t cols)
+{
+    for (size_t r0 = 0; r0 < rows; r0 += TRANSPOSE_BLOCK) {
+        size_t r1 = std::min(r0 + TRANSPOSE_BLOCK, rows);
+        for (size_t c0 = 0; c0 < cols; c0 += TRANSPOSE_BLOCK) {
+            size_t c1 = std::min(c0 + TRANSPOSE_BLOCK, cols);
+            for (size_t r = r0; r < r1; ++r) {
+                for (size_t c = c0; c < c1; ++c) {
+                    dst[c * rows + r] = src[r * cols + c];
+                }
+            }
+        }
+    }
+}
+} // namespace
+
+bool GESDFCpuGenerator::ComputeFromCurves(const Curves& curves, FillRule fillRule, int width, int height,
+    std::vector<float>& distances)
+{
+    bool hasArrays = curves.startX && curves.startY && curves.controlX && curves.controlY && curves.endX &&
+        curves.endY;
+    if (!IsValidSize(width, height) || (curves.count > 0 && !hasArrays)) {
+        LOGE("GESDFCpuGenerator::ComputeFromCurves invalid input %{public}d x %{public}d", width, height);
+        return false;
+    }
+    distances.assign(static_cast<size_t>(width) * static_cast<size_t>(height), NO_EDGE_DISTANCE);
+    if (curves.count == 0) {
+        return true;
+    }
+    std::vector<Quad> quads;
+    quads.reserve(curves.count);
+    for (size_t i = 0; i < curves.count; ++i) {
+        quads.push_back(MakeQuad(curves.startX[i], curves.startY[i], curves.controlX[i], curves.controlY[i],
+            curves.endX[i], curves.endY[i]));
+    }
+
+    std::vector<const Quad*> candidates;
+    for (int ty = 0; ty < height; ty += TILE_SIZE) {
+        for (int tx = 0; tx < width; tx += TILE_SIZE) {
+            int xEnd = std::min(tx + TILE_SIZE, width);
+            int yEnd = std::min(ty + TILE_SIZE, height);
+            float xmin = tx + PIXEL_CENTER;
+            float xmax = xEnd - PIXEL_CENTER;
+            float ymin = ty + PIXEL_CENTER;
+            float ymax = yEnd - PIXEL_CENTER;
+            // Every pixel of the tile is at most this far from the start point of some curve
+            float upperSq = std::numeric_limits<float>::max();
+            for (const auto& q : quads) {
+                auto startX = static_cast<float>(q.x0);
+                auto startY = static_cast<float>(q.y0);
+                float dx = std::max(std::abs(xmin - startX), std::abs(xmax - startX));
+                float dy = std::max(std::abs(ymin - startY), std::abs(ymax - startY));
+                upperSq = std::min(upperSq, dx * dx + dy * dy);
+            }
+            candidates.clear();
+            for (const auto& q : quads) {
+                if (BoxDistanceSq(xmin, xmax, ymin, ymax, q) <= upperSq) {
+                    candidates.push_back(&q);
+                }
+            }
+            for (int y = ty; y < yEnd; ++y) {
+                float py = y + PIXEL_CENTER;
+                for (int x = tx; x < xEnd; ++x) {
+                    float px = x + PIXEL_CENTER;
+                    double best = std::numeric_limits<double>::max();
+                    for (const Quad* q : candidates) {
+                        if (BoxDistanceSq(px, px, py, py, *q) < best) {
+                            best = std::min(best, QuadDistanceSq(px, py, *q));
+                        }
+                    }
+                    distances[static_cast<size_t>(y) * width + x] = static_cast<float>(std::sqrt(best));
+                }
+            }
+        }
+    }
+    ComputeSigns(curves, fillRule, width, height, distances);
+    return true;
+}
+
+void GESDFCpuGenerator::ComputeSigns(const Curves& curves, FillRule fillRule, int width, int height,
+    std::vector<float>& distances)
+{
+    std::vector<Quad> quads;
+    quads.reserve(curves.count + 1);
+    auto closeContour = [&quads](float fromX, float fromY, float toX, float toY) {
+        if (std::abs(fromX - toX) > ENDPOINT_MATCH_EPS || std::abs(fromY - toY) > ENDPOINT_MATCH_EPS) {
+            quads.push_back(MakeQuad(fromX, fromY, fromX, fromY, toX, toY));
+        }
+    };
+    size_t contourStart = 0;
+    for (size_t i = 0; i < curves.count; ++i) {
+        if (i > 0 && (std::abs(curves.startX[i] - curves.endX[i - 1]) > ENDPOINT_MATCH_EPS ||
+            std::abs(curves.startY[i] - curves.endY[i - 1]) > ENDPOINT_MATCH_EPS)) {
+            closeContour(curves.endX[i - 1], curves.endY[i - 1], curves.startX[contourStart],
+                curves.startY[contourStart]);
+            contourStart = i;
+        }
+        quads.push_back(MakeQuad(curves.startX[i], curves.startY[i], curves.controlX[i], curves.controlY[i],
+            curves.endX[i], curves.endY[i]));
+    }
+    closeContour(curves.endX[curves.count - 1], curves.endY[curves.count - 1], curves.startX[contourStart],
+        curves.startY[contourStart]);
+
+    std::vector<std::pair<float, int>> crossings;
+    for (int y = 0; y < height; ++y) {
+        double py = y + PIXEL_CENTER;
+        crossings.clear();
+        for (const auto& q : quads) {
+            if (py < q.ymin || py > q.ymax) {
+                continue;
+            }
+            // Split at the y extreme into monotonic spans
+            double denom = q.y0 - 2.0 * q.y1 + q.y2; // 2.0: second difference
+            double tExtreme = denom != 0.0 ? (q.y0 - q.y1) / denom : -1.0;
+            if (tExtreme > 0.0 && tExtreme < 1.0) {
+                AddRowCrossing(q, 0.0, tExtreme, py, crossings);
+                AddRowCrossing(q, tExtreme, 1.0, py, crossings);
+            } else {
+                AddRowCrossing(q, 0.0, 1.0, py, crossings);
+            }
+        }
+        std::sort(crossings.begin(), crossings.end());
+        int winding = 0;
+        size_t next = 0;
+        float* row = distances.data() + static_cast<size_t>(y) * width;
+        for (int x = 0; x < width; ++x) {
+            float px = x + PIXEL_CENTER;
+            while (next < crossings.size() && crossings[next].first <= px) {
+                winding += crossings[next].second;
+                ++next;
+            }
+            bool inside = fillRule == FillRule::EVEN_ODD ? (winding & 1) != 0 : winding != 0;
+            row[x] = inside ? -row[x] : row[x];
+        }
+    }
+}
+
+bool GESDFCpuGenerator::ComputeFromAlpha(const uint8_t* alpha, size_t pixelStride, size_t rowBytes, int width,
+    int height, std::vector<float>& distances)
+{
+    if (alpha == nullptr || !IsValidSize(width, height) || pixelStride == 0 ||
+        rowBytes < (static_cast<size_t>(width) - 1) * pixelStride + 1) {
+        LOGE("GESDFCpuGenerator::ComputeFromAlpha invalid input %{public}d x %{public}d", width, height);
+        return false;
+    }
+    size_t size = static_cast<size_t>(width) * static_cast<size_t>(height);
+    // Squared distances to the nearest pixel inside (outer) and outside (inner) the edge, partial alpha seeding both
+    // with the distance from the pixel center to the edge
+    std::vector<float> outer(size);
+    std::vector<float> inner(size);
+    for (int y = 0; y < height; ++y) {
+        const uint8_t* src = alpha + static_cast<size_t>(y) * rowBytes;
+        float* outerRow = outer.data() + static_cast<size_t>(y) * width;
+        float* innerRow = inner.data() + static_cast<size_t>(y) * width;
+        int x = SeedRowVectorized(src, pixelStride, width, outerRow, innerRow);
+        for (; x < width; ++x) {
+            float a = src[static_cast<size_t>(x) * pixelStride] * ALPHA_SCALE;
+            float d = PIXEL_CENTER - a;
+            float edgeSq = d * d;
+            outerRow[x] = a >= 1.0f ? 0.0f : (a <= 0.0f ? EDT_INF : (d > 0.0f ? edgeSq : 0.0f));
+            innerRow[x] = a >= 1.0f ? EDT_INF : (a <= 0.0f ? 0.0f : (d < 0.0f ? edgeSq : 0.0f));
+        }
+    }
+    std::vector<float> scratch(size);
+    Transform2D(outer, scratch, width, height);
+    Transform2D(inner, scratch, width, height);
+
+    distances.resize(size);
+    const GEFloat4 noEdge = GEFloat4::Splat(NO_EDGE_DISTANCE);
+    size_t i = 0;
+    for (; i + GEFloat4::LANES <= size; i += GEFloat4::LANES) {
+        (Min(Sqrt(GEFloat4::Load(outer.data() + i)), noEdge) - Min(Sqrt(GEFloat4::Load(inner.data() + i)), noEdge))
+            .Store(distances.data() + i);
+    }
+    for (; i < size; ++i) {
+        distances[i] = std::min(std::sqrt(outer[i]), NO_EDGE_DISTANCE) - std::min(std::sqrt(inner[i]),
+            NO_EDGE_DISTANCE);
+    }
+    return true;
+}
+
+void GESDFCpuGenerator::Transform1D(float* f, int n, std::vector<int>& v, std::vector<float>& z,
+    std::vector<float>& out)
+{
+    // Lower envelope of the parabolas (q - i)^2 + f[i], v holds their vertices and z their ranges
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    int k = 0;
+    v[0] = 0;
+    z[0] = -inf;
+    z[1] = inf;
+    for (int q = 1; q < n; ++q) {
+        float fq = f[q] + static_cast<float>(q) * q;
+        float s = 0.0f;
+        while (true) {
+            int r = v[k];
+            s = (fq - f[r] - static_cast<float>(r) * r) / (2.0f * (q - r)); // 2.0: parabola intersection
+            if (s > z[k]) {
+                break;
+            }
+            --k;
+        }
+        ++k;
+        v[k] = q;
+        z[k] = s;
+        z[k + 1] = inf;
+    }
+    k = 0;
+    for (int q = 0; q < n; ++q) {
+        while (z[k + 1] < q) {
+            ++k;
+        }
+        float dq = static_cast<float>(q - v[k]);
+        out[q] = dq * dq + f[v[k]];
+    }
+    std::copy(out.begin(), out.begin() + n, f);
+}
+
+void GESDFCpuGenerator::Transform2D(std::vector<float>& plane, std::vector<float>& scratch, int width, int height)
+{
+    int longest = std::max(width, height);
+    std::vector<int> v(longest + 1);
+    std::vector<float> z(longest + 1);
+    std::vector<float> out(longest + 1);
+    // Rows then columns, the columns transposed so that both passes walk contiguous memory
+    for (int y = 0; y < height; ++y) {
+        Transform1D(plane.data() + static_cast<size_t>(y) * width, width, v, z, out);
+    }
+    BlockTranspose(plane, scratch, height, width);
+    for (int x = 0; x < width; ++x) {
+        Transform1D(scratch.data() + static_cast<size_t>(x) * height, height, v, z, out);
+    }
+    BlockTranspose(scratch, plane, width, height);
+}
+
+float GESDFCpuGenerator::Sample(const std::vector<float>& field, int width, int height, float x, float y)
+{
+    if (width <= 0 || height <= 0 || field.size() < static_cast<size_t>(width) * static_cast<size_t>(height)) {
+        return NO_EDGE_DISTANCE;
+    }
+    float fx = std::clamp(x - PIXEL_CENTER, 0.0f, static_cast<float>(width - 1));
+    float fy = std::clamp(y - PIXEL_CENTER, 0.0f, static_cast<float>(height - 1));
+    int x0 = static_cast<int>(fx);
+    int y0 = static_cast<int>(fy);
+    int x1 = std::min(x0 + 1, width - 1);
+    int y1 = std::min(y0 + 1, height - 1);
+    float tx = fx - x0;
+    float ty = fy - y0;
+    auto at = [&field, width](int px, int py) { return field[static_cast<size_t>(py) * width + px]; };
+    float top = at(x0, y0) + (at(x1, y0) - at(x0, y0)) * tx;
+    float bottom = at(x0, y1) + (at(x1, y1) - at(x0, y1)) * tx;
+    return top + (bottom - top) * ty;
+}
+
+bool GESDFCpuGenerator::IsEnabled(bool defaultValue)
+{
+#ifdef GE_OHOS
+    // if -1, return the defaultValue; else if 0 force false, else if 1 force true
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.cpusdf", "-1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    auto readValue = GESystemProperties::ConvertToInt(enable, -1);
+    if (readValue == -1) {
+        return defaultValue;
+    }
+    return readValue > 0;
+#else
+    return defaultValue;
+#endif
+}
+
+} // namespace Rosen
+} // namespace OHOS
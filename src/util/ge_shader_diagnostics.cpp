@@ -182,6 +182,16 @@ bool DumpSkslSource(const std::string& hash, const std::string& shaderSrc)
 
 } // anonymous namespace
 
+std::string GEComputeShaderHash(const std::string& shaderSrc)
+{
+    return ComputeSHA256(shaderSrc);
+}
+
+bool GEAtomicWriteFile(const char* path, const void* data, size_t len)
+{
+    return AtomicWriteFile(path, data, len);
+}
+
 void GESetShaderDiagnosticsEnabledForTest(bool enabled)
 {
     g_shaderDiagnosticsOverride = enabled ? DiagnosticsOverride::FORCE_ON : DiagnosticsOverride::FORCE_OFF;
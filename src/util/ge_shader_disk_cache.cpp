@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_shader_disk_cache.h"
+
+#include <cerrno>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+#include "ge_log.h"
+#include "ge_shader_diagnostics.h"
+#include "ge_system_properties.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr uint32_t OPTIONS_PRESENT = 1u << 0;
+constexpr uint32_t OPTIONS_FORCE_NO_INLINE = 1u << 1;
+constexpr uint32_t OPTIONS_USE_AF = 1u << 2;
+constexpr uint32_t OPTIONS_USE_HIGHP_LOCAL_COORDS = 1u << 3;
+constexpr uint32_t OPTIONS_NEED_DRAWINGSL_TO_SKSL = 1u << 4;
+
+constexpr uint32_t CACHE_MAGIC = 0x43534547; // "GESC"
+// Bump when the file layout changes
+constexpr uint32_t CACHE_FORMAT_VERSION = 1;
+constexpr int CACHE_DIR_MODE = 0755;
+constexpr const char* CACHE_FILE_PREFIX = "ge_shader_cache.";
+constexpr const char* CACHE_FILE_SUFFIX = ".bin";
+// Same cap as GEAtomicWriteFile, larger files are never written so any found on load are corrupt
+constexpr size_t MAX_CACHE_FILE_SIZE = 128 * 1024;
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ull;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+struct CacheFileHeader {
+    uint32_t magic = CACHE_MAGIC;
+    uint32_t formatVersion = CACHE_FORMAT_VERSION;
+    uint64_t buildId = 0;
+    uint32_t optionsKey = 0;
+    uint32_t sourceSize = 0;
+};
+
+// Stable across processes, unlike std::hash
+uint64_t Fnv1a(const std::string& value)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (unsigned char c : value) {
+        hash = (hash ^ c) * FNV_PRIME;
+    }
+    return hash;
+}
+
+uint64_t ComputeBuildId()
+{
+    std::string version = "ge_shader_cache." + std::to_string(CACHE_FORMAT_VERSION);
+#ifdef GE_OHOS
+    // Skia is part of the system image, a software update may change how sources compile
+    version += "." + GESystemProperties::GetEventProperty("const.product.software.version");
+#endif
+    return Fnv1a(version);
+}
+
+bool IsCacheFileName(const std::string& name)
+{
+    size_t prefixLen = strlen(CACHE_FILE_PREFIX);
+    size_t suffixLen = strlen(CACHE_FILE_SUFFIX);
+    return name.size() > prefixLen + suffixLen && name.compare(0, prefixLen, CACHE_FILE_PREFIX) == 0 &&
+           name.compare(name.size() - suffixLen, suffixLen, CACHE_FILE_SUFFIX) == 0;
+}
+
+bool ReadFile(const std::string& path, std::string& content)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size < 0 || static_cast<size_t>(st.st_size) > MAX_CACHE_FILE_SIZE) {
+        close(fd);
+        return false;
+    }
+    content.resize(static_cast<size_t>(st.st_size));
+    size_t offset = 0;
+    while (offset < content.size()) {
+        ssize_t n = read(fd, &content[offset], content.size() - offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        offset += static_cast<size_t>(n);
+    }
+    close(fd);
+    return offset == content.size();
+}
+} // namespace
+
+GEShaderDiskCache& GEShaderDiskCache::GetInstance()
+{
+    // Never destroyed, like GERuntimeEffectRegistry which stores into it
+    static GEShaderDiskCache* instance = new GEShaderDiskCache();
+    return *instance;
+}
+
+GEShaderDiskCache::GEShaderDiskCache() : buildId_(ComputeBuildId())
+{
+#ifdef GE_OHOS
+    constexpr const char* PROPERTY_SHADER_DISK_CACHE_ENABLED = "persist.sys.graphic.geShaderDiskCacheEnabled";
+    enabled_ = std::atoi(GESystemProperties::GetEventProperty(PROPERTY_SHADER_DISK_CACHE_ENABLED).c_str()) != 0;
+#endif
+}
+
+bool GEShaderDiskCache::IsEnabled() const
+{
+    return enabled_;
+}
+
+uint32_t GEShaderDiskCache::EncodeOptions(const Drawing::RuntimeEffectOptions* options)
+{
+    if (options == nullptr) {
+        return 0;
+    }
+    uint32_t key = OPTIONS_PRESENT;
+    key |= options->forceNoInline ? OPTIONS_FORCE_NO_INLINE : 0;
+    key |= options->useAF ? OPTIONS_USE_AF : 0;
+    key |= options->useHighpLocalCoords ? OPTIONS_USE_HIGHP_LOCAL_COORDS : 0;
+    key |= options->needDrawingslToSksl ? OPTIONS_NEED_DRAWINGSL_TO_SKSL : 0;
+    return key;
+}
+
+Drawing::RuntimeEffectOptions GEShaderDiskCache::DecodeOptions(uint32_t optionsKey)
+{
+    Drawing::RuntimeEffectOptions options;
+    options.forceNoInline = (optionsKey & OPTIONS_FORCE_NO_INLINE) != 0;
+    options.useAF = (optionsKey & OPTIONS_USE_AF) != 0;
+    options.useHighpLocalCoords = (optionsKey & OPTIONS_USE_HIGHP_LOCAL_COORDS) != 0;
+    options.needDrawingslToSksl = (optionsKey & OPTIONS_NEED_DRAWINGSL_TO_SKSL) != 0;
+    return options;
+}
+
+bool GEShaderDiskCache::HasOptions(uint32_t optionsKey)
+{
+    return (optionsKey & OPTIONS_PRESENT) != 0;
+}
+
+std::string GEShaderDiskCache::GetPath(const std::string& hash, uint32_t optionsKey) const
+{
+    return directory_ + CACHE_FILE_PREFIX + hash + "." + std::to_string(optionsKey) + CACHE_FILE_SUFFIX;
+}
+
+uint64_t GEShaderDiskCache::GetSourceKey(const std::string& shaderSrc, uint32_t optionsKey)
+{
+    return (Fnv1a(shaderSrc) ^ optionsKey) * FNV_PRIME;
+}
+
+bool GEShaderDiskCache::Store(const std::string& shaderSrc, uint32_t optionsKey)
+{
+    if (!enabled_) {
+        return false;
+    }
+    {
+        std::lock_guard<std::mutex> lock(pendingMutex_);
+        if (!knownSources_.insert(GetSourceKey(shaderSrc, optionsKey)).second) {
+            return false;
+        }
+    }
+    return Write(shaderSrc, optionsKey);
+}
+
+void GEShaderDiskCache::StoreAsync(const std::string& shaderSrc, uint32_t optionsKey)
+{
+    if (!enabled_) {
+        return;
+    }
+    uint64_t sourceKey = GetSourceKey(shaderSrc, optionsKey);
+    std::lock_guard<std::mutex> lock(pendingMutex_);
+    if (!knownSources_.insert(sourceKey).second) {
+        return;
+    }
+    pendingStores_.push_back({ shaderSrc, optionsKey });
+    if (isWriterRunning_) {
+        return;
+    }
+    isWriterRunning_ = true;
+    // Ends once the queue is empty, the cache it uses is never destroyed
+    std::thread([this]() { DrainPendingStores(); }).detach();
+}
+
+void GEShaderDiskCache::DrainPendingStores()
+{
+    std::unique_lock<std::mutex> lock(pendingMutex_);
+    while (!pendingStores_.empty()) {
+        Record record = std::move(pendingStores_.front());
+        pendingStores_.pop_front();
+        lock.unlock();
+        Write(record.source, record.optionsKey);
+        lock.lock();
+    }
+    isWriterRunning_ = false;
+    lock.unlock();
+    pendingDoneCv_.notify_all();
+}
+
+void GEShaderDiskCache::WaitForPendingStores()
+{
+    std::unique_lock<std::mutex> lock(pendingMutex_);
+    pendingDoneCv_.wait(lock, [this]() { return pendingStores_.empty() && !isWriterRunning_; });
+}
+
+bool GEShaderDiskCache::Write(const std::string& shaderSrc, uint32_t optionsKey)
+{
+    size_t fileSize = sizeof(CacheFileHeader) + shaderSrc.size();
+    if (fileSize > MAX_CACHE_FILE_SIZE) {
+        return false;
+    }
+    std::string hash = GEComputeShaderHash(shaderSrc);
+    if (hash.empty()) {
+        return false;
+    }
+    CacheFileHeader header;
+    header.buildId = buildId_;
+    header.optionsKey = optionsKey;
+    header.sourceSize = static_cast<uint32_t>(shaderSrc.size());
+    std::string content(reinterpret_cast<const char*>(&header), sizeof(header));
+    content += shaderSrc;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!scanned_) {
+        ScanLocked();
+    }
+    std::string path = GetPath(hash, optionsKey);
+    // Written by an earlier process, which this one did not Load
+    if (access(path.c_str(), F_OK) == 0) {
+        return false;
+    }
+    if (totalBytes_ + fileSize > maxBytes_) {
+        LOGD("GEShaderDiskCache::Store skipped, cache full: %{public}zu bytes", totalBytes_);
+        return false;
+    }
+    if (!GEAtomicWriteFile(path.c_str(), content.data(), content.size())) {
+        return false;
+    }
+    totalBytes_ += fileSize;
+    storeCount_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool GEShaderDiskCache::ReadRecord(const std::string& name, Record& record, size_t& fileSize) const
+{
+    // Name is prefix + 64 hex chars of SHA-256 + "." + optionsKey + suffix
+    size_t prefixLen = strlen(CACHE_FILE_PREFIX);
+    size_t dot = name.find('.', prefixLen);
+    if (dot == std::string::npos) {
+        return false;
+    }
+    std::string hash = name.substr(prefixLen, dot - prefixLen);
+
+    std::string content;
+    if (!ReadFile(directory_ + name, content) || content.size() < sizeof(CacheFileHeader)) {
+        return false;
+    }
+    CacheFileHeader header;
+    std::memcpy(&header, content.data(), sizeof(header));
+    if (header.magic != CACHE_MAGIC || header.formatVersion != CACHE_FORMAT_VERSION || header.buildId != buildId_ ||
+        header.sourceSize != content.size() - sizeof(header) ||
+        name != CACHE_FILE_PREFIX + hash + "." + std::to_string(header.optionsKey) + CACHE_FILE_SUFFIX) {
+        return false;
+    }
+    record.source = content.substr(sizeof(header));
+    record.optionsKey = header.optionsKey;
+    fileSize = content.size();
+    // Catches truncated or bit-flipped sources, a compile would fail or, worse, succeed with different code
+    return GEComputeShaderHash(record.source) == hash;
+}
+
+std::vector<GEShaderDiskCache::Record> GEShaderDiskCache::Load()
+{
+    std::vector<Record> records;
+    if (!enabled_) {
+        return records;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    DIR* dir = opendir(directory_.c_str());
+    if (dir == nullptr) {
+        scanned_ = true;
+        totalBytes_ = 0;
+        return records;
+    }
+    size_t totalBytes = 0;
+    for (struct dirent* ent = readdir(dir); ent != nullptr; ent = readdir(dir)) {
+        std::string name = ent->d_name;
+        if (!IsCacheFileName(name)) {
+            continue;
+        }
+        Record record;
+        size_t fileSize = 0;
+        if (!ReadRecord(name, record, fileSize)) {
+            LOGD("GEShaderDiskCache::Load removing stale or corrupt %{public}s", name.c_str());
+            unlink((directory_ + name).c_str());
+            rejectedCount_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        totalBytes += fileSize;
+        records.push_back(std::move(record));
+    }
+    closedir(dir);
+    scanned_ = true;
+    totalBytes_ = totalBytes;
+    loadCount_.fetch_add(records.size(), std::memory_order_relaxed);
+    std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+    for (const auto& record : records) {
+        knownSources_.insert(GetSourceKey(record.source, record.optionsKey));
+    }
+    return records;
+}
+
+void GEShaderDiskCache::ScanLocked()
+{
+    scanned_ = true;
+    totalBytes_ = 0;
+    if (mkdir(directory_.c_str(), CACHE_DIR_MODE) != 0 && errno != EEXIST) {
+        LOGE("GEShaderDiskCache: mkdir(%{public}s) failed: errno=%{public}d", directory_.c_str(), errno);
+        return;
+    }
+    DIR* dir = opendir(directory_.c_str());
+    if (dir == nullptr) {
+        return;
+    }
+    for (struct dirent* ent = readdir(dir); ent != nullptr; ent = readdir(dir)) {
+        std::string name = ent->d_name;
+        struct stat st {};
+        if (IsCacheFileName(name) && stat((directory_ + name).c_str(), &st) == 0 && st.st_size > 0) {
+            totalBytes_ += static_cast<size_t>(st.st_size);
+        }
+    }
+    closedir(dir);
+}
+
+GEShaderDiskCache::Stats GEShaderDiskCache::GetStats() const
+{
+    Stats stats;
+    stats.storeCount = storeCount_.load(std::memory_order_relaxed);
+    stats.loadCount = loadCount_.load(std::memory_order_relaxed);
+    stats.rejectedCount = rejectedCount_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.totalBytes = totalBytes_;
+    return stats;
+}
+
+void GEShaderDiskCache::SetForTest(bool enabled, const std::string& directory, size_t maxBytes)
+{
+    WaitForPendingStores();
+    {
+        std::lock_guard<std::mutex> pendingLock(pendingMutex_);
+        knownSources_.clear();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    enabled_ = enabled;
+    directory_ = directory;
+    maxBytes_ = maxBytes;
+    scanned_ = false;
+    totalBytes_ = 0;
+    storeCount_.store(0, std::memory_order_relaxed);
+    loadCount_.store(0, std::memory_order_relaxed);
+    rejectedCount_.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ge_transient_surface_pool.h"
+
+#include <algorithm>
+
+#include "ge_log.h"
+#include "ge_system_properties.h"
+#include "ge_trace.h"
+
+namespace OHOS {
+namespace Rosen {
+
+GETransientSurfacePool::PoolState& GETransientSurfacePool::GetPoolState()
+{
+    thread_local PoolState state;
+    return state;
+}
+
+void GETransientSurfacePool::BeginFrame()
+{
+    auto& state = GetPoolState();
+    if (state.depth++ > 0) {
+        return;
+    }
+    state.frameStart = std::chrono::steady_clock::now();
+    // Sizes blurred by some node of each display frame stay, sizes of an earlier burst of frames go
+    TrimIdle(state, state.frameStart - IDLE_TIME);
+}
+
+void GETransientSurfacePool::EndFrame()
+{
+    auto& state = GetPoolState();
+    if (state.depth == 0) {
+        LOGE("GETransientSurfacePool::EndFrame without BeginFrame");
+        return;
+    }
+    if (--state.depth > 0) {
+        return;
+    }
+    for (auto& entry : state.entries) {
+        entry.frameHold = nullptr;
+    }
+    state.frame++;
+}
+
+bool GETransientSurfacePool::IsInFrame()
+{
+    return GetPoolState().depth > 0;
+}
+
+void GETransientSurfacePool::Clear()
+{
+    auto& state = GetPoolState();
+    state.entries.clear();
+    state.bytes = 0;
+}
+
+size_t GETransientSurfacePool::GetSurfaceCount()
+{
+    return GetPoolState().entries.size();
+}
+
+size_t GETransientSurfacePool::GetPooledBytes()
+{
+    return GetPoolState().bytes;
+}
+
+uint64_t GETransientSurfacePool::GetMadeSurfaceCount()
+{
+    return GetPoolState().madeSurfaces;
+}
+
+std::shared_ptr<Drawing::Image> GETransientSurfacePool::MakeImage(Drawing::Canvas& canvas,
+    Drawing::RuntimeShaderBuilder& builder, const Drawing::ImageInfo& info, bool holdUntilFrameEnd)
+{
+#ifdef RS_ENABLE_GPU
+    auto& state = GetPoolState();
+    if (state.depth == 0 || canvas.GetGPUContext() == nullptr || info.GetWidth() <= 0 || info.GetHeight() <= 0 ||
+        !IsEnabled()) {
+        return builder.MakeImage(canvas.GetGPUContext().get(), nullptr, info, false);
+    }
+    auto entry = AcquireEntry(state, canvas, info);
+    auto surfaceCanvas = entry ? entry->surface->GetCanvas() : nullptr;
+    if (surfaceCanvas == nullptr) {
+        return builder.MakeImage(canvas.GetGPUContext().get(), nullptr, info, false);
+    }
+    Drawing::Brush brush;
+    brush.SetShaderEffect(builder.MakeShader(nullptr, false));
+    // Every pixel is replaced, whatever the previous lease left in the surface
+    brush.SetBlendMode(Drawing::BlendMode::SRC);
+    surfaceCanvas->AttachBrush(brush);
+    surfaceCanvas->DrawRect(Drawing::Rect(0, 0, info.GetWidth(), info.GetHeight()));
+    surfaceCanvas->DetachBrush();
+    auto image = entry->surface->GetImageSnapshot();
+    entry->snapshot = image;
+    entry->frameHold = holdUntilFrameEnd ? image : nullptr;
+    entry->lastUsedFrame = state.frame;
+    entry->lastUsedTime = state.frameStart;
+    return image;
+#else
+    return builder.MakeImage(nullptr, nullptr, info, false);
+#endif
+}
+
+GETransientSurfacePool::Entry* GETransientSurfacePool::AcquireEntry(PoolState& state, Drawing::Canvas& canvas,
+    const Drawing::ImageInfo& info)
+{
+    const void* context = canvas.GetGPUContext().get();
+    for (auto& entry : state.entries) {
+        if (entry.context == context && entry.snapshot.expired() && IsSameInfo(entry.info, info)) {
+            return &entry;
+        }
+    }
+    size_t bytes = GetByteSize(info);
+    if (state.bytes + bytes > MAX_POOL_BYTES) {
+        // Make room from surfaces of the earlier frames before giving up on pooling this size
+        Trim(state, state.frame, MAX_POOL_BYTES - std::min(bytes, MAX_POOL_BYTES));
+        if (state.bytes + bytes > MAX_POOL_BYTES) {
+            return nullptr;
+        }
+    }
+    auto surface = MakeSurface(state, canvas, info);
+    if (surface == nullptr) {
+        return nullptr;
+    }
+    Entry entry;
+    entry.surface = std::move(surface);
+    entry.info = info;
+    entry.context = context;
+    entry.lastUsedFrame = state.frame;
+    entry.lastUsedTime = state.frameStart;
+    entry.bytes = bytes;
+    state.bytes += bytes;
+    state.entries.push_back(std::move(entry));
+    return &state.entries.back();
+}
+
+std::shared_ptr<Drawing::Surface> GETransientSurfacePool::AcquireSurface(Drawing::Canvas& canvas,
+    const Drawing::ImageInfo& info)
+{
+    if (canvas.GetGPUContext() == nullptr || info.GetWidth() <= 0 || info.GetHeight() <= 0) {
+        return nullptr;
+    }
+    auto& state = GetPoolState();
+    const void* context = canvas.GetGPUContext().get();
+    auto it = std::find_if(state.entries.begin(), state.entries.end(), [context, &info](const Entry& entry) {
+        return entry.context == context && entry.snapshot.expired() && IsSameInfo(entry.info, info);
+    });
+    if (it == state.entries.end()) {
+        return MakeSurface(state, canvas, info);
+    }
+    // The caller owns it from now on, the pool no longer lends it
+    auto surface = std::move(it->surface);
+    state.bytes -= it->bytes;
+    state.entries.erase(it);
+    return surface;
+}
+
+void GETransientSurfacePool::ReleaseSurface(Drawing::Canvas& canvas, std::shared_ptr<Drawing::Surface> surface,
+    const Drawing::ImageInfo& info, const std::shared_ptr<Drawing::Image>& snapshot)
+{
+    auto& state = GetPoolState();
+    size_t bytes = GetByteSize(info);
+    if (surface == nullptr || canvas.GetGPUContext() == nullptr || !IsEnabled() ||
+        state.bytes + bytes > MAX_POOL_BYTES) {
+        return;
+    }
+    Entry entry;
+    entry.surface = std::move(surface);
+    entry.info = info;
+    entry.context = canvas.GetGPUContext().get();
+    entry.snapshot = snapshot;
+    entry.lastUsedFrame = state.frame;
+    // May be called outside frames, where frameStart is stale
+    entry.lastUsedTime = std::chrono::steady_clock::now();
+    entry.bytes = bytes;
+    state.bytes += bytes;
+    state.entries.push_back(std::move(entry));
+}
+
+std::shared_ptr<Drawing::Surface> GETransientSurfacePool::MakeSurface(PoolState& state, Drawing::Canvas& canvas,
+    const Drawing::ImageInfo& info)
+{
+#ifdef RS_ENABLE_GPU
+    GE_TRACE_NAME_FMT("GETransientSurfacePool::MakeSurface, Width: %d, Height: %d", info.GetWidth(),
+        info.GetHeight());
+    auto surface = Drawing::Surface::MakeRenderTarget(canvas.GetGPUContext().get(), false, info);
+    if (surface == nullptr) {
+        GE_LOGE("GETransientSurfacePool::MakeSurface make surface failed");
+        return nullptr;
+    }
+    state.madeSurfaces++;
+    return surface;
+#else
+    return nullptr;
+#endif
+}
+
+void GETransientSurfacePool::Trim(PoolState& state, uint64_t minFrame, size_t byteBudget)
+{
+    // Leased surfaces stay, their snapshots are still being read
+    auto isIdle = [minFrame](const Entry& entry) {
+        return entry.lastUsedFrame < minFrame && entry.snapshot.expired();
+    };
+    for (auto it = state.entries.begin(); it != state.entries.end();) {
+        if (isIdle(*it) || (state.bytes > byteBudget && it->snapshot.expired())) {
+            state.bytes -= it->bytes;
+            it = state.entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void GETransientSurfacePool::TrimIdle(PoolState& state, std::chrono::steady_clock::time_point minTime)
+{
+    for (auto it = state.entries.begin(); it != state.entries.end();) {
+        if (it->lastUsedTime < minTime && it->snapshot.expired()) {
+            state.bytes -= it->bytes;
+            it = state.entries.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+bool GETransientSurfacePool::IsSameInfo(const Drawing::ImageInfo& lhs, const Drawing::ImageInfo& rhs)
+{
+    if (lhs.GetWidth() != rhs.GetWidth() || lhs.GetHeight() != rhs.GetHeight() ||
+        lhs.GetColorType() != rhs.GetColorType() || lhs.GetAlphaType() != rhs.GetAlphaType()) {
+        return false;
+    }
+    auto lhsColorSpace = lhs.GetColorSpace();
+    auto rhsColorSpace = rhs.GetColorSpace();
+    if (lhsColorSpace == nullptr || rhsColorSpace == nullptr) {
+        return lhsColorSpace == rhsColorSpace;
+    }
+    return lhsColorSpace == rhsColorSpace || lhsColorSpace->Equals(rhsColorSpace);
+}
+
+size_t GETransientSurfacePool::GetByteSize(const Drawing::ImageInfo& info)
+{
+    constexpr size_t defaultBytesPerPixel = 4; // RGBA8888
+    int bytesPerPixel = info.GetBytesPerPixel();
+    size_t pixelBytes = bytesPerPixel > 0 ? static_cast<size_t>(bytesPerPixel) : defaultBytesPerPixel;
+    return static_cast<size_t>(std::max(info.GetWidth(), 0)) * static_cast<size_t>(std::max(info.GetHeight(), 0)) *
+        pixelBytes;
+}
+
+bool GETransientSurfacePool::IsEnabled()
+{
+#ifdef GE_OHOS
+    static CachedHandle g_Handle = CachedParameterCreate("persist.sys.graphic.effect.blursurfacepool", "1");
+    int changed = 0;
+    const char* enable = CachedParameterGetChanged(g_Handle, &changed);
+    return GESystemProperties::ConvertToInt(enable, 1) != 0;
+#else
+    return true;
+#endif
+}
+
+} // namespace Rosen
+} // namespace OHOS
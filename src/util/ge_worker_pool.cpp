@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ge_worker_pool.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace OHOS {
+namespace Rosen {
+
+GEWorkerPool& GEWorkerPool::GetInstance()
+{
+    // Never destroyed, its workers are detached and live as long as the process
+    static GEWorkerPool* instance = new GEWorkerPool();
+    return *instance;
+}
+
+void GEWorkerPool::Run(int taskCount, unsigned int helperCount, const std::function<void(int)>& task)
+{
+    if (taskCount <= 0) {
+        return;
+    }
+    helperCount = std::min({ helperCount, MAX_WORKERS, static_cast<unsigned int>(taskCount - 1) });
+    if (helperCount == 0) {
+        for (int i = 0; i < taskCount; ++i) {
+            task(i);
+        }
+        return;
+    }
+    auto batch = std::make_shared<Batch>();
+    batch->taskCount = taskCount;
+    batch->task = &task;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (; workerCount_ < helperCount; ++workerCount_) {
+            std::thread([this]() { WorkerLoop(); }).detach();
+        }
+        pending_.insert(pending_.end(), helperCount, batch);
+    }
+    if (helperCount == 1) {
+        wakeCv_.notify_one();
+    } else {
+        wakeCv_.notify_all();
+    }
+    RunTasks(*batch);
+    {
+        // Entries no worker reached would only find every task claimed
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.erase(std::remove(pending_.begin(), pending_.end(), batch), pending_.end());
+    }
+    std::unique_lock<std::mutex> lock(batch->mutex);
+    batch->doneCv.wait(lock, [&batch]() { return batch->finishedTasks.load() == batch->taskCount; });
+}
+
+unsigned int GEWorkerPool::GetWorkerCount()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return workerCount_;
+}
+
+void GEWorkerPool::RunTasks(Batch& batch)
+{
+    for (int i = batch.nextTask++; i < batch.taskCount; i = batch.nextTask++) {
+        (*batch.task)(i);
+        if (++batch.finishedTasks == batch.taskCount) {
+            std::lock_guard<std::mutex> lock(batch.mutex);
+            batch.doneCv.notify_all();
+        }
+    }
+}
+
+void GEWorkerPool::WorkerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wakeCv_.wait(lock, [this]() { return !pending_.empty(); });
+        std::shared_ptr<Batch> batch = std::move(pending_.front());
+        pending_.pop_front();
+        lock.unlock();
+        RunTasks(*batch);
+        lock.lock();
+    }
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+#include "ge_shader_prewarm.h"
+
+using namespace OHOS;
+using namespace OHOS::GraphicsEffectEngine;
+
+namespace {
+constexpr double NS_PER_MS = 1000000.0;
+
+const char* CategoryName(GEEffectCategory category)
+{
+    switch (category) {
+        case GEEffectCategory::FILTER:
+            return "filter";
+        case GEEffectCategory::SHADER:
+            return "shader";
+        case GEEffectCategory::MASK:
+            return "mask";
+        case GEEffectCategory::SHAPE:
+            return "shape";
+        default:
+            return "unknown";
+    }
+}
+} // namespace
+
+// Usage: graphics_effect_shader_prewarm [threadCount], warms up every registered effect on the CPU raster backend
+int main(int argc, char* argv[])
+{
+    uint32_t threadCount = 0;
+    if (argc > 1) {
+        threadCount = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+    }
+
+    size_t diskCacheCount = GEShaderPrewarm::RunDiskCache(threadCount);
+    if (diskCacheCount > 0) {
+        std::printf("%zu programs compiled from the disk cache\n", diskCacheCount);
+    }
+    auto report = GEShaderPrewarm::Run(threadCount);
+    std::printf("%6s %-8s %8s %8s %12s %12s\n", "type", "category", "compiles", "failures", "compile(ms)", "total(ms)");
+    for (const auto& effect : report.effects) {
+        std::printf("%6d %-8s %8" PRIu64 " %8" PRIu64 " %12.3f %12.3f%s\n", static_cast<int>(effect.type),
+            CategoryName(effect.category), effect.compileCount, effect.failureCount,
+            effect.compileTimeNs / NS_PER_MS, effect.elapsedNs / NS_PER_MS, effect.created ? "" : " (not created)");
+    }
+    std::printf("%zu effects, %u threads, wall %.3f ms, %" PRIu64 " compiles (%" PRIu64 " failed) in %.3f ms\n",
+        report.effects.size(), report.threadCount, report.wallTimeNs / NS_PER_MS, report.registryStats.compileCount,
+        report.registryStats.failureCount, report.registryStats.compileTimeNs / NS_PER_MS);
+    return report.registryStats.failureCount == 0 ? 0 : 1;
+}
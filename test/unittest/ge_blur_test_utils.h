@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TEST_UNITTEST_GRAPHICS_EFFECT_GE_BLUR_TEST_UTILS_H
+#define TEST_UNITTEST_GRAPHICS_EFFECT_GE_BLUR_TEST_UTILS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+
+#include "ge_cpu_blur.h"
+
+#include "draw/color.h"
+#include "image/bitmap.h"
+#include "image/image.h"
+
+namespace OHOS {
+namespace Rosen {
+namespace GETest {
+
+// Dither noise of the mix pass plus 8 bit rounding
+constexpr float COLOR_TOLERANCE = 3.0f / 255.0f;
+
+// Opaque black on the left half, opaque white on the right half
+inline std::shared_ptr<Drawing::Image> MakeStepImage(int width, int height)
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    if (!bmp.Build(width, height, format) || bmp.GetPixels() == nullptr) {
+        return nullptr;
+    }
+    bmp.ClearWithColor(Drawing::Color::COLOR_BLACK);
+    auto* pixels = static_cast<uint8_t*>(bmp.GetPixels());
+    for (int y = 0; y < height; ++y) {
+        uint8_t* row = pixels + static_cast<size_t>(y) * bmp.GetRowBytes();
+        for (int x = width / 2; x < width; ++x) { // 2: right half
+            std::fill(row + x * 4, row + x * 4 + 4, 255); // 4: rgba, 255: opaque white
+        }
+    }
+    return bmp.MakeImage();
+}
+
+// Whether every pixel is (r, g, b, a) within COLOR_TOLERANCE
+inline bool IsFlatColor(const std::shared_ptr<Drawing::Image>& image, float r, float g, float b, float a)
+{
+    GECpuBlur::Buffer buffer;
+    if (!GECpuBlur::ReadImage(image, buffer)) {
+        return false;
+    }
+    for (size_t i = 0; i < buffer.pixels.size(); i += 4) { // 4: rgba
+        if (std::abs(buffer.pixels[i] - r) > COLOR_TOLERANCE || std::abs(buffer.pixels[i + 1] - g) > COLOR_TOLERANCE ||
+            std::abs(buffer.pixels[i + 2] - b) > COLOR_TOLERANCE || // 2: blue
+            std::abs(buffer.pixels[i + 3] - a) > COLOR_TOLERANCE) { // 3: alpha
+            return false;
+        }
+    }
+    return true;
+}
+
+// Green channel of the pixel at (x, y)
+inline float GetGreen(const GECpuBlur::Buffer& buffer, int x, int y)
+{
+    return buffer.pixels[(static_cast<size_t>(y) * buffer.width + x) * 4 + 1]; // 4: rgba
+}
+
+} // namespace GETest
+} // namespace Rosen
+} // namespace OHOS
+
+#endif // TEST_UNITTEST_GRAPHICS_EFFECT_GE_BLUR_TEST_UTILS_H
@@ -16,6 +16,7 @@
 
 #include "ge_cache_provider.h"
 #include "ge_image_cache_provider.h"
+#include "ge_multi_cache_provider.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -72,5 +73,100 @@ HWTEST_F(GECacheProviderTest, GEImageCacheProviderStore, TestSize.Level0)
     ASSERT_EQ(pImageCache->data, cache.data);
 }
 
+HWTEST_F(GECacheProviderTest, GEImageCacheProviderStoreByKey, TestSize.Level0)
+{
+    GEImageCacheProvider imageCacheProvider;
+    IGECacheProvider& cacheProvider = imageCacheProvider;
+
+    GEImageCache cache;
+    cache.data = MakeImage();
+    EXPECT_TRUE(cacheProvider.StoreByKey(cache, 1)); // 1: cache key, ignored by single-slot providers
+    auto pImageCache = cacheProvider.GetByKeyAs<GEImageCache>(2); // 2: cache key, ignored by single-slot providers
+    ASSERT_NE(pImageCache, nullptr);
+    EXPECT_EQ(pImageCache->data, cache.data);
+    EXPECT_EQ(pImageCache->GetByteSize(), GEImageCache::GetImageBytes(*cache.data));
+}
+
+HWTEST_F(GECacheProviderTest, GEMultiCacheProviderStoreByKey, TestSize.Level0)
+{
+    GEMultiCacheProvider multiCacheProvider;
+    IGECacheProvider& cacheProvider = multiCacheProvider;
+    EXPECT_EQ(cacheProvider.GetFirst(), nullptr);
+
+    GEImageCache first;
+    first.data = MakeImage();
+    GEImageCache second;
+    second.data = MakeImage();
+    EXPECT_TRUE(cacheProvider.StoreByKey(first, 1)); // 1: first key
+    EXPECT_TRUE(cacheProvider.StoreByKey(second, 2)); // 2: second key
+    EXPECT_EQ(multiCacheProvider.GetEntryCount(), 2); // 2: both keys kept
+
+    auto pFirst = cacheProvider.GetByKeyAs<GEImageCache>(1); // 1: first key
+    ASSERT_NE(pFirst, nullptr);
+    EXPECT_EQ(pFirst->data, first.data);
+    auto pSecond = cacheProvider.GetByKeyAs<GEImageCache>(2); // 2: second key
+    ASSERT_NE(pSecond, nullptr);
+    EXPECT_EQ(pSecond->data, second.data);
+    EXPECT_EQ(cacheProvider.GetByKeyAs<GEImageCache>(3), nullptr); // 3: unknown key
+    EXPECT_EQ(multiCacheProvider.GetUsedBytes(), first.GetByteSize() + second.GetByteSize());
+
+    // Store without key keeps the single-slot behaviour
+    EXPECT_TRUE(cacheProvider.Store(first));
+    auto pCache = cacheProvider.GetFirst();
+    ASSERT_NE(pCache, nullptr);
+    ASSERT_NE(pCache->As<GEImageCache>(), nullptr);
+    EXPECT_EQ(pCache->As<GEImageCache>()->data, first.data);
+
+    EXPECT_TRUE(multiCacheProvider.Erase(ExactDowncastUtils::TypeID::Get<GEImageCache>(), 1)); // 1: first key
+    EXPECT_FALSE(multiCacheProvider.Erase(ExactDowncastUtils::TypeID::Get<GEImageCache>(), 1)); // 1: first key
+    multiCacheProvider.Clear();
+    EXPECT_EQ(multiCacheProvider.GetEntryCount(), 0);
+    EXPECT_EQ(multiCacheProvider.GetUsedBytes(), 0);
+}
+
+HWTEST_F(GECacheProviderTest, GEMultiCacheProviderEvictLRU, TestSize.Level0)
+{
+    GEImageCache cache;
+    cache.data = MakeImage();
+    GEMultiCacheProvider cacheProvider(cache.GetByteSize() * 2); // 2: room for two caches
+
+    cacheProvider.StoreByKey(cache, 1); // 1: first key
+    cacheProvider.StoreByKey(cache, 2); // 2: second key
+    EXPECT_NE(cacheProvider.GetByKeyAs<GEImageCache>(1), nullptr); // 1 becomes the most recently used
+    cacheProvider.StoreByKey(cache, 3); // 3: third key, evicts 2
+    EXPECT_EQ(cacheProvider.GetEntryCount(), 2); // 2: within budget
+    EXPECT_NE(cacheProvider.GetByKeyAs<GEImageCache>(1), nullptr); // 1: first key
+    EXPECT_EQ(cacheProvider.GetByKeyAs<GEImageCache>(2), nullptr); // 2: evicted key
+    EXPECT_NE(cacheProvider.GetByKeyAs<GEImageCache>(3), nullptr); // 3: third key
+
+    cacheProvider.SetMaxEntries(1);
+    EXPECT_EQ(cacheProvider.GetEntryCount(), 1);
+    EXPECT_NE(cacheProvider.GetByKeyAs<GEImageCache>(3), nullptr); // 3: most recently used key
+}
+
+HWTEST_F(GECacheProviderTest, GEMultiCacheProviderEvictCost, TestSize.Level0)
+{
+    GEImageCache small;
+    small.data = MakeImage();
+    GEImageCache empty;
+    GEMultiCacheProvider cacheProvider(small.GetByteSize() * 2, GEMultiCacheProvider::DEFAULT_MAX_ENTRIES,
+        GEMultiCacheProvider::EvictionPolicy::COST); // 2: room for two images
+
+    cacheProvider.StoreByKey(small, 1); // 1: first key
+    cacheProvider.StoreByKey(empty, 2); // 2: second key, no image
+    cacheProvider.StoreByKey(small, 3); // 3: third key
+    cacheProvider.StoreByKey(small, 4); // 4: fourth key, evicts the largest and oldest entry 1
+    EXPECT_EQ(cacheProvider.GetByKeyAs<GEImageCache>(1), nullptr); // 1: evicted key
+    EXPECT_NE(cacheProvider.GetByKeyAs<GEImageCache>(2), nullptr); // 2: cheap entry kept although older
+    EXPECT_NE(cacheProvider.GetByKeyAs<GEImageCache>(3), nullptr); // 3: third key
+    EXPECT_NE(cacheProvider.GetByKeyAs<GEImageCache>(4), nullptr); // 4: fourth key
+
+    GEImageCache tooLarge;
+    tooLarge.data = MakeImage();
+    cacheProvider.SetByteBudget(small.GetByteSize() - 1);
+    EXPECT_FALSE(cacheProvider.StoreByKey(tooLarge, 5)); // 5: cache larger than the budget
+    EXPECT_EQ(cacheProvider.GetUsedBytes(), 0);
+}
+
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "ge_compiled_effect_chain.h"
+#include "ge_visual_effect.h"
+#include "ge_visual_effect_container.h"
+#include "ge_visual_effect_impl.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GECompiledEffectChainTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    std::shared_ptr<Drawing::GEVisualEffect> CreateGreyEffect();
+    std::shared_ptr<Drawing::GEVisualEffect> CreateKawaseBlurEffect(int radius);
+};
+
+std::shared_ptr<Drawing::GEVisualEffect> GECompiledEffectChainTest::CreateGreyEffect()
+{
+    auto effect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    effect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 0.5f); // 0.5: grey coef
+    effect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 0.5f); // 0.5: grey coef
+    return effect;
+}
+
+std::shared_ptr<Drawing::GEVisualEffect> GECompiledEffectChainTest::CreateKawaseBlurEffect(int radius)
+{
+    auto effect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    effect->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, radius);
+    return effect;
+}
+
+/**
+ * @tc.name: ParamsGeneration001
+ * @tc.desc: Verify the params generation only moves on valid writes
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECompiledEffectChainTest, ParamsGeneration001, TestSize.Level1)
+{
+    auto effect = CreateKawaseBlurEffect(10); // 10: blur radius
+    auto impl = effect->GetImpl();
+    auto generation = impl->GetParamsGeneration();
+
+    effect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 0.5f); // not a Kawase blur tag, ignored
+    EXPECT_EQ(impl->GetParamsGeneration(), generation);
+
+    effect->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 20); // 20: blur radius
+    EXPECT_GT(impl->GetParamsGeneration(), generation);
+
+    generation = impl->GetParamsGeneration();
+    impl->MarkParamsChanged();
+    EXPECT_GT(impl->GetParamsGeneration(), generation);
+}
+
+/**
+ * @tc.name: Update001
+ * @tc.desc: Verify unchanged effects keep their compiled filters across updates
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECompiledEffectChainTest, Update001, TestSize.Level1)
+{
+    Drawing::GEVisualEffectContainer veContainer;
+    auto grey = CreateGreyEffect();
+    auto blur = CreateKawaseBlurEffect(10); // 10: blur radius
+    veContainer.AddToChainedFilter(grey);
+    veContainer.AddToChainedFilter(blur);
+
+    GECompiledEffectChain chain;
+    EXPECT_EQ(chain.Update(veContainer), 2); // 2: both effects compiled
+    EXPECT_EQ(chain.GetNodeCount(), 2);
+    auto greyFilter = chain.AcquireFilter(grey->GetImpl());
+    auto blurFilter = chain.AcquireFilter(blur->GetImpl());
+    ASSERT_NE(greyFilter, nullptr);
+    ASSERT_NE(blurFilter, nullptr);
+
+    EXPECT_EQ(chain.Update(veContainer), 0);
+    EXPECT_EQ(chain.AcquireFilter(grey->GetImpl()), greyFilter);
+    EXPECT_EQ(chain.AcquireFilter(blur->GetImpl()), blurFilter);
+}
+
+/**
+ * @tc.name: Update002
+ * @tc.desc: Verify only the effect with changed params is rebuilt
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECompiledEffectChainTest, Update002, TestSize.Level1)
+{
+    Drawing::GEVisualEffectContainer veContainer;
+    auto grey = CreateGreyEffect();
+    auto blur = CreateKawaseBlurEffect(10); // 10: blur radius
+    veContainer.AddToChainedFilter(grey);
+    veContainer.AddToChainedFilter(blur);
+
+    GECompiledEffectChain chain;
+    chain.Update(veContainer);
+    auto greyFilter = chain.AcquireFilter(grey->GetImpl());
+    auto blurFilter = chain.AcquireFilter(blur->GetImpl());
+
+    blur->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 20); // 20: blur radius
+    EXPECT_EQ(chain.AcquireFilter(blur->GetImpl()), nullptr); // outdated until the next update
+    EXPECT_EQ(chain.Update(veContainer), 1);
+    EXPECT_EQ(chain.AcquireFilter(grey->GetImpl()), greyFilter);
+    auto newBlurFilter = chain.AcquireFilter(blur->GetImpl());
+    ASSERT_NE(newBlurFilter, nullptr);
+    EXPECT_NE(newBlurFilter, blurFilter);
+}
+
+/**
+ * @tc.name: Update003
+ * @tc.desc: Verify nodes of removed effects are released
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECompiledEffectChainTest, Update003, TestSize.Level1)
+{
+    auto grey = CreateGreyEffect();
+    auto blur = CreateKawaseBlurEffect(10); // 10: blur radius
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(grey);
+    veContainer.AddToChainedFilter(blur);
+
+    GECompiledEffectChain chain;
+    chain.Update(veContainer);
+    EXPECT_EQ(chain.GetNodeCount(), 2); // 2: grey and blur
+
+    Drawing::GEVisualEffectContainer greyOnlyContainer;
+    greyOnlyContainer.AddToChainedFilter(grey);
+    EXPECT_EQ(chain.Update(greyOnlyContainer), 0);
+    EXPECT_EQ(chain.GetNodeCount(), 1);
+    EXPECT_EQ(chain.AcquireFilter(blur->GetImpl()), nullptr);
+
+    chain.Clear();
+    EXPECT_EQ(chain.GetNodeCount(), 0);
+    EXPECT_EQ(chain.AcquireFilter(grey->GetImpl()), nullptr);
+}
+
+/**
+ * @tc.name: Update004
+ * @tc.desc: Verify filters that are not reusable are handed out once and never compiled again
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECompiledEffectChainTest, Update004, TestSize.Level1)
+{
+    auto edgeLight = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_EDGE_LIGHT);
+    Drawing::GEVisualEffectContainer veContainer;
+    veContainer.AddToChainedFilter(edgeLight);
+
+    GECompiledEffectChain chain;
+    EXPECT_EQ(chain.Update(veContainer), 1);
+    auto filter = chain.AcquireFilter(edgeLight->GetImpl());
+    ASSERT_NE(filter, nullptr);
+    EXPECT_FALSE(filter->IsReusableAcrossFrames());
+    EXPECT_EQ(chain.AcquireFilter(edgeLight->GetImpl()), nullptr);
+
+    EXPECT_EQ(chain.Update(veContainer), 0);
+    EXPECT_EQ(chain.AcquireFilter(edgeLight->GetImpl()), nullptr);
+}
+
+/**
+ * @tc.name: AcquireFilter001
+ * @tc.desc: Verify null and unknown effects have no compiled filter
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECompiledEffectChainTest, AcquireFilter001, TestSize.Level1)
+{
+    GECompiledEffectChain chain;
+    EXPECT_EQ(chain.AcquireFilter(nullptr), nullptr);
+    auto grey = CreateGreyEffect();
+    EXPECT_EQ(chain.AcquireFilter(grey->GetImpl()), nullptr);
+}
+
+} // namespace Rosen
+} // namespace OHOS
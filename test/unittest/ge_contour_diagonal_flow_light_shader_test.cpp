@@ -819,11 +819,11 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, ComputeAllCurveBoundingBoxes_001,
 }
 
 /**
- * @tc.name: InitializeWorkQueue_001
- * @tc.desc: Verify function InitializeWorkQueue
+ * @tc.name: SpatialIndexRoot_001
+ * @tc.desc: Verify the spatial index root keeps the curves touching the root box
  * @tc.type: FUNC
  */
-HWTEST_F(GEContourDiagonalFlowLightShaderTest, InitializeWorkQueue_001, TestSize.Level1)
+HWTEST_F(GEContourDiagonalFlowLightShaderTest, SpatialIndexRoot_001, TestSize.Level1)
 {
     auto params = InitializeParams();
     const int w = 200, h = 200;
@@ -849,25 +849,22 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, InitializeWorkQueue_001, TestSize
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBoxUnion, curveBBoxes); // 0.05: maxThickness
     Box4f leftHalfCanvas{0.0f, float(w) * 0.5f, 0.0f, float(h)};
 
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(leftHalfCanvas, curveBBoxes, workQueue);
-
-    ASSERT_FALSE(workQueue.empty());
-    Grid root = workQueue.front();
-    EXPECT_GT(root.curveIndices.size(), 0u);
-    EXPECT_EQ(root.curveIndices.size(), static_cast<size_t>(shader.numCurves_));
+    shader.spatialIndex_.Build(curveBBoxes, leftHalfCanvas);
+    ASSERT_FALSE(shader.spatialIndex_.GetNodes().empty());
+    const auto& root = shader.spatialIndex_.GetNodes()[0];
+    EXPECT_EQ(root.indexCount, static_cast<uint32_t>(shader.numCurves_));
 }
 
 /**
- * @tc.name: SplitGrid_001
- * @tc.desc: Verify function SplitGrid
+ * @tc.name: SpatialIndexSplit_001
+ * @tc.desc: Verify the spatial index splits a grid holding more than MAX_CURVES_PER_GRID curves
  * @tc.type: FUNC
  */
-HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_001, TestSize.Level1)
+HWTEST_F(GEContourDiagonalFlowLightShaderTest, SpatialIndexSplit_001, TestSize.Level1)
 {
     auto params = InitializeParams();
-    const int w = 100, h = 100;
-    const size_t K = 12;
+    const int w = 512, h = 512;
+    const size_t K = 24;
     std::vector<Vector2f> contour; contour.reserve(2 * K);
     for (size_t i = 0; i < K; ++i) {
         float y  = 0.05f + 0.90f * (float(i) / float(K - 1));
@@ -889,29 +886,26 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_001, TestSize.Level1)
     Box4f canvasBBox;
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBox, curveBBoxes); // 0.05f: maxThickness
 
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    ASSERT_FALSE(workQueue.empty());
-    Grid current = workQueue.front();
-
-    size_t q0 = workQueue.size();
-    shader.SplitGrid(current, curveBBoxes, workQueue, 128); // 128: minGridSize
-    EXPECT_GT(workQueue.size(), q0);
+    shader.spatialIndex_.Build(curveBBoxes, canvasBBox);
+    const auto& nodes = shader.spatialIndex_.GetNodes();
+    ASSERT_GT(nodes.size(), 1u);
+    EXPECT_FALSE(nodes[0].IsLeaf());
+    EXPECT_GT(shader.spatialIndex_.GetLeaves().size(), 1u);
 }
 
 /**
- * @tc.name: SplitGrid_002
- * @tc.desc: Verify function SplitGrid sparse quadrants for empty child.curveIndices
+ * @tc.name: SpatialIndexSplit_002
+ * @tc.desc: Verify quadrants no curve touches are not kept as grids
  * @tc.type: FUNC
  */
-HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_002, TestSize.Level1)
+HWTEST_F(GEContourDiagonalFlowLightShaderTest, SpatialIndexSplit_002, TestSize.Level1)
 {
     auto params = InitializeParams();
     const int w = 200, h = 200;
-    const size_t K = 6;
+    const size_t K = 20;
     std::vector<Vector2f> contour; contour.reserve(2 * K);
     for (size_t i = 0; i < K; ++i) {
-        float y  = 0.08f + 0.01f * static_cast<float>(i); // 0.08 ~ 0.13
+        float y  = 0.08f + 0.002f * static_cast<float>(i); // 0.08 ~ 0.12
         float x0 = 0.10f;
         float xc = 0.12f;
         contour.emplace_back(x0, y);  // P0 (UV)
@@ -927,19 +921,14 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, SplitGrid_002, TestSize.Level1)
     std::vector<Box4f> curveBBoxes;
     Box4f canvasBBox;
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBox, curveBBoxes); // 0.05:maxThickness
-
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    ASSERT_FALSE(workQueue.empty());
-    size_t q0 = workQueue.size();
-    Grid current = workQueue.front(); // entire curveIndices
-    current.bbox[1] += 1000.0f;  // XMAX_I, expand to the right
-    current.bbox[3] += 1000.0f;  // YMAX_I, expand downwards
-
-    shader.SplitGrid(current, curveBBoxes, workQueue, 128); // 128: minGridSize
-    size_t pushed = workQueue.size() - q0;
-    // only push the lefttop corner to the workQueue，child.curveIndices.empty() is true in the other three corners
-    EXPECT_EQ(pushed, 1u);
+    canvasBBox[1] += 1000.0f;  // XMAX_I, expand to the right
+    canvasBBox[3] += 1000.0f;  // YMAX_I, expand downwards
+
+    shader.spatialIndex_.Build(curveBBoxes, canvasBBox);
+    const auto& root = shader.spatialIndex_.GetNodes()[0];
+    // only the lefttop corner is kept, the other three corners have no curve
+    EXPECT_EQ(root.childCount, 1u);
+    EXPECT_GE(shader.spatialIndex_.GetEmptyCells().size(), 3u);
 }
 
 /**
@@ -955,10 +944,8 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, ProcessFinalGrid_001, TestSize.Le
     std::vector<Box4f> curveBBoxes;
     Box4f canvasBBox;
     shader.ComputeAllCurveBoundingBoxes(100, 100, 0.05f, canvasBBox, curveBBoxes); // width, height, maxThickness
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(canvasBBox, curveBBoxes, workQueue);
-    Grid current = workQueue.front();
-    shader.ProcessFinalGrid(current, curveBBoxes, 100); // 100: height
+    shader.spatialIndex_.Build(curveBBoxes, canvasBBox);
+    shader.ProcessFinalGrid(shader.spatialIndex_.GetNodes()[0], 100); // 100: height
     ASSERT_FALSE(shader.curvesInGrid_.empty());
     ASSERT_FALSE(shader.segmentIndex_.empty());
 }
@@ -999,15 +986,13 @@ HWTEST_F(GEContourDiagonalFlowLightShaderTest, ProcessFinalGrid_002, TestSize.Le
     Box4f canvasBBoxUnion;
     shader.ComputeAllCurveBoundingBoxes(w, h, 0.05f, canvasBBoxUnion, curveBBoxes); // 0.05f: maxThickness
     Box4f rightCanvas{0.80f * w, static_cast<float>(w), 0.0f, static_cast<float>(h)};
-    std::queue<Grid> workQueue;
-    shader.InitializeWorkQueue(rightCanvas, curveBBoxes, workQueue);
-    ASSERT_FALSE(workQueue.empty());
-    Grid current = workQueue.front();
-    EXPECT_EQ(current.curveIndices.size(), kR + 1);
-    EXPECT_LT(current.curveIndices.size(), static_cast<size_t>(shader.numCurves_));
-    shader.ProcessFinalGrid(current, curveBBoxes, 100); // 100: height
-    ASSERT_FALSE(shader.curvesInGrid_.empty());
-    ASSERT_FALSE(shader.segmentIndex_.empty());
+    shader.spatialIndex_.Build(curveBBoxes, rightCanvas);
+    const auto& root = shader.spatialIndex_.GetNodes()[0];
+    EXPECT_EQ(root.indexCount, kR + 1);
+    EXPECT_LT(root.indexCount, static_cast<uint32_t>(shader.numCurves_));
+    shader.ProcessFinalGrid(root, 100); // 100: height
+    ASSERT_EQ(shader.curvesInGrid_.size(), 1u);
+    EXPECT_EQ(shader.segmentIndex_[0].size(), kR + 1);
 }
 
 /**
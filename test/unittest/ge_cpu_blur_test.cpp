@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+
+#include <gtest/gtest.h>
+
+#include "ge_cpu_blur.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+constexpr float EPSILON = 1e-4f;
+
+GECpuBlur::Buffer MakeBuffer(int width, int height, float r, float g, float b, float a)
+{
+    GECpuBlur::Buffer buffer;
+    buffer.width = width;
+    buffer.height = height;
+    buffer.pixels.resize(static_cast<size_t>(width) * height * 4); // 4: rgba
+    for (size_t i = 0; i < buffer.pixels.size(); i += 4) { // 4: rgba
+        buffer.pixels[i] = r;
+        buffer.pixels[i + 1] = g;
+        buffer.pixels[i + 2] = b; // 2: blue
+        buffer.pixels[i + 3] = a; // 3: alpha
+    }
+    return buffer;
+}
+
+bool IsConstant(const GECpuBlur::Buffer& buffer, float r, float g, float b, float a)
+{
+    for (size_t i = 0; i < buffer.pixels.size(); i += 4) { // 4: rgba
+        if (std::abs(buffer.pixels[i] - r) > EPSILON || std::abs(buffer.pixels[i + 1] - g) > EPSILON ||
+            std::abs(buffer.pixels[i + 2] - b) > EPSILON || std::abs(buffer.pixels[i + 3] - a) > EPSILON) {
+            return false;
+        }
+    }
+    return !buffer.pixels.empty();
+}
+} // namespace
+
+class GECpuBlurTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static inline Drawing::Canvas canvas_;
+};
+
+/**
+ * @tc.name: ShouldUse_001
+ * @tc.desc: Verify canvases without a GPU context use the native passes
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECpuBlurTest, ShouldUse_001, TestSize.Level1)
+{
+    EXPECT_EQ(GECpuBlur::ShouldUse(canvas_), GECpuBlur::IsEnabled());
+}
+
+/**
+ * @tc.name: MakeMapping_001
+ * @tc.desc: Verify scale and translate matrices are inverted and skewed ones are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECpuBlurTest, MakeMapping_001, TestSize.Level1)
+{
+    Drawing::Matrix matrix;
+    matrix.SetScale(2.0f, 4.0f);
+    matrix.PostTranslate(10.0f, 20.0f);
+    GECpuBlur::Mapping mapping;
+    ASSERT_TRUE(GECpuBlur::MakeMapping(matrix, mapping));
+    EXPECT_NEAR(mapping.scaleX, 0.5f, EPSILON);
+    EXPECT_NEAR(mapping.scaleY, 0.25f, EPSILON);
+    EXPECT_NEAR(mapping.transX, -5.0f, EPSILON);
+    EXPECT_NEAR(mapping.transY, -5.0f, EPSILON);
+
+    Drawing::Matrix skew;
+    skew.SetSkew(0.5f, 0.0f);
+    EXPECT_FALSE(GECpuBlur::MakeMapping(skew, mapping));
+
+    Drawing::Matrix singular;
+    singular.SetScale(0.0f, 1.0f);
+    EXPECT_FALSE(GECpuBlur::MakeMapping(singular, mapping));
+}
+
+/**
+ * @tc.name: Resample_001
+ * @tc.desc: Verify resampling keeps constant images and clears for empty sources
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECpuBlurTest, Resample_001, TestSize.Level1)
+{
+    auto src = MakeBuffer(40, 30, 0.2f, 0.4f, 0.6f, 1.0f);
+    GECpuBlur::Mapping mapping { 4.0f, 3.0f, 0.0f, 0.0f };
+    GECpuBlur::Buffer dst;
+    GECpuBlur::Resample(src, mapping, 10, 10, dst);
+    EXPECT_EQ(dst.width, 10);
+    EXPECT_EQ(dst.height, 10);
+    EXPECT_TRUE(IsConstant(dst, 0.2f, 0.4f, 0.6f, 1.0f));
+
+    GECpuBlur::Resample(GECpuBlur::Buffer {}, mapping, 5, 5, dst);
+    EXPECT_TRUE(IsConstant(dst, 0.0f, 0.0f, 0.0f, 0.0f));
+}
+
+/**
+ * @tc.name: KawasePass_001
+ * @tc.desc: Verify a Kawase pass keeps constant images and spreads a single pixel
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECpuBlurTest, KawasePass_001, TestSize.Level1)
+{
+    auto src = MakeBuffer(64, 64, 0.5f, 0.5f, 0.5f, 1.0f);
+    GECpuBlur::Buffer dst;
+    GECpuBlur::KawasePass(src, {}, 3.0f, 64.0f, 64.0f, 64, 64, dst);
+    EXPECT_TRUE(IsConstant(dst, 0.5f, 0.5f, 0.5f, 1.0f));
+
+    auto dot = MakeBuffer(9, 9, 0.0f, 0.0f, 0.0f, 0.0f);
+    dot.pixels[(4 * 9 + 4) * 4 + 3] = 1.0f; // 4, 9: center pixel of 9 x 9, 3: alpha
+    GECpuBlur::KawasePass(dot, {}, 2.0f, 9.0f, 9.0f, 9, 9, dst);
+    EXPECT_NEAR(dst.pixels[(4 * 9 + 4) * 4 + 3], 0.2f, EPSILON); // center tap weight
+    EXPECT_NEAR(dst.pixels[(2 * 9 + 2) * 4 + 3], 0.2f, EPSILON); // diagonal tap weight
+    EXPECT_NEAR(dst.pixels[(4 * 9 + 2) * 4 + 3], 0.0f, EPSILON);
+}
+
+/**
+ * @tc.name: MesaPass_001
+ * @tc.desc: Verify a MESA pass keeps constant images at the requested size
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECpuBlurTest, MesaPass_001, TestSize.Level1)
+{
+    auto src = MakeBuffer(64, 48, 0.1f, 0.3f, 0.7f, 0.9f);
+    GECpuBlur::Buffer dst;
+    GECpuBlur::MesaPass(src, { 2.0f, 2.0f, 0.0f, 0.0f }, 2.5f, 1.5f, 32, 24, dst);
+    EXPECT_EQ(dst.width, 32);
+    EXPECT_EQ(dst.height, 24);
+    EXPECT_TRUE(IsConstant(dst, 0.1f, 0.3f, 0.7f, 0.9f));
+}
+
+/**
+ * @tc.name: MixAndDither_001
+ * @tc.desc: Verify the final pass mixes with the original and leaves alpha without noise
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECpuBlurTest, MixAndDither_001, TestSize.Level1)
+{
+    auto blurred = MakeBuffer(16, 16, 1.0f, 1.0f, 1.0f, 1.0f);
+    auto original = MakeBuffer(16, 16, 0.0f, 0.0f, 0.0f, 1.0f);
+    GECpuBlur::Buffer dst;
+    GECpuBlur::MixAndDither(blurred, {}, &original, {}, 0.5f, 0.0f, 16, 16, dst);
+    EXPECT_TRUE(IsConstant(dst, 0.5f, 0.5f, 0.5f, 1.0f));
+
+    GECpuBlur::MixAndDither(blurred, {}, nullptr, {}, 1.0f, 1.75f, 16, 16, dst);
+    for (size_t i = 0; i < dst.pixels.size(); i += 4) { // 4: rgba
+        EXPECT_NEAR(dst.pixels[i], 1.0f, 1.75f / 255.0f + EPSILON);
+        EXPECT_NEAR(dst.pixels[i + 3], 1.0f, EPSILON); // 3: alpha
+    }
+}
+
+/**
+ * @tc.name: ReadImage_001
+ * @tc.desc: Verify images survive a round trip through a buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECpuBlurTest, ReadImage_001, TestSize.Level1)
+{
+    GECpuBlur::Buffer buffer;
+    EXPECT_FALSE(GECpuBlur::ReadImage(nullptr, buffer));
+
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(20, 10, format); // 20, 10 bitmap size
+    bmp.ClearWithColor(Drawing::Color::COLOR_BLUE);
+    auto image = bmp.MakeImage();
+    ASSERT_NE(image, nullptr);
+    ASSERT_TRUE(GECpuBlur::ReadImage(image, buffer));
+    EXPECT_EQ(buffer.width, 20);
+    EXPECT_EQ(buffer.height, 10);
+    EXPECT_TRUE(IsConstant(buffer, 0.0f, 0.0f, 1.0f, 1.0f));
+
+    auto made = GECpuBlur::MakeImage(buffer, image->GetImageInfo());
+    ASSERT_NE(made, nullptr);
+    EXPECT_EQ(made->GetWidth(), 20);
+    EXPECT_EQ(made->GetHeight(), 10);
+}
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "ge_curve_spatial_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+namespace {
+using Box = GECurveSpatialIndex::Box;
+constexpr float CANVAS_SIZE = 512.0f;
+constexpr float CURVE_SIZE = 16.0f;
+constexpr uint32_t GRID_CURVES = 8;
+
+// GRID_CURVES x GRID_CURVES small boxes spread evenly over the canvas
+std::vector<Box> MakeGridBoxes()
+{
+    std::vector<Box> boxes;
+    float step = CANVAS_SIZE / GRID_CURVES;
+    for (uint32_t y = 0; y < GRID_CURVES; ++y) {
+        for (uint32_t x = 0; x < GRID_CURVES; ++x) {
+            float left = x * step + 4.0f; // 4.0: keep off the cell edges
+            float top = y * step + 4.0f;  // 4.0: keep off the cell edges
+            boxes.push_back({ left, left + CURVE_SIZE, top, top + CURVE_SIZE });
+        }
+    }
+    return boxes;
+}
+
+GECurveSpatialIndex::Config MakeConfig()
+{
+    GECurveSpatialIndex::Config config;
+    config.maxCurvesPerLeaf = 4;
+    config.minNodeSize = 64.0f;
+    config.splitEitherSide = true;
+    config.halveThinNodes = true;
+    return config;
+}
+
+std::vector<uint32_t> LeafCurves(const GECurveSpatialIndex& index, size_t leaf)
+{
+    const auto& node = index.GetNodes()[index.GetLeaves()[leaf]];
+    return { index.CurvesBegin(node), index.CurvesEnd(node) };
+}
+
+void ExpectSameLeaves(const GECurveSpatialIndex& a, const GECurveSpatialIndex& b)
+{
+    ASSERT_EQ(a.GetLeaves(), b.GetLeaves());
+    for (size_t i = 0; i < a.GetLeaves().size(); ++i) {
+        EXPECT_EQ(a.GetNodes()[a.GetLeaves()[i]].bbox, b.GetNodes()[b.GetLeaves()[i]].bbox);
+        EXPECT_EQ(LeafCurves(a, i), LeafCurves(b, i));
+    }
+    EXPECT_EQ(a.GetEmptyCells(), b.GetEmptyCells());
+}
+} // namespace
+
+class GECurveSpatialIndexTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    const Box rootBox_ = { 0.0f, CANVAS_SIZE, 0.0f, CANVAS_SIZE };
+};
+
+/**
+ * @tc.name: Build_001
+ * @tc.desc: Verify every curve lands in a leaf touching it, leaves hold few curves in ascending order
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECurveSpatialIndexTest, Build_001, TestSize.Level1)
+{
+    auto boxes = MakeGridBoxes();
+    GECurveSpatialIndex index(MakeConfig());
+    index.Build(boxes, rootBox_);
+
+    ASSERT_GT(index.GetLeaves().size(), 1u);
+    std::vector<bool> covered(boxes.size(), false);
+    for (size_t i = 0; i < index.GetLeaves().size(); ++i) {
+        const auto& leaf = index.GetNodes()[index.GetLeaves()[i]];
+        EXPECT_TRUE(leaf.IsLeaf());
+        EXPECT_LE(leaf.indexCount, 4u);
+        auto curves = LeafCurves(index, i);
+        EXPECT_TRUE(std::is_sorted(curves.begin(), curves.end()));
+        for (uint32_t curve : curves) {
+            EXPECT_TRUE(GECurveSpatialIndex::Intersect(leaf.bbox, boxes[curve]));
+            covered[curve] = true;
+        }
+    }
+    EXPECT_EQ(std::count(covered.begin(), covered.end(), false), 0);
+    // Leaves come out in breadth first order
+    for (size_t i = 1; i < index.GetLeaves().size(); ++i) {
+        EXPECT_LT(index.GetLeaves()[i - 1], index.GetLeaves()[i]);
+    }
+}
+
+/**
+ * @tc.name: Build_002
+ * @tc.desc: Verify curves stacked on one spot stop splitting at maxDepth
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECurveSpatialIndexTest, Build_002, TestSize.Level1)
+{
+    std::vector<Box> boxes(32, Box { 100.0f, 101.0f, 100.0f, 101.0f }); // 32 curves on one pixel
+    auto config = MakeConfig();
+    config.minNodeSize = 0.0f;
+    config.maxDepth = 3;
+    GECurveSpatialIndex index(config);
+    index.Build(boxes, rootBox_);
+
+    for (const auto& node : index.GetNodes()) {
+        EXPECT_LE(node.depth, 3u);
+    }
+    ASSERT_EQ(index.GetLeaves().size(), 1u);
+    EXPECT_EQ(LeafCurves(index, 0).size(), boxes.size());
+}
+
+/**
+ * @tc.name: Build_003
+ * @tc.desc: Verify halveThinNodes splits a narrow node in two and empty children become empty cells
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECurveSpatialIndexTest, Build_003, TestSize.Level1)
+{
+    std::vector<Box> boxes;
+    for (int i = 0; i < 6; ++i) { // 6 curves in the top half of a 32 x 512 column
+        float top = i * 32.0f;
+        boxes.push_back({ 0.0f, 32.0f, top, top + 16.0f });
+    }
+    Box column = { 0.0f, 32.0f, 0.0f, CANVAS_SIZE };
+    GECurveSpatialIndex index(MakeConfig());
+    index.Build(boxes, column);
+
+    const auto& root = index.GetNodes()[0];
+    EXPECT_EQ(root.childCount, 1u);
+    ASSERT_FALSE(index.GetEmptyCells().empty());
+    const Box& bottom = index.GetEmptyCells()[0];
+    EXPECT_FLOAT_EQ(bottom[GECurveSpatialIndex::XMAX_I] - bottom[GECurveSpatialIndex::XMIN_I], 32.0f);
+    EXPECT_FLOAT_EQ(bottom[GECurveSpatialIndex::YMIN_I], CANVAS_SIZE * 0.5f);
+}
+
+/**
+ * @tc.name: Build_004
+ * @tc.desc: Verify clipToRoot keeps only the curves touching the root box
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECurveSpatialIndexTest, Build_004, TestSize.Level1)
+{
+    auto boxes = MakeGridBoxes();
+    auto config = MakeConfig();
+    config.clipToRoot = true;
+    GECurveSpatialIndex index(config);
+    Box leftColumn = { 0.0f, 32.0f, 0.0f, CANVAS_SIZE };
+    index.Build(boxes, leftColumn);
+
+    EXPECT_EQ(index.GetNodes()[0].indexCount, GRID_CURVES);
+    index.Clear();
+    EXPECT_TRUE(index.GetNodes().empty());
+    EXPECT_TRUE(index.GetLeaves().empty());
+}
+
+/**
+ * @tc.name: Update_001
+ * @tc.desc: Verify moving curves within and across cells updates in place and matches a fresh build
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECurveSpatialIndexTest, Update_001, TestSize.Level1)
+{
+    auto boxes = MakeGridBoxes();
+    auto config = MakeConfig();
+    config.maxCurvesPerLeaf = 5; // 5: leaves of 4 curves have room for one more
+    GECurveSpatialIndex index(config);
+    index.Build(boxes, rootBox_);
+    size_t nodeCount = index.GetNodes().size();
+
+    boxes[9][GECurveSpatialIndex::XMIN_I] += 8.0f; // 8.0: stays inside its cell
+    boxes[9][GECurveSpatialIndex::XMAX_I] += 8.0f;
+    boxes[27][GECurveSpatialIndex::YMIN_I] += 48.0f; // 48.0: reaches into the cell below
+    boxes[27][GECurveSpatialIndex::YMAX_I] += 48.0f;
+    EXPECT_TRUE(index.Update(boxes, { 9, 27 }, rootBox_));
+    EXPECT_EQ(index.GetNodes().size(), nodeCount);
+
+    GECurveSpatialIndex fresh(config);
+    fresh.Build(boxes, rootBox_);
+    ExpectSameLeaves(index, fresh);
+}
+
+/**
+ * @tc.name: Update_002
+ * @tc.desc: Verify Update refuses changes a fresh build would split differently, leaving the index unchanged
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECurveSpatialIndexTest, Update_002, TestSize.Level1)
+{
+    std::vector<Box> boxes(6, Box { 10.0f, 20.0f, 10.0f, 20.0f }); // 6 curves in the top left corner
+    GECurveSpatialIndex index(MakeConfig());
+    index.Build(boxes, rootBox_);
+    ASSERT_FALSE(index.GetEmptyCells().empty());
+    auto leaves = index.GetLeaves();
+
+    auto moved = boxes;
+    moved[0] = { 400.0f, 410.0f, 400.0f, 410.0f }; // Into an empty cell
+    EXPECT_FALSE(index.Update(moved, { 0 }, rootBox_));
+    EXPECT_EQ(index.GetLeaves(), leaves);
+
+    moved.pop_back();
+    EXPECT_FALSE(index.Update(moved, { 0 }, rootBox_));
+    EXPECT_FALSE(index.Update(boxes, { 0 }, { 0.0f, 256.0f, 0.0f, 256.0f }));
+}
+
+/**
+ * @tc.name: Refresh_001
+ * @tc.desc: Verify Refresh updates when few curves moved and rebuilds otherwise, both matching a fresh build
+ * @tc.type: FUNC
+ */
+HWTEST_F(GECurveSpatialIndexTest, Refresh_001, TestSize.Level1)
+{
+    auto boxes = MakeGridBoxes();
+    GECurveSpatialIndex index(MakeConfig());
+    EXPECT_FALSE(index.Refresh(boxes, rootBox_)); // First call builds
+    EXPECT_TRUE(index.Refresh(boxes, rootBox_));  // Nothing moved
+
+    boxes[0][GECurveSpatialIndex::XMAX_I] += 2.0f; // 2.0: small move
+    EXPECT_TRUE(index.Refresh(boxes, rootBox_));
+
+    for (auto& box : boxes) {
+        box[GECurveSpatialIndex::XMAX_I] += 2.0f; // 2.0: every curve moves
+    }
+    EXPECT_FALSE(index.Refresh(boxes, rootBox_));
+
+    GECurveSpatialIndex fresh(MakeConfig());
+    fresh.Build(boxes, rootBox_);
+    ExpectSameLeaves(index, fresh);
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -310,5 +310,21 @@ HWTEST_F(GEEffectFactoryTest, VerifyRegistrationCoverage_001, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: GetCategory_001
+ * @tc.desc: Verify registrations record the category of the effect they create
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEEffectFactoryTest, GetCategory_001, TestSize.Level1)
+{
+    EXPECT_EQ(GEEffectFactory::GetCategory(GEFilterType::KAWASE_BLUR), GEEffectCategory::FILTER);
+    EXPECT_EQ(GEEffectFactory::GetCategory(GEFilterType::AURORA_NOISE), GEEffectCategory::SHADER);
+    EXPECT_EQ(GEEffectFactory::GetCategory(GEFilterType::RIPPLE_MASK), GEEffectCategory::MASK);
+    EXPECT_EQ(GEEffectFactory::GetCategory(GEFilterType::SDF_RRECT_SHAPE), GEEffectCategory::SHAPE);
+    EXPECT_FALSE(GEEffectFactory::IsRegistered(GEFilterType::GAMMA_CORRECTION));
+    EXPECT_EQ(GEEffectFactory::GetCategory(GEFilterType::GAMMA_CORRECTION), GEEffectCategory::UNKNOWN);
+    EXPECT_EQ(GEEffectFactory::GetCategory(GEFilterType::MAX), GEEffectCategory::UNKNOWN);
+}
+
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
\ No newline at end of file
@@ -14,11 +14,15 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <any>
 #include <memory>
+#include <string_view>
 #include <vector>
 
 #include "ge_filter_composer.h"
 #include "ge_filter_composer_pass.h"
+#include "ge_filter_fusion_pass.h"
 #include "ge_filter_type.h"
 #include "ge_filter_type_info.h"
 #include "ge_direct_draw_on_canvas_pass.h"
@@ -682,5 +686,197 @@ HWTEST_F(GEFilterComposerTest, HpsUpscalePassRunHpsEffectWithGEAfter, TestSize.L
     GTEST_LOG_(INFO) << "GEFilterComposerTest HpsUpscalePassRunHpsEffectWithGEAfter end";
 }
 
+/**
+ * @tc.name: FilterFusionPassRunBlurChain
+ * @tc.desc: Test GEFilterFusionPass folds grey followed by two blurs into one MESA blur and reports the rules
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, FilterFusionPassRunBlurChain, TestSize.Level1)
+{
+    GEFilterFusionPass pass;
+
+    std::vector<GEFilterComposable> composables;
+    composables.push_back(CreateGreyEffect());
+    composables.push_back(CreateKawaseBlurEffect());
+    composables.push_back(CreateKawaseBlurEffect());
+    composables.push_back(CreateVisualEffect(Drawing::GE_FILTER_WATER_RIPPLE));
+
+    auto result = pass.Run(composables);
+    EXPECT_TRUE(result.changed);
+    ASSERT_EQ(composables.size(), 2);
+    auto effect = composables[0].GetEffect();
+    ASSERT_NE(effect, nullptr);
+    EXPECT_EQ(effect->GetImpl()->GetFilterType(), GEFilterType::MESA_BLUR);
+    auto params = effect->GetImpl()->GetMESAParams();
+    ASSERT_NE(params, nullptr);
+    auto kawaseRadius = CreateKawaseBlurEffect()->GetImpl()->GetKawaseParams()->radius;
+    EXPECT_EQ(params->radius, GEFilterFusionPass::CombineBlurRadius(kawaseRadius, kawaseRadius));
+    EXPECT_EQ(params->greyCoef1, 0.5f);
+    EXPECT_EQ(composables[1].GetEffect()->GetImpl()->GetFilterType(), GEFilterType::WATER_RIPPLE);
+
+    std::vector<std::string_view> expectedRules { "GreyKawaseToMesa", "MesaKawase" };
+    EXPECT_EQ(pass.GetFiredRules(), expectedRules);
+}
+
+/**
+ * @tc.name: FilterFusionPassRunGreyMesa
+ * @tc.desc: Test GEFilterFusionPass fuses grey into a MESA blur only when that blur has no grey of its own
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, FilterFusionPassRunGreyMesa, TestSize.Level1)
+{
+    GEFilterFusionPass pass;
+
+    std::vector<GEFilterComposable> composables;
+    composables.push_back(CreateGreyEffect());
+    composables.push_back(CreateMesaBlurEffect()); // Already has grey
+    EXPECT_FALSE(pass.Run(composables).changed);
+    EXPECT_TRUE(pass.GetFiredRules().empty());
+    ASSERT_EQ(composables.size(), 2);
+
+    auto plainMesa = CreateMesaBlurEffect();
+    plainMesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_GREY_COEF_1, 0.f);
+    plainMesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_GREY_COEF_2, 0.f);
+    composables = { CreateGreyEffect(), plainMesa };
+    EXPECT_TRUE(pass.Run(composables).changed);
+    ASSERT_EQ(composables.size(), 1);
+    auto params = composables[0].GetEffect()->GetImpl()->GetMESAParams();
+    ASSERT_NE(params, nullptr);
+    EXPECT_EQ(params->greyCoef1, 0.5f);
+    EXPECT_EQ(params->greyCoef2, 0.5f);
+    ASSERT_EQ(pass.GetFiredRules().size(), 1);
+    EXPECT_EQ(pass.GetFiredRules()[0], "GreyMesaToMesa");
+}
+
+/**
+ * @tc.name: FilterFusionPassSkipNonCommuting
+ * @tc.desc: Test GEFilterFusionPass leaves grey after a blur and directional blurs untouched
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, FilterFusionPassSkipNonCommuting, TestSize.Level1)
+{
+    GEFilterFusionPass pass;
+
+    std::vector<GEFilterComposable> composables;
+    composables.push_back(CreateKawaseBlurEffect());
+    composables.push_back(CreateGreyEffect());
+    EXPECT_FALSE(pass.Run(composables).changed);
+
+    auto directionMesa = CreateMesaBlurEffect();
+    directionMesa->SetParam(Drawing::GE_FILTER_MESA_BLUR_IS_DIRECTION, true);
+    composables = { directionMesa, CreateKawaseBlurEffect() };
+    EXPECT_FALSE(pass.Run(composables).changed);
+    ASSERT_EQ(composables.size(), 2);
+    EXPECT_EQ(composables[0].GetEffect(), directionMesa);
+}
+
+/**
+ * @tc.name: FilterFusionPassCustomRules
+ * @tc.desc: Test GEFilterFusionPass only applies the rules it is given
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, FilterFusionPassCustomRules, TestSize.Level1)
+{
+    GEFilterFusionPass pass(GEFilterFusionPass::SelectDefaultRules({ "KawaseKawase" }));
+    ASSERT_EQ(GEFilterFusionPass::SelectDefaultRules({ "KawaseKawase" }).size(), 1);
+
+    std::vector<GEFilterComposable> composables;
+    composables.push_back(CreateGreyEffect());
+    composables.push_back(CreateKawaseBlurEffect());
+    composables.push_back(CreateKawaseBlurEffect());
+    EXPECT_TRUE(pass.Run(composables).changed);
+    ASSERT_EQ(composables.size(), 2);
+    EXPECT_EQ(composables[0].GetEffect()->GetImpl()->GetFilterType(), GEFilterType::GREY);
+    EXPECT_EQ(composables[1].GetEffect()->GetImpl()->GetFilterType(), GEFilterType::KAWASE_BLUR);
+}
+
+/**
+ * @tc.name: FilterFusionPassCombineBlurRadius
+ * @tc.desc: Test blur radii combine by Gaussian variance and radii below 1 do not blur
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, FilterFusionPassCombineBlurRadius, TestSize.Level1)
+{
+    EXPECT_EQ(GEFilterFusionPass::CombineBlurRadius(0, 30), 30);
+    EXPECT_EQ(GEFilterFusionPass::CombineBlurRadius(30, 0), 30);
+    int combined = GEFilterFusionPass::CombineBlurRadius(30, 40);
+    EXPECT_GT(combined, 40);
+    EXPECT_LT(combined, 70);
+    EXPECT_EQ(GEFilterFusionPass::CombineBlurRadius(40, 30), combined);
+}
+
+/**
+ * @tc.name: FilterFusionPassInheritEffectState
+ * @tc.desc: Test the fused effect keeps the canvas info and headroom of the first effect, and its cache when both
+ *           are the same filter
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, FilterFusionPassInheritEffectState, TestSize.Level1)
+{
+    Drawing::CanvasInfo canvasInfo;
+    canvasInfo.geoWidth = 100.0f;
+    canvasInfo.geoHeight = 200.0f;
+    canvasInfo.disableFilterCache = true;
+    auto cache = std::make_shared<std::any>(1);
+
+    GEFilterFusionPass pass;
+    auto mesa = CreateMesaBlurEffect();
+    mesa->SetCanvasInfo(canvasInfo);
+    mesa->SetSupportHeadroom(2.0f);
+    mesa->GetImpl()->SetCache(cache);
+    std::vector<GEFilterComposable> composables { mesa, CreateKawaseBlurEffect() };
+    EXPECT_TRUE(pass.Run(composables).changed);
+    ASSERT_EQ(composables.size(), 1);
+    auto fused = composables[0].GetEffect();
+    ASSERT_NE(fused, nullptr);
+    EXPECT_EQ(fused->GetCanvasInfo().geoWidth, canvasInfo.geoWidth);
+    EXPECT_EQ(fused->GetCanvasInfo().geoHeight, canvasInfo.geoHeight);
+    EXPECT_TRUE(fused->GetCanvasInfo().disableFilterCache);
+    EXPECT_EQ(fused->GetSupportHeadroom(), 2.0f);
+    EXPECT_EQ(fused->GetImpl()->GetCache(), cache);
+
+    auto grey = CreateGreyEffect();
+    grey->SetSupportHeadroom(2.0f);
+    grey->GetImpl()->SetCache(cache);
+    composables = { grey, CreateKawaseBlurEffect() };
+    EXPECT_TRUE(pass.Run(composables).changed);
+    ASSERT_EQ(composables.size(), 1);
+    fused = composables[0].GetEffect();
+    ASSERT_NE(fused, nullptr);
+    EXPECT_EQ(fused->GetSupportHeadroom(), 2.0f);
+    EXPECT_EQ(fused->GetImpl()->GetCache(), nullptr);
+}
+
+/**
+ * @tc.name: FilterFusionPassRenderRules
+ * @tc.desc: Test GERender leaves consecutive blurs unfused unless blur fusion is enabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterComposerTest, FilterFusionPassRenderRules, TestSize.Level1)
+{
+    auto rules = GEFilterFusionPass::GetRenderRules();
+    bool hasBlurRule = std::any_of(rules.begin(), rules.end(), [](const GEFilterFusionRule& rule) {
+        return rule.name == "KawaseKawase" || rule.name == "MesaMesa" || rule.name == "KawaseMesa" ||
+            rule.name == "MesaKawase";
+    });
+    EXPECT_EQ(hasBlurRule, GEFilterFusionPass::IsBlurFusionEnabled());
+    if (GEFilterFusionPass::IsBlurFusionEnabled()) {
+        return;
+    }
+
+    GEFilterFusionPass pass(rules);
+    std::vector<GEFilterComposable> composables;
+    composables.push_back(CreateGreyEffect());
+    composables.push_back(CreateKawaseBlurEffect());
+    composables.push_back(CreateKawaseBlurEffect());
+    EXPECT_TRUE(pass.Run(composables).changed);
+    ASSERT_EQ(composables.size(), 2);
+    EXPECT_EQ(composables[0].GetEffect()->GetImpl()->GetFilterType(), GEFilterType::MESA_BLUR);
+    EXPECT_EQ(composables[1].GetEffect()->GetImpl()->GetFilterType(), GEFilterType::KAWASE_BLUR);
+    std::vector<std::string_view> expectedRules { "GreyKawaseToMesa" };
+    EXPECT_EQ(pass.GetFiredRules(), expectedRules);
+}
+
+
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+
+#include "ge_filter_result_cache.h"
+#include "ge_render.h"
+#include "ge_visual_effect.h"
+#include "ge_visual_effect_impl.h"
+#include "image/bitmap.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GEFilterResultCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static std::shared_ptr<Drawing::Image> MakeImage(int width, int height);
+    static GEFilterResultCache::Key MakeKey(uint32_t imageId, uint64_t paramsHash = 1);
+};
+
+std::shared_ptr<Drawing::Image> GEFilterResultCacheTest::MakeImage(int width, int height)
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(width, height, format);
+    bmp.ClearWithColor(Drawing::Color::COLOR_BLUE);
+    return bmp.MakeImage();
+}
+
+GEFilterResultCache::Key GEFilterResultCacheTest::MakeKey(uint32_t imageId, uint64_t paramsHash)
+{
+    GEFilterResultCache::Key key;
+    key.type = Drawing::GEFilterType::GREY;
+    key.paramsHash = paramsHash;
+    key.imageId = imageId;
+    key.src = Drawing::Rect(0.0f, 0.0f, 50.0f, 50.0f); // 50: image size
+    key.dst = key.src;
+    return key;
+}
+
+/**
+ * @tc.name: FindStore001
+ * @tc.desc: Verify an image is only found with the key it was stored under
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterResultCacheTest, FindStore001, TestSize.Level1)
+{
+    GEFilterResultCache cache;
+    auto image = MakeImage(50, 50); // 50: image size
+    ASSERT_NE(image, nullptr);
+    auto key = MakeKey(1);
+    EXPECT_EQ(cache.Find(key), nullptr);
+    EXPECT_TRUE(cache.Store(key, image));
+    EXPECT_EQ(cache.Find(key), image);
+    EXPECT_EQ(cache.GetUsedBytes(), GEFilterResultCache::GetImageBytes(*image));
+
+    auto otherParams = MakeKey(1, 2); // 2: another params hash
+    EXPECT_EQ(cache.Find(otherParams), nullptr);
+    auto otherDst = key;
+    otherDst.dst = Drawing::Rect(0.0f, 0.0f, 25.0f, 25.0f); // 25: half of image size
+    EXPECT_EQ(cache.Find(otherDst), nullptr);
+    auto otherState = key;
+    otherState.stateHash = 1;
+    EXPECT_EQ(cache.Find(otherState), nullptr);
+
+    EXPECT_EQ(cache.GetHitCount(), 1);
+    EXPECT_EQ(cache.GetMissCount(), 4); // 4: one miss before store, three mismatched keys
+    cache.ResetStats();
+    EXPECT_EQ(cache.GetHitCount(), 0);
+    EXPECT_EQ(cache.GetMissCount(), 0);
+}
+
+/**
+ * @tc.name: Store001
+ * @tc.desc: Verify null images and images larger than the budget are rejected
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterResultCacheTest, Store001, TestSize.Level1)
+{
+    auto image = MakeImage(50, 50); // 50: image size
+    ASSERT_NE(image, nullptr);
+    GEFilterResultCache cache(GEFilterResultCache::GetImageBytes(*image) - 1);
+    EXPECT_FALSE(cache.Store(MakeKey(1), nullptr));
+    EXPECT_FALSE(cache.Store(MakeKey(1), image));
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetUsedBytes(), 0);
+}
+
+/**
+ * @tc.name: Evict001
+ * @tc.desc: Verify the least recently used entry is evicted once the budget is exceeded
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterResultCacheTest, Evict001, TestSize.Level1)
+{
+    auto image = MakeImage(50, 50); // 50: image size
+    ASSERT_NE(image, nullptr);
+    size_t imageBytes = GEFilterResultCache::GetImageBytes(*image);
+    GEFilterResultCache cache(imageBytes * 2); // 2: room for two images
+
+    EXPECT_TRUE(cache.Store(MakeKey(1), image));
+    EXPECT_TRUE(cache.Store(MakeKey(2), image)); // 2: second image id
+    EXPECT_NE(cache.Find(MakeKey(1)), nullptr); // 1 becomes the most recently used
+    EXPECT_TRUE(cache.Store(MakeKey(3), image)); // 3: third image id, evicts 2
+    EXPECT_EQ(cache.GetEntryCount(), 2);
+    EXPECT_NE(cache.Find(MakeKey(1)), nullptr);
+    EXPECT_EQ(cache.Find(MakeKey(2)), nullptr); // 2: evicted image id
+    EXPECT_NE(cache.Find(MakeKey(3)), nullptr); // 3: third image id
+
+    cache.SetByteBudget(imageBytes);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_NE(cache.Find(MakeKey(3)), nullptr); // 3: most recently used image id
+    EXPECT_EQ(cache.GetUsedBytes(), imageBytes);
+}
+
+/**
+ * @tc.name: Invalidate001
+ * @tc.desc: Verify invalidation by image, by type and clear
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterResultCacheTest, Invalidate001, TestSize.Level1)
+{
+    auto image = MakeImage(50, 50); // 50: image size
+    ASSERT_NE(image, nullptr);
+    GEFilterResultCache cache;
+    auto blurKey = MakeKey(1);
+    blurKey.type = Drawing::GEFilterType::KAWASE_BLUR;
+    cache.Store(MakeKey(1), image);
+    cache.Store(MakeKey(2), image); // 2: second image id
+    cache.Store(blurKey, image);
+
+    cache.InvalidateImage(2); // 2: second image id
+    EXPECT_EQ(cache.GetEntryCount(), 2);
+    EXPECT_EQ(cache.Find(MakeKey(2)), nullptr); // 2: second image id
+
+    cache.InvalidateType(Drawing::GEFilterType::KAWASE_BLUR);
+    EXPECT_EQ(cache.GetEntryCount(), 1);
+    EXPECT_EQ(cache.Find(blurKey), nullptr);
+    EXPECT_NE(cache.Find(MakeKey(1)), nullptr);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetEntryCount(), 0);
+    EXPECT_EQ(cache.GetUsedBytes(), 0);
+}
+
+/**
+ * @tc.name: ParamsHash001
+ * @tc.desc: Verify the params hash follows the params content
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterResultCacheTest, ParamsHash001, TestSize.Level1)
+{
+    auto blur = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    blur->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 10); // 10: blur radius
+    auto sameBlur = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    sameBlur->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 10); // 10: blur radius
+
+    auto hash = blur->GetImpl()->GetParamsHash();
+    auto sameHash = sameBlur->GetImpl()->GetParamsHash();
+    ASSERT_NE(hash, nullptr);
+    ASSERT_NE(sameHash, nullptr);
+    uint64_t value = hash->value;
+    EXPECT_EQ(value, sameHash->value);
+
+    blur->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 20); // 20: blur radius
+    hash = blur->GetImpl()->GetParamsHash();
+    ASSERT_NE(hash, nullptr);
+    EXPECT_NE(hash->value, value);
+
+    auto grey = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    auto greyHash = grey->GetImpl()->GetParamsHash();
+    ASSERT_NE(greyHash, nullptr);
+    EXPECT_NE(greyHash->value, sameHash->value);
+}
+
+/**
+ * @tc.name: SetFilterResultCacheEnabled001
+ * @tc.desc: Verify GERender only owns a filter result cache while it is enabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFilterResultCacheTest, SetFilterResultCacheEnabled001, TestSize.Level1)
+{
+    GraphicsEffectEngine::GERender render;
+    EXPECT_EQ(render.GetFilterResultCache(), nullptr);
+    render.SetFilterResultCacheEnabled(true, 1024); // 1024: byte budget
+    ASSERT_NE(render.GetFilterResultCache(), nullptr);
+    EXPECT_EQ(render.GetFilterResultCache()->GetByteBudget(), 1024); // 1024: byte budget
+    render.SetFilterResultCacheEnabled(false);
+    EXPECT_EQ(render.GetFilterResultCache(), nullptr);
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -16,6 +16,8 @@
 #include <gtest/gtest.h>
 
 #include "ge_frosted_glass_blur_shader_filter.h"
+#include "ge_image_cache_provider.h"
+#include "ge_multi_cache_provider.h"
 
 #include "draw/color.h"
 #include "draw/canvas.h"
@@ -114,5 +116,47 @@ HWTEST_F(GEFrostedGlassBlurShaderFilterTest, OnProcessImage_InvalidInputs, TestS
     EXPECT_EQ(filter->OnProcessImage(canvas_, img00, src_, dst_), nullptr);
 }
 
+/**
+ * @tc.name: EdgeCacheKey_001
+ * @tc.desc: Verify each panel keeps one edge image across backgrounds and panels at other rects keep their own
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEFrostedGlassBlurShaderFilterTest, EdgeCacheKey_001, TestSize.Level1)
+{
+    auto params = MakeParams();
+    Drawing::Rect otherRect { 10.0f, 10.0f, 100.0f, 100.0f };
+    auto key = GEFrostedGlassBlurShaderFilter::GetEdgeCacheKey(params.radius, params.radiusScale, src_, dst_);
+    EXPECT_EQ(key, GEFrostedGlassBlurShaderFilter::GetEdgeCacheKey(params.radius, params.radiusScale, src_, dst_));
+    EXPECT_NE(key, GEFrostedGlassBlurShaderFilter::GetEdgeCacheKey(params.radius + 1.0f, params.radiusScale, src_,
+        dst_));
+    EXPECT_NE(key, GEFrostedGlassBlurShaderFilter::GetEdgeCacheKey(params.radius, params.radiusScale, otherRect,
+        otherRect));
+
+    GEMultiCacheProvider provider;
+    EXPECT_EQ(GEFrostedGlassBlurShaderFilter::GetEdgeImage(provider, key), nullptr);
+    GEImageCache cache;
+    cache.data = image_;
+    ASSERT_TRUE(provider.StoreByKey(cache, key));
+    EXPECT_EQ(GEFrostedGlassBlurShaderFilter::GetEdgeImage(provider, key), image_);
+
+    // A new background snapshot every frame overwrites the panel's entry, found again without the image
+    provider.Clear();
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat fmt { Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL };
+    bmp.Build(NUM_50, NUM_50, fmt);
+    bmp.ClearWithColor(Drawing::Color::COLOR_RED);
+    auto nextFrameImage = bmp.MakeImage();
+    auto filter = std::make_unique<GEFrostedGlassBlurShaderFilter>(params);
+    filter->SetCacheProvider(&provider);
+    filter->OnProcessImage(canvas_, image_, src_, dst_);
+    filter->OnProcessImage(canvas_, nextFrameImage, src_, dst_);
+    EXPECT_EQ(provider.GetEntryCount(), 1u);
+    EXPECT_NE(provider.GetByKeyAs<GEImageCache>(key), nullptr);
+
+    // A second panel of the same style at another place stores its own entry
+    filter->OnProcessImage(canvas_, nextFrameImage, otherRect, otherRect);
+    EXPECT_EQ(provider.GetEntryCount(), 2u);
+}
+
 } // namespace Rosen
 } // namespace OHOS
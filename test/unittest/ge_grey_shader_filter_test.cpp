@@ -166,6 +166,34 @@ HWTEST_F(GEGreyShaderFilterTest, OnProcessImage_006, TestSize.Level0)
     GTEST_LOG_(INFO) << "GEGreyShaderFilterTest OnProcessImage_006 end";
 }
 
+/**
+ * @tc.name: OnMakeChainedShader_001
+ * @tc.desc: Verify the filter supports shader chaining and makes a shader of its input
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEGreyShaderFilterTest, OnMakeChainedShader_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GEGreyShaderFilterTest OnMakeChainedShader_001 start";
+
+    Drawing::GEGreyShaderFilterParams geGreyShaderFilterParams { 1.0, 1.0 };
+    std::unique_ptr<GEGreyShaderFilter> geGreyShaderFilter =
+        std::make_unique<GEGreyShaderFilter>(geGreyShaderFilterParams);
+    EXPECT_TRUE(geGreyShaderFilter->SupportsShaderChaining());
+    EXPECT_EQ(geGreyShaderFilter->MakeChainedShader(nullptr, image_->GetImageInfo()), nullptr);
+
+    auto input = GEShaderFilter::MakeChainInputShader(*image_);
+    ASSERT_NE(input, nullptr);
+    auto shader = geGreyShaderFilter->MakeChainedShader(input, image_->GetImageInfo());
+    ASSERT_NE(shader, nullptr);
+    auto chainedShader = geGreyShaderFilter->MakeChainedShader(shader, image_->GetImageInfo());
+    ASSERT_NE(chainedShader, nullptr);
+    auto chainedImage = GEShaderFilter::MakeChainedImage(canvas_, chainedShader, image_->GetImageInfo());
+    ASSERT_NE(chainedImage, nullptr);
+    EXPECT_EQ(chainedImage->GetWidth(), image_->GetWidth());
+
+    GTEST_LOG_(INFO) << "GEGreyShaderFilterTest OnMakeChainedShader_001 end";
+}
+
 /**
  * @tc.name: Type_001
  * @tc.desc: Verify the Type function
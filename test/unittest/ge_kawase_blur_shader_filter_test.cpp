@@ -13,8 +13,12 @@
  * limitations under the License.
  */
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
+#include "ge_blur_test_utils.h"
+#include "ge_cpu_blur.h"
 #include "ge_kawase_blur_shader_filter.h"
 
 #include "draw/color.h"
@@ -39,6 +43,7 @@ namespace OHOS {
 namespace GraphicsEffectEngine {
 
 using namespace Rosen;
+using namespace Rosen::GETest;
 
 class GEKawaseBlurShaderFilterTest : public testing::Test {
 public:
@@ -47,6 +52,12 @@ public:
     void SetUp() override;
     void TearDown() override;
 
+    // Whether OnProcessImage blurs through GECpuBlur on canvas_, which has no GPU context
+    static bool UsesCpuBlur(const GEKawaseBlurShaderFilter& filter)
+    {
+        return GECpuBlur::ShouldUse(canvas_) && filter.blurEffectAf_ == nullptr;
+    }
+
     static inline Drawing::Canvas canvas_;
     std::shared_ptr<Drawing::Image> image_ { nullptr };
 
@@ -106,7 +117,13 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, OnProcessImage_002, TestSize.Level0)
 {
     Drawing::GEKawaseBlurShaderFilterParams params{1}; // 1 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
-    EXPECT_EQ(geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
+    auto output = geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_);
+    if (!UsesCpuBlur(*geKawaseBlurShaderFilter)) {
+        EXPECT_EQ(output, image_);
+        return;
+    }
+    EXPECT_NE(output, image_);
+    EXPECT_TRUE(IsFlatColor(output, 0.0f, 0.0f, 1.0f, 1.0f));
 }
 
 /**
@@ -130,7 +147,13 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, OnProcessImage_004, TestSize.Level0)
 {
     Drawing::GEKawaseBlurShaderFilterParams params{8001}; // 8001 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
-    EXPECT_EQ(geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
+    auto output = geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_);
+    if (!UsesCpuBlur(*geKawaseBlurShaderFilter)) {
+        EXPECT_EQ(output, image_);
+        return;
+    }
+    EXPECT_NE(output, image_);
+    EXPECT_TRUE(IsFlatColor(output, 0.0f, 0.0f, 1.0f, 1.0f));
 }
 
 /**
@@ -142,7 +165,13 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, OnProcessImage_005, TestSize.Level0)
 {
     Drawing::GEKawaseBlurShaderFilterParams params{100}; // 100 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
-    EXPECT_EQ(geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
+    auto output = geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_);
+    if (!UsesCpuBlur(*geKawaseBlurShaderFilter)) {
+        EXPECT_EQ(output, image_);
+        return;
+    }
+    EXPECT_NE(output, image_);
+    EXPECT_TRUE(IsFlatColor(output, 0.0f, 0.0f, 1.0f, 1.0f));
 }
 
 /**
@@ -154,7 +183,13 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, OnProcessImage_006, TestSize.Level0)
 {
     Drawing::GEKawaseBlurShaderFilterParams params{60}; // 60 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
-    EXPECT_EQ(geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
+    auto output = geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_);
+    if (!UsesCpuBlur(*geKawaseBlurShaderFilter)) {
+        EXPECT_EQ(output, image_);
+        return;
+    }
+    EXPECT_NE(output, image_);
+    EXPECT_TRUE(IsFlatColor(output, 0.0f, 0.0f, 1.0f, 1.0f));
 }
 
 /**
@@ -166,7 +201,58 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, OnProcessImage_007, TestSize.Level0)
 {
     Drawing::GEKawaseBlurShaderFilterParams params{30}; // 30 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
-    EXPECT_EQ(geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
+    auto output = geKawaseBlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_);
+    if (!UsesCpuBlur(*geKawaseBlurShaderFilter)) {
+        EXPECT_EQ(output, image_);
+        return;
+    }
+    EXPECT_NE(output, image_);
+    EXPECT_TRUE(IsFlatColor(output, 0.0f, 0.0f, 1.0f, 1.0f));
+}
+
+/**
+ * @tc.name: OnProcessImage_008
+ * @tc.desc: Verify OnProcessImage smooths a step edge and keeps its two sides apart
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEKawaseBlurShaderFilterTest, OnProcessImage_008, TestSize.Level1)
+{
+    Drawing::GEKawaseBlurShaderFilterParams params { 10 }; // 10 blur radius
+    auto filter = std::make_shared<GEKawaseBlurShaderFilter>(params);
+    auto step = MakeStepImage(64, 64); // 64, 64 image size
+    ASSERT_NE(step, nullptr);
+    Drawing::Rect bounds = step->GetImageInfo().GetBound();
+    auto output = filter->OnProcessImage(canvas_, step, bounds, bounds);
+    if (!UsesCpuBlur(*filter)) {
+        EXPECT_EQ(output, step);
+        return;
+    }
+    ASSERT_NE(output, step);
+    GECpuBlur::Buffer buffer;
+    ASSERT_TRUE(GECpuBlur::ReadImage(output, buffer));
+    ASSERT_EQ(buffer.width, 64);
+    int row = 32; // 32: middle row
+    EXPECT_GT(GetGreen(buffer, 31, row), 0.05f); // 31: last black column
+    EXPECT_LT(GetGreen(buffer, 32, row), 0.95f); // 32: first white column
+    EXPECT_LT(GetGreen(buffer, 0, row), 0.5f);
+    EXPECT_GT(GetGreen(buffer, 63, row), 0.5f); // 63: last column
+}
+
+/**
+ * @tc.name: ProcessImageOnCpu_001
+ * @tc.desc: Verify the native passes blur a constant image into an image of the destination size
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEKawaseBlurShaderFilterTest, ProcessImageOnCpu_001, TestSize.Level1)
+{
+    Drawing::GEKawaseBlurShaderFilterParams params { 30 }; // 30 blur radius
+    auto filter = std::make_shared<GEKawaseBlurShaderFilter>(params);
+    filter->ComputeRadiusAndScale(30); // 30 blur radius
+    Drawing::Rect dst { 0.0f, 0.0f, 50.0f, 50.0f }; // 50, 50 destination size
+    auto output = filter->ProcessImageOnCpu(image_, src_, dst, 2, 1.0f); // 2 passes, 1.0 radius per pass
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(output->GetWidth(), 50);
+    EXPECT_EQ(output->GetHeight(), 50);
 }
 
 /**
@@ -375,7 +461,7 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, InitSimpleFilter_002, TestSize.Level1)
     Drawing::GEKawaseBlurShaderFilterParams params { 1 }; // 1 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
     geKawaseBlurShaderFilter->InitSimpleFilter();
-    //g_simpleFilter != nullptr
+    //simpleFilter_ != nullptr
     EXPECT_TRUE(geKawaseBlurShaderFilter->InitSimpleFilter());
 }
 
@@ -389,7 +475,7 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, InitSimpleFilter_003, TestSize.Level1)
     Drawing::GEKawaseBlurShaderFilterParams params { 10 }; // 10 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
     geKawaseBlurShaderFilter->InitSimpleFilter();
-    //g_simpleFilter != nullptr
+    //simpleFilter_ != nullptr
     EXPECT_TRUE(geKawaseBlurShaderFilter->InitSimpleFilter());
 }
 
@@ -403,7 +489,7 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, InitSimpleFilter_004, TestSize.Level1)
     Drawing::GEKawaseBlurShaderFilterParams params { 100 }; // 100 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
     geKawaseBlurShaderFilter->InitSimpleFilter();
-    //g_simpleFilter != nullptr
+    //simpleFilter_ != nullptr
     EXPECT_TRUE(geKawaseBlurShaderFilter->InitSimpleFilter());
 }
 
@@ -429,7 +515,7 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, InitBlurEffectForAdvancedFilter_002, Test
     Drawing::GEKawaseBlurShaderFilterParams params { 1 }; // 1 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
     geKawaseBlurShaderFilter->InitBlurEffectForAdvancedFilter();
-    //g_blurEffectAf != nullptr
+    //blurEffectAf_ != nullptr
     EXPECT_TRUE(geKawaseBlurShaderFilter->InitBlurEffectForAdvancedFilter());
 }
 
@@ -443,7 +529,7 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, InitBlurEffectForAdvancedFilter003, TestS
     Drawing::GEKawaseBlurShaderFilterParams params { 10 }; // 10 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
     geKawaseBlurShaderFilter->InitBlurEffectForAdvancedFilter();
-    //g_blurEffectAf != nullptr
+    //blurEffectAf_ != nullptr
     EXPECT_TRUE(geKawaseBlurShaderFilter->InitBlurEffectForAdvancedFilter());
 }
 
@@ -457,7 +543,7 @@ HWTEST_F(GEKawaseBlurShaderFilterTest, InitBlurEffectForAdvancedFilter_004, Test
     Drawing::GEKawaseBlurShaderFilterParams params { 100 }; // 100 blur radius
     auto geKawaseBlurShaderFilter = std::make_shared<GEKawaseBlurShaderFilter>(params);
     geKawaseBlurShaderFilter->InitBlurEffectForAdvancedFilter();
-    //g_blurEffectAf != nullptr
+    //blurEffectAf_ != nullptr
     EXPECT_TRUE(geKawaseBlurShaderFilter->InitBlurEffectForAdvancedFilter());
 }
 
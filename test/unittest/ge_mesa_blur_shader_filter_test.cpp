@@ -13,9 +13,16 @@
  * limitations under the License.
  */
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
+#include "ge_blur_test_utils.h"
+#include "ge_cpu_blur.h"
+#include "ge_image_cache_provider.h"
 #include "ge_mesa_blur_shader_filter.h"
+#include "ge_multi_cache_provider.h"
+#include "ge_transient_surface_pool.h"
 
 #include "draw/color.h"
 #include "image/bitmap.h"
@@ -28,6 +35,7 @@ namespace OHOS {
 namespace GraphicsEffectEngine {
 
 using namespace Rosen;
+using namespace Rosen::GETest;
 
 class GEMESABlurShaderFilterTest : public testing::Test {
 public:
@@ -40,6 +48,12 @@ public:
     std::shared_ptr<Drawing::Canvas> canvasGpu_ = nullptr;
     Drawing::ImageInfo imageInfo_ = {};
 
+    // Whether OnProcessImage blurs through GECpuBlur on canvas_, which has no GPU context
+    static bool UsesCpuBlur(const GEMESABlurShaderFilter& filter)
+    {
+        return GECpuBlur::ShouldUse(canvas_) && !filter.isGreyX_ && !filter.isDirection_;
+    }
+
     static inline Drawing::Canvas canvas_;
     std::shared_ptr<Drawing::Image> image_ { nullptr };
 
@@ -200,7 +214,13 @@ HWTEST_F(GEMESABlurShaderFilterTest, OnProcessImage_003, TestSize.Level0)
         auto geMESABlurShaderFilter = std::make_shared<GEMESABlurShaderFilter>(params);
         ASSERT_TRUE(geMESABlurShaderFilter != nullptr);
 
-        EXPECT_EQ(geMESABlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
+        auto output = geMESABlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_);
+        if (!UsesCpuBlur(*geMESABlurShaderFilter)) {
+            EXPECT_EQ(output, image_);
+            continue;
+        }
+        EXPECT_NE(output, image_);
+        EXPECT_TRUE(IsFlatColor(output, 0.0f, 0.0f, 1.0f, 1.0f));
     }
 
     for (auto radius : blurRadius) {
@@ -209,6 +229,7 @@ HWTEST_F(GEMESABlurShaderFilterTest, OnProcessImage_003, TestSize.Level0)
         auto geMESABlurShaderFilter = std::make_shared<GEMESABlurShaderFilter>(params);
         ASSERT_TRUE(geMESABlurShaderFilter != nullptr);
 
+        EXPECT_FALSE(UsesCpuBlur(*geMESABlurShaderFilter));
         EXPECT_EQ(geMESABlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
     }
 
@@ -218,6 +239,7 @@ HWTEST_F(GEMESABlurShaderFilterTest, OnProcessImage_003, TestSize.Level0)
         auto geMESABlurShaderFilter = std::make_shared<GEMESABlurShaderFilter>(params);
         ASSERT_TRUE(geMESABlurShaderFilter != nullptr);
 
+        EXPECT_FALSE(UsesCpuBlur(*geMESABlurShaderFilter));
         EXPECT_EQ(geMESABlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
     }
 }
@@ -237,10 +259,74 @@ HWTEST_F(GEMESABlurShaderFilterTest, OnProcessImage_004, TestSize.Level0)
         auto geMESABlurShaderFilter = std::make_shared<GEMESABlurShaderFilter>(params);
         ASSERT_TRUE(geMESABlurShaderFilter != nullptr);
 
+        EXPECT_FALSE(UsesCpuBlur(*geMESABlurShaderFilter));
         EXPECT_EQ(geMESABlurShaderFilter->OnProcessImage(canvas_, image_, src_, dst_), image_);
     }
 }
 
+/**
+ * @tc.name: OnProcessImage_005
+ * @tc.desc: Verify OnProcessImage smooths a step edge and keeps its two sides apart
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEMESABlurShaderFilterTest, OnProcessImage_005, TestSize.Level1)
+{
+    // 10, 0.f: valid MESA blur params
+    Drawing::GEMESABlurShaderFilterParams params{10, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f};
+    auto filter = std::make_shared<GEMESABlurShaderFilter>(params);
+    auto step = MakeStepImage(64, 64); // 64, 64 image size
+    ASSERT_NE(step, nullptr);
+    Drawing::Rect bounds = step->GetImageInfo().GetBound();
+    auto output = filter->OnProcessImage(canvas_, step, bounds, bounds);
+    if (!UsesCpuBlur(*filter)) {
+        EXPECT_EQ(output, step);
+        return;
+    }
+    ASSERT_NE(output, step);
+    GECpuBlur::Buffer buffer;
+    ASSERT_TRUE(GECpuBlur::ReadImage(output, buffer));
+    ASSERT_EQ(buffer.width, 64);
+    int row = 32; // 32: middle row
+    EXPECT_GT(GetGreen(buffer, 31, row), 0.05f); // 31: last black column
+    EXPECT_LT(GetGreen(buffer, 32, row), 0.95f); // 32: first white column
+    EXPECT_LT(GetGreen(buffer, 0, row), 0.5f);
+    EXPECT_GT(GetGreen(buffer, 63, row), 0.5f); // 63: last column
+}
+
+/**
+ * @tc.name: SetGeneralBlurParams_001
+ * @tc.desc: Verify the pass counts, scales and offsets of the precomputed and the scaled radii
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEMESABlurShaderFilterTest, SetGeneralBlurParams_001, TestSize.Level1)
+{
+    // 1, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f valid MESA blur params
+    Drawing::GEMESABlurShaderFilterParams params{1, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f};
+    auto filter = std::make_shared<GEMESABlurShaderFilter>(params);
+    ASSERT_TRUE(filter != nullptr);
+    constexpr float eps = 1e-4f;
+
+    GEMESABlurShaderFilter::NewBlurParams blur;
+    filter->radius_ = 7; // 7: four passes and a pre-filter pass
+    EXPECT_TRUE(filter->SetGeneralBlurParams(blur));
+    EXPECT_EQ(blur.numberOfPasses, 5);
+    EXPECT_FLOAT_EQ(filter->blurScale_, 0.5f);
+    EXPECT_NEAR(blur.offsets[0], 1.2436947f, eps); // 7 / 8 of the first four pass offset
+    EXPECT_NEAR(blur.offsets[8], 1.2f, eps); // 1.8 * (1 - 1 / 3): pre-filter offset
+
+    filter->radius_ = 32; // 32: second row of the five pass table
+    EXPECT_TRUE(filter->SetGeneralBlurParams(blur));
+    EXPECT_EQ(blur.numberOfPasses, 5);
+    EXPECT_FLOAT_EQ(filter->blurScale_, 0.125f);
+    EXPECT_NEAR(blur.offsets[0], 1.4925693f, eps);
+
+    filter->radius_ = 8000; // 8000: largest radius
+    EXPECT_TRUE(filter->SetGeneralBlurParams(blur));
+    EXPECT_EQ(blur.numberOfPasses, 5);
+    EXPECT_FLOAT_EQ(filter->blurScale_, 0.03125f);
+    EXPECT_NEAR(blur.offsets[0], 139.04075f, 1e-2f); // 25 times the last five pass offset
+}
+
 /**
  * @tc.name: ScaleAndAddRandomColor_001
  * @tc.desc: Verify function ScaleAndAddRandomColor
@@ -314,5 +400,139 @@ HWTEST_F(GEMESABlurShaderFilterTest, DirectionBlur_001, TestSize.Level1)
     auto image = geMESABlurShaderFilter->OnProcessImage(*canvasGpu_, image_, src_, dst_);
     EXPECT_NE(image, image_);
 }
+
+/**
+ * @tc.name: TemporalArea_001
+ * @tc.desc: Verify patches are outset to the downsampling grid and the support covers every pass
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEMESABlurShaderFilterTest, TemporalArea_001, TestSize.Level1)
+{
+    // 40, 40, 50, 50: dirty rect; 10: outset; 16: grid; 96, 96: aligned image size
+    auto rect = GEMESABlurShaderFilter::OutsetToGrid(Drawing::RectI(40, 40, 50, 50), 10, 16, 96, 96);
+    EXPECT_EQ(rect, Drawing::RectI(16, 16, 64, 64));
+    // Clamped to the aligned image
+    rect = GEMESABlurShaderFilter::OutsetToGrid(Drawing::RectI(0, 0, 5, 5), 10, 16, 32, 32);
+    EXPECT_EQ(rect, Drawing::RectI(0, 0, 16, 16));
+
+    // 32, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f valid MESA blur params
+    Drawing::GEMESABlurShaderFilterParams params{32, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f};
+    auto filter = std::make_shared<GEMESABlurShaderFilter>(params);
+    GEMESABlurShaderFilter::NewBlurParams blur;
+    ASSERT_TRUE(filter->SetGeneralBlurParams(blur));
+    // (5 + 15.168 of offsets + 5 passes) / 0.125 rounded up
+    EXPECT_EQ(filter->GetTemporalSupport(blur), 202);
+}
+
+/**
+ * @tc.name: ProcessImageTemporally_001
+ * @tc.desc: Verify the temporal mode needs a cache provider, a GPU context and an image blurred in place
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEMESABlurShaderFilterTest, ProcessImageTemporally_001, TestSize.Level1)
+{
+    // 10, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f valid MESA blur params
+    Drawing::GEMESABlurShaderFilterParams params{10, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f};
+    auto filter = std::make_shared<GEMESABlurShaderFilter>(params);
+    EXPECT_EQ(filter->ProcessImageTemporally(canvas_, image_, src_, dst_), nullptr);
+
+    GEMultiCacheProvider provider;
+    filter->SetCacheProvider(&provider);
+    filter->SetDirtyRect(Drawing::Rect(0.0f, 0.0f, 4.0f, 4.0f));
+    // No GPU context
+    EXPECT_EQ(filter->ProcessImageTemporally(canvas_, image_, src_, dst_), nullptr);
+    EXPECT_NE(filter->OnProcessImage(canvas_, image_, src_, dst_), nullptr);
+    EXPECT_EQ(provider.GetEntryCount(), 0u);
+    if (canvasGpu_ == nullptr) {
+        return;
+    }
+    // 1.0f, 1.0f, 20.0f, 20.0f: not the whole image
+    Drawing::Rect part(1.0f, 1.0f, 20.0f, 20.0f);
+    EXPECT_FALSE(filter->CanProcessTemporally(*canvasGpu_, image_, part, part));
+
+    // The first frame blurs the whole image into a kept surface, an unchanged input reuses it
+    auto output = filter->OnProcessImage(*canvasGpu_, image_, src_, dst_);
+    EXPECT_NE(output, nullptr);
+    EXPECT_EQ(provider.GetEntryCount(), 1u);
+    filter->SetDirtyRect(Drawing::Rect());
+    EXPECT_NE(filter->OnProcessImage(*canvasGpu_, image_, src_, dst_), nullptr);
+
+    // The first patch takes a second surface, later frames swap the two while the caller holds the last output
+    filter->SetDirtyRect(Drawing::Rect(0.0f, 0.0f, 4.0f, 4.0f));
+    output = filter->OnProcessImage(*canvasGpu_, image_, src_, dst_);
+    EXPECT_NE(output, nullptr);
+    auto madeSurfaces = GETransientSurfacePool::GetMadeSurfaceCount();
+    for (int i = 0; i < 3; i++) { // 3: frames, enough to swap the surfaces both ways
+        auto next = filter->OnProcessImage(*canvasGpu_, image_, src_, dst_);
+        ASSERT_NE(next, nullptr);
+        EXPECT_NE(next, output);
+        output = next;
+    }
+    EXPECT_EQ(GETransientSurfacePool::GetMadeSurfaceCount(), madeSurfaces);
+    EXPECT_EQ(provider.GetEntryCount(), 1u);
+    auto cache = provider.GetByKeyAs<GEMESABlurTemporalCache>(filter->GetTemporalCacheKey(image_->GetImageInfo()));
+    ASSERT_NE(cache, nullptr);
+    EXPECT_NE(cache->backSurface, nullptr);
+    EXPECT_NE(cache->surface, cache->backSurface);
+}
+
+/**
+ * @tc.name: ProcessImageTemporally_002
+ * @tc.desc: Verify blurs without a dirty rect take the pooled passes and keep nothing
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEMESABlurShaderFilterTest, ProcessImageTemporally_002, TestSize.Level1)
+{
+    // 10, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f valid MESA blur params
+    Drawing::GEMESABlurShaderFilterParams params{10, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f};
+    auto filter = std::make_shared<GEMESABlurShaderFilter>(params);
+    GEMultiCacheProvider provider;
+    filter->SetCacheProvider(&provider);
+    filter->SetDirtyRect(std::nullopt);
+    Drawing::Canvas& canvas = canvasGpu_ != nullptr ? *canvasGpu_ : canvas_;
+
+    auto madeSurfaces = GETransientSurfacePool::GetMadeSurfaceCount();
+    EXPECT_EQ(filter->ProcessImageTemporally(canvas, image_, src_, dst_), nullptr);
+    EXPECT_NE(filter->OnProcessImage(canvas, image_, src_, dst_), nullptr);
+    EXPECT_EQ(GETransientSurfacePool::GetMadeSurfaceCount(), madeSurfaces);
+    EXPECT_EQ(provider.GetEntryCount(), 0u);
+}
+
+/**
+ * @tc.name: ProcessImageTemporally_003
+ * @tc.desc: Verify providers which reject the output turn the temporal mode off before a surface is made
+ * @tc.type:FUNC
+ */
+HWTEST_F(GEMESABlurShaderFilterTest, ProcessImageTemporally_003, TestSize.Level1)
+{
+    // 10, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f valid MESA blur params
+    Drawing::GEMESABlurShaderFilterParams params{10, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0, 0.f, 0.f};
+    auto filter = std::make_shared<GEMESABlurShaderFilter>(params);
+    filter->SetDirtyRect(Drawing::Rect(0.0f, 0.0f, 4.0f, 4.0f));
+    Drawing::Canvas& canvas = canvasGpu_ != nullptr ? *canvasGpu_ : canvas_;
+    auto madeSurfaces = GETransientSurfacePool::GetMadeSurfaceCount();
+
+    // Only keeps GEImageCache entries
+    GEImageCacheProvider imageProvider;
+    filter->SetCacheProvider(&imageProvider);
+    EXPECT_EQ(filter->ProcessImageTemporally(canvas, image_, src_, dst_), nullptr);
+    EXPECT_NE(filter->OnProcessImage(canvas, image_, src_, dst_), nullptr);
+    EXPECT_EQ(imageProvider.GetByKeyAs<GEMESABlurTemporalCache>(filter->GetTemporalCacheKey(image_->GetImageInfo())),
+        nullptr);
+    EXPECT_EQ(filter->isTemporalStoreRejected_, canvasGpu_ != nullptr);
+    // GERender sets the same provider again on every run, the rejection stays
+    filter->SetCacheProvider(&imageProvider);
+    EXPECT_EQ(filter->isTemporalStoreRejected_, canvasGpu_ != nullptr);
+
+    // 16: budget far below the 50 x 50 output
+    GEMultiCacheProvider smallProvider(16);
+    filter->SetCacheProvider(&smallProvider);
+    EXPECT_FALSE(filter->isTemporalStoreRejected_);
+    EXPECT_EQ(filter->ProcessImageTemporally(canvas, image_, src_, dst_), nullptr);
+    EXPECT_NE(filter->OnProcessImage(canvas, image_, src_, dst_), nullptr);
+    EXPECT_EQ(smallProvider.GetEntryCount(), 0u);
+    EXPECT_EQ(filter->isTemporalStoreRejected_, canvasGpu_ != nullptr);
+    EXPECT_EQ(GETransientSurfacePool::GetMadeSurfaceCount(), madeSurfaces);
+}
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
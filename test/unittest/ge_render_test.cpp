@@ -280,6 +280,86 @@ HWTEST_F(GERenderTest, ApplyImageEffect001, TestSize.Level0)
     GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_001 end";
 }
 
+/**
+ * @tc.name: ApplyImageEffect_ShaderChain_001
+ * @tc.desc: Verify ApplyImageEffect draws a run of chainable filters into one image of the input size
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyImageEffect_ShaderChain_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ShaderChain_001 start";
+
+    auto greyEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 1.0f);
+    greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 1.0f);
+    auto aiBarEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_AI_BAR);
+    aiBarEffect->SetParam(Drawing::GE_FILTER_AI_BAR_LOW, 0.5f);
+    aiBarEffect->SetParam(Drawing::GE_FILTER_AI_BAR_HIGH, 0.7f);
+    aiBarEffect->SetParam(Drawing::GE_FILTER_AI_BAR_THRESHOLD, 0.5f);
+    aiBarEffect->SetParam(Drawing::GE_FILTER_AI_BAR_OPACITY, 0.5f);
+    aiBarEffect->SetParam(Drawing::GE_FILTER_AI_BAR_SATURATION, 1.0f);
+
+    auto veContainer = std::make_shared<Drawing::GEVisualEffectContainer>();
+    veContainer->AddToChainedFilter(greyEffect);
+    veContainer->AddToChainedFilter(aiBarEffect);
+    veContainer->AddToChainedFilter(greyEffect);
+
+    auto image = MakeImage();
+    ASSERT_NE(image, nullptr);
+    const Drawing::Rect src(0.0f, 0.0f, 50.0f, 50.0f);
+    const Drawing::Rect dst(0.0f, 0.0f, 50.0f, 50.0f);
+    const Drawing::SamplingOptions sampling;
+    auto geRender = std::make_shared<GERender>();
+    ASSERT_NE(geRender, nullptr);
+    auto outImage = geRender->ApplyImageEffect(*canvas_, *veContainer, {image, src, dst}, sampling);
+    ASSERT_NE(outImage, nullptr);
+    EXPECT_NE(outImage, image);
+    EXPECT_EQ(outImage->GetWidth(), image->GetWidth());
+    EXPECT_EQ(outImage->GetHeight(), image->GetHeight());
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ShaderChain_001 end";
+}
+
+/**
+ * @tc.name: ApplyImageEffect_ShaderChain_002
+ * @tc.desc: Verify a non-chainable filter splits the run and chaining is skipped with the filter result cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, ApplyImageEffect_ShaderChain_002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ShaderChain_002 start";
+
+    auto greyEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_GREY);
+    greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_1, 1.0f);
+    greyEffect->SetParam(Drawing::GE_FILTER_GREY_COEF_2, 1.0f);
+    auto blurEffect = std::make_shared<Drawing::GEVisualEffect>(Drawing::GE_FILTER_KAWASE_BLUR);
+    blurEffect->SetParam(Drawing::GE_FILTER_KAWASE_BLUR_RADIUS, 5); // 5 blur radius
+
+    auto veContainer = std::make_shared<Drawing::GEVisualEffectContainer>();
+    veContainer->AddToChainedFilter(greyEffect);
+    veContainer->AddToChainedFilter(greyEffect);
+    veContainer->AddToChainedFilter(blurEffect);
+    veContainer->AddToChainedFilter(greyEffect);
+
+    auto image = MakeImage();
+    ASSERT_NE(image, nullptr);
+    const Drawing::Rect src(0.0f, 0.0f, 50.0f, 50.0f);
+    const Drawing::Rect dst(0.0f, 0.0f, 50.0f, 50.0f);
+    const Drawing::SamplingOptions sampling;
+    auto geRender = std::make_shared<GERender>();
+    ASSERT_NE(geRender, nullptr);
+    auto outImage = geRender->ApplyImageEffect(*canvas_, *veContainer, {image, src, dst}, sampling);
+    ASSERT_NE(outImage, nullptr);
+    EXPECT_EQ(outImage->GetWidth(), image->GetWidth());
+
+    geRender->SetFilterResultCacheEnabled(true);
+    auto cachedOutImage = geRender->ApplyImageEffect(*canvas_, *veContainer, {image, src, dst}, sampling);
+    ASSERT_NE(cachedOutImage, nullptr);
+    EXPECT_EQ(cachedOutImage->GetWidth(), image->GetWidth());
+
+    GTEST_LOG_(INFO) << "GERenderTest ApplyImageEffect_ShaderChain_002 end";
+}
+
 /**
  * @tc.name: GenerateShaderFilters_001
  * @tc.desc: Verify the GenerateShaderFilters
@@ -1632,5 +1712,25 @@ HWTEST_F(GERenderTest, DrawShaderEffect_InvalidBoundsZeroSize, TestSize.Level1)
 
     GTEST_LOG_(INFO) << "GERenderTest DrawShaderEffect_InvalidBoundsZeroSize end";
 }
+
+/**
+ * @tc.name: GetDirtyRect_001
+ * @tc.desc: Verify the dirty rect only reaches filters reading the input image
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERenderTest, GetDirtyRect_001, TestSize.Level1)
+{
+    auto image = MakeImage();
+    auto otherImage = MakeImage();
+    Drawing::Rect dirty(1.0f, 2.0f, 3.0f, 4.0f);
+    GERender::ShaderFilterEffectContext context {image, {}, {}, nullptr, dirty};
+    auto dirtyRect = GERender::GetDirtyRect(context, image);
+    ASSERT_TRUE(dirtyRect.has_value());
+    EXPECT_EQ(*dirtyRect, dirty);
+    EXPECT_FALSE(GERender::GetDirtyRect(context, otherImage).has_value());
+
+    context.dirtyRect = std::nullopt;
+    EXPECT_FALSE(GERender::GetDirtyRect(context, image).has_value());
+}
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
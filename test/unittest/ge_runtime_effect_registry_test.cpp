@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ge_runtime_effect_registry.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+namespace {
+// Each test uses its own sources: the registry is process-wide and never forgets an entry
+const std::string SKSL_SAME_SOURCE = "half4 main(float2 xy) { return half4(0.25); }";
+const std::string SKSL_OPTIONS = "half4 main(float2 xy) { return half4(0.5); }";
+const std::string SKSL_INVALID = "half4 main(float2 xy) { return undefinedSymbol; }";
+const std::string SKSL_CONCURRENT = "half4 main(float2 xy) { return half4(0.75); }";
+constexpr int CONCURRENT_THREAD_COUNT = 8;
+} // namespace
+
+class GERuntimeEffectRegistryTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        GERuntimeEffectRegistry::GetInstance().ResetStats();
+    }
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: GetOrCreate_SameSource
+ * @tc.desc: Verify a source is compiled once and later lookups share the effect
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERuntimeEffectRegistryTest, GetOrCreate_SameSource, TestSize.Level1)
+{
+    auto& registry = GERuntimeEffectRegistry::GetInstance();
+    auto first = registry.GetOrCreate(SKSL_SAME_SOURCE);
+    ASSERT_NE(first, nullptr);
+    auto second = registry.GetOrCreate(SKSL_SAME_SOURCE);
+    EXPECT_EQ(first, second);
+
+    auto stats = registry.GetStats();
+    EXPECT_EQ(stats.compileCount, 1u);
+    EXPECT_EQ(stats.hitCount, 1u);
+    EXPECT_EQ(stats.failureCount, 0u);
+    EXPECT_GE(stats.entryCount, 1u);
+}
+
+/**
+ * @tc.name: GetOrCreate_Options
+ * @tc.desc: Verify the same source compiled with different options gives distinct entries
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERuntimeEffectRegistryTest, GetOrCreate_Options, TestSize.Level1)
+{
+    auto& registry = GERuntimeEffectRegistry::GetInstance();
+    Drawing::RuntimeEffectOptions options;
+    options.useHighpLocalCoords = true;
+    auto plain = registry.GetOrCreate(SKSL_OPTIONS);
+    auto withOptions = registry.GetOrCreate(SKSL_OPTIONS, options);
+    ASSERT_NE(plain, nullptr);
+    ASSERT_NE(withOptions, nullptr);
+    EXPECT_NE(plain, withOptions);
+    EXPECT_EQ(registry.GetOrCreate(SKSL_OPTIONS, options), withOptions);
+    EXPECT_EQ(registry.GetStats().compileCount, 2u);
+}
+
+/**
+ * @tc.name: GetOrCreate_InvalidSource
+ * @tc.desc: Verify a source failing to compile returns nullptr and is not compiled again
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERuntimeEffectRegistryTest, GetOrCreate_InvalidSource, TestSize.Level1)
+{
+    auto& registry = GERuntimeEffectRegistry::GetInstance();
+    EXPECT_EQ(registry.GetOrCreate(SKSL_INVALID), nullptr);
+    EXPECT_EQ(registry.GetOrCreate(SKSL_INVALID), nullptr);
+
+    auto stats = registry.GetStats();
+    EXPECT_EQ(stats.compileCount, 1u);
+    EXPECT_EQ(stats.failureCount, 1u);
+    EXPECT_EQ(stats.hitCount, 1u);
+}
+
+/**
+ * @tc.name: GetOrCreate_Concurrent
+ * @tc.desc: Verify threads asking for the same source at once compile it once and share the effect
+ * @tc.type: FUNC
+ */
+HWTEST_F(GERuntimeEffectRegistryTest, GetOrCreate_Concurrent, TestSize.Level1)
+{
+    auto& registry = GERuntimeEffectRegistry::GetInstance();
+    std::vector<std::shared_ptr<Drawing::RuntimeEffect>> effects(CONCURRENT_THREAD_COUNT);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < CONCURRENT_THREAD_COUNT; ++i) {
+        threads.emplace_back([&registry, &effects, i]() { effects[i] = registry.GetOrCreate(SKSL_CONCURRENT); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_NE(effects[0], nullptr);
+    for (const auto& effect : effects) {
+        EXPECT_EQ(effect, effects[0]);
+    }
+    auto stats = registry.GetStats();
+    EXPECT_EQ(stats.compileCount, 1u);
+    EXPECT_EQ(stats.hitCount, static_cast<uint64_t>(CONCURRENT_THREAD_COUNT - 1));
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -284,6 +284,43 @@ HWTEST_F(GESDFBorderShaderTest, MakeSDFBorderShader_OutlineBorder_001, TestSize.
     GTEST_LOG_(INFO) << "MakeSDFBorderShader_OutlineBorder_001 end";
 }
 
+/**
+ * @tc.name: GetBorderBand_001
+ * @tc.desc: Validate inner borders stay inside the shape and outlines grow by their width
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFBorderShaderTest, GetBorderBand_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GetBorderBand_001 start";
+    GESDFBorderShaderParams params;
+    params.shape = CreateTestShape();
+    params.border = GetTestBorderParams();
+    GESDFBorderShader borderShader(params);
+
+    Rect rect {0, 0, 300.0f, 300.0f};
+    Rect innerRect;
+    EXPECT_TRUE(borderShader.GetBorderBand(rect, innerRect));
+    // Shape bounds 9.5 to 210.5, one antialiasing pixel around them
+    EXPECT_FLOAT_EQ(rect.GetLeft(), 8.5f);
+    EXPECT_FLOAT_EQ(rect.GetRight(), 211.5f);
+    // Inscribed rect shrunk by the border, its antialiasing pixel and one pixel of safety
+    Rect inscribedRect;
+    params.shape->GetInscribedRect(inscribedRect);
+    EXPECT_FLOAT_EQ(innerRect.GetLeft(), inscribedRect.GetLeft() + 12.0f);
+
+    params.border = GetTestOutlineParams();
+    borderShader.SetSDFBorderParams(params);
+    rect = {0, 0, 300.0f, 300.0f};
+    EXPECT_TRUE(borderShader.GetBorderBand(rect, innerRect));
+    EXPECT_FLOAT_EQ(rect.GetLeft(), 0.0f);
+    EXPECT_FLOAT_EQ(rect.GetRight(), 222.5f);
+    EXPECT_FLOAT_EQ(innerRect.GetLeft(), inscribedRect.GetLeft() + 1.0f);
+
+    rect = {250.0f, 250.0f, 300.0f, 300.0f};
+    EXPECT_FALSE(borderShader.GetBorderBand(rect, innerRect));
+    GTEST_LOG_(INFO) << "GetBorderBand_001 end";
+}
+
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
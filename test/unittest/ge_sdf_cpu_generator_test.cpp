@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+#include "ge_sdf_cpu_generator.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+namespace {
+constexpr int FIELD_SIZE = 64;
+
+// Curves stored as the structure of arrays GESDFCpuGenerator::Curves points into
+struct CurveList {
+    std::vector<float> startX;
+    std::vector<float> startY;
+    std::vector<float> controlX;
+    std::vector<float> controlY;
+    std::vector<float> endX;
+    std::vector<float> endY;
+
+    void AddQuad(float x0, float y0, float x1, float y1, float x2, float y2)
+    {
+        startX.push_back(x0);
+        startY.push_back(y0);
+        controlX.push_back(x1);
+        controlY.push_back(y1);
+        endX.push_back(x2);
+        endY.push_back(y2);
+    }
+
+    void AddLine(float x0, float y0, float x1, float y1)
+    {
+        AddQuad(x0, y0, x0, y0, x1, y1);
+    }
+
+    // Clockwise on screen, left top right bottom
+    void AddRect(float l, float t, float r, float b, bool close = true)
+    {
+        AddLine(l, t, r, t);
+        AddLine(r, t, r, b);
+        AddLine(r, b, l, b);
+        if (close) {
+            AddLine(l, b, l, t);
+        }
+    }
+
+    GESDFCpuGenerator::Curves View() const
+    {
+        return { startX.data(), startY.data(), controlX.data(), controlY.data(), endX.data(), endY.data(),
+            startX.size() };
+    }
+};
+
+float At(const std::vector<float>& field, int x, int y)
+{
+    return field[static_cast<size_t>(y) * FIELD_SIZE + x];
+}
+} // namespace
+
+class GESDFCpuGeneratorTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: ComputeFromCurves_001
+ * @tc.desc: Verify the distances of a square are exact, negative inside and positive outside
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromCurves_001, TestSize.Level1)
+{
+    CurveList curves;
+    curves.AddRect(16.0f, 16.0f, 48.0f, 48.0f);
+    std::vector<float> field;
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromCurves(curves.View(), GESDFCpuGenerator::FillRule::NON_ZERO,
+        FIELD_SIZE, FIELD_SIZE, field));
+    ASSERT_EQ(field.size(), static_cast<size_t>(FIELD_SIZE * FIELD_SIZE));
+
+    EXPECT_FLOAT_EQ(At(field, 32, 32), -15.5f); // Center (32.5, 32.5), 15.5 from the right and bottom edges
+    EXPECT_FLOAT_EQ(At(field, 20, 32), -4.5f);
+    EXPECT_FLOAT_EQ(At(field, 8, 32), 7.5f);
+    EXPECT_FLOAT_EQ(At(field, 0, 0), std::sqrt(2.0f * 15.5f * 15.5f)); // Nearest to the top left corner
+}
+
+/**
+ * @tc.name: ComputeFromCurves_002
+ * @tc.desc: Verify the distance to a curved quadratic matches a dense sampling of the curve
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromCurves_002, TestSize.Level1)
+{
+    CurveList curves;
+    curves.AddQuad(8.0f, 56.0f, 32.0f, -24.0f, 56.0f, 56.0f);
+    std::vector<float> field;
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromCurves(curves.View(), GESDFCpuGenerator::FillRule::NON_ZERO,
+        FIELD_SIZE, FIELD_SIZE, field));
+
+    constexpr int samples = 20000;
+    for (int y = 0; y < FIELD_SIZE; y += 7) {     // 7: sparse rows
+        for (int x = 0; x < FIELD_SIZE; x += 5) { // 5: sparse columns
+            float px = x + 0.5f;
+            float py = y + 0.5f;
+            float best = std::numeric_limits<float>::max();
+            for (int i = 0; i <= samples; ++i) {
+                float t = static_cast<float>(i) / samples;
+                float bx = (1 - t) * (1 - t) * 8.0f + 2 * t * (1 - t) * 32.0f + t * t * 56.0f;
+                float by = (1 - t) * (1 - t) * 56.0f + 2 * t * (1 - t) * -24.0f + t * t * 56.0f;
+                best = std::min(best, std::hypot(px - bx, py - by));
+            }
+            EXPECT_NEAR(std::abs(At(field, x, y)), best, 1e-2f);
+        }
+    }
+}
+
+/**
+ * @tc.name: ComputeFromCurves_003
+ * @tc.desc: Verify nested squares wound the same way fill the hole with NON_ZERO only
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromCurves_003, TestSize.Level1)
+{
+    CurveList curves;
+    curves.AddRect(8.0f, 8.0f, 56.0f, 56.0f);
+    curves.AddRect(24.0f, 24.0f, 40.0f, 40.0f);
+    std::vector<float> nonZero;
+    std::vector<float> evenOdd;
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromCurves(curves.View(), GESDFCpuGenerator::FillRule::NON_ZERO,
+        FIELD_SIZE, FIELD_SIZE, nonZero));
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromCurves(curves.View(), GESDFCpuGenerator::FillRule::EVEN_ODD,
+        FIELD_SIZE, FIELD_SIZE, evenOdd));
+
+    EXPECT_LT(At(nonZero, 32, 32), 0.0f);
+    EXPECT_GT(At(evenOdd, 32, 32), 0.0f);
+    EXPECT_FLOAT_EQ(std::abs(At(nonZero, 32, 32)), At(evenOdd, 32, 32));
+    EXPECT_LT(At(nonZero, 12, 12), 0.0f);
+    EXPECT_LT(At(evenOdd, 12, 12), 0.0f);
+}
+
+/**
+ * @tc.name: ComputeFromCurves_004
+ * @tc.desc: Verify an open contour is closed for the fill but not for the distance
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromCurves_004, TestSize.Level1)
+{
+    CurveList curves;
+    curves.AddRect(16.0f, 16.0f, 48.0f, 48.0f, false);
+    std::vector<float> field;
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromCurves(curves.View(), GESDFCpuGenerator::FillRule::NON_ZERO,
+        FIELD_SIZE, FIELD_SIZE, field));
+
+    EXPECT_LT(At(field, 32, 32), 0.0f);
+    EXPECT_FLOAT_EQ(At(field, 16, 32), -15.5f); // 0.5 from the missing left edge, 15.5 from the bottom one
+    EXPECT_GT(At(field, 8, 32), 0.0f);
+}
+
+/**
+ * @tc.name: ComputeFromCurves_005
+ * @tc.desc: Verify invalid sizes and curve arrays are rejected, and no curve gives a field with no edge
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromCurves_005, TestSize.Level1)
+{
+    CurveList curves;
+    curves.AddRect(16.0f, 16.0f, 48.0f, 48.0f);
+    std::vector<float> field = { 1.0f };
+    auto rule = GESDFCpuGenerator::FillRule::NON_ZERO;
+    EXPECT_FALSE(GESDFCpuGenerator::ComputeFromCurves(curves.View(), rule, 0, FIELD_SIZE, field));
+    EXPECT_FALSE(GESDFCpuGenerator::ComputeFromCurves(curves.View(), rule, 8192, 8192, field));
+    auto broken = curves.View();
+    broken.endY = nullptr;
+    EXPECT_FALSE(GESDFCpuGenerator::ComputeFromCurves(broken, rule, FIELD_SIZE, FIELD_SIZE, field));
+    EXPECT_EQ(field.size(), 1u);
+
+    EXPECT_TRUE(GESDFCpuGenerator::ComputeFromCurves({}, rule, FIELD_SIZE, FIELD_SIZE, field));
+    EXPECT_EQ(At(field, 0, 0), GESDFCpuGenerator::NO_EDGE_DISTANCE);
+}
+
+/**
+ * @tc.name: ComputeFromAlpha_001
+ * @tc.desc: Verify the distance transform of a binary mask matches the brute force nearest pixel distance
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromAlpha_001, TestSize.Level1)
+{
+    std::vector<uint8_t> mask(FIELD_SIZE * FIELD_SIZE, 0);
+    uint32_t seed = 12345;
+    for (auto& value : mask) {
+        seed = seed * 1103515245u + 12345u; // LCG, deterministic scatter
+        value = (seed >> 16) % 37 == 0 ? 255 : 0; // 37: about 3% of the pixels inside
+    }
+    std::vector<float> field;
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromAlpha(mask.data(), 1, FIELD_SIZE, FIELD_SIZE, FIELD_SIZE, field));
+
+    for (int y = 0; y < FIELD_SIZE; ++y) {
+        for (int x = 0; x < FIELD_SIZE; ++x) {
+            bool inside = mask[y * FIELD_SIZE + x] != 0;
+            float best = std::numeric_limits<float>::max();
+            for (int sy = 0; sy < FIELD_SIZE; ++sy) {
+                for (int sx = 0; sx < FIELD_SIZE; ++sx) {
+                    if ((mask[sy * FIELD_SIZE + sx] != 0) != inside) {
+                        best = std::min(best, std::hypot(static_cast<float>(sx - x), static_cast<float>(sy - y)));
+                    }
+                }
+            }
+            ASSERT_NEAR(At(field, x, y), inside ? -best : best, 1e-3f) << x << ", " << y;
+        }
+    }
+}
+
+/**
+ * @tc.name: ComputeFromAlpha_002
+ * @tc.desc: Verify a disc mask read from RGBA pixels approximates the distance to its circle
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromAlpha_002, TestSize.Level1)
+{
+    constexpr size_t channels = 4;
+    constexpr float radius = 20.0f;
+    constexpr float center = FIELD_SIZE * 0.5f;
+    std::vector<uint8_t> rgba(FIELD_SIZE * FIELD_SIZE * channels, 0);
+    for (int y = 0; y < FIELD_SIZE; ++y) {
+        for (int x = 0; x < FIELD_SIZE; ++x) {
+            float d = std::hypot(x + 0.5f - center, y + 0.5f - center) - radius;
+            float coverage = std::clamp(0.5f - d, 0.0f, 1.0f);
+            rgba[(y * FIELD_SIZE + x) * channels + 3] = static_cast<uint8_t>(std::lround(coverage * 255.0f));
+        }
+    }
+    std::vector<float> field;
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromAlpha(rgba.data() + 3, channels, FIELD_SIZE * channels, FIELD_SIZE,
+        FIELD_SIZE, field));
+
+    for (int y = 0; y < FIELD_SIZE; y += 3) {     // 3: sparse rows
+        for (int x = 0; x < FIELD_SIZE; x += 3) { // 3: sparse columns
+            float expected = std::hypot(x + 0.5f - center, y + 0.5f - center) - radius;
+            EXPECT_NEAR(At(field, x, y), expected, 1.0f) << x << ", " << y;
+        }
+    }
+}
+
+/**
+ * @tc.name: ComputeFromAlpha_003
+ * @tc.desc: Verify invalid input is rejected and a mask without edge gives NO_EDGE_DISTANCE
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromAlpha_003, TestSize.Level1)
+{
+    std::vector<uint8_t> mask(FIELD_SIZE * FIELD_SIZE, 0);
+    std::vector<float> field;
+    EXPECT_FALSE(GESDFCpuGenerator::ComputeFromAlpha(nullptr, 1, FIELD_SIZE, FIELD_SIZE, FIELD_SIZE, field));
+    EXPECT_FALSE(GESDFCpuGenerator::ComputeFromAlpha(mask.data(), 0, FIELD_SIZE, FIELD_SIZE, FIELD_SIZE, field));
+    EXPECT_FALSE(GESDFCpuGenerator::ComputeFromAlpha(mask.data(), 1, FIELD_SIZE - 1, FIELD_SIZE, FIELD_SIZE, field));
+    EXPECT_TRUE(field.empty());
+
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromAlpha(mask.data(), 1, FIELD_SIZE, FIELD_SIZE, FIELD_SIZE, field));
+    EXPECT_EQ(At(field, 10, 10), GESDFCpuGenerator::NO_EDGE_DISTANCE);
+    std::fill(mask.begin(), mask.end(), 255);
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromAlpha(mask.data(), 1, FIELD_SIZE, FIELD_SIZE, FIELD_SIZE, field));
+    EXPECT_EQ(At(field, 10, 10), -GESDFCpuGenerator::NO_EDGE_DISTANCE);
+}
+
+/**
+ * @tc.name: ComputeFromAlpha_004
+ * @tc.desc: Verify a row seeded partly by vector lanes and partly by the scalar tail matches its mirrored row
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, ComputeFromAlpha_004, TestSize.Level1)
+{
+    constexpr int width = 7; // 4 vector lanes and a 3 pixel tail
+    std::vector<uint8_t> mask = { 0, 64, 128, 255, 255, 192, 32 };
+    std::vector<uint8_t> mirrored(mask.rbegin(), mask.rend());
+    std::vector<float> field;
+    std::vector<float> mirroredField;
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromAlpha(mask.data(), 1, width, width, 1, field));
+    ASSERT_TRUE(GESDFCpuGenerator::ComputeFromAlpha(mirrored.data(), 1, width, width, 1, mirroredField));
+
+    for (int x = 0; x < width; ++x) {
+        EXPECT_NEAR(field[x], mirroredField[width - 1 - x], 1e-4f) << x;
+    }
+    EXPECT_GT(field[0], 0.0f);
+    EXPECT_LT(field[3], 0.0f);
+    EXPECT_LT(field[4], 0.0f);
+    EXPECT_GT(field[6], 0.0f);
+}
+
+/**
+ * @tc.name: Sample_001
+ * @tc.desc: Verify bilinear sampling hits pixel centers exactly, interpolates between them and clamps at edges
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFCpuGeneratorTest, Sample_001, TestSize.Level1)
+{
+    std::vector<float> field = { 0.0f, 2.0f, 4.0f, 6.0f }; // 2 x 2
+    EXPECT_FLOAT_EQ(GESDFCpuGenerator::Sample(field, 2, 2, 0.5f, 0.5f), 0.0f);
+    EXPECT_FLOAT_EQ(GESDFCpuGenerator::Sample(field, 2, 2, 1.0f, 0.5f), 1.0f);
+    EXPECT_FLOAT_EQ(GESDFCpuGenerator::Sample(field, 2, 2, 1.0f, 1.0f), 3.0f);
+    EXPECT_FLOAT_EQ(GESDFCpuGenerator::Sample(field, 2, 2, -5.0f, 9.0f), 4.0f);
+    EXPECT_FLOAT_EQ(GESDFCpuGenerator::Sample(field, 3, 3, 0.5f, 0.5f), GESDFCpuGenerator::NO_EDGE_DISTANCE);
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_sdf_evaluation_cache.h"
+#include "ge_sdf_rrect_shader_shape.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr float TEST_WIDTH = 200.0f;
+constexpr float TEST_HEIGHT = 200.0f;
+
+std::shared_ptr<GESDFShaderShape> MakeRRect()
+{
+    GESDFRRectShapeParams param;
+    param.rrect = { 10.0f, 10.0f, 60.0f, 40.0f };
+    param.rrect.SetCornerRadius(8.0f, 8.0f);
+    return std::make_shared<GESDFRRectShaderShape>(param);
+}
+} // namespace
+
+class GESDFEvaluationCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static inline Canvas canvas_;
+};
+
+/**
+ * @tc.name: FrameScope_001
+ * @tc.desc: Verify frames nest and only the outermost end leaves the frame
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFEvaluationCacheTest, FrameScope_001, TestSize.Level1)
+{
+    EXPECT_FALSE(GESDFEvaluationCache::IsInFrame());
+    {
+        GESDFEvaluationCache::FrameScope outer;
+        EXPECT_TRUE(GESDFEvaluationCache::IsInFrame());
+        {
+            GESDFEvaluationCache::FrameScope inner;
+            EXPECT_TRUE(GESDFEvaluationCache::IsInFrame());
+        }
+        EXPECT_TRUE(GESDFEvaluationCache::IsInFrame());
+    }
+    EXPECT_FALSE(GESDFEvaluationCache::IsInFrame());
+    EXPECT_EQ(GESDFEvaluationCache::GetEntryCount(), 0u);
+
+    // Unbalanced ends are ignored
+    GESDFEvaluationCache::EndFrame();
+    EXPECT_FALSE(GESDFEvaluationCache::IsInFrame());
+}
+
+/**
+ * @tc.name: GetShader_001
+ * @tc.desc: Verify shapes are evaluated directly outside frames and on canvases without a GPU context
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFEvaluationCacheTest, GetShader_001, TestSize.Level1)
+{
+    auto shape = MakeRRect();
+    Rect sampleRect(0.0f, 0.0f, TEST_WIDTH, TEST_HEIGHT);
+    EXPECT_EQ(GESDFEvaluationCache::GetShader(nullptr, canvas_, TEST_WIDTH, TEST_HEIGHT, sampleRect), nullptr);
+    EXPECT_NE(GESDFEvaluationCache::GetShader(shape, canvas_, TEST_WIDTH, TEST_HEIGHT, sampleRect), nullptr);
+
+    GESDFEvaluationCache::FrameScope frame;
+    EXPECT_NE(GESDFEvaluationCache::GetShader(shape, canvas_, TEST_WIDTH, TEST_HEIGHT, sampleRect), nullptr);
+    EXPECT_NE(GESDFEvaluationCache::GetShader(shape, canvas_, TEST_WIDTH, TEST_HEIGHT, sampleRect, true), nullptr);
+    EXPECT_EQ(GESDFEvaluationCache::GetEntryCount(), 0u);
+}
+
+/**
+ * @tc.name: RasterizeEntry_001
+ * @tc.desc: Verify areas over the texture limit are left to the shape shader
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFEvaluationCacheTest, RasterizeEntry_001, TestSize.Level1)
+{
+    GESDFEvaluationCache::Entry entry;
+    entry.shape = MakeRRect();
+    entry.width = TEST_WIDTH;
+    entry.height = TEST_HEIGHT;
+    entry.sampleRect = Rect(0.0f, 0.0f, GESDFEvaluationCache::MAX_TEXTURE_SIZE + 1.0f, TEST_HEIGHT);
+    EXPECT_FALSE(GESDFEvaluationCache::RasterizeEntry(entry, canvas_));
+    EXPECT_EQ(entry.image, nullptr);
+
+    // No GPU context to make the image with
+    entry.sampleRect = Rect(0.0f, 0.0f, TEST_WIDTH, TEST_HEIGHT);
+    EXPECT_FALSE(GESDFEvaluationCache::RasterizeEntry(entry, canvas_));
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
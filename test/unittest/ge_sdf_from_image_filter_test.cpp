@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cmath>
 #include <gtest/gtest.h>
 
@@ -328,5 +329,88 @@ HWTEST_F(GESDFFromImageFilterTest, OnProcessImage_011, TestSize.Level0)
     auto result = geSDFFromImageFilter->OnProcessImage(canvas_, smallImage, smallBounds, smallBounds);
     EXPECT_NE(result, nullptr);
 }
+
+/**
+ * @tc.name: ProcessImageOnCpu_001
+ * @tc.desc: Verify the CPU backend outputs a field of the stretched size with and without derivatives
+ * @tc.type:FUNC
+ */
+HWTEST_F(GESDFFromImageFilterTest, ProcessImageOnCpu_001, TestSize.Level1)
+{
+    Drawing::GESDFFromImageFilterParams params { 32, true };
+    auto geSDFFromImageFilter = std::make_shared<GESDFFromImageFilter>(params);
+    ASSERT_TRUE(geSDFFromImageFilter != nullptr);
+
+    auto result = geSDFFromImageFilter->ProcessImageOnCpu(image_, src_, src_);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetWidth(), image_->GetWidth());
+    EXPECT_EQ(result->GetHeight(), image_->GetHeight());
+
+    Drawing::Rect largeDst { 0.0f, 0.0f, 100.0f, 80.0f };
+    geSDFFromImageFilter->generateDerivs_ = false;
+    result = geSDFFromImageFilter->ProcessImageOnCpu(image_, src_, largeDst);
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetWidth(), 100);
+    EXPECT_EQ(result->GetHeight(), 80);
+
+    Drawing::Rect emptyDst { 0.0f, 0.0f, 0.0f, 0.0f };
+    EXPECT_EQ(geSDFFromImageFilter->ProcessImageOnCpu(image_, src_, emptyDst), nullptr);
+}
+
+/**
+ * @tc.name: MakeTiles_001
+ * @tc.desc: Verify tile cores cover the output once and areas pad them by the spread and derivative reach
+ * @tc.type:FUNC
+ */
+HWTEST_F(GESDFFromImageFilterTest, MakeTiles_001, TestSize.Level1)
+{
+    Drawing::GESDFFromImageFilterParams params { 32, true };
+    auto geSDFFromImageFilter = std::make_shared<GESDFFromImageFilter>(params);
+    ASSERT_TRUE(geSDFFromImageFilter != nullptr);
+
+    constexpr int outputWidth = 3000;
+    constexpr int outputHeight = 1000;
+    auto tiles = geSDFFromImageFilter->MakeTiles(outputWidth, outputHeight);
+    ASSERT_EQ(tiles.size(), 3u); // 3: three columns of one row
+    int margin = geSDFFromImageFilter->GetTileMargin();
+    EXPECT_GT(margin, geSDFFromImageFilter->GetSpreadFactor());
+    int64_t coveredArea = 0;
+    for (const auto& tile : tiles) {
+        coveredArea += static_cast<int64_t>(tile.core.GetWidth()) * tile.core.GetHeight();
+        EXPECT_LE(tile.core.GetWidth(), GESDFFromImageFilter::TILE_SIZE);
+        EXPECT_GE(tile.area.GetLeft(), 0);
+        EXPECT_LE(tile.area.GetRight(), outputWidth);
+        EXPECT_EQ(tile.area.GetLeft(), std::max(tile.core.GetLeft() - margin, 0));
+        EXPECT_EQ(tile.area.GetRight(), std::min(tile.core.GetRight() + margin, outputWidth));
+        EXPECT_EQ(tile.area.GetHeight(), outputHeight);
+    }
+    EXPECT_EQ(coveredArea, static_cast<int64_t>(outputWidth) * outputHeight);
+    EXPECT_EQ(tiles[1].core.GetLeft(), tiles[0].core.GetRight());
+    EXPECT_TRUE(geSDFFromImageFilter->MakeTiles(0, outputHeight).empty());
+}
+
+/**
+ * @tc.name: UseTiles_001
+ * @tc.desc: Verify only large outputs with a spread well below the tile size are tiled
+ * @tc.type:FUNC
+ */
+HWTEST_F(GESDFFromImageFilterTest, UseTiles_001, TestSize.Level1)
+{
+    Drawing::GESDFFromImageFilterParams params { 32, true };
+    auto geSDFFromImageFilter = std::make_shared<GESDFFromImageFilter>(params);
+    ASSERT_TRUE(geSDFFromImageFilter != nullptr);
+    constexpr int largeSize = GESDFFromImageFilter::MAX_UNTILED_SIZE + 1;
+    EXPECT_FALSE(geSDFFromImageFilter->UseTiles(GESDFFromImageFilter::MAX_UNTILED_SIZE, 100));
+    EXPECT_EQ(geSDFFromImageFilter->UseTiles(largeSize, 100), GESDFFromImageFilter::IsTilingEnabled());
+
+    Drawing::GESDFFromImageFilterParams wideParams { 1024, true };
+    auto wideFilter = std::make_shared<GESDFFromImageFilter>(wideParams);
+    ASSERT_TRUE(wideFilter != nullptr);
+    EXPECT_FALSE(wideFilter->UseTiles(largeSize, largeSize));
+
+    // Without a GPU context the output is made in one piece
+    Drawing::Rect largeDst { 0.0f, 0.0f, static_cast<float>(largeSize), 100.0f };
+    EXPECT_NE(geSDFFromImageFilter->OnProcessImage(canvas_, image_, src_, largeDst), nullptr);
+}
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
@@ -13,12 +13,15 @@
  * limitations under the License.
  */
 
+#include <cmath>
 #include <gtest/gtest.h>
 
 #include "draw/canvas.h"
 #include "draw/path.h"
 #include "ge_external_dynamic_loader.h"
 #include "ge_sdf_path_shader_shape.h"
+#include "ge_sdf_union_op_shader_shape.h"
+#include "image/bitmap.h"
 #include "render_context/render_context.h"
 
 using namespace testing;
@@ -181,6 +184,7 @@ public:
     void SetUp() override;
     void TearDown() override;
     std::shared_ptr<Drawing::Surface> CreateSurface();
+    static std::shared_ptr<Drawing::Image> MakeImage(int width, int height);
     std::shared_ptr<Drawing::Surface> surface_ = nullptr;
     std::shared_ptr<Drawing::Canvas> canvas_ = nullptr;
     Drawing::Rect rect_;
@@ -192,6 +196,7 @@ void GESDFPathShaderShapeTest::TearDownTestCase(void) {}
 
 void GESDFPathShaderShapeTest::SetUp()
 {
+    GESDFPathShaderShape::ClearDistanceFieldCache();
     Drawing::Rect rect { 0.0f, 0.0f, 400.0f, 400.0f };
     rect_ = rect;
     imageInfo_ = Drawing::ImageInfo { rect.GetWidth(), rect.GetHeight(), Drawing::ColorType::COLORTYPE_RGBA_F16,
@@ -218,6 +223,15 @@ std::shared_ptr<Drawing::Surface> GESDFPathShaderShapeTest::CreateSurface()
     return Drawing::Surface::MakeRenderTarget(context.get(), false, imageInfo_);
 }
 
+std::shared_ptr<Drawing::Image> GESDFPathShaderShapeTest::MakeImage(int width, int height)
+{
+    Drawing::Bitmap bmp;
+    Drawing::BitmapFormat format { Drawing::COLORTYPE_RGBA_F16, Drawing::ALPHATYPE_OPAQUE };
+    bmp.Build(width, height, format);
+    bmp.ClearWithColor(Drawing::Color::COLOR_BLUE);
+    return bmp.MakeImage();
+}
+
 /**
  * @tc.name: GetPath_001
  * @tc.desc: Verify GetPath returns correct path
@@ -395,6 +409,83 @@ HWTEST_F(GESDFPathShaderShapeTest, GetCurveByPath_004, TestSize.Level1)
     EXPECT_EQ(result.size(), 3);
 }
 
+/**
+ * @tc.name: GetCurveByPath_005
+ * @tc.desc: Verify GetCurveByPath closes an open contour with a line back to its start point
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, GetCurveByPath_005, TestSize.Level1)
+{
+    Drawing::Path path;
+    path.MoveTo(10.0f, 20.0f);
+    path.LineTo(100.0f, 20.0f);
+    path.LineTo(100.0f, 200.0f);
+    path.Close();
+
+    auto result = GESDFPathShaderShape::GetCurveByPath(path);
+    ASSERT_EQ(result.size(), 3);
+    ASSERT_EQ(result[2].size(), 2);
+    EXPECT_FLOAT_EQ(result[2][0].x_, 100.0f);
+    EXPECT_FLOAT_EQ(result[2][1].x_, 10.0f);
+    EXPECT_FLOAT_EQ(result[2][1].y_, 20.0f);
+}
+
+/**
+ * @tc.name: GetQuadCurvesByPath_001
+ * @tc.desc: Verify GetQuadCurvesByPath appends lines, quadratics and cubics as quadratics
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, GetQuadCurvesByPath_001, TestSize.Level1)
+{
+    Drawing::Path path;
+    path.MoveTo(10.0f, 20.0f);
+    path.LineTo(100.0f, 200.0f);
+    path.QuadTo(150.0f, 250.0f, 200.0f, 200.0f);
+    path.CubicTo(210.0f, 190.0f, 220.0f, 180.0f, 230.0f, 170.0f);
+
+    GESDFPathCurves curves;
+    EXPECT_EQ(GESDFPathShaderShape::GetQuadCurvesByPath(path, curves), 3);
+    ASSERT_EQ(curves.Size(), 3);
+    // A line has its control point on its start point
+    EXPECT_FLOAT_EQ(curves.controlX[0], 10.0f);
+    EXPECT_FLOAT_EQ(curves.controlY[0], 20.0f);
+    EXPECT_FLOAT_EQ(curves.endX[0], 100.0f);
+    EXPECT_FLOAT_EQ(curves.startX[1], 100.0f);
+    EXPECT_FLOAT_EQ(curves.controlX[1], 150.0f);
+    EXPECT_FLOAT_EQ(curves.endY[1], 200.0f);
+    EXPECT_FLOAT_EQ(curves.startX[2], 200.0f);
+    EXPECT_FLOAT_EQ(curves.endX[2], 230.0f);
+    EXPECT_EQ(curves.controlY.size(), curves.Size());
+
+    curves.Clear();
+    EXPECT_EQ(curves.Size(), 0);
+    EXPECT_EQ(GESDFPathShaderShape::GetQuadCurvesByPath(Drawing::Path(), curves), 0);
+}
+
+/**
+ * @tc.name: GetQuadCurvesByPath_002
+ * @tc.desc: Verify GetQuadCurvesByPath splits a conic into quadratics joined end to end
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, GetQuadCurvesByPath_002, TestSize.Level1)
+{
+    Drawing::Path path;
+    path.MoveTo(100.0f, 0.0f);
+    path.ConicTo(100.0f, 100.0f, 0.0f, 100.0f, 0.7071f); // 0.7071f: weight of a quarter circle
+
+    GESDFPathCurves curves;
+    size_t count = GESDFPathShaderShape::GetQuadCurvesByPath(path, curves);
+    ASSERT_GT(count, 1);
+    EXPECT_FLOAT_EQ(curves.startX[0], 100.0f);
+    EXPECT_FLOAT_EQ(curves.endY[count - 1], 100.0f);
+    for (size_t i = 1; i < count; ++i) {
+        EXPECT_FLOAT_EQ(curves.startX[i], curves.endX[i - 1]);
+        EXPECT_FLOAT_EQ(curves.startY[i], curves.endY[i - 1]);
+        // Every end point lies on the circle of radius 100 centered at the origin
+        EXPECT_NEAR(std::hypot(curves.startX[i], curves.startY[i]), 100.0f, 0.01f);
+    }
+}
+
 /**
  * @tc.name: Preprocess_001
  * @tc.desc: Verify Preprocess with valid path and invalid canvas
@@ -1050,8 +1141,7 @@ HWTEST_F(GESDFPathShaderShapeTest, RenderGridsToSurface_EmptyGridSkip_001, TestS
     ASSERT_GT(originalGridCount, 0u);
 
     // Insert an empty grid with zero curves to trigger the skip branch
-    Grid emptyGrid;
-    emptyGrid.bbox = { 0.0f, 100.0f, 0.0f, 100.0f };
+    Box4f emptyGrid = { 0.0f, 100.0f, 0.0f, 100.0f };
     shape.curvesInGrid_.emplace_back(std::vector<float>{}, emptyGrid);
     shape.segmentIndex_.emplace_back(std::vector<float>{});
 
@@ -1160,6 +1250,156 @@ HWTEST_F(GESDFPathShaderShapeTest, RunSDFPropagationNullSdfTexZeroPasses, TestSi
     EXPECT_EQ(result, nullptr);
 }
 
+/**
+ * @tc.name: DistanceFieldCacheKey_001
+ * @tc.desc: Verify the cache key is stable for the same curves and size, and changes with the curves or the size
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, DistanceFieldCacheKey_001, TestSize.Level1)
+{
+    Drawing::Path path;
+    path.MoveTo(10.0f, 20.0f);
+    path.QuadTo(60.0f, 10.0f, 100.0f, 200.0f);
+    path.Close();
+    GESDFPathShapeParams param;
+    param.path = path;
+    Drawing::Canvas canvas;
+
+    GESDFPathShaderShape shape(param);
+    shape.numCurves_ = GESDFPathShaderShape::GetQuadCurvesByPath(path, shape.curves_);
+    uint64_t key = shape.MakeDistanceFieldCacheKey(canvas, path, 200.0f, 200.0f);
+    EXPECT_EQ(shape.MakeDistanceFieldCacheKey(canvas, path, 200.0f, 200.0f), key);
+    EXPECT_NE(shape.MakeDistanceFieldCacheKey(canvas, path, 200.0f, 100.0f), key);
+
+    Drawing::Path moved = path;
+    moved.Offset(5.0f, 0.0f);
+    GESDFPathShaderShape movedShape(param);
+    movedShape.numCurves_ = GESDFPathShaderShape::GetQuadCurvesByPath(moved, movedShape.curves_);
+    EXPECT_NE(movedShape.MakeDistanceFieldCacheKey(canvas, moved, 200.0f, 200.0f), key);
+}
+
+/**
+ * @tc.name: DistanceFieldCacheStore_001
+ * @tc.desc: Verify a stored distance field is loaded back by its key until the cache is cleared
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, DistanceFieldCacheStore_001, TestSize.Level1)
+{
+    auto image = MakeImage(64, 64);
+    ASSERT_NE(image, nullptr);
+
+    constexpr uint64_t key = 42;
+    EXPECT_EQ(GESDFPathShaderShape::LoadCachedDistanceField(key), nullptr);
+    GESDFPathShaderShape::StoreCachedDistanceField(key, image);
+    EXPECT_EQ(GESDFPathShaderShape::LoadCachedDistanceField(key), image);
+    EXPECT_EQ(GESDFPathShaderShape::LoadCachedDistanceField(key + 1), nullptr);
+
+    GESDFPathShaderShape::ClearDistanceFieldCache();
+    EXPECT_EQ(GESDFPathShaderShape::LoadCachedDistanceField(key), nullptr);
+}
+
+/**
+ * @tc.name: DistanceFieldCacheBudget_001
+ * @tc.desc: Verify a budget of 0 drops the cached fields and stores no new ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, DistanceFieldCacheBudget_001, TestSize.Level1)
+{
+    auto image = MakeImage(64, 64);
+    ASSERT_NE(image, nullptr);
+
+    GESDFPathShaderShape::StoreCachedDistanceField(1, image);
+    GESDFPathShaderShape::SetDistanceFieldCacheBudget(0);
+    EXPECT_EQ(GESDFPathShaderShape::LoadCachedDistanceField(1), nullptr);
+    GESDFPathShaderShape::StoreCachedDistanceField(2, image);
+    EXPECT_EQ(GESDFPathShaderShape::LoadCachedDistanceField(2), nullptr);
+
+    constexpr size_t budget = 8 * 1024 * 1024; // 8MB: the default budget
+    GESDFPathShaderShape::SetDistanceFieldCacheBudget(budget);
+    GESDFPathShaderShape::StoreCachedDistanceField(2, image);
+    EXPECT_EQ(GESDFPathShaderShape::LoadCachedDistanceField(2), image);
+}
+
+
+/**
+ * @tc.name: ComputeDistanceFieldOnCpu_001
+ * @tc.desc: Verify the CPU backend outputs an F16 field of the target size, and fails for an empty size
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, ComputeDistanceFieldOnCpu_001, TestSize.Level1)
+{
+    Drawing::Path path;
+    path.AddRect(Drawing::Rect(20.0f, 20.0f, 80.0f, 50.0f));
+    GESDFPathShapeParams param;
+    param.path = path;
+
+    GESDFPathShaderShape shape(param);
+    shape.numCurves_ = GESDFPathShaderShape::GetQuadCurvesByPath(path, shape.curves_);
+    auto field = shape.ComputeDistanceFieldOnCpu(path, 100, 60);
+    ASSERT_NE(field, nullptr);
+    EXPECT_EQ(field->GetWidth(), 100);
+    EXPECT_EQ(field->GetHeight(), 60);
+    EXPECT_EQ(field->GetColorType(), Drawing::ColorType::COLORTYPE_RGBA_F16);
+
+    EXPECT_EQ(shape.ComputeDistanceFieldOnCpu(path, 0, 60), nullptr);
+}
+
+/**
+ * @tc.name: PrecisionHint_001
+ * @tc.desc: Verify an error bound above a pixel lowers the field scale to its inverse, and finer bounds keep it
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, PrecisionHint_001, TestSize.Level1)
+{
+    GESDFPathShapeParams param;
+    param.path.AddRect(Drawing::Rect(20.0f, 20.0f, 80.0f, 50.0f));
+    GESDFPathShaderShape shape(param);
+
+    Vector2f scale(1.0f, 1.0f);
+    EXPECT_FALSE(shape.ApplyPrecisionHint(scale));
+    shape.SetPrecisionHint({ 0.0f, 1.0f });
+    EXPECT_FALSE(shape.ApplyPrecisionHint(scale));
+
+    shape.SetPrecisionHint({ 0.0f, 4.0f });
+    EXPECT_TRUE(shape.ApplyPrecisionHint(scale));
+    EXPECT_FLOAT_EQ(scale.x_, 0.25f);
+    EXPECT_FLOAT_EQ(scale.y_, 0.25f);
+
+    // Already coarser than the hint asks for
+    Vector2f coarse(0.2f, 0.2f);
+    EXPECT_FALSE(shape.ApplyPrecisionHint(coarse));
+    EXPECT_FLOAT_EQ(coarse.x_, 0.2f);
+}
+
+/**
+ * @tc.name: PrecisionHint_002
+ * @tc.desc: Verify a distance bound caps the propagation passes, and smooth unions widen it by their spacing
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFPathShaderShapeTest, PrecisionHint_002, TestSize.Level1)
+{
+    GESDFPathShapeParams param;
+    param.path.AddRect(Drawing::Rect(20.0f, 20.0f, 80.0f, 50.0f));
+    auto shape = std::make_shared<GESDFPathShaderShape>(param);
+    shape->maxEmptyGridShortSide_ = 64.0f;
+    shape->UpdateNumPasses(200.0f);
+    EXPECT_EQ(shape->numPasses_, 6u); // 6: log2(32) + 1 passes to cross the empty grid
+
+    shape->SetPrecisionHint({ 4.0f, 0.0f });
+    shape->UpdateNumPasses(200.0f);
+    EXPECT_EQ(shape->numPasses_, 2u); // 2: steps of 2 and 1 pixels reach 4 pixels away
+
+    GESDFUnionOpShapeParams unionParam;
+    unionParam.left = shape;
+    unionParam.op = GESDFUnionOp::SMOOTH_UNION;
+    unionParam.spacing = 6.0f;
+    GESDFUnionOpShaderShape smoothUnion(unionParam);
+    smoothUnion.SetPrecisionHint({ 4.0f, 2.0f });
+    EXPECT_FLOAT_EQ(shape->precisionHint_.maxDistance, 10.0f);
+    EXPECT_FLOAT_EQ(shape->precisionHint_.maxError, 2.0f);
+    smoothUnion.SetPrecisionHint({});
+    EXPECT_EQ(shape->precisionHint_, GESDFPrecisionHint {});
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
@@ -478,6 +478,28 @@ HWTEST_F(GESDFRRectShaderShapeTest, GetInscribedRectWithCorners, TestSize.Level1
 
     GTEST_LOG_(INFO) << "GESDFRRectShaderShapeTest GetInscribedRectWithCorners end";
 }
+
+/**
+ * @tc.name: GetBoundingRect_001
+ * @tc.desc: Verify GetBoundingRect covers the rect extended like the distance function
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFRRectShaderShapeTest, GetBoundingRect_001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GESDFRRectShaderShapeTest GetBoundingRect_001 start";
+    GESDFRRectShapeParams param;
+    param.rrect = {10.0f, 20.0f, 200.0f, 100.0f};
+    param.rrect.SetCornerRadius(20.0f, 20.0f);
+
+    GESDFRRectShaderShape shape(param);
+    Drawing::Rect rect;
+    EXPECT_TRUE(shape.GetBoundingRect(rect));
+    EXPECT_FLOAT_EQ(rect.left_, 9.5f);
+    EXPECT_FLOAT_EQ(rect.top_, 19.5f);
+    EXPECT_FLOAT_EQ(rect.right_, 210.5f);
+    EXPECT_FLOAT_EQ(rect.bottom_, 120.5f);
+    GTEST_LOG_(INFO) << "GESDFRRectShaderShapeTest GetBoundingRect_001 end";
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
@@ -212,5 +212,36 @@ HWTEST_F(GESDFShadowShaderTest, OnDrawShaderDrawRectFallback, TestSize.Level1)
     shadowShader.OnDrawShader(canvas_, rect);
     EXPECT_NE(shadowShader.GetDrawingShader(), nullptr);
 }
+
+/**
+ * @tc.name: ClipRectToShadowBoundsTest
+ * @tc.desc: Verify the drawn rect shrinks to the offset shape grown by the shadow radius
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShadowShaderTest, ClipRectToShadowBoundsTest, TestSize.Level1)
+{
+    Drawing::GESDFRRectShapeParams rectShapeParams {{100.0f, 100.0f, 50.0f, 50.0f}};
+    auto sdfShape = std::make_shared<Drawing::GESDFRRectShaderShape>(rectShapeParams);
+    Drawing::GESDFShadowShaderParams shadowParams;
+    shadowParams.shape = sdfShape;
+    shadowParams.shadow.radius = 10.0f;
+    shadowParams.shadow.offsetX = 20.0f;
+    GESDFShadowShader shadowShader(shadowParams);
+
+    Drawing::Rect rect {0.0f, 0.0f, 1000.0f, 1000.0f};
+    EXPECT_TRUE(shadowShader.ClipRectToShadowBounds(rect));
+    // 99.5 + 20 offset - 15 shadow extent - 1 margin
+    EXPECT_FLOAT_EQ(rect.GetLeft(), 103.5f);
+    // 150.5 + 15 shadow extent + 1 margin
+    EXPECT_FLOAT_EQ(rect.GetBottom(), 166.5f);
+
+    Drawing::Rect farRect {500.0f, 500.0f, 600.0f, 600.0f};
+    EXPECT_FALSE(shadowShader.ClipRectToShadowBounds(farRect));
+
+    shadowParams.shape = nullptr;
+    shadowShader.SetSDFShadowParams(shadowParams);
+    EXPECT_TRUE(shadowShader.ClipRectToShadowBounds(farRect));
+    EXPECT_FLOAT_EQ(farRect.GetLeft(), 500.0f);
+}
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
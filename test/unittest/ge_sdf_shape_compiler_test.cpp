@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_sdf_rrect_shader_shape.h"
+#include "ge_sdf_shape_compiler.h"
+#include "ge_sdf_sub_op_shader_shape.h"
+#include "ge_sdf_transform_shader_shape.h"
+#include "ge_sdf_triangle_shader_shape.h"
+#include "ge_sdf_union_op_shader_shape.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace Drawing {
+namespace {
+constexpr float TEST_WIDTH = 200.0f;
+constexpr float TEST_HEIGHT = 200.0f;
+using NodeKind = GESDFShapeCompiler::NodeKind;
+
+std::shared_ptr<GESDFShaderShape> MakeRRect(float left, float radius)
+{
+    GESDFRRectShapeParams param;
+    param.rrect = { left, 10.0f, 60.0f, 40.0f };
+    param.rrect.SetCornerRadius(radius, radius);
+    return std::make_shared<GESDFRRectShaderShape>(param);
+}
+
+std::shared_ptr<GESDFShaderShape> MakeCornerRRect()
+{
+    GESDFRRectShapeParams param;
+    param.rrect = { 20.0f, 30.0f, 80.0f, 50.0f };
+    param.rrect.SetCornerRadius(Vector4f(4.0f, 8.0f, 12.0f, 16.0f));
+    return std::make_shared<GESDFRRectShaderShape>(param);
+}
+
+std::shared_ptr<GESDFShaderShape> MakeUnion(std::shared_ptr<GESDFShaderShape> left,
+    std::shared_ptr<GESDFShaderShape> right, GESDFUnionOp op, float spacing = 5.0f)
+{
+    GESDFUnionOpShapeParams param;
+    param.left = left;
+    param.right = right;
+    param.op = op;
+    param.spacing = spacing;
+    return std::make_shared<GESDFUnionOpShaderShape>(param);
+}
+} // namespace
+
+class GESDFShapeCompilerTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: Flatten_001
+ * @tc.desc: Verify a union of rounded rects flattens to post ordered nodes with vec4 aligned parameters
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShapeCompilerTest, Flatten_001, TestSize.Level1)
+{
+    auto shape = MakeUnion(MakeRRect(10.0f, 8.0f), MakeCornerRRect(), GESDFUnionOp::UNION);
+    GESDFShapeCompiler::Program program;
+    ASSERT_TRUE(GESDFShapeCompiler::Flatten(*shape, TEST_WIDTH, TEST_HEIGHT, false, program));
+
+    EXPECT_EQ(program.key, "DrRu");
+    ASSERT_EQ(program.nodes.size(), 3u);
+    EXPECT_EQ(program.nodes[0].kind, NodeKind::RRECT);
+    EXPECT_EQ(program.nodes[1].kind, NodeKind::RRECT_CORNERS);
+    EXPECT_EQ(program.nodes[2].kind, NodeKind::UNION);
+    EXPECT_EQ(program.nodes[2].left, 0);
+    EXPECT_EQ(program.nodes[2].right, 1);
+    EXPECT_EQ(program.nodes[1].paramOffset, 2u); // 2: uniform radius rect takes two vec4
+    EXPECT_EQ(program.params.size(), 20u);       // 20: five vec4
+    EXPECT_TRUE(program.children.empty());
+    // Center and half size extended by half a pixel, like the nested shader
+    EXPECT_FLOAT_EQ(program.params[0], 40.0f);
+    EXPECT_FLOAT_EQ(program.params[2], 30.5f);
+}
+
+/**
+ * @tc.name: Flatten_002
+ * @tc.desc: Verify empty children collapse like the nested shaders and identity transforms add no node
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShapeCompilerTest, Flatten_002, TestSize.Level1)
+{
+    GESDFShapeCompiler::Program program;
+    auto single = MakeUnion(MakeRRect(10.0f, 8.0f), nullptr, GESDFUnionOp::SMOOTH_UNION);
+    EXPECT_FALSE(GESDFShapeCompiler::Flatten(*single, TEST_WIDTH, TEST_HEIGHT, false, program));
+
+    GESDFSubOpShapeParams subParam;
+    subParam.right = MakeRRect(10.0f, 8.0f);
+    GESDFSubOpShaderShape sub(subParam);
+    EXPECT_FALSE(GESDFShapeCompiler::Flatten(sub, TEST_WIDTH, TEST_HEIGHT, false, program));
+
+    GESDFTransformShapeParams transformParam;
+    transformParam.shape = MakeUnion(MakeRRect(10.0f, 8.0f), MakeRRect(50.0f, 4.0f), GESDFUnionOp::SMOOTH_UNION);
+    GESDFTransformShaderShape identity(transformParam);
+    ASSERT_TRUE(GESDFShapeCompiler::Flatten(identity, TEST_WIDTH, TEST_HEIGHT, true, program));
+    EXPECT_EQ(program.key, "NrrU");
+
+    transformParam.matrix.Translate(10.0f, 20.0f);
+    GESDFTransformShaderShape translate(transformParam);
+    ASSERT_TRUE(GESDFShapeCompiler::Flatten(translate, TEST_WIDTH, TEST_HEIGHT, true, program));
+    EXPECT_EQ(program.key, "NrrUt");
+    // Inverse translation in the first two rows
+    uint32_t offset = program.nodes.back().paramOffset * 4;
+    EXPECT_FLOAT_EQ(program.params[offset + 2], -10.0f);
+    EXPECT_FLOAT_EQ(program.params[offset + 6], -20.0f);
+}
+
+/**
+ * @tc.name: Flatten_003
+ * @tc.desc: Verify shapes without an inline distance function become child shaders
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShapeCompilerTest, Flatten_003, TestSize.Level1)
+{
+    GESDFTriangleShapeParams triangleParam;
+    triangleParam.vertex0 = Vector2f(100.0f, 100.0f);
+    triangleParam.vertex1 = Vector2f(180.0f, 100.0f);
+    triangleParam.vertex2 = Vector2f(140.0f, 180.0f);
+    triangleParam.radius = 4.0f;
+    auto triangle = std::make_shared<GESDFTriangleShaderShape>(triangleParam);
+    auto shape = MakeUnion(MakeRRect(10.0f, 8.0f), triangle, GESDFUnionOp::SMOOTH_UNION);
+
+    GESDFShapeCompiler::Program program;
+    ASSERT_TRUE(GESDFShapeCompiler::Flatten(*shape, TEST_WIDTH, TEST_HEIGHT, false, program));
+    EXPECT_EQ(program.key, "DrcU");
+    ASSERT_EQ(program.children.size(), 1u);
+    EXPECT_EQ(program.nodes[1].childSlot, 0u);
+    EXPECT_NE(GESDFShapeCompiler::GenerateSource(program).find("uniform shader child0;"), std::string::npos);
+
+    // Smooth union normals over triangles search for the exit point, only the nested shader does that
+    EXPECT_FALSE(GESDFShapeCompiler::Flatten(*shape, TEST_WIDTH, TEST_HEIGHT, true, program));
+}
+
+/**
+ * @tc.name: GenerateSource_001
+ * @tc.desc: Verify trees differing only in parameters share the key and the source
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShapeCompilerTest, GenerateSource_001, TestSize.Level1)
+{
+    auto first = MakeUnion(MakeRRect(10.0f, 8.0f), MakeRRect(50.0f, 4.0f), GESDFUnionOp::SMOOTH_UNION, 5.0f);
+    auto second = MakeUnion(MakeRRect(30.0f, 2.0f), MakeRRect(90.0f, 6.0f), GESDFUnionOp::SMOOTH_UNION, 9.0f);
+    GESDFShapeCompiler::Program firstProgram;
+    GESDFShapeCompiler::Program secondProgram;
+    ASSERT_TRUE(GESDFShapeCompiler::Flatten(*first, TEST_WIDTH, TEST_HEIGHT, false, firstProgram));
+    ASSERT_TRUE(GESDFShapeCompiler::Flatten(*second, TEST_WIDTH, TEST_HEIGHT, false, secondProgram));
+
+    EXPECT_EQ(firstProgram.key, secondProgram.key);
+    EXPECT_NE(firstProgram.params, secondProgram.params);
+    auto source = GESDFShapeCompiler::GenerateSource(firstProgram);
+    EXPECT_EQ(source, GESDFShapeCompiler::GenerateSource(secondProgram));
+    EXPECT_NE(source.find("uniform vec4 nodeParams[5];"), std::string::npos);
+    EXPECT_EQ(source.find("uniform shader"), std::string::npos);
+}
+
+/**
+ * @tc.name: GenerateDrawingShader_001
+ * @tc.desc: Verify a nested tree generates one flat shader, with and without normals
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFShapeCompilerTest, GenerateDrawingShader_001, TestSize.Level1)
+{
+    GESDFSmoothSubOpShapeParams subParam;
+    subParam.left = MakeUnion(MakeRRect(10.0f, 8.0f), MakeCornerRRect(), GESDFUnionOp::SMOOTH_UNION);
+    subParam.right = MakeRRect(40.0f, 2.0f);
+    subParam.spacing = 3.0f;
+    auto shape = std::make_shared<GESDFSmoothSubOpShaderShape>(subParam);
+
+    EXPECT_NE(GESDFShapeCompiler::GenerateDrawingShader(*shape, TEST_WIDTH, TEST_HEIGHT, false), nullptr);
+    EXPECT_NE(GESDFShapeCompiler::GenerateDrawingShader(*shape, TEST_WIDTH, TEST_HEIGHT, true), nullptr);
+    EXPECT_NE(shape->GenerateDrawingShader(TEST_WIDTH, TEST_HEIGHT), nullptr);
+
+    auto single = MakeUnion(nullptr, nullptr, GESDFUnionOp::UNION);
+    EXPECT_EQ(GESDFShapeCompiler::GenerateDrawingShader(*single, TEST_WIDTH, TEST_HEIGHT, false), nullptr);
+}
+} // namespace Drawing
+} // namespace Rosen
+} // namespace OHOS
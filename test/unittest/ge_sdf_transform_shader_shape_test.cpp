@@ -1465,6 +1465,58 @@ HWTEST_F(GESDFTransformShaderShapeTest, TryGetCenterAndHalfSize_009, TestSize.Le
     EXPECT_FLOAT_EQ(shapeHalfSize2[1], 50.0f);
     GTEST_LOG_(INFO) << "GESDFTransformShaderShapeTest TryGetCenterAndHalfSize_009 end";
 }
+
+/**
+ * @tc.name: CopyState_001
+ * @tc.desc: Verify copying a state that only moves the matrix keeps the child and its cached shader
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFTransformShaderShapeTest, CopyState_001, TestSize.Level1)
+{
+    GESDFTransformShapeParams param;
+    param.shape = CreateTestShape();
+    param.shape->SetHash(1u);
+    GESDFTransformShaderShape shape(param);
+    auto childShader = shape.GetChildShader(200.0f, 200.0f, false);
+    ASSERT_NE(childShader, nullptr);
+    auto child = shape.GetSDFShape();
+
+    GESDFTransformShapeParams moved;
+    moved.shape = CreateTestShape();
+    moved.shape->SetHash(1u);
+    moved.matrix.Translate(10.0f, 20.0f);
+    shape.CopyState(GESDFTransformShaderShape(moved));
+    EXPECT_EQ(shape.GetSDFShape(), child);
+    EXPECT_FLOAT_EQ(shape.GetMatrix().Get(Drawing::Matrix::TRANS_X), 10.0f);
+    EXPECT_EQ(shape.GetChildShader(200.0f, 200.0f, false), childShader);
+    EXPECT_NE(shape.GetChildShader(100.0f, 200.0f, false), childShader);
+
+    // A changed child replaces the current one
+    GESDFTransformShapeParams changed;
+    changed.shape = CreateTestShape();
+    changed.shape->SetHash(2u);
+    shape.CopyState(GESDFTransformShaderShape(changed));
+    EXPECT_EQ(shape.GetSDFShape(), changed.shape);
+}
+
+/**
+ * @tc.name: CopyState_002
+ * @tc.desc: Verify children without a hash are always replaced
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFTransformShaderShapeTest, CopyState_002, TestSize.Level1)
+{
+    GESDFTransformShapeParams param;
+    param.shape = CreateTestShape();
+    GESDFTransformShaderShape shape(param);
+
+    GESDFTransformShapeParams moved;
+    moved.shape = CreateTestShape();
+    moved.matrix.Translate(10.0f, 20.0f);
+    shape.CopyState(GESDFTransformShaderShape(moved));
+    EXPECT_EQ(shape.GetSDFShape(), moved.shape);
+    EXPECT_FALSE(GESDFTransformShaderShape::IsSameShape(param.shape, 0u, param.shape));
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
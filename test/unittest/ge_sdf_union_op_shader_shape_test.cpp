@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include "ge_sdf_union_op_shader_shape.h"
+#include "ge_sdf_pixelmap_shader_shape.h"
 #include "ge_sdf_rrect_shader_shape.h"
 
 using namespace testing;
@@ -545,6 +546,39 @@ HWTEST_F(GESDFUnionOpShaderShapeTest, GetInscribedRectRightOnlySupport, TestSize
     EXPECT_TRUE(shape.GetInscribedRect(rect));
 }
 
+/**
+ * @tc.name: GetBoundingRect_001
+ * @tc.desc: Verify GetBoundingRect joins both sides and grows smooth unions by their spacing
+ * @tc.type: FUNC
+ */
+HWTEST_F(GESDFUnionOpShaderShapeTest, GetBoundingRect_001, TestSize.Level1)
+{
+    GESDFRRectShapeParams rightParam;
+    rightParam.rrect = {150.0f, 50.0f, 50.0f, 100.0f};
+    GESDFUnionOpShapeParams param;
+    param.left = CreateTestShape();
+    param.right = std::make_shared<GESDFRRectShaderShape>(rightParam);
+    param.op = GESDFUnionOp::UNION;
+    GESDFUnionOpShaderShape shape(param);
+    Drawing::Rect rect;
+    EXPECT_TRUE(shape.GetBoundingRect(rect));
+    EXPECT_FLOAT_EQ(rect.left_, -0.5f);
+    EXPECT_FLOAT_EQ(rect.right_, 200.5f);
+    EXPECT_FLOAT_EQ(rect.bottom_, 150.5f);
+
+    param.op = GESDFUnionOp::SMOOTH_UNION;
+    param.spacing = 5.0f;
+    GESDFUnionOpShaderShape smoothShape(param);
+    EXPECT_TRUE(smoothShape.GetBoundingRect(rect));
+    EXPECT_FLOAT_EQ(rect.left_, -5.5f);
+    EXPECT_FLOAT_EQ(rect.bottom_, 155.5f);
+
+    // A pixelmap distance has no analytic bounds, so neither has the union
+    param.right = std::make_shared<GESDFPixelmapShaderShape>(GESDFPixelmapShapeParams());
+    GESDFUnionOpShaderShape unboundedShape(param);
+    EXPECT_FALSE(unboundedShape.GetBoundingRect(rect));
+}
+
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
\ No newline at end of file
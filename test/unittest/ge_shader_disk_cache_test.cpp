@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <unistd.h>
+
+#include "ge_shader_diagnostics.h"
+#include "ge_shader_disk_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+namespace {
+const std::string TEST_CACHE_DIR = "/data/local/tmp/ge_shader_disk_cache_test/";
+const std::string SKSL_MINIMAL = "half4 main(float2 xy) { return half4(1.0); }";
+const std::string SKSL_RED = "half4 main(float2 xy) { return half4(1.0, 0.0, 0.0, 1.0); }";
+constexpr size_t TINY_MAX_BYTES = 16;
+} // namespace
+
+class GEShaderDiskCacheTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override
+    {
+        RemoveCacheFiles();
+        GEShaderDiskCache::GetInstance().SetForTest(true, TEST_CACHE_DIR);
+    }
+    void TearDown() override
+    {
+        RemoveCacheFiles();
+        GEShaderDiskCache::GetInstance().SetForTest(false, GE_SHADER_DISK_CACHE_DIR);
+    }
+
+    static void RemoveCacheFiles()
+    {
+        DIR* dir = opendir(TEST_CACHE_DIR.c_str());
+        if (dir == nullptr) {
+            return;
+        }
+        for (struct dirent* ent = readdir(dir); ent != nullptr; ent = readdir(dir)) {
+            std::string name = ent->d_name;
+            if (name != "." && name != "..") {
+                unlink((TEST_CACHE_DIR + name).c_str());
+            }
+        }
+        closedir(dir);
+    }
+
+    static std::string CachePath(const std::string& source, uint32_t optionsKey)
+    {
+        return TEST_CACHE_DIR + "ge_shader_cache." + GEComputeShaderHash(source) + "." +
+               std::to_string(optionsKey) + ".bin";
+    }
+};
+
+/**
+ * @tc.name: StoreLoad_001
+ * @tc.desc: Verify stored sources and their options are loaded back
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderDiskCacheTest, StoreLoad_001, TestSize.Level1)
+{
+    auto& cache = GEShaderDiskCache::GetInstance();
+    Drawing::RuntimeEffectOptions options;
+    options.useAF = true;
+    uint32_t optionsKey = GEShaderDiskCache::EncodeOptions(&options);
+    EXPECT_TRUE(cache.Store(SKSL_MINIMAL, 0));
+    EXPECT_TRUE(cache.Store(SKSL_RED, optionsKey));
+
+    auto records = cache.Load();
+    ASSERT_EQ(records.size(), 2u);
+    for (const auto& record : records) {
+        if (record.source == SKSL_MINIMAL) {
+            EXPECT_EQ(record.optionsKey, 0u);
+        } else {
+            EXPECT_EQ(record.source, SKSL_RED);
+            EXPECT_EQ(record.optionsKey, optionsKey);
+        }
+    }
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.storeCount, 2u);
+    EXPECT_EQ(stats.loadCount, 2u);
+    EXPECT_EQ(stats.rejectedCount, 0u);
+    EXPECT_GT(stats.totalBytes, SKSL_MINIMAL.size() + SKSL_RED.size());
+}
+
+/**
+ * @tc.name: Store_001
+ * @tc.desc: Verify a program is written once, and not at all past the byte budget or when disabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderDiskCacheTest, Store_001, TestSize.Level1)
+{
+    auto& cache = GEShaderDiskCache::GetInstance();
+    EXPECT_TRUE(cache.Store(SKSL_MINIMAL, 0));
+    EXPECT_FALSE(cache.Store(SKSL_MINIMAL, 0));
+
+    cache.SetForTest(true, TEST_CACHE_DIR, TINY_MAX_BYTES);
+    EXPECT_FALSE(cache.Store(SKSL_RED, 0));
+
+    cache.SetForTest(false, TEST_CACHE_DIR);
+    EXPECT_FALSE(cache.Store(SKSL_RED, 0));
+    EXPECT_TRUE(cache.Load().empty());
+}
+
+/**
+ * @tc.name: StoreAsync_001
+ * @tc.desc: Verify queued stores are written once, and sources loaded from disk are not stored again
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderDiskCacheTest, StoreAsync_001, TestSize.Level1)
+{
+    auto& cache = GEShaderDiskCache::GetInstance();
+    cache.StoreAsync(SKSL_MINIMAL, 0);
+    cache.StoreAsync(SKSL_MINIMAL, 0);
+    cache.StoreAsync(SKSL_RED, 0);
+    cache.WaitForPendingStores();
+    EXPECT_EQ(cache.GetStats().storeCount, 2u);
+    EXPECT_EQ(access(CachePath(SKSL_MINIMAL, 0).c_str(), F_OK), 0);
+    EXPECT_EQ(access(CachePath(SKSL_RED, 0).c_str(), F_OK), 0);
+
+    // A restarted process loads the cache, later compiles of the same sources write nothing
+    cache.SetForTest(true, TEST_CACHE_DIR);
+    EXPECT_EQ(cache.Load().size(), 2u);
+    cache.StoreAsync(SKSL_MINIMAL, 0);
+    EXPECT_FALSE(cache.Store(SKSL_RED, 0));
+    cache.WaitForPendingStores();
+    EXPECT_EQ(cache.GetStats().storeCount, 0u);
+
+    // Without a load the existing file is found before writing
+    cache.SetForTest(true, TEST_CACHE_DIR);
+    EXPECT_FALSE(cache.Store(SKSL_RED, 0));
+    EXPECT_EQ(cache.GetStats().storeCount, 0u);
+}
+
+/**
+ * @tc.name: Load_Corrupt_001
+ * @tc.desc: Verify a file whose source does not match its hash is rejected and removed
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderDiskCacheTest, Load_Corrupt_001, TestSize.Level1)
+{
+    auto& cache = GEShaderDiskCache::GetInstance();
+    ASSERT_TRUE(cache.Store(SKSL_MINIMAL, 0));
+    std::string path = CachePath(SKSL_MINIMAL, 0);
+    int fd = open(path.c_str(), O_WRONLY);
+    ASSERT_GE(fd, 0);
+    ASSERT_GE(lseek(fd, -1, SEEK_END), 0);
+    EXPECT_EQ(write(fd, "x", 1), 1);
+    close(fd);
+
+    EXPECT_TRUE(cache.Load().empty());
+    EXPECT_EQ(cache.GetStats().rejectedCount, 1u);
+    EXPECT_NE(access(path.c_str(), F_OK), 0);
+}
+
+/**
+ * @tc.name: Load_Corrupt_002
+ * @tc.desc: Verify a truncated file is rejected and removed
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderDiskCacheTest, Load_Corrupt_002, TestSize.Level1)
+{
+    auto& cache = GEShaderDiskCache::GetInstance();
+    ASSERT_TRUE(cache.Store(SKSL_RED, 0));
+    std::string path = CachePath(SKSL_RED, 0);
+    ASSERT_EQ(truncate(path.c_str(), 4), 0);
+
+    EXPECT_TRUE(cache.Load().empty());
+    EXPECT_EQ(cache.GetStats().rejectedCount, 1u);
+    EXPECT_NE(access(path.c_str(), F_OK), 0);
+}
+
+/**
+ * @tc.name: EncodeOptions_001
+ * @tc.desc: Verify options survive an encode and decode, and no options encode to 0
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderDiskCacheTest, EncodeOptions_001, TestSize.Level1)
+{
+    EXPECT_EQ(GEShaderDiskCache::EncodeOptions(nullptr), 0u);
+    EXPECT_FALSE(GEShaderDiskCache::HasOptions(0));
+
+    Drawing::RuntimeEffectOptions options;
+    options.forceNoInline = true;
+    options.useHighpLocalCoords = true;
+    options.needDrawingslToSksl = false;
+    uint32_t key = GEShaderDiskCache::EncodeOptions(&options);
+    EXPECT_TRUE(GEShaderDiskCache::HasOptions(key));
+    auto decoded = GEShaderDiskCache::DecodeOptions(key);
+    EXPECT_EQ(decoded.forceNoInline, options.forceNoInline);
+    EXPECT_EQ(decoded.useAF, options.useAF);
+    EXPECT_EQ(decoded.useHighpLocalCoords, options.useHighpLocalCoords);
+    EXPECT_EQ(decoded.needDrawingslToSksl, options.needDrawingslToSksl);
+}
+
+} // namespace Rosen
+} // namespace OHOS
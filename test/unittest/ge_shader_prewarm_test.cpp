@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "ge_shader_prewarm.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace GraphicsEffectEngine {
+
+using namespace Rosen::Drawing;
+
+class GEShaderPrewarmTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: Run_001
+ * @tc.desc: Verify Run creates every registered effect of a known category, in GEFilterType order
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderPrewarmTest, Run_001, TestSize.Level1)
+{
+    auto report = GEShaderPrewarm::Run(2);
+    EXPECT_EQ(report.threadCount, 2u);
+    ASSERT_FALSE(report.effects.empty());
+
+    size_t expected = 0;
+    for (int32_t i = 1; i < static_cast<int32_t>(GEFilterType::MAX); ++i) {
+        auto type = static_cast<GEFilterType>(i);
+        if (GEEffectFactory::IsRegistered(type) && GEEffectFactory::GetCategory(type) != GEEffectCategory::UNKNOWN) {
+            ++expected;
+        }
+    }
+    EXPECT_EQ(report.effects.size(), expected);
+    for (size_t i = 0; i < report.effects.size(); ++i) {
+        EXPECT_TRUE(report.effects[i].created) << "Type " << static_cast<int>(report.effects[i].type);
+        if (i > 0) {
+            EXPECT_LT(report.effects[i - 1].type, report.effects[i].type);
+        }
+    }
+}
+
+/**
+ * @tc.name: Run_002
+ * @tc.desc: Verify a second warm-up finds every program already compiled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderPrewarmTest, Run_002, TestSize.Level1)
+{
+    GEShaderPrewarm::Run(1);
+    auto report = GEShaderPrewarm::Run(0);
+    EXPECT_GE(report.threadCount, 1u);
+    for (const auto& effect : report.effects) {
+        EXPECT_EQ(effect.compileCount, 0u) << "Type " << static_cast<int>(effect.type);
+    }
+}
+
+/**
+ * @tc.name: RunEffect_001
+ * @tc.desc: Verify an unregistered effect type is skipped
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderPrewarmTest, RunEffect_001, TestSize.Level1)
+{
+    auto report = GEShaderPrewarm::RunEffect(GEFilterType::GAMMA_CORRECTION);
+    EXPECT_FALSE(report.created);
+    EXPECT_EQ(report.category, GEEffectCategory::UNKNOWN);
+    EXPECT_EQ(report.compileCount, 0u);
+}
+
+/**
+ * @tc.name: RunEffect_002
+ * @tc.desc: Verify a registered filter is created and its compiles are counted on the calling thread
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEShaderPrewarmTest, RunEffect_002, TestSize.Level1)
+{
+    auto report = GEShaderPrewarm::RunEffect(GEFilterType::KAWASE_BLUR);
+    EXPECT_TRUE(report.created);
+    EXPECT_EQ(report.category, GEEffectCategory::FILTER);
+    EXPECT_GE(report.elapsedNs, report.compileTimeNs);
+}
+
+} // namespace GraphicsEffectEngine
+} // namespace OHOS
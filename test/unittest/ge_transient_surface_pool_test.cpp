@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+
+#include "ge_runtime_effect_registry.h"
+#include "ge_transient_surface_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+namespace {
+std::shared_ptr<Drawing::RuntimeEffect> MakeColorEffect()
+{
+    static const std::string colorString(R"(
+        half4 main(float2 xy) {
+            return half4(0.0, 0.0, 1.0, 1.0);
+        }
+    )");
+    return GERuntimeEffectRegistry::GetInstance().GetOrCreate(colorString);
+}
+} // namespace
+
+class GETransientSurfacePoolTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override
+    {
+        GETransientSurfacePool::Clear();
+    }
+
+    static inline Drawing::Canvas canvas_;
+};
+
+/**
+ * @tc.name: FrameScope_001
+ * @tc.desc: Verify frames nest and unbalanced ends are ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(GETransientSurfacePoolTest, FrameScope_001, TestSize.Level1)
+{
+    EXPECT_FALSE(GETransientSurfacePool::IsInFrame());
+    {
+        GETransientSurfacePool::FrameScope outer;
+        {
+            GETransientSurfacePool::FrameScope inner;
+            EXPECT_TRUE(GETransientSurfacePool::IsInFrame());
+        }
+        EXPECT_TRUE(GETransientSurfacePool::IsInFrame());
+    }
+    EXPECT_FALSE(GETransientSurfacePool::IsInFrame());
+
+    GETransientSurfacePool::EndFrame();
+    EXPECT_FALSE(GETransientSurfacePool::IsInFrame());
+}
+
+/**
+ * @tc.name: MakeImage_001
+ * @tc.desc: Verify canvases without a GPU context make images without pooling surfaces
+ * @tc.type: FUNC
+ */
+HWTEST_F(GETransientSurfacePoolTest, MakeImage_001, TestSize.Level1)
+{
+    auto effect = MakeColorEffect();
+    ASSERT_NE(effect, nullptr);
+    Drawing::RuntimeShaderBuilder builder(effect);
+    Drawing::ImageInfo info(16, 16, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL); // 16: image size
+
+    GETransientSurfacePool::FrameScope frame;
+    auto image = GETransientSurfacePool::MakeImage(canvas_, builder, info);
+    auto heldImage = GETransientSurfacePool::MakeImage(canvas_, builder, info, true);
+    EXPECT_EQ(image == nullptr, heldImage == nullptr);
+    EXPECT_EQ(GETransientSurfacePool::GetSurfaceCount(), 0u);
+    EXPECT_EQ(GETransientSurfacePool::GetPooledBytes(), 0u);
+}
+
+/**
+ * @tc.name: AcquireSurface_001
+ * @tc.desc: Verify canvases without a GPU context get no surface and hand none back
+ * @tc.type: FUNC
+ */
+HWTEST_F(GETransientSurfacePoolTest, AcquireSurface_001, TestSize.Level1)
+{
+    Drawing::ImageInfo info(16, 16, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL); // 16: image size
+    auto madeSurfaces = GETransientSurfacePool::GetMadeSurfaceCount();
+    EXPECT_EQ(GETransientSurfacePool::AcquireSurface(canvas_, info), nullptr);
+    EXPECT_EQ(GETransientSurfacePool::GetMadeSurfaceCount(), madeSurfaces);
+
+    GETransientSurfacePool::ReleaseSurface(canvas_, nullptr, info);
+    EXPECT_EQ(GETransientSurfacePool::GetSurfaceCount(), 0u);
+    EXPECT_EQ(GETransientSurfacePool::GetPooledBytes(), 0u);
+}
+
+/**
+ * @tc.name: Trim_001
+ * @tc.desc: Verify trimming keeps leased surfaces and drops idle ones
+ * @tc.type: FUNC
+ */
+HWTEST_F(GETransientSurfacePoolTest, Trim_001, TestSize.Level1)
+{
+    Drawing::ImageInfo info(16, 16, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL); // 16: image size
+    auto& state = GETransientSurfacePool::GetPoolState();
+    auto leasedImage = std::make_shared<Drawing::Image>();
+    for (int i = 0; i < 2; i++) { // 2: one leased and one idle entry
+        GETransientSurfacePool::Entry entry;
+        entry.info = info;
+        entry.bytes = GETransientSurfacePool::GetByteSize(info);
+        state.bytes += entry.bytes;
+        state.entries.push_back(std::move(entry));
+    }
+    state.entries[0].snapshot = leasedImage;
+
+    GETransientSurfacePool::Trim(state, UINT64_MAX, 0);
+    ASSERT_EQ(GETransientSurfacePool::GetSurfaceCount(), 1u);
+    EXPECT_EQ(GETransientSurfacePool::GetPooledBytes(), GETransientSurfacePool::GetByteSize(info));
+
+    leasedImage = nullptr;
+    GETransientSurfacePool::Trim(state, UINT64_MAX, 0);
+    EXPECT_EQ(GETransientSurfacePool::GetSurfaceCount(), 0u);
+    EXPECT_EQ(GETransientSurfacePool::GetPooledBytes(), 0u);
+}
+
+/**
+ * @tc.name: TrimIdle_001
+ * @tc.desc: Verify surfaces are dropped after IDLE_TIME unused, not after a number of frames
+ * @tc.type: FUNC
+ */
+HWTEST_F(GETransientSurfacePoolTest, TrimIdle_001, TestSize.Level1)
+{
+    Drawing::ImageInfo info(16, 16, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL); // 16: image size
+    auto& state = GETransientSurfacePool::GetPoolState();
+    auto now = std::chrono::steady_clock::now();
+    for (int i = 0; i < 2; i++) { // 2: one recent and one idle entry
+        GETransientSurfacePool::Entry entry;
+        entry.info = info;
+        entry.bytes = GETransientSurfacePool::GetByteSize(info);
+        entry.lastUsedTime = now;
+        state.bytes += entry.bytes;
+        state.entries.push_back(std::move(entry));
+    }
+    state.entries[1].lastUsedTime = now - GETransientSurfacePool::IDLE_TIME - std::chrono::milliseconds(1);
+
+    // Many blurred nodes in one display frame, each in its own pool frame
+    for (int i = 0; i < 32; i++) { // 32: pool frames, one per blurred node
+        GETransientSurfacePool::FrameScope frame;
+    }
+    ASSERT_EQ(GETransientSurfacePool::GetSurfaceCount(), 1u);
+    EXPECT_EQ(state.entries[0].lastUsedTime, now);
+
+    GETransientSurfacePool::TrimIdle(state, now + std::chrono::milliseconds(1));
+    EXPECT_EQ(GETransientSurfacePool::GetSurfaceCount(), 0u);
+    EXPECT_EQ(GETransientSurfacePool::GetPooledBytes(), 0u);
+}
+
+/**
+ * @tc.name: IsSameInfo_001
+ * @tc.desc: Verify surfaces only match images of the same size, types and colour space
+ * @tc.type: FUNC
+ */
+HWTEST_F(GETransientSurfacePoolTest, IsSameInfo_001, TestSize.Level1)
+{
+    Drawing::ImageInfo info(16, 16, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL); // 16: image size
+    EXPECT_TRUE(GETransientSurfacePool::IsSameInfo(info, info));
+    Drawing::ImageInfo wider(32, 16, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL); // 32, 16: image size
+    EXPECT_FALSE(GETransientSurfacePool::IsSameInfo(info, wider));
+    Drawing::ImageInfo halfFloat(16, 16, Drawing::COLORTYPE_RGBA_F16, Drawing::ALPHATYPE_PREMUL); // 16: image size
+    EXPECT_FALSE(GETransientSurfacePool::IsSameInfo(info, halfFloat));
+    Drawing::ImageInfo linear(16, 16, Drawing::COLORTYPE_RGBA_8888, Drawing::ALPHATYPE_PREMUL, // 16: image size
+        Drawing::ColorSpace::CreateSRGBLinear());
+    EXPECT_FALSE(GETransientSurfacePool::IsSameInfo(info, linear));
+    EXPECT_TRUE(GETransientSurfacePool::IsSameInfo(linear, linear));
+}
+} // namespace Rosen
+} // namespace OHOS
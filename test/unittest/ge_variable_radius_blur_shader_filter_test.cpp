@@ -13,9 +13,14 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <vector>
+
 #include <gtest/gtest.h>
+#include "ge_blur_test_utils.h"
 #include "ge_variable_radius_blur_shader_filter.h"
 #include "ge_ripple_shader_mask.h"
+#include "ge_shader_mask.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -23,6 +28,8 @@ using namespace testing::ext;
 namespace OHOS {
 namespace Rosen {
 
+using namespace GETest;
+
 class GEVariableRadiusBlurShaderFilterTest : public testing::Test {
 public:
     static void SetUpTestCase();
@@ -76,6 +83,36 @@ std::shared_ptr<Drawing::GERippleShaderMask> CreateRippleShaderMask()
     return std::make_shared<Drawing::GERippleShaderMask>(maskParams);
 }
 
+// Blurs every pixel with the full radius
+class GEFullRadiusShaderMask : public Drawing::GEShaderMask {
+public:
+    std::shared_ptr<Drawing::ShaderEffect> GenerateDrawingShader(float width, float height) const override
+    {
+        return Drawing::ShaderEffect::CreateColorShader(Drawing::Color::COLOR_BLACK);
+    }
+
+    std::shared_ptr<Drawing::ShaderEffect> GenerateDrawingShaderHasNormal(float width, float height) const override
+    {
+        return GenerateDrawingShader(width, height);
+    }
+};
+
+// Green channel of one row, scaled to [0, 1]
+std::vector<float> ReadGreenRow(const std::shared_ptr<Drawing::Image>& image, int y)
+{
+    int width = image->GetWidth();
+    std::vector<uint8_t> rgba(static_cast<size_t>(width) * 4); // 4: rgba
+    Drawing::ImageInfo info(width, 1, Drawing::ColorType::COLORTYPE_RGBA_8888, Drawing::AlphaType::ALPHATYPE_PREMUL);
+    std::vector<float> green;
+    if (!image->ReadPixels(info, rgba.data(), rgba.size(), 0, y)) {
+        return green;
+    }
+    for (int x = 0; x < width; ++x) {
+        green.push_back(rgba[x * 4 + 1] / 255.0f); // 4: rgba, 255: channel max
+    }
+    return green;
+}
+
 std::shared_ptr<GEVariableRadiusBlurShaderFilter> CreateVariableRadiusBlurShaderFilter()
 {
     Drawing::GEVariableRadiusBlurShaderFilterParams params = {
@@ -146,5 +183,90 @@ HWTEST_F(GEVariableRadiusBlurShaderFilterTest, TypeTest001, TestSize.Level1)
     EXPECT_EQ(variableRadiusBlurShaderFilter->TypeName(), Drawing::GE_FILTER_VARIABLE_RADIUS_BLUR);
 }
 
+/**
+ * @tc.name: UsePyramidTest001
+ * @tc.desc: Verify only large unmasked radii use the pyramid
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(GEVariableRadiusBlurShaderFilterTest, UsePyramidTest001, TestSize.Level1)
+{
+    auto variableRadiusBlurShaderFilter = CreateVariableRadiusBlurShaderFilter();
+    ASSERT_NE(variableRadiusBlurShaderFilter, nullptr);
+
+    bool enabled = GEVariableRadiusBlurShaderFilter::IsPyramidEnabled();
+    EXPECT_FALSE(variableRadiusBlurShaderFilter->UsePyramid(GEVariableRadiusBlurShaderFilter::PYRAMID_MIN_RADIUS - 1));
+    EXPECT_EQ(variableRadiusBlurShaderFilter->UsePyramid(30.0f), enabled); // 30.0: largest half radius
+
+    variableRadiusBlurShaderFilter->params_.applyInsideMask = true;
+    EXPECT_FALSE(variableRadiusBlurShaderFilter->UsePyramid(30.0f)); // 30.0: largest half radius
+}
+
+/**
+ * @tc.name: GetPyramidLevelCountTest001
+ * @tc.desc: Verify the pyramid grows with the radius and stops at the image size
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(GEVariableRadiusBlurShaderFilterTest, GetPyramidLevelCountTest001, TestSize.Level1)
+{
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(4.0f, 1000, 1000), 2); // log2(4.0): 2 levels
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(30.0f, 1000, 1000),
+        GEVariableRadiusBlurShaderFilter::MAX_PYRAMID_LEVELS);
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(30.0f, 1000, 10), 2); // 10 >> 2 keeps 2 rows
+    EXPECT_EQ(GEVariableRadiusBlurShaderFilter::GetPyramidLevelCount(30.0f, 1, 1), 0);
+}
+
+/**
+ * @tc.name: PyramidMatchesBoxTest001
+ * @tc.desc: Verify the pyramid blurs a step edge like the box passes at the smallest radius it takes over
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(GEVariableRadiusBlurShaderFilterTest, PyramidMatchesBoxTest001, TestSize.Level1)
+{
+    auto step = MakeStepImage(64, 64); // 64, 64 image size
+    ASSERT_NE(step, nullptr);
+    GEFullRadiusShaderMask mask;
+    auto maskShader = mask.GenerateDrawingShader(step->GetWidth(), step->GetHeight());
+    float radius = GEVariableRadiusBlurShaderFilter::PYRAMID_MIN_RADIUS;
+    GEVariableRadiusBlurShaderFilter::MakeHorizontalBoxBlurEffect();
+    GEVariableRadiusBlurShaderFilter::MakeVerticalBoxBlurEffect();
+    GEVariableRadiusBlurShaderFilter::MakePyramidEffects();
+
+    auto box = GEVariableRadiusBlurShaderFilter::BuildBoxLinearGradientBlur(
+        step, canvas_, radius, maskShader, Drawing::Matrix());
+    auto pyramid = GEVariableRadiusBlurShaderFilter::BuildPyramidLinearGradientBlur(
+        step, canvas_, radius, maskShader, Drawing::Matrix());
+    ASSERT_NE(box, step);
+    ASSERT_NE(pyramid, nullptr);
+    auto boxRow = ReadGreenRow(box, 32); // 32: middle row
+    auto pyramidRow = ReadGreenRow(pyramid, 32); // 32: middle row
+    ASSERT_EQ(boxRow.size(), 64u);
+    ASSERT_EQ(pyramidRow.size(), 64u);
+    // The two blurs differ by about 0.04 around the edge, a level scaled up by 1.5 by about 0.12
+    for (size_t x = 0; x < boxRow.size(); ++x) {
+        EXPECT_NEAR(pyramidRow[x], boxRow[x], 0.06f) << "x: " << x;
+    }
+    EXPECT_GT(boxRow[31], 0.05f); // 31: last black column is smoothed
+}
+
+/**
+ * @tc.name: ProcessImageTest002
+ * @tc.desc: Verify a large radius blurs through the pyramid or falls back to the box passes
+ * @tc.type:FUNC
+ * @tc.require:
+ */
+HWTEST_F(GEVariableRadiusBlurShaderFilterTest, ProcessImageTest002, TestSize.Level1)
+{
+    auto variableRadiusBlurShaderFilter = CreateVariableRadiusBlurShaderFilter();
+    ASSERT_NE(variableRadiusBlurShaderFilter, nullptr);
+
+    Drawing::Rect dst { 0.0f, 0.0f, 50.0f, 50.0f }; // 50, 50 image size
+    auto output = variableRadiusBlurShaderFilter->OnProcessImage(canvas_, image_, dst, dst);
+    ASSERT_NE(output, nullptr);
+    EXPECT_EQ(output->GetWidth(), 50);
+}
+
 }  // namespace Rosen
 }  // namespace OHOS
\ No newline at end of file
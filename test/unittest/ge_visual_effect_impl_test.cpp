@@ -2244,5 +2244,68 @@ HWTEST_F(GEVisualEffectImplTest, MakeGetParams_SDFEdgeLightEffect, TestSize.Leve
     auto params = geVisualEffectImpl.GetSDFEdgeLightEffectParams();
     EXPECT_NE(params, nullptr);
 }
+/**
+ * @tc.name: DirtyBits_SetParam
+ * @tc.desc: Verify only writes of a new value bump the generation and mark their tag dirty
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEVisualEffectImplTest, DirtyBits_SetParam, TestSize.Level1)
+{
+    Drawing::GEVisualEffectImpl impl(Drawing::GE_FILTER_GREY);
+    impl.SetParam(Drawing::GEParamsMemberTag::GREY_GREY_COEF1, 0.5f);
+    auto generation = impl.GetParamsGeneration();
+    EXPECT_FALSE(impl.GetDirtyBitsSince(generation).Any());
+
+    impl.SetParam(Drawing::GEParamsMemberTag::GREY_GREY_COEF1, 0.5f); // same value, not a change
+    EXPECT_EQ(impl.GetParamsGeneration(), generation);
+
+    impl.SetParam(Drawing::GEParamsMemberTag::GREY_GREY_COEF2, 0.8f);
+    EXPECT_EQ(impl.GetParamsGeneration(), generation + 1);
+    auto dirty = impl.GetDirtyBitsSince(generation);
+    EXPECT_TRUE(dirty.Test(Drawing::GEParamsMemberTag::GREY_GREY_COEF2));
+    EXPECT_FALSE(dirty.Test(Drawing::GEParamsMemberTag::GREY_GREY_COEF1));
+
+    // Older observers only know that something changed
+    auto all = impl.GetDirtyBitsSince(generation - 1);
+    EXPECT_TRUE(all.Test(Drawing::GEParamsMemberTag::GREY_GREY_COEF1));
+    EXPECT_TRUE(all.Test(Drawing::GEParamsMemberTag::GREY_GREY_COEF2));
+}
+
+/**
+ * @tc.name: DirtyBits_Batch
+ * @tc.desc: Verify a batch is published once by the outermost Commit
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEVisualEffectImplTest, DirtyBits_Batch, TestSize.Level1)
+{
+    Drawing::GEVisualEffectImpl impl(Drawing::GE_FILTER_GREY);
+    EXPECT_FALSE(impl.Commit()); // no batch in progress
+    auto generation = impl.GetParamsGeneration();
+
+    impl.BeginUpdate();
+    impl.SetParam(Drawing::GEParamsMemberTag::GREY_GREY_COEF1, 0.3f);
+    impl.BeginUpdate();
+    impl.SetParam(Drawing::GEParamsMemberTag::GREY_GREY_COEF2, 0.6f);
+    EXPECT_FALSE(impl.Commit()); // nested
+    EXPECT_EQ(impl.GetParamsGeneration(), generation);
+    EXPECT_TRUE(impl.Commit());
+    EXPECT_EQ(impl.GetParamsGeneration(), generation + 1);
+    auto params = impl.GetGreyParams();
+    ASSERT_NE(params, nullptr);
+    EXPECT_FLOAT_EQ(params->greyCoef1, 0.3f);
+    EXPECT_FLOAT_EQ(params->greyCoef2, 0.6f);
+    auto dirty = impl.GetDirtyBitsSince(generation);
+    EXPECT_TRUE(dirty.TestAny(Drawing::GEParamsMemberTag::GREY_GREY_COEF1));
+    EXPECT_TRUE(dirty.Test(Drawing::GEParamsMemberTag::GREY_GREY_COEF2));
+
+    generation = impl.GetParamsGeneration();
+    EXPECT_FALSE(impl.SetParams(std::pair { Drawing::GEParamsMemberTag::GREY_GREY_COEF1, 0.3f },
+        std::pair { Drawing::GEParamsMemberTag::GREY_GREY_COEF2, 0.6f }));
+    EXPECT_EQ(impl.GetParamsGeneration(), generation);
+    EXPECT_TRUE(impl.SetParams(std::pair { Drawing::GEParamsMemberTag::GREY_GREY_COEF2, 0.7f }));
+    dirty = impl.GetDirtyBitsSince(generation);
+    EXPECT_FALSE(dirty.Test(Drawing::GEParamsMemberTag::GREY_GREY_COEF1));
+    EXPECT_TRUE(dirty.Test(Drawing::GEParamsMemberTag::GREY_GREY_COEF2));
+}
 } // namespace GraphicsEffectEngine
 } // namespace OHOS
@@ -798,6 +798,54 @@ HWTEST_F(GEVisualEffectTest, GenerateShaderShape_WithoutMakeParams, TestSize.Lev
 
     GTEST_LOG_(INFO) << "GEVisualEffectTest GenerateShaderShape_WithoutMakeParams end";
 }
+/**
+ * @tc.name: ResolveParamTag001
+ * @tc.desc: Verify a resolved tag handle sets the same param as its name and unknown names are ignored
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEVisualEffectTest, ResolveParamTag001, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GEVisualEffectTest ResolveParamTag001 start";
+
+    auto radiusTag = GEVisualEffect::ResolveParamTag(GE_FILTER_KAWASE_BLUR_RADIUS);
+    ASSERT_TRUE(radiusTag.IsValid());
+    EXPECT_EQ(radiusTag.GetValue(), static_cast<uint32_t>(GEParamsMemberTag::KAWASE_BLUR_RADIUS));
+    EXPECT_EQ(GEParamsBuilder::GetFilterTypeFromString(GE_FILTER_KAWASE_BLUR), GEFilterType::KAWASE_BLUR);
+
+    auto visualEffect = std::make_shared<GEVisualEffect>(GE_FILTER_KAWASE_BLUR);
+    visualEffect->SetParam(radiusTag, 20); // 20: blur radius
+    auto params = visualEffect->GetImpl()->GetKawaseParams();
+    ASSERT_NE(params, nullptr);
+    EXPECT_EQ(params->radius, 20); // 20: blur radius
+
+    auto unknownTag = GEVisualEffect::ResolveParamTag("UnknownEffect_UnknownParam");
+    EXPECT_FALSE(unknownTag.IsValid());
+    EXPECT_EQ(GEParamsMemberHelper::GEParamsMemberTagFromString("UnknownEffect_UnknownParam"),
+        GEParamsMemberTag::INVALID);
+    EXPECT_EQ(GEParamsBuilder::GetFilterTypeFromString("UnknownEffect"), GEFilterType::NONE);
+    auto generation = visualEffect->GetImpl()->GetParamsGeneration();
+    visualEffect->SetParam(unknownTag, 30); // 30: blur radius
+    EXPECT_EQ(visualEffect->GetImpl()->GetParamsGeneration(), generation);
+    EXPECT_EQ(params->radius, 20); // 20: blur radius unchanged
+
+    GTEST_LOG_(INFO) << "GEVisualEffectTest ResolveParamTag001 end";
+}
+
+/**
+ * @tc.name: ResolveParamTag002
+ * @tc.desc: Verify aliases resolve to the tag of their field
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEVisualEffectTest, ResolveParamTag002, TestSize.Level1)
+{
+    GTEST_LOG_(INFO) << "GEVisualEffectTest ResolveParamTag002 start";
+
+    EXPECT_EQ(GEParamsMemberHelper::GEParamsMemberTagFromString("SDFSmoothUnionOpShape_ShapeX"),
+        GEParamsMemberTag::SDF_UNION_OP_LEFT);
+    EXPECT_EQ(GEParamsBuilder::GetFilterTypeFromString("SDFSmoothUnionOpShape"), GEFilterType::SDF_UNION_OP);
+
+    GTEST_LOG_(INFO) << "GEVisualEffectTest ResolveParamTag002 end";
+}
 } // namespace Drawing
 } // namespace Rosen
 } // namespace OHOS
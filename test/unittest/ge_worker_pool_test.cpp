@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "ge_worker_pool.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS {
+namespace Rosen {
+
+class GEWorkerPoolTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: Run_001
+ * @tc.desc: Verify every task runs exactly once and Run returns only after all of them finished
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWorkerPoolTest, Run_001, TestSize.Level1)
+{
+    constexpr int taskCount = 100;
+    std::vector<std::atomic<int>> runs(taskCount);
+    GEWorkerPool::GetInstance().Run(taskCount, 3, [&runs](int task) { // 3: helpers
+        std::this_thread::yield();
+        ++runs[task];
+    });
+    for (int i = 0; i < taskCount; ++i) {
+        EXPECT_EQ(runs[i].load(), 1) << i;
+    }
+
+    int calls = 0;
+    GEWorkerPool::GetInstance().Run(0, 3, [&calls](int) { ++calls; }); // 3: helpers
+    GEWorkerPool::GetInstance().Run(-1, 3, [&calls](int) { ++calls; }); // 3: helpers
+    EXPECT_EQ(calls, 0);
+    GEWorkerPool::GetInstance().Run(2, 0, [&calls](int) { ++calls; }); // 2: tasks on the caller only
+    EXPECT_EQ(calls, 2);
+}
+
+/**
+ * @tc.name: Run_002
+ * @tc.desc: Verify workers are kept across batches instead of being started for each one
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWorkerPoolTest, Run_002, TestSize.Level1)
+{
+    auto& pool = GEWorkerPool::GetInstance();
+    std::atomic<int> total { 0 };
+    pool.Run(8, 2, [&total](int) { ++total; }); // 8: tasks, 2: helpers
+    unsigned int workerCount = pool.GetWorkerCount();
+    EXPECT_GE(workerCount, 2u);
+    for (int i = 0; i < 20; ++i) { // 20: batches
+        pool.Run(8, 2, [&total](int) { ++total; }); // 8: tasks, 2: helpers
+    }
+    EXPECT_EQ(total.load(), 8 * 21); // 8 tasks in each of 21 batches
+    EXPECT_EQ(pool.GetWorkerCount(), workerCount);
+
+    pool.Run(64, 100, [&total](int) { ++total; }); // 64: tasks, 100: more helpers than the pool has
+    EXPECT_LE(pool.GetWorkerCount(), GEWorkerPool::MAX_WORKERS);
+}
+
+/**
+ * @tc.name: Run_003
+ * @tc.desc: Verify batches submitted from several threads at once all complete
+ * @tc.type: FUNC
+ */
+HWTEST_F(GEWorkerPoolTest, Run_003, TestSize.Level1)
+{
+    constexpr int callerCount = 4;
+    constexpr int taskCount = 32;
+    std::atomic<int> total { 0 };
+    std::vector<std::thread> callers;
+    for (int i = 0; i < callerCount; ++i) {
+        callers.emplace_back([&total]() {
+            for (int batch = 0; batch < 10; ++batch) { // 10: batches per caller
+                GEWorkerPool::GetInstance().Run(taskCount, GEWorkerPool::MAX_WORKERS, [&total](int) { ++total; });
+            }
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    EXPECT_EQ(total.load(), callerCount * taskCount * 10); // 10: batches per caller
+}
+
+} // namespace Rosen
+} // namespace OHOS
@@ -528,15 +528,26 @@ def generate_struct_tag_ranges_decl(structs: List[StructInfo], type_aliases: Dic
     output.append("    // Convert GEParamsMemberTag to corresponding GEFilterType")
     output.append("    static GEFilterType GetFilterTypeFromTag(GEParamsMemberTag tag);")
 
+    output.append("")
+    output.append("    // Position of tag among the tags of its params type, the bit of tag in GEParamsDirtyBits")
+    output.append("    // Returns GEParamsDirtyBits::CAPACITY for INVALID and out of range tags")
+    output.append("    static uint32_t GetTagIndexInParams(GEParamsMemberTag tag);")
+
     output.append("")
     output.append("    // Convert string to GEParamsMemberTag")
     output.append("    // Note: Strings are sourced from GEParamsFieldAccessor<Tag>::name for single source of truth")
     output.append("    //       Aliases from [[ge::prop(alias=...)]] are also included")
-    output.append("    static GEParamsMemberTag GEParamsMemberTagFromString(const std::string& str);")
+    output.append("    static GEParamsMemberTag GEParamsMemberTagFromString(std::string_view str);")
+
+    output.append("")
+    output.append("    // Hash every member of params into hasher, see GEParamsHasher for how each member type is hashed")
+    output.append("    // Returns false when params holds a member without a stable content hash")
+    output.append("    static bool HashParams(const GEFilterParams& params, GEParamsHasher& hasher);")
 
     output.append("")
     output.append("    // Set params member by tag using overloaded functions (reduces binary bloat)")
     output.append("    // All implementations are in the .cpp file")
+    output.append("    // Returns true when the member now holds a different value, see GEParamsFieldEqual")
     output.append(generate_set_params_member_overloads_decl(structs, type_aliases, blocked_types))
 
     output.append("};")
@@ -576,6 +587,40 @@ def generate_get_filter_type_from_tag_impl(structs: List[StructInfo]) -> str:
     return "\n".join(output)
 
 
+def generate_tag_index_in_params_impl(structs: List[StructInfo]) -> str:
+    """Generate GEParamsMemberHelper::GetTagIndexInParams() implementation."""
+    indices = [DIRTY_BITS_CAPACITY]  # INVALID
+    for struct in structs:
+        index = 0
+        for field in struct.fields:
+            for tag_info in iterate_field_tags(struct, field):
+                indices.append(index)
+                index += 1
+        if index > DIRTY_BITS_CAPACITY:
+            raise ValueError(f"{struct.name} declares {index} tags, GEParamsDirtyBits holds {DIRTY_BITS_CAPACITY}")
+
+    output = []
+    output.append("namespace {")
+    output.append("// Indexed by GEParamsMemberTag, tags of one params type are numbered from 0 in declaration order")
+    output.append(f"constexpr std::array<uint8_t, {len(indices)}> GE_TAG_INDEX_IN_PARAMS = {{")
+    per_line = 20
+    for start in range(0, len(indices), per_line):
+        output.append("    " + ", ".join(str(i) for i in indices[start:start + per_line]) + ",")
+    output.append("};")
+    output.append("} // namespace")
+    output.append("")
+    output.append(f"static_assert(GEParamsDirtyBits::CAPACITY == {DIRTY_BITS_CAPACITY}, \"Update DIRTY_BITS_CAPACITY in gen_metadata.py\");")
+    output.append("")
+    output.append("uint32_t GEParamsMemberHelper::GetTagIndexInParams(GEParamsMemberTag tag)")
+    output.append("{")
+    output.append("    auto value = static_cast<uint32_t>(tag);")
+    output.append("    return value < GE_TAG_INDEX_IN_PARAMS.size() ? GE_TAG_INDEX_IN_PARAMS[value] : GEParamsDirtyBits::CAPACITY;")
+    output.append("}")
+    output.append("")
+
+    return "\n".join(output)
+
+
 def generate_set_params_member_overloads_impl(structs: List[StructInfo], type_aliases: Dict[str, str], blocked_types: Optional[Dict[str, str]] = None) -> str:
     """Generate overloaded SetParamsMemberByTag function implementations."""
     if blocked_types is None:
@@ -591,14 +636,18 @@ def generate_set_params_member_overloads_impl(structs: List[StructInfo], type_al
     output.append("        using SetterType = std::remove_cv_t<std::remove_reference_t<decltype(value)>>; \\")
     output.append("        auto unboxed = GEFilterParams::Unbox<ParamsType>(params); \\")
     output.append("        if (unboxed == nullptr) { \\")
-    output.append("            return; \\")
+    output.append("            return false; \\")
     output.append("        } \\")
     output.append("        auto& actualParams = *unboxed; \\")
     output.append("        FieldType transformed; \\")
-    output.append("        if (GEParamsValueTransformer<GEParamsMemberTag::Tag, SetterType, FieldType>::Transform(value, transformed)) { \\")
-    output.append("            GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Set(actualParams, transformed); \\")
+    output.append("        if (!GEParamsValueTransformer<GEParamsMemberTag::Tag, SetterType, FieldType>::Transform(value, transformed)) { \\")
+    output.append("            return false; \\")
+    output.append("        } \\")
+    output.append("        if (GEParamsFieldEqual(GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Get(actualParams), transformed)) { \\")
+    output.append("            return false; \\")
     output.append("        } \\")
-    output.append("        break; \\")
+    output.append("        GEParamsFieldAccessor<GEParamsMemberTag::Tag>::Set(actualParams, transformed); \\")
+    output.append("        return true; \\")
     output.append("    }")
     output.append("")
 
@@ -630,13 +679,13 @@ def generate_set_params_member_overloads_impl(structs: List[StructInfo], type_al
                 type_to_tags.setdefault(normalized_original, []).append((tag_info.tag_name, struct.name, field.name))
 
     for field_type, tags in sorted(type_to_tags.items()):
-        output.append(f"void GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params,")
+        output.append(f"bool GEParamsMemberHelper::SetParamsMemberByTag(GEFilterParams& params,")
         output.append(f"    GEParamsMemberTag tag, const {field_type}& value)")
         output.append("{")
         output.append("")
         output.append("    auto expectedFilterType = GetFilterTypeFromTag(tag);")
         output.append("    if (params.GetType() != expectedFilterType) {")
-        output.append("        return;")
+        output.append("        return false;")
         output.append("    }")
         output.append("")
         output.append("    switch (tag) {")
@@ -649,7 +698,7 @@ def generate_set_params_member_overloads_impl(structs: List[StructInfo], type_al
         output.append("                static_cast<uint32_t>(tag),")
         output.append("                static_cast<uint32_t>(expectedFilterType),")
         output.append("                static_cast<uint32_t>(params.GetType()));")
-        output.append("            break;")
+        output.append("            return false;")
         output.append("    }")
         output.append("}")
         output.append("")
@@ -790,12 +839,98 @@ def generate_set_params_member_overloads_decl(structs: List[StructInfo], type_al
     sorted_types = sorted(unique_types)
 
     for field_type in sorted_types:
-        output.append(f"    static void SetParamsMemberByTag(GEFilterParams& params,")
+        output.append(f"    static bool SetParamsMemberByTag(GEFilterParams& params,")
         output.append(f"                                     GEParamsMemberTag tag, const {field_type}& value);")
 
     return "\n".join(output)
 
 
+# Must match GEParamsDirtyBits::CAPACITY, checked by a static_assert in the generated cpp
+DIRTY_BITS_CAPACITY = 64
+
+
+# Name lookup helpers emitted into the cpp, shared by the hash-sorted name tables
+NAME_LOOKUP_HELPERS = r'''
+namespace {
+// 64-bit FNV-1a, gen_metadata.py sorts the name tables below by this hash
+constexpr uint64_t GENameHash(std::string_view str)
+{
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    constexpr uint64_t basis = 0xcbf29ce484222325ULL;
+    uint64_t hash = basis;
+    for (char c : str) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= prime;
+    }
+    return hash;
+}
+
+template<typename Value>
+struct GENameTableEntry {
+    uint64_t nameHash;
+    std::string_view name;
+    Value value;
+};
+
+// Checked at compile time: every hash matches its name and hashes are strictly increasing (no collision)
+template<typename Value, size_t N>
+constexpr bool IsNameTableValid(const std::array<GENameTableEntry<Value>, N>& table)
+{
+    for (size_t i = 0; i < N; ++i) {
+        if (table[i].nameHash != GENameHash(table[i].name) ||
+            (i > 0 && table[i - 1].nameHash >= table[i].nameHash)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Binary search on the hash, then a single string compare. No allocation and no std::hash of a std::string.
+template<typename Value, size_t N>
+Value FindInNameTable(const std::array<GENameTableEntry<Value>, N>& table, std::string_view name, Value notFound)
+{
+    uint64_t hash = GENameHash(name);
+    auto it = std::lower_bound(table.begin(), table.end(), hash,
+        [](const GENameTableEntry<Value>& entry, uint64_t value) { return entry.nameHash < value; });
+    if (it != table.end() && it->nameHash == hash && it->name == name) {
+        return it->value;
+    }
+    return notFound;
+}
+} // namespace
+'''
+
+
+def name_hash(name: str) -> int:
+    """64-bit FNV-1a, must match GENameHash in the generated cpp."""
+    value = 0xcbf29ce484222325
+    for byte in name.encode("utf-8"):
+        value ^= byte
+        value = (value * 0x100000001b3) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+
+def generate_name_table(table_name: str, value_type: str, entries: List[Tuple[str, str]]) -> List[str]:
+    """Generate a constexpr table of (name, entry macro) pairs sorted by name hash, raising on a hash collision.
+
+    Entry macros take the hash as their first argument through the {hash} placeholder.
+    """
+    hashed = sorted((name_hash(name), name, entry) for name, entry in entries)
+    for prev, curr in zip(hashed, hashed[1:]):
+        if prev[0] == curr[0]:
+            message = f"Error: Hash collision in {table_name} between '{prev[1]}' and '{curr[1]}'"
+            console.error(message)
+            raise RuntimeError(message)
+
+    output = []
+    output.append("// Sorted by GENameHash of the name")
+    output.append(f"constexpr std::array<GENameTableEntry<{value_type}>, {len(hashed)}> {table_name} = {{")
+    for value, _, entry in hashed:
+        output.append("    " + entry.format(hash=f"0x{value:016x}ULL"))
+    output.append("};")
+    return output
+
+
 def generate_string_to_enum_mapping_impl(structs: List[StructInfo]) -> str:
     """Generate GEParamsMemberHelper::GEParamsMemberTagFromString() implementation."""
     output = []
@@ -834,41 +969,38 @@ def generate_string_to_enum_mapping_impl(structs: List[StructInfo]) -> str:
         console.error("\n".join(error_lines))
         raise RuntimeError("\n".join(error_lines))
 
-    output.append("GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(const std::string& str)")
-    output.append("{")
-    output.append("    static const std::unordered_map<std::string, GEParamsMemberTag> map = {")
-
-    # Helper macro for reducing repetition - uses GEParamsFieldAccessor::name
-    output.append("#define GE_STRING_TO_TAG_ENTRY(Tag) \\")
-    output.append("    { GEParamsFieldAccessor<GEParamsMemberTag::Tag>::name, GEParamsMemberTag::Tag }")
-    output.append("")
-
-    # Helper macro for alias entries
-    output.append("#define GE_STRING_TO_TAG_ALIAS(Tag, Alias) \\")
-    output.append("    { #Alias, GEParamsMemberTag::Tag }")
-    output.append("")
-
+    # Collect table entries, the name of a primary entry comes from GEParamsFieldAccessor<Tag>::name
+    entries: List[Tuple[str, str]] = []
     for struct in structs:
         for field in struct.fields:
             for tag_info in iterate_field_tags(struct, field):
-                output.append(f"        GE_STRING_TO_TAG_ENTRY({tag_info.tag_name}),")
+                entries.append((tag_info.prop_name, f"GE_STRING_TO_TAG_ENTRY({{hash}}, {tag_info.tag_name}),"))
 
                 # Add alias entry if present (for the first prop attribute)
                 if field.prop_attributes and not tag_info.is_array_element:
                     prop_attr = field.prop_attributes[0]
                     if prop_attr.alias:
-                        output.append(f"        GE_STRING_TO_TAG_ALIAS({tag_info.tag_name}, {prop_attr.alias}),")
+                        entries.append((prop_attr.alias,
+                            f"GE_STRING_TO_TAG_ALIAS({{hash}}, {tag_info.tag_name}, {prop_attr.alias}),"))
 
-    output.append("    };")
+    output.append("#define GE_STRING_TO_TAG_ENTRY(Hash, Tag) \\")
+    output.append("    GENameTableEntry<GEParamsMemberTag> { \\")
+    output.append("        Hash, GEParamsFieldAccessor<GEParamsMemberTag::Tag>::name, GEParamsMemberTag::Tag \\")
+    output.append("    }")
+    output.append("")
+    output.append("#define GE_STRING_TO_TAG_ALIAS(Hash, Tag, Alias) \\")
+    output.append("    GENameTableEntry<GEParamsMemberTag> { Hash, #Alias, GEParamsMemberTag::Tag }")
+    output.append("")
+    output.extend(generate_name_table("GE_PARAMS_MEMBER_TAG_TABLE", "GEParamsMemberTag", entries))
     output.append("")
     output.append("#undef GE_STRING_TO_TAG_ENTRY")
     output.append("#undef GE_STRING_TO_TAG_ALIAS")
     output.append("")
-    output.append("    auto it = map.find(str);")
-    output.append("    if (it != map.end()) {")
-    output.append("        return it->second;")
-    output.append("    }")
-    output.append("    return GEParamsMemberTag::INVALID;")
+    output.append('static_assert(IsNameTableValid(GE_PARAMS_MEMBER_TAG_TABLE), "Regenerate with gen_metadata.py");')
+    output.append("")
+    output.append("GEParamsMemberTag GEParamsMemberHelper::GEParamsMemberTagFromString(std::string_view str)")
+    output.append("{")
+    output.append("    return FindInNameTable(GE_PARAMS_MEMBER_TAG_TABLE, str, GEParamsMemberTag::INVALID);")
     output.append("}")
     output.append("")
 
@@ -885,7 +1017,7 @@ def generate_params_builder_decl() -> str:
     output.append("")
     output.append("    // Convert filter name string to GEFilterType")
     output.append("    // Note: Strings are sourced from GEFilterParamsTypeInfo<Struct>::FilterName")
-    output.append("    static GEFilterType GetFilterTypeFromString(const std::string& str);")
+    output.append("    static GEFilterType GetFilterTypeFromString(std::string_view str);")
     output.append("};")
     output.append("")
 
@@ -921,43 +1053,69 @@ def generate_params_builder_impl(structs: List[StructInfo]) -> str:
     return "\n".join(output)
 
 
-def generate_filter_type_from_string_impl(structs: List[StructInfo]) -> str:
-    """Generate GEParamsBuilder::GetFilterTypeFromString() implementation."""
+def generate_hash_params_impl(structs: List[StructInfo]) -> str:
+    """Generate GEParamsMemberHelper::HashParams() implementation."""
     output = []
 
-    output.append("GEFilterType GEParamsBuilder::GetFilterTypeFromString(const std::string& str)")
+    output.append("bool GEParamsMemberHelper::HashParams(const GEFilterParams& params, GEParamsHasher& hasher)")
     output.append("{")
-    output.append("    static const std::unordered_map<std::string, GEFilterType> map = {")
+    output.append("    hasher.Combine(params.GetType());")
+    output.append("    switch (params.GetType()) {")
 
-    # Helper macro for primary filter name - uses GEFilterParamsTypeInfo::FilterName
-    output.append("#define GE_FILTER_NAME_TO_TYPE_ENTRY(Struct) \\")
-    output.append("    { std::string(GEFilterParamsTypeInfo<Struct>::FilterName), GEFilterParamsTypeInfo<Struct>::ID }")
-    output.append("")
+    for struct in structs:
+        output.append(f"        case GEFilterType::{struct.enum_type}: {{")
+        output.append(f"            auto unboxed = GEFilterParams::Unbox<{struct.name}>(params);")
+        output.append("            if (unboxed == nullptr) {")
+        output.append("                return false;")
+        output.append("            }")
+        for field in struct.fields:
+            output.append(f"            hasher.Combine(unboxed->{field.name});")
+        output.append("            break;")
+        output.append("        }")
 
-    # Helper macro for alias entries (struct-level alias from [[ge::params(..., alias="...")]])
-    output.append("#define GE_FILTER_NAME_TO_TYPE_ALIAS(Struct, Alias) \\")
-    output.append("    { #Alias, GEFilterParamsTypeInfo<Struct>::ID }")
+    output.append("        default:")
+    output.append("            return false;")
+    output.append("    }")
+    output.append("    return hasher.IsHashable();")
+    output.append("}")
     output.append("")
 
+    return "\n".join(output)
+
+
+def generate_filter_type_from_string_impl(structs: List[StructInfo]) -> str:
+    """Generate GEParamsBuilder::GetFilterTypeFromString() implementation."""
+    output = []
+
+    # Collect table entries, the name of a primary entry comes from GEFilterParamsTypeInfo<Struct>::FilterName
+    entries: List[Tuple[str, str]] = []
     for struct in structs:
         struct_name = struct.name
-        output.append(f"        GE_FILTER_NAME_TO_TYPE_ENTRY({struct_name}),")
+        entries.append((struct.filter_name, f"GE_FILTER_NAME_TO_TYPE_ENTRY({{hash}}, {struct_name}),"))
 
         # Add alias entry if struct has alias attribute
         struct_alias = struct.params.get("alias") if struct.params else None
         if struct_alias:
-            output.append(f"        GE_FILTER_NAME_TO_TYPE_ALIAS({struct_name}, {struct_alias}),")
+            entries.append((struct_alias, f"GE_FILTER_NAME_TO_TYPE_ALIAS({{hash}}, {struct_name}, {struct_alias}),"))
 
-    output.append("    };")
+    output.append("#define GE_FILTER_NAME_TO_TYPE_ENTRY(Hash, Struct) \\")
+    output.append("    GENameTableEntry<GEFilterType> { \\")
+    output.append("        Hash, GEFilterParamsTypeInfo<Struct>::FilterName, GEFilterParamsTypeInfo<Struct>::ID \\")
+    output.append("    }")
+    output.append("")
+    output.append("#define GE_FILTER_NAME_TO_TYPE_ALIAS(Hash, Struct, Alias) \\")
+    output.append("    GENameTableEntry<GEFilterType> { Hash, #Alias, GEFilterParamsTypeInfo<Struct>::ID }")
+    output.append("")
+    output.extend(generate_name_table("GE_FILTER_TYPE_TABLE", "GEFilterType", entries))
     output.append("")
     output.append("#undef GE_FILTER_NAME_TO_TYPE_ENTRY")
     output.append("#undef GE_FILTER_NAME_TO_TYPE_ALIAS")
     output.append("")
-    output.append("    auto it = map.find(str);")
-    output.append("    if (it != map.end()) {")
-    output.append("        return it->second;")
-    output.append("    }")
-    output.append("    return GEFilterType::NONE;")
+    output.append('static_assert(IsNameTableValid(GE_FILTER_TYPE_TABLE), "Regenerate with gen_metadata.py");')
+    output.append("")
+    output.append("GEFilterType GEParamsBuilder::GetFilterTypeFromString(std::string_view str)")
+    output.append("{")
+    output.append("    return FindInNameTable(GE_FILTER_TYPE_TABLE, str, GEFilterType::NONE);")
     output.append("}")
     output.append("")
 
@@ -1468,6 +1626,7 @@ def generate_header(structs: List[StructInfo], type_aliases: Dict[str, str], blo
     output.append("namespace Drawing {")
     output.append("")
     output.append("class GEFilterParams;")
+    output.append("class GEParamsHasher;")
     output.append("")
 
     output.append("// Helper macro to escape commas in macro arguments")
@@ -1524,7 +1683,9 @@ def generate_cpp(structs: List[StructInfo], type_aliases: Dict[str, str], blocke
     output.append('#include "ge_params_reflection.h"')
     output.append('#include "ge_filter_params.h"')
     output.append('#include "ge_log.h"')
-    output.append("#include <unordered_map>")
+    output.append('#include "ge_params_dirty_bits.h"')
+    output.append('#include "ge_params_hasher.h"')
+    output.append("#include <array>")
     output.append("")
 
     output.append("namespace OHOS {")
@@ -1535,15 +1696,24 @@ def generate_cpp(structs: List[StructInfo], type_aliases: Dict[str, str], blocke
     # Generate GEParamsBuilder::Build() implementation
     output.append(generate_params_builder_impl(structs))
 
+    # Hash-sorted name table helpers shared by GetFilterTypeFromString() and GEParamsMemberTagFromString()
+    output.append(NAME_LOOKUP_HELPERS)
+
     # Generate GEParamsBuilder::GetFilterTypeFromString() implementation
     output.append(generate_filter_type_from_string_impl(structs))
 
     # Generate GEParamsMemberHelper::GetFilterTypeFromTag() implementation
     output.append(generate_get_filter_type_from_tag_impl(structs))
 
+    # Generate GEParamsMemberHelper::GetTagIndexInParams() implementation
+    output.append(generate_tag_index_in_params_impl(structs))
+
     # Generate GEParamsMemberTagFromString() implementation
     output.append(generate_string_to_enum_mapping_impl(structs))
 
+    # Generate GEParamsMemberHelper::HashParams() implementation
+    output.append(generate_hash_params_impl(structs))
+
     # Generate overloaded SetParamsMemberByTag implementations
     output.append(generate_set_params_member_overloads_impl(structs, type_aliases, blocked_types))
 